@@ -18,6 +18,7 @@
 
 #include "util/foreach.h"
 #include "util/progress.h"
+#include "util/task.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -303,13 +304,97 @@ void BVH2::pack_nodes(const BVHNode *root)
   pack.root_index = (root->is_leaf()) ? -1 : 0;
 }
 
+/* Number of levels refitted serially at the top of the tree. The subtrees
+ * below this cut are refitted in parallel, giving up to 2^N tasks. */
+#define BVH_REFIT_PARALLEL_DEPTH 6
+
 void BVH2::refit_nodes()
 {
   assert(!params.top_level);
 
+  const bool root_is_leaf = (pack.root_index == -1);
+
+  /* Gather subtree roots a few levels down from the root, refit the subtrees
+   * in parallel bottom-up, then finish the top levels serially from the
+   * cached subtree bounds. */
+  vector<RefitEntry> entries;
+  refit_node_gather(0, root_is_leaf, 0, entries);
+
+  parallel_for(blocked_range<size_t>(0, entries.size(), 1),
+               [this, &entries](const blocked_range<size_t> &r) {
+                 for (size_t i = r.begin(); i != r.end(); i++) {
+                   RefitEntry &entry = entries[i];
+                   refit_node(entry.idx, entry.leaf, entry.bbox, entry.visibility);
+                 }
+               });
+
   BoundBox bbox = BoundBox::empty;
   uint visibility = 0;
-  refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
+  size_t entry_index = 0;
+  refit_node_from_entries(0, root_is_leaf, 0, entries, entry_index, bbox, visibility);
+  assert(entry_index == entries.size());
+}
+
+void BVH2::refit_node_gather(int idx, bool leaf, int depth, vector<RefitEntry> &entries) const
+{
+  if (leaf || depth == BVH_REFIT_PARALLEL_DEPTH) {
+    entries.push_back({idx, leaf});
+    return;
+  }
+
+  const int4 *data = &pack.nodes[idx];
+  const int c0 = data[0].z;
+  const int c1 = data[0].w;
+
+  refit_node_gather((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), depth + 1, entries);
+  refit_node_gather((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), depth + 1, entries);
+}
+
+void BVH2::refit_node_from_entries(int idx,
+                                   bool leaf,
+                                   int depth,
+                                   const vector<RefitEntry> &entries,
+                                   size_t &entry_index,
+                                   BoundBox &bbox,
+                                   uint &visibility)
+{
+  if (leaf || depth == BVH_REFIT_PARALLEL_DEPTH) {
+    /* Take over the bounds refitted in parallel. Traversal order matches
+     * #refit_node_gather, so entries are consumed in order. */
+    const RefitEntry &entry = entries[entry_index++];
+    assert(entry.idx == idx && entry.leaf == leaf);
+    bbox.grow(entry.bbox);
+    visibility |= entry.visibility;
+    return;
+  }
+
+  assert(idx + BVH_NODE_SIZE <= pack.nodes.size());
+
+  const int4 *data = &pack.nodes[idx];
+  const bool is_unaligned = (data[0].x & PATH_RAY_NODE_UNALIGNED) != 0;
+  const int c0 = data[0].z;
+  const int c1 = data[0].w;
+  /* refit inner node, set bbox from children */
+  BoundBox bbox0 = BoundBox::empty, bbox1 = BoundBox::empty;
+  uint visibility0 = 0, visibility1 = 0;
+
+  refit_node_from_entries(
+      (c0 < 0) ? -c0 - 1 : c0, (c0 < 0), depth + 1, entries, entry_index, bbox0, visibility0);
+  refit_node_from_entries(
+      (c1 < 0) ? -c1 - 1 : c1, (c1 < 0), depth + 1, entries, entry_index, bbox1, visibility1);
+
+  if (is_unaligned) {
+    Transform aligned_space = transform_identity();
+    pack_unaligned_node(
+        idx, aligned_space, aligned_space, bbox0, bbox1, c0, c1, visibility0, visibility1);
+  }
+  else {
+    pack_aligned_node(idx, bbox0, bbox1, c0, c1, visibility0, visibility1);
+  }
+
+  bbox.grow(bbox0);
+  bbox.grow(bbox1);
+  visibility = visibility0 | visibility1;
 }
 
 void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
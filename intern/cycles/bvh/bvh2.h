@@ -84,6 +84,23 @@ class BVH2 : public BVH {
   void refit_nodes();
   void refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility);
 
+  /* Subtree root along the cut used to parallelize refitting, with the
+   * refitted bounds of the subtree (see #refit_nodes). */
+  struct RefitEntry {
+    int idx;
+    bool leaf;
+    BoundBox bbox = BoundBox::empty;
+    uint visibility = 0;
+  };
+  void refit_node_gather(int idx, bool leaf, int depth, vector<RefitEntry> &entries) const;
+  void refit_node_from_entries(int idx,
+                               bool leaf,
+                               int depth,
+                               const vector<RefitEntry> &entries,
+                               size_t &entry_index,
+                               BoundBox &bbox,
+                               uint &visibility);
+
   /* Refit range of primitives. */
   void refit_primitives(int start, int end, BoundBox &bbox, uint &visibility);
 
@@ -135,6 +135,7 @@ CUDADevice::CUDADevice(const DeviceInfo &info, Stats &stats, Profiler &profiler)
 CUDADevice::~CUDADevice()
 {
   texture_info.free();
+  mem_pool_clear();
   if (cuModule) {
     cuda_assert(cuModuleUnload(cuModule));
   }
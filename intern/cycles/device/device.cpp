@@ -538,6 +538,12 @@ void GPUDevice::init_host_memory(size_t preferred_texture_headroom,
   device_texture_headroom = preferred_texture_headroom > 0 ? preferred_texture_headroom :
                                                              128 * 1024 * 1024LL;  // 128MB
 
+  /* Retain at most a modest fraction of the device memory in the allocation
+   * pool, it is released again as soon as allocations run into the headroom. */
+  size_t total = 0, free = 0;
+  get_device_memory_info(total, free);
+  device_mem_pool_limit = total / 16;
+
   VLOG_INFO << "Mapped host memory limit set to " << string_human_readable_number(map_host_limit)
             << " bytes. (" << string_human_readable_size(map_host_limit) << ")";
 }
@@ -558,6 +564,7 @@ void GPUDevice::move_textures_to_host(size_t size, bool for_texture)
     device_memory *max_mem = NULL;
     size_t max_size = 0;
     bool max_is_image = false;
+    int min_access_hint = 0;
 
     thread_scoped_lock lock(device_mem_map_mutex);
     foreach (MemMap::value_type &pair, device_mem_map) {
@@ -584,11 +591,19 @@ void GPUDevice::move_textures_to_host(size_t size, bool for_texture)
         continue;
       }
 
-      /* Try to move largest allocation, prefer moving images. */
-      if (is_image > max_is_image || (is_image == max_is_image && mem.device_size > max_size)) {
+      /* Prefer moving images, and among those the least frequently accessed
+       * ones, so that often sampled textures keep their fast device copy as
+       * long as possible. Then move the largest allocation so fewer buffers
+       * need to pay the slow host memory access path. */
+      if (is_image > max_is_image ||
+          (is_image == max_is_image &&
+           (max_mem == NULL || mem.access_frequency_hint < min_access_hint ||
+            (mem.access_frequency_hint == min_access_hint && mem.device_size > max_size))))
+      {
         max_is_image = is_image;
         max_size = mem.device_size;
         max_mem = &mem;
+        min_access_hint = mem.access_frequency_hint;
       }
     }
     lock.unlock();
@@ -648,21 +663,41 @@ GPUDevice::Mem *GPUDevice::generic_alloc(device_memory &mem, size_t pitch_paddin
 
   size_t headroom = (is_texture) ? device_texture_headroom : device_working_headroom;
 
-  size_t total = 0, free = 0;
-  get_device_memory_info(total, free);
+  /* Reuse a previously freed device allocation of the same size if there is
+   * one, this skips both the driver allocation and the memory info query. */
+  if (!move_texture_to_host) {
+    device_pointer = mem_pool_acquire(size);
+    if (device_pointer) {
+      mem_alloc_result = true;
+      device_mem_in_use += size;
+      status = " in device memory (reused)";
+    }
+  }
 
-  /* Move textures to host memory if needed. */
-  if (!move_texture_to_host && !is_image && (size + headroom) >= free && can_map_host) {
-    move_textures_to_host(size + headroom - free, is_texture);
+  if (!mem_alloc_result) {
+    size_t total = 0, free = 0;
     get_device_memory_info(total, free);
-  }
 
-  /* Allocate in device memory. */
-  if (!move_texture_to_host && (size + headroom) < free) {
-    mem_alloc_result = alloc_device(device_pointer, size);
-    if (mem_alloc_result) {
-      device_mem_in_use += size;
-      status = " in device memory";
+    /* Pooled allocations count against the free device memory reported by the
+     * driver, release them before resorting to host memory. */
+    if ((size + headroom) >= free && device_mem_pool_size) {
+      mem_pool_clear();
+      get_device_memory_info(total, free);
+    }
+
+    /* Move textures to host memory if needed. */
+    if (!move_texture_to_host && !is_image && (size + headroom) >= free && can_map_host) {
+      move_textures_to_host(size + headroom - free, is_texture);
+      get_device_memory_info(total, free);
+    }
+
+    /* Allocate in device memory. */
+    if (!move_texture_to_host && (size + headroom) < free) {
+      mem_alloc_result = alloc_device(device_pointer, size);
+      if (mem_alloc_result) {
+        device_mem_in_use += size;
+        status = " in device memory";
+      }
     }
   }
 
@@ -775,6 +810,10 @@ void GPUDevice::generic_free(device_memory &mem)
       }
       map_host_used -= mem.device_size;
     }
+    else if (mem_pool_release((void *)mem.device_pointer, mem.device_size)) {
+      /* Retained in the pool for reuse, stays allocated on the device. */
+      device_mem_in_use -= mem.device_size;
+    }
     else {
       /* Free device memory. */
       free_device((void *)mem.device_pointer);
@@ -789,6 +828,50 @@ void GPUDevice::generic_free(device_memory &mem)
   }
 }
 
+void *GPUDevice::mem_pool_acquire(size_t size)
+{
+  thread_scoped_lock lock(device_mem_pool_mutex);
+
+  MemPoolMap::iterator it = device_mem_pool.find(size);
+  if (it == device_mem_pool.end() || it->second.empty()) {
+    return NULL;
+  }
+
+  void *device_pointer = it->second.back();
+  it->second.pop_back();
+  device_mem_pool_size -= size;
+
+  return device_pointer;
+}
+
+bool GPUDevice::mem_pool_release(void *device_pointer, size_t size)
+{
+  thread_scoped_lock lock(device_mem_pool_mutex);
+
+  if (size == 0 || device_mem_pool_size + size > device_mem_pool_limit) {
+    return false;
+  }
+
+  device_mem_pool[size].push_back(device_pointer);
+  device_mem_pool_size += size;
+
+  return true;
+}
+
+void GPUDevice::mem_pool_clear()
+{
+  thread_scoped_lock lock(device_mem_pool_mutex);
+
+  for (MemPoolMap::value_type &entry : device_mem_pool) {
+    for (void *device_pointer : entry.second) {
+      free_device(device_pointer);
+    }
+  }
+
+  device_mem_pool.clear();
+  device_mem_pool_size = 0;
+}
+
 void GPUDevice::generic_copy_to(device_memory &mem)
 {
   if (!mem.host_pointer || !mem.device_pointer) {
@@ -804,6 +887,31 @@ void GPUDevice::generic_copy_to(device_memory &mem)
   }
 }
 
+void GPUDevice::mem_copy_to(device_memory &mem, size_t offset, size_t size)
+{
+  /* Partial upload requires an existing device allocation of matching size,
+   * otherwise fall back to a full copy which handles (re)allocation. */
+  if (!mem.is_resident(this) || !mem.device_pointer || mem.device_size != mem.memory_size() ||
+      mem.type == MEM_TEXTURE)
+  {
+    mem_copy_to(mem);
+    return;
+  }
+
+  if (!mem.host_pointer) {
+    return;
+  }
+
+  thread_scoped_lock lock(device_mem_map_mutex);
+  if (!device_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
+    const size_t offset_bytes = mem.memory_elements_size(offset);
+    const size_t size_bytes = mem.memory_elements_size(size);
+    copy_host_to_device((void *)((char *)mem.device_pointer + offset_bytes),
+                        (char *)mem.host_pointer + offset_bytes,
+                        size_bytes);
+  }
+}
+
 /* DeviceInfo */
 
 CCL_NAMESPACE_END
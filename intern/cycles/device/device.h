@@ -308,6 +308,12 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy a range of elements of an already allocated and fully copied buffer.
+   * Backends without partial upload support copy the entire buffer instead. */
+  virtual void mem_copy_to(device_memory &mem, size_t /*offset*/, size_t /*size*/)
+  {
+    mem_copy_to(mem);
+  }
   virtual void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -340,7 +346,9 @@ class GPUDevice : public Device {
         device_mem_map(),
         device_mem_map_mutex(),
         move_texture_to_host(false),
-        device_mem_in_use(0)
+        device_mem_in_use(0),
+        device_mem_pool_size(0),
+        device_mem_pool_limit(0)
   {
   }
 
@@ -381,10 +389,32 @@ class GPUDevice : public Device {
   /* Simple counter which will try to track amount of used device memory */
   size_t device_mem_in_use;
 
+  /* Pool of freed device allocations which are retained for reuse, keyed by
+   * their exact size. Reallocating the same buffers between renders and scene
+   * updates then skips the expensive driver allocation and free calls. */
+  typedef map<size_t, vector<void *>> MemPoolMap;
+  MemPoolMap device_mem_pool;
+  thread_mutex device_mem_pool_mutex;
+  size_t device_mem_pool_size;
+  size_t device_mem_pool_limit;
+
+  /* Take a pooled allocation of the given size, returns NULL if none is available. */
+  void *mem_pool_acquire(size_t size);
+  /* Retain a device allocation for later reuse. Returns false when the pool is
+   * full and the caller is responsible for freeing the allocation. */
+  bool mem_pool_release(void *device_pointer, size_t size);
+  /* Free all pooled allocations. Called under device memory pressure, and by
+   * the backend destructor before the device context is destroyed. */
+  void mem_pool_clear();
+
   virtual void init_host_memory(size_t preferred_texture_headroom = 0,
                                 size_t preferred_working_headroom = 0);
   virtual void move_textures_to_host(size_t size, bool for_texture);
 
+  /* Keep the whole buffer copy visible next to the partial override. */
+  using Device::mem_copy_to;
+  void mem_copy_to(device_memory &mem, size_t offset, size_t size) override;
+
   /* Allocation, deallocation and copy functions, with corresponding
    * support of device/host allocations. */
   virtual GPUDevice::Mem *generic_alloc(device_memory &mem, size_t pitch_padding = 0);
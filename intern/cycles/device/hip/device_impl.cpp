@@ -126,6 +126,7 @@ HIPDevice::HIPDevice(const DeviceInfo &info, Stats &stats, Profiler &profiler)
 HIPDevice::~HIPDevice()
 {
   texture_info.free();
+  mem_pool_clear();
   if (hipModule) {
     hip_assert(hipModuleUnload(hipModule));
   }
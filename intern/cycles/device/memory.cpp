@@ -19,6 +19,7 @@ device_memory::device_memory(Device *device, const char *_name, MemoryType type)
       data_depth(0),
       type(type),
       name_storage(_name),
+      access_frequency_hint(1),
       device(device),
       device_pointer(0),
       host_pointer(0),
@@ -82,13 +83,23 @@ void device_memory::device_free()
 void device_memory::device_copy_to()
 {
   if (host_pointer) {
+    device->stats.mem_copy_to_device(memory_size());
     device->mem_copy_to(*this);
   }
 }
 
+void device_memory::device_copy_to(size_t offset, size_t size)
+{
+  if (host_pointer) {
+    device->stats.mem_copy_to_device(memory_elements_size(size));
+    device->mem_copy_to(*this, offset, size);
+  }
+}
+
 void device_memory::device_copy_from(size_t y, size_t w, size_t h, size_t elem)
 {
   assert(type != MEM_TEXTURE && type != MEM_READ_ONLY && type != MEM_GLOBAL);
+  device->stats.mem_copy_from_device((size_t)elem * w * h);
   device->mem_copy_from(*this, y, w, h, elem);
 }
 
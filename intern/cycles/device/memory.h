@@ -235,6 +235,11 @@ class device_memory {
   const char *name;
   std::string name_storage;
 
+  /* Estimated relative access frequency during rendering, used to decide
+   * which allocations to migrate to host memory first when device memory
+   * runs out. Lower values are moved to the host first. */
+  int access_frequency_hint;
+
   /* Pointers. */
   Device *device;
   device_ptr device_pointer;
@@ -282,6 +287,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t offset, size_t size);
   void device_copy_from(size_t y, size_t w, size_t h, size_t elem);
   void device_zero();
 
@@ -523,6 +529,17 @@ template<typename T> class device_vector : public device_memory {
     }
   }
 
+  /* Copy only a range of elements to the device. Only valid when the device
+   * buffer was already allocated and copied with matching size, backends
+   * without partial upload support copy the whole buffer instead. */
+  void copy_to_device(size_t offset, size_t size)
+  {
+    assert(offset + size <= data_size);
+    if (size != 0) {
+      device_copy_to(offset, size);
+    }
+  }
+
   void copy_to_device_if_modified()
   {
     if (!modified) {
@@ -366,6 +366,41 @@ class MultiDevice : public Device {
     stats.mem_alloc(mem.device_size - existing_size);
   }
 
+  void mem_copy_to(device_memory &mem, size_t offset, size_t size) override
+  {
+    device_ptr existing_key = mem.device_pointer;
+    size_t existing_size = mem.device_size;
+
+    if (!existing_key) {
+      /* Not allocated on the devices yet, needs a full copy. */
+      mem_copy_to(mem);
+      return;
+    }
+
+    foreach (const vector<SubDevice *> &island, peer_islands) {
+      SubDevice *owner_sub = find_suitable_mem_device(existing_key, island);
+      mem.device = owner_sub->device;
+      mem.device_pointer = owner_sub->ptr_map[existing_key];
+      mem.device_size = existing_size;
+
+      owner_sub->device->mem_copy_to(mem, offset, size);
+      owner_sub->ptr_map[existing_key] = mem.device_pointer;
+
+      if (mem.type == MEM_GLOBAL || mem.type == MEM_TEXTURE) {
+        /* Texture objects and pointers in kernel globals on the other devices
+         * still point at the owner allocation, no data copy is needed. */
+        foreach (SubDevice *island_sub, island) {
+          if (island_sub != owner_sub) {
+            island_sub->device->mem_copy_to(mem);
+          }
+        }
+      }
+    }
+
+    mem.device = this;
+    mem.device_pointer = existing_key;
+  }
+
   void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) override
   {
     device_ptr key = mem.device_pointer;
@@ -135,6 +135,7 @@ OneapiDevice::~OneapiDevice()
 #  endif
 
   texture_info.free();
+  mem_pool_clear();
   usm_free(device_queue_, kg_memory_);
   usm_free(device_queue_, kg_memory_device_);
 
@@ -16,10 +16,17 @@ DeviceQueue::DeviceQueue(Device *device)
     : device(device),
       last_kernels_enqueued_(0),
       last_sync_time_(0.0),
-      is_per_kernel_performance_(false)
+      is_per_kernel_performance_(false),
+      is_stats_export_(false)
 {
   DCHECK_NE(device, nullptr);
   is_per_kernel_performance_ = getenv("CYCLES_DEBUG_PER_KERNEL_PERFORMANCE");
+  is_stats_export_ = getenv("CYCLES_STATS_JSON_DIR");
+}
+
+bool DeviceQueue::is_stats_collection_enabled() const
+{
+  return VLOG_DEVICE_STATS_IS_ON || is_stats_export_;
 }
 
 DeviceQueue::~DeviceQueue()
@@ -55,7 +62,7 @@ DeviceQueue::~DeviceQueue()
 
 void DeviceQueue::debug_init_execution()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (is_stats_collection_enabled()) {
     last_sync_time_ = time_dt();
   }
 
@@ -74,14 +81,14 @@ void DeviceQueue::debug_enqueue_begin(DeviceKernel kernel, const int work_size)
 
 void DeviceQueue::debug_enqueue_end()
 {
-  if (VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) {
+  if (is_stats_collection_enabled() && is_per_kernel_performance_) {
     synchronize();
   }
 }
 
 void DeviceQueue::debug_synchronize()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (is_stats_collection_enabled()) {
     const double new_time = time_dt();
     const double elapsed_time = new_time - last_sync_time_;
     VLOG_DEVICE_STATS << "GPU queue synchronize, elapsed " << std::setw(10) << elapsed_time << "s";
@@ -162,6 +162,14 @@ class DeviceQueue {
     return nullptr;
   }
 
+  /* Accumulated execution time between synchronization points, keyed by the combination of
+   * kernels which were enqueued since the previous one. Only filled in when statistics
+   * collection is enabled (device statistics logging or statistics export). */
+  const map<DeviceKernelMask, double> &stats_kernel_time() const
+  {
+    return stats_kernel_time_;
+  }
+
  protected:
   /* Hide construction so that allocation via `Device` API is enforced. */
   explicit DeviceQueue(Device *device);
@@ -173,6 +181,10 @@ class DeviceQueue {
   void debug_synchronize();
   string debug_active_kernels();
 
+  /* Whether kernel execution time is to be accumulated, either for the debugging logs or for the
+   * statistics export from the session. */
+  bool is_stats_collection_enabled() const;
+
   /* Combination of kernels enqueued together sync last synchronize. */
   DeviceKernelMask last_kernels_enqueued_;
   /* Time of synchronize call. */
@@ -182,6 +194,9 @@ class DeviceQueue {
   /* If it is true, then a performance statistics in the debugging logs will have focus on kernels
    * and an explicit queue synchronization will be added after each kernel execution. */
   bool is_per_kernel_performance_;
+  /* If it is true, kernel execution time is accumulated for the statistics export even when the
+   * device statistics logging is disabled. */
+  bool is_stats_export_;
 };
 
 CCL_NAMESPACE_END
@@ -62,7 +62,7 @@ void HdCyclesCurves::Populate(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyB
   }
 
   if (dirtyBits & HdChangeTracker::DirtyPrimvar) {
-    PopulatePrimvars(sceneDelegate);
+    PopulatePrimvars(sceneDelegate, dirtyBits);
   }
 
   rebuild = (_geom->curve_keys_is_modified()) || (_geom->curve_radius_is_modified());
@@ -141,10 +141,14 @@ void HdCyclesCurves::PopulateWidths(HdSceneDelegate *sceneDelegate)
   _geom->set_curve_radius(radiusDataCycles);
 }
 
-void HdCyclesCurves::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
+void HdCyclesCurves::PopulatePrimvars(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyBits)
 {
   Scene *const scene = (Scene *)_geom->get_owner();
 
+  // A topology update clears the entire geometry, in which case all attributes have to be
+  // created again regardless of their individual dirty state
+  const bool resyncAll = HdChangeTracker::IsTopologyDirty(dirtyBits, GetId());
+
   const std::pair<HdInterpolation, AttributeElement> interpolations[] = {
       std::make_pair(HdInterpolationVertex, ATTR_ELEMENT_CURVE_KEY),
       std::make_pair(HdInterpolationVarying, ATTR_ELEMENT_CURVE_KEY),
@@ -161,6 +165,11 @@ void HdCyclesCurves::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
         continue;
       }
 
+      // Only update primvars that are flagged dirty, others are still up to date
+      if (!resyncAll && !HdChangeTracker::IsPrimvarDirty(dirtyBits, GetId(), desc.name)) {
+        continue;
+      }
+
       VtValue value = GetPrimvar(sceneDelegate, desc.name);
       if (value.IsEmpty()) {
         continue;
@@ -34,7 +34,7 @@ class HdCyclesCurves final : public HdCyclesGeometry<PXR_NS::HdBasisCurves, CCL_
   void PopulatePoints(PXR_NS::HdSceneDelegate *sceneDelegate);
   void PopulateWidths(PXR_NS::HdSceneDelegate *sceneDelegate);
 
-  void PopulatePrimvars(PXR_NS::HdSceneDelegate *sceneDelegate);
+  void PopulatePrimvars(PXR_NS::HdSceneDelegate *sceneDelegate, PXR_NS::HdDirtyBits dirtyBits);
 
   void PopulateTopology(PXR_NS::HdSceneDelegate *sceneDelegate);
 };
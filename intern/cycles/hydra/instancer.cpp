@@ -123,7 +123,10 @@ VtMatrix4dArray HdCyclesInstancer::ComputeInstanceTransforms(const SdfPath &prot
   if (const auto instancer = static_cast<HdCyclesInstancer *>(
           GetDelegate()->GetRenderIndex().GetInstancer(GetParentId())))
   {
-    for (const GfMatrix4d &parentTransform : instancer->ComputeInstanceTransforms(GetId())) {
+    const VtMatrix4dArray parentTransforms = instancer->ComputeInstanceTransforms(GetId());
+    resultTransforms.reserve(parentTransforms.size() * transforms.size());
+
+    for (const GfMatrix4d &parentTransform : parentTransforms) {
       for (const GfMatrix4d &localTransform : transforms) {
         resultTransforms.push_back(parentTransform * localTransform);
       }
@@ -148,7 +148,7 @@ void HdCyclesMesh::Populate(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyBit
 
   // Must happen after topology update, so that appropriate attribute set can be selected
   if (dirtyBits & HdChangeTracker::DirtyPrimvar) {
-    PopulatePrimvars(sceneDelegate);
+    PopulatePrimvars(sceneDelegate, dirtyBits);
   }
 
   rebuild = (_geom->triangles_is_modified()) || (_geom->subd_start_corner_is_modified()) ||
@@ -294,10 +294,14 @@ void HdCyclesMesh::PopulateNormals(HdSceneDelegate *sceneDelegate)
   }
 }
 
-void HdCyclesMesh::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
+void HdCyclesMesh::PopulatePrimvars(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyBits)
 {
   Scene *const scene = (Scene *)_geom->get_owner();
 
+  // A topology update clears the entire geometry, in which case all attributes have to be
+  // created again regardless of their individual dirty state
+  const bool resyncAll = HdChangeTracker::IsTopologyDirty(dirtyBits, GetId());
+
   const bool subdivision = _geom->get_subdivision_type() != Mesh::SUBDIVISION_NONE;
   AttributeSet &attributes = subdivision ? _geom->subd_attributes : _geom->attributes;
 
@@ -318,6 +322,11 @@ void HdCyclesMesh::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
         continue;
       }
 
+      // Only update primvars that are flagged dirty, others are still up to date
+      if (!resyncAll && !HdChangeTracker::IsPrimvarDirty(dirtyBits, GetId(), desc.name)) {
+        continue;
+      }
+
       VtValue value = GetPrimvar(sceneDelegate, desc.name);
       if (value.IsEmpty()) {
         continue;
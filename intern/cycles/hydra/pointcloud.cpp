@@ -66,7 +66,7 @@ void HdCyclesPoints::Populate(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyB
   }
 
   if (dirtyBits & HdChangeTracker::DirtyPrimvar) {
-    PopulatePrimvars(sceneDelegate);
+    PopulatePrimvars(sceneDelegate, dirtyBits);
   }
 }
 
@@ -143,10 +143,14 @@ void HdCyclesPoints::PopulateWidths(HdSceneDelegate *sceneDelegate)
   _geom->set_radius(radiusDataCycles);
 }
 
-void HdCyclesPoints::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
+void HdCyclesPoints::PopulatePrimvars(HdSceneDelegate *sceneDelegate, HdDirtyBits dirtyBits)
 {
   Scene *const scene = (Scene *)_geom->get_owner();
 
+  // A change to the points may resize the geometry, in which case all attributes have to be
+  // created again regardless of their individual dirty state
+  const bool resyncAll = (dirtyBits & HdChangeTracker::DirtyPoints) != 0;
+
   const std::pair<HdInterpolation, AttributeElement> interpolations[] = {
       std::make_pair(HdInterpolationVertex, ATTR_ELEMENT_VERTEX),
       std::make_pair(HdInterpolationConstant, ATTR_ELEMENT_OBJECT),
@@ -161,6 +165,11 @@ void HdCyclesPoints::PopulatePrimvars(HdSceneDelegate *sceneDelegate)
         continue;
       }
 
+      // Only update primvars that are flagged dirty, others are still up to date
+      if (!resyncAll && !HdChangeTracker::IsPrimvarDirty(dirtyBits, GetId(), desc.name)) {
+        continue;
+      }
+
       VtValue value = GetPrimvar(sceneDelegate, desc.name);
       if (value.IsEmpty()) {
         continue;
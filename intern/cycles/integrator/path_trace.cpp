@@ -54,6 +54,8 @@ PathTrace::PathTrace(Device *device,
   work_balance_infos_.resize(path_trace_works_.size());
   work_balance_do_initial(work_balance_infos_);
 
+  adaptive_filter_converged_works_.resize(path_trace_works_.size(), 0);
+
   render_scheduler.set_need_schedule_rebalance(path_trace_works_.size() > 1);
 }
 
@@ -368,6 +370,9 @@ void PathTrace::init_render_buffers(const RenderWork &render_work)
       path_trace_work->zero_render_buffers();
     });
 
+    std::fill(
+        adaptive_filter_converged_works_.begin(), adaptive_filter_converged_works_.end(), 0);
+
     tile_buffer_read();
   }
 }
@@ -439,14 +444,30 @@ void PathTrace::adaptive_sample(RenderWork &render_work)
 
     const double start_time = time_dt();
 
+    if (render_work.adaptive_sampling.reset) {
+      /* Convergence flags are re-calculated from scratch for the new threshold, so previous
+       * filter results are no longer valid. */
+      std::fill(
+          adaptive_filter_converged_works_.begin(), adaptive_filter_converged_works_.end(), 0);
+    }
+
+    const int num_works = path_trace_works_.size();
     uint num_active_pixels = 0;
-    parallel_for_each(path_trace_works_, [&](unique_ptr<PathTraceWork> &path_trace_work) {
+    parallel_for(0, num_works, [&](int i) {
+      if (adaptive_filter_converged_works_[i]) {
+        /* Already converged slices can not gain unconverged pixels at the same threshold, so
+         * there is no need to filter them again. */
+        return;
+      }
       const uint num_active_pixels_in_work =
-          path_trace_work->adaptive_sampling_converge_filter_count_active(
+          path_trace_works_[i]->adaptive_sampling_converge_filter_count_active(
               render_work.adaptive_sampling.threshold, render_work.adaptive_sampling.reset);
       if (num_active_pixels_in_work) {
         atomic_add_and_fetch_u(&num_active_pixels, num_active_pixels_in_work);
       }
+      else {
+        adaptive_filter_converged_works_[i] = 1;
+      }
     });
 
     render_scheduler_.report_adaptive_filter_time(
@@ -731,6 +752,9 @@ void PathTrace::rebalance(const RenderWork &render_work)
   render_state_.need_reset_params = true;
   update_work_buffer_params_if_needed(render_work);
 
+  /* The works now cover different slices of the big tile, so per-work convergence is unknown. */
+  std::fill(adaptive_filter_converged_works_.begin(), adaptive_filter_converged_works_.end(), 0);
+
   copy_from_render_buffers(&big_tile_cpu_buffers);
 
   render_scheduler_.report_rebalance_time(render_work, time_dt() - start_time, true);
@@ -1279,6 +1303,13 @@ string PathTrace::full_report() const
   return result;
 }
 
+void PathTrace::collect_kernel_time_stats(map<DeviceKernelMask, double> &stats) const
+{
+  for (const auto &path_trace_work : path_trace_works_) {
+    path_trace_work->collect_kernel_time_stats(stats);
+  }
+}
+
 void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bool reset)
 {
 #ifdef WITH_PATH_GUIDING
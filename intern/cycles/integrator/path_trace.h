@@ -175,6 +175,10 @@ class PathTrace {
    * times, and so on. */
   string full_report() const;
 
+  /* Gather kernel execution time measured by the works' device queues, accumulated over all
+   * works into the given container. */
+  void collect_kernel_time_stats(map<DeviceKernelMask, double> &stats) const;
+
   /* Callback which is called to report current rendering progress.
    *
    * It is supposed to be cheaper than buffer update/write, hence can be called more often.
@@ -273,6 +277,12 @@ class PathTrace {
   /* Per-path trace work information needed for multi-device balancing. */
   vector<WorkBalanceInfo> work_balance_infos_;
 
+  /* Per-work flags set when the adaptive sampling filter found no unconverged pixels in the
+   * work's slice of the big tile. Converged pixels can not become unconverged again at the same
+   * threshold, so such slices are skipped by following filter works until the convergence flags
+   * are re-calculated for a lower threshold or a new render. */
+  vector<int> adaptive_filter_converged_works_;
+
   /* Render buffer parameters of the full frame and current big tile. */
   BufferParams full_params_;
   BufferParams big_tile_params_;
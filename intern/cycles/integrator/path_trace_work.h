@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "device/kernel.h"
+
 #include "integrator/pass_accessor.h"
 #include "scene/pass.h"
 #include "session/buffers.h"
+#include "util/map.h"
 #include "util/types.h"
 #include "util/unique_ptr.h"
 
@@ -126,6 +129,10 @@ class PathTraceWork {
   /* Run cryptomatte pass post-processing kernels. */
   virtual void cryptomatte_postproces() = 0;
 
+  /* Add kernel execution time measured by the work's device queue to the given container.
+   * Only GPU works measure kernel time, the base implementation is a no-op. */
+  virtual void collect_kernel_time_stats(map<DeviceKernelMask, double> & /*stats*/) const {}
+
   /* Cheap-ish request to see whether rendering is requested and is to be stopped as soon as
    * possible, without waiting for any samples to be finished. */
   inline bool is_cancel_requested() const
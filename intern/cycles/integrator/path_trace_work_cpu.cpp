@@ -65,7 +65,15 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 {
   const int64_t image_width = effective_buffer_params_.width;
   const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
+
+  /* Schedule work in small square blocks of pixels, so that every thread
+   * shades spatially coherent paths back to back. Neighboring pixels tend to
+   * hit the same BVH nodes, shaders and textures, which keeps the working set
+   * in the CPU caches on shader-heavy scenes. */
+  const int64_t block_size = 8;
+  const int64_t num_blocks_x = divide_up(image_width, block_size);
+  const int64_t num_blocks_y = divide_up(image_height, block_size);
+  const int64_t total_blocks_num = num_blocks_x * num_blocks_y;
 
   if (device_->profiler.active()) {
     for (CPUKernelThreadGlobals &kernel_globals : kernel_thread_globals_) {
@@ -75,28 +83,41 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
+    parallel_for(int64_t(0), total_blocks_num, [&](int64_t block_index) {
       if (is_cancel_requested()) {
         return;
       }
 
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
+      const int64_t block_y = block_index / num_blocks_x;
+      const int64_t block_x = block_index - block_y * num_blocks_x;
 
-      KernelWorkTile work_tile;
-      work_tile.x = effective_buffer_params_.full_x + x;
-      work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
-      work_tile.start_sample = start_sample;
-      work_tile.sample_offset = sample_offset;
-      work_tile.num_samples = 1;
-      work_tile.offset = effective_buffer_params_.offset;
-      work_tile.stride = effective_buffer_params_.stride;
+      const int64_t x_begin = block_x * block_size;
+      const int64_t y_begin = block_y * block_size;
+      const int64_t x_end = std::min(x_begin + block_size, image_width);
+      const int64_t y_end = std::min(y_begin + block_size, image_height);
 
       CPUKernelThreadGlobals *kernel_globals = kernel_thread_globals_get(kernel_thread_globals_);
 
-      render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+      for (int64_t y = y_begin; y < y_end; ++y) {
+        for (int64_t x = x_begin; x < x_end; ++x) {
+          if (is_cancel_requested()) {
+            return;
+          }
+
+          KernelWorkTile work_tile;
+          work_tile.x = effective_buffer_params_.full_x + x;
+          work_tile.y = effective_buffer_params_.full_y + y;
+          work_tile.w = 1;
+          work_tile.h = 1;
+          work_tile.start_sample = start_sample;
+          work_tile.sample_offset = sample_offset;
+          work_tile.num_samples = 1;
+          work_tile.offset = effective_buffer_params_.offset;
+          work_tile.stride = effective_buffer_params_.stride;
+
+          render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+        }
+      }
     });
   });
   if (device_->profiler.active()) {
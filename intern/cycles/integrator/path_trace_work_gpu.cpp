@@ -1121,6 +1121,13 @@ void PathTraceWorkGPU::cryptomatte_postproces()
   queue_->enqueue(DEVICE_KERNEL_CRYPTOMATTE_POSTPROCESS, work_size, args);
 }
 
+void PathTraceWorkGPU::collect_kernel_time_stats(map<DeviceKernelMask, double> &stats) const
+{
+  for (const auto &[mask, time] : queue_->stats_kernel_time()) {
+    stats[mask] += time;
+  }
+}
+
 bool PathTraceWorkGPU::copy_render_buffers_from_device()
 {
   queue_->copy_from_device(buffers_->buffer);
@@ -49,6 +49,8 @@ class PathTraceWorkGPU : public PathTraceWork {
   virtual int adaptive_sampling_converge_filter_count_active(float threshold, bool reset) override;
   virtual void cryptomatte_postproces() override;
 
+  virtual void collect_kernel_time_stats(map<DeviceKernelMask, double> &stats) const override;
+
  protected:
   void alloc_integrator_soa();
   void alloc_integrator_queue();
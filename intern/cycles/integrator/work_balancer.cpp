@@ -29,46 +29,48 @@ void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos)
   }
 }
 
-static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_infos)
-{
-  double total_time = 0;
-  for (const WorkBalanceInfo &info : work_balance_infos) {
-    total_time += info.time_spent;
-  }
-  return total_time;
-}
-
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* The balance is based on the observed throughput of every device: the fraction of the overall
+ * work which the device performed, divided by the time it spent on it. Scheduling work
+ * proportionally to the throughput equalizes the render time of all devices in a single step when
+ * the throughput is stable, which converges much quicker than an incremental time equalization
+ * when devices of very different performance are mixed together.
+ * The measured throughput is damped a bit to avoid oscillation caused by noise in the timing of
+ * the individual work batches. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
   const int num_infos = work_balance_infos.size();
 
-  const double total_time = calculate_total_time(work_balance_infos);
-  const double time_average = total_time / num_infos;
+  double total_throughput = 0;
+  vector<double> throughputs;
+  throughputs.reserve(num_infos);
+
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    const double throughput = info.weight / info.time_spent;
+    throughputs.push_back(throughput);
+    total_throughput += throughput;
+  }
+
+  const double total_throughput_inv = 1.0 / total_throughput;
+
+  /* Interpolation factor between the current weight and the weight which matches the measured
+   * throughput. Kept below 1 so that a single noisy measurement does not move all of the work. */
+  const double lerp_weight = 0.75;
 
   double total_weight = 0;
   vector<double> new_weights;
   new_weights.reserve(num_infos);
 
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
-
   bool has_big_difference = false;
 
-  for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
+  for (int i = 0; i < num_infos; ++i) {
+    const WorkBalanceInfo &info = work_balance_infos[i];
+    const double target_weight = throughputs[i] * total_throughput_inv;
+    const double new_weight = mix(info.weight, target_weight, lerp_weight);
     new_weights.push_back(new_weight);
     total_weight += new_weight;
 
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    if (std::fabs(1.0 - target_weight / info.weight) > 0.02) {
       has_big_difference = true;
     }
   }
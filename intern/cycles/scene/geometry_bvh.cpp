@@ -158,6 +158,9 @@ void GeometryManager::device_update_bvh(Device *device,
    * BVH's leaf nodes which may be different when the objects or vertices move. */
 
   if (pack.nodes.size()) {
+    /* BVH nodes are traversed for every ray, keep them on the device for as
+     * long as possible when memory runs out. */
+    dscene->bvh_nodes.access_frequency_hint = 2;
     dscene->bvh_nodes.steal_data(pack.nodes);
     dscene->bvh_nodes.copy_to_device();
   }
@@ -296,6 +296,11 @@ ustring ImageLoader::osl_filepath() const
   return ustring();
 }
 
+bool ImageLoader::reduce_to_miplevel(const int /*texture_limit*/, ImageMetaData & /*metadata*/)
+{
+  return false;
+}
+
 int ImageLoader::get_tile_number() const
 {
   return 0;
@@ -540,20 +545,35 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
   }
 
   /* Get metadata. */
-  int width = img->metadata.width;
-  int height = img->metadata.height;
-  int depth = img->metadata.depth;
-  int components = img->metadata.channels;
+  ImageMetaData metadata = img->metadata;
+  int width = metadata.width;
+  int height = metadata.height;
+  int depth = metadata.depth;
+  int components = metadata.channels;
 
   /* Read pixels. */
   vector<StorageType> pixels_storage;
   StorageType *pixels;
-  const size_t max_size = max(max(width, height), depth);
+  size_t max_size = max(max(width, height), depth);
   if (max_size == 0) {
     /* Don't bother with empty images. */
     return false;
   }
 
+  /* Try to read a reduced resolution directly from a mip map stored in the
+   * file, which avoids loading the full resolution image and scaling it down
+   * afterwards. */
+  if (texture_limit > 0 && max_size > texture_limit) {
+    if (img->loader->reduce_to_miplevel(texture_limit, metadata)) {
+      VLOG_WORK << "Loading image " << img->loader->name() << " from mip map at " << metadata.width
+                << "x" << metadata.height << ".";
+      width = metadata.width;
+      height = metadata.height;
+      depth = metadata.depth;
+      max_size = max(max(width, height), depth);
+    }
+  }
+
   /* Allocate memory as needed, may be smaller to resize down. */
   if (texture_limit > 0 && max_size > texture_limit) {
     pixels_storage.resize(((size_t)width) * height * depth * 4);
@@ -570,8 +590,7 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
   }
 
   const size_t num_pixels = ((size_t)width) * height * depth;
-  img->loader->load_pixels(
-      img->metadata, pixels, num_pixels * components, image_associate_alpha(img));
+  img->loader->load_pixels(metadata, pixels, num_pixels * components, image_associate_alpha(img));
 
   /* The kernel can handle 1 and 4 channel images. Anything that is not a single
    * channel image is converted to RGBA format. */
@@ -719,6 +738,11 @@ void ImageManager::device_load_image(Device *device, Scene *scene, size_t slot,
   img->mem->info.use_transform_3d = img->metadata.use_transform_3d;
   img->mem->info.transform_3d = img->metadata.transform_3d;
 
+  /* Approximate access frequency by the number of image users, so that when
+   * device memory runs out, textures referenced by few shaders are moved to
+   * host memory before widely used ones. */
+  img->mem->access_frequency_hint = img->users;
+
   /* Create new texture. */
   if (type == IMAGE_DATA_TYPE_FLOAT4) {
     if (!file_load_image<TypeDesc::FLOAT, float>(img, texture_limit)) {
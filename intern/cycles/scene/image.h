@@ -108,6 +108,12 @@ class ImageLoader {
                            const size_t pixels_size,
                            const bool associate_alpha) = 0;
 
+  /* Check whether the image can be loaded directly at a reduced resolution
+   * from a mip map stored in the file. If so, update the metadata dimensions
+   * to the largest level that fits within the texture size limit, and
+   * load_pixels will read that level. */
+  virtual bool reduce_to_miplevel(const int texture_limit, ImageMetaData &metadata);
+
   /* Name for logs and stats. */
   virtual string name() const = 0;
 
@@ -89,9 +89,41 @@ bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures & /*features*/,
   return true;
 }
 
+bool OIIOImageLoader::reduce_to_miplevel(const int texture_limit, ImageMetaData &metadata)
+{
+  unique_ptr<ImageInput> in(ImageInput::create(filepath.string()));
+  if (!in) {
+    return false;
+  }
+
+  ImageSpec spec;
+  if (!in->open(filepath.string(), spec)) {
+    return false;
+  }
+
+  /* Mip levels are stored from fine to coarse, so the first level which fits
+   * within the texture size limit is the largest one. */
+  bool found = false;
+  int miplevel = 0;
+  while (in->seek_subimage(0, ++miplevel)) {
+    const ImageSpec &mip_spec = in->spec();
+    if (max(max(mip_spec.width, mip_spec.height), mip_spec.depth) <= texture_limit) {
+      metadata.width = mip_spec.width;
+      metadata.height = mip_spec.height;
+      metadata.depth = mip_spec.depth;
+      found = true;
+      break;
+    }
+  }
+
+  in->close();
+  return found;
+}
+
 template<TypeDesc::BASETYPE FileFormat, typename StorageType>
 static void oiio_load_pixels(const ImageMetaData &metadata,
                              const unique_ptr<ImageInput> &in,
+                             const int miplevel,
                              const bool associate_alpha,
                              StorageType *pixels)
 {
@@ -111,7 +143,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
   if (depth <= 1) {
     size_t scanlinesize = width * components * sizeof(StorageType);
     in->read_image(0,
-                   0,
+                   miplevel,
                    0,
                    components,
                    FileFormat,
@@ -121,7 +153,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
                    AutoStride);
   }
   else {
-    in->read_image(0, 0, 0, components, FileFormat, (uchar *)readpixels);
+    in->read_image(0, miplevel, 0, components, FileFormat, (uchar *)readpixels);
   }
 
   if (components > 4) {
@@ -216,23 +248,49 @@ bool OIIOImageLoader::load_pixels(const ImageMetaData &metadata,
     }
   }
 
+  /* When the metadata was reduced to a mip map stored in the file, find the
+   * level with the matching resolution to read. */
+  int miplevel = 0;
+  if (metadata.width != spec.width || metadata.height != spec.height ||
+      metadata.depth != spec.depth)
+  {
+    bool found = false;
+    while (in->seek_subimage(0, ++miplevel)) {
+      const ImageSpec &mip_spec = in->spec();
+      if (mip_spec.width == metadata.width && mip_spec.height == metadata.height &&
+          mip_spec.depth == metadata.depth)
+      {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      /* File changed on disk since the metadata was loaded. */
+      in->close();
+      return false;
+    }
+  }
+
   switch (metadata.type) {
     case IMAGE_DATA_TYPE_BYTE:
     case IMAGE_DATA_TYPE_BYTE4:
-      oiio_load_pixels<TypeDesc::UINT8, uchar>(metadata, in, do_associate_alpha, (uchar *)pixels);
+      oiio_load_pixels<TypeDesc::UINT8, uchar>(
+          metadata, in, miplevel, do_associate_alpha, (uchar *)pixels);
       break;
     case IMAGE_DATA_TYPE_USHORT:
     case IMAGE_DATA_TYPE_USHORT4:
       oiio_load_pixels<TypeDesc::USHORT, uint16_t>(
-          metadata, in, do_associate_alpha, (uint16_t *)pixels);
+          metadata, in, miplevel, do_associate_alpha, (uint16_t *)pixels);
       break;
     case IMAGE_DATA_TYPE_HALF:
     case IMAGE_DATA_TYPE_HALF4:
-      oiio_load_pixels<TypeDesc::HALF, half>(metadata, in, do_associate_alpha, (half *)pixels);
+      oiio_load_pixels<TypeDesc::HALF, half>(
+          metadata, in, miplevel, do_associate_alpha, (half *)pixels);
       break;
     case IMAGE_DATA_TYPE_FLOAT:
     case IMAGE_DATA_TYPE_FLOAT4:
-      oiio_load_pixels<TypeDesc::FLOAT, float>(metadata, in, do_associate_alpha, (float *)pixels);
+      oiio_load_pixels<TypeDesc::FLOAT, float>(
+          metadata, in, miplevel, do_associate_alpha, (float *)pixels);
       break;
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT:
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
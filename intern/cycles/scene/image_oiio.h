@@ -21,6 +21,8 @@ class OIIOImageLoader : public ImageLoader {
                    const size_t pixels_size,
                    const bool associate_alpha) override;
 
+  bool reduce_to_miplevel(const int texture_limit, ImageMetaData &metadata) override;
+
   string name() const override;
 
   ustring osl_filepath() const override;
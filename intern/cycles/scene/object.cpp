@@ -584,8 +584,14 @@ void ObjectManager::device_update_object_transform(UpdateObjectTransformState *s
                      (geom->geometry_type == Geometry::POINTCLOUD) ?
                          static_cast<PointCloud *>(geom)->num_points() :
                          0;
-  kobject.patch_map_offset = 0;
-  kobject.attribute_map_offset = 0;
+  if (update_all) {
+    /* Freshly allocated array. The actual offsets are filled in later by
+     * device_update_geom_offsets(), once attributes and patch tables have
+     * been packed. Otherwise keep the current values, so that a partial
+     * upload does not clobber them on the device. */
+    kobject.patch_map_offset = 0;
+    kobject.attribute_map_offset = 0;
+  }
 
   if (ob->asset_name_is_modified() || update_all) {
     uint32_t hash_name = util_murmur_hash3(ob->name.c_str(), ob->name.length(), 0);
@@ -720,6 +726,19 @@ void ObjectManager::device_update_transforms(DeviceScene *dscene, Scene *scene,
   /* as all the arrays are the same size, checking only dscene.objects is sufficient */
   const bool update_all = dscene->objects.need_realloc();
 
+  /* Track the range of modified objects, so that moving a few objects among
+   * many only uploads the changed slice of the transform tables. */
+  size_t modified_begin = scene->objects.size();
+  size_t modified_end = 0;
+  if (!update_all) {
+    for (size_t i = 0; i < scene->objects.size(); i++) {
+      if (scene->objects[i]->is_modified()) {
+        modified_begin = min(modified_begin, i);
+        modified_end = max(modified_end, i + 1);
+      }
+    }
+  }
+
   /* Parallel object update, with grain size to avoid too much threading overhead
    * for individual objects. */
   static const int OBJECTS_PER_TASK = 32;
@@ -735,11 +754,32 @@ void ObjectManager::device_update_transforms(DeviceScene *dscene, Scene *scene,
     return;
   }
 
-  dscene->objects.copy_to_device_if_modified();
+  /* Partial upload is only safe when all changes come from modified objects
+   * themselves. Geometry or particle system changes can alter entries of
+   * objects which are not tagged as modified. */
+  const uint32_t object_only_flags = OBJECT_MODIFIED | TRANSFORM_MODIFIED | VISIBILITY_MODIFIED |
+                                     HOLDOUT_MODIFIED;
+  const bool partial_update = !update_all && (update_flags & ~object_only_flags) == 0 &&
+                              modified_begin < modified_end;
+  if (partial_update) {
+    dscene->objects.copy_to_device(modified_begin, modified_end - modified_begin);
+  }
+  else {
+    dscene->objects.copy_to_device_if_modified();
+  }
   if (state.need_motion == Scene::MOTION_PASS) {
-    dscene->object_motion_pass.copy_to_device();
+    if (partial_update) {
+      dscene->object_motion_pass.copy_to_device(modified_begin * OBJECT_MOTION_PASS_SIZE,
+                                                (modified_end - modified_begin) *
+                                                    OBJECT_MOTION_PASS_SIZE);
+    }
+    else {
+      dscene->object_motion_pass.copy_to_device();
+    }
   }
   else if (state.need_motion == Scene::MOTION_BLUR) {
+    /* Motion offsets depend on the motion size of all preceding objects, so
+     * no reliable slice can be computed here. */
     dscene->object_motion.copy_to_device();
   }
 
@@ -958,7 +998,9 @@ void ObjectManager::device_update_geom_offsets(Device *, DeviceScene *dscene, Sc
 
   KernelObject *kobjects = dscene->objects.data();
 
-  bool update = false;
+  /* Range of objects whose offsets changed, to only upload that slice. */
+  size_t update_begin = scene->objects.size();
+  size_t update_end = 0;
 
   foreach (Object *object, scene->objects) {
     Geometry *geom = object->geometry;
@@ -972,7 +1014,8 @@ void ObjectManager::device_update_geom_offsets(Device *, DeviceScene *dscene, Sc
 
         if (kobjects[object->index].patch_map_offset != patch_map_offset) {
           kobjects[object->index].patch_map_offset = patch_map_offset;
-          update = true;
+          update_begin = min(update_begin, size_t(object->index));
+          update_end = max(update_end, size_t(object->index) + 1);
         }
       }
     }
@@ -986,12 +1029,13 @@ void ObjectManager::device_update_geom_offsets(Device *, DeviceScene *dscene, Sc
 
     if (kobjects[object->index].attribute_map_offset != attr_map_offset) {
       kobjects[object->index].attribute_map_offset = attr_map_offset;
-      update = true;
+      update_begin = min(update_begin, size_t(object->index));
+      update_end = max(update_end, size_t(object->index) + 1);
     }
   }
 
-  if (update) {
-    dscene->objects.copy_to_device();
+  if (update_begin < update_end) {
+    dscene->objects.copy_to_device(update_begin, update_end - update_begin);
   }
 }
 
@@ -16,6 +16,8 @@
 
 #include "util/foreach.h"
 #include "util/log.h"
+#include "util/md5.h"
+#include "util/path.h"
 #include "util/progress.h"
 #include "util/task.h"
 
@@ -168,6 +170,13 @@ SVMCompiler::SVMCompiler(Scene *scene) : scene(scene)
 
   /* This struct has one entry for every node, in order of ShaderNodeType definition. */
   svm_node_types_used = (std::atomic_int *)&scene->dscene.data.svm_usage;
+  node_types_used_record.resize(NODE_NUM, false);
+}
+
+void SVMCompiler::set_node_type_used(ShaderNodeType type)
+{
+  svm_node_types_used[type] = true;
+  node_types_used_record[type] = true;
 }
 
 int SVMCompiler::stack_size(SocketType::Type type)
@@ -392,13 +401,13 @@ void SVMCompiler::add_node(int a, int b, int c, int d)
 
 void SVMCompiler::add_node(ShaderNodeType type, int a, int b, int c)
 {
-  svm_node_types_used[type] = true;
+  set_node_type_used(type);
   current_svm_nodes.push_back_slow(make_int4(type, a, b, c));
 }
 
 void SVMCompiler::add_node(ShaderNodeType type, const float3 &f)
 {
-  svm_node_types_used[type] = true;
+  set_node_type_used(type);
   current_svm_nodes.push_back_slow(
       make_int4(type, __float_as_int(f.x), __float_as_int(f.y), __float_as_int(f.z)));
 }
@@ -411,7 +420,9 @@ void SVMCompiler::add_node(const float4 &f)
 
 uint SVMCompiler::attribute(ustring name)
 {
-  return scene->shader_manager->get_attribute_id(name);
+  const uint64_t id = scene->shader_manager->get_attribute_id(name);
+  named_attributes_used[name] = id;
+  return id;
 }
 
 uint SVMCompiler::attribute(AttributeStandard std)
@@ -685,7 +696,7 @@ void SVMCompiler::generate_multi_closure(ShaderNode *root_node,
         /* Add instruction to skip closure and its dependencies if mix
          * weight is zero.
          */
-        svm_node_types_used[NODE_JUMP_IF_ONE] = true;
+        set_node_type_used(NODE_JUMP_IF_ONE);
         current_svm_nodes.push_back_slow(make_int4(NODE_JUMP_IF_ONE, 0, stack_assign(facin), 0));
         int node_jump_skip_index = current_svm_nodes.size() - 1;
 
@@ -701,7 +712,7 @@ void SVMCompiler::generate_multi_closure(ShaderNode *root_node,
         /* Add instruction to skip closure and its dependencies if mix
          * weight is zero.
          */
-        svm_node_types_used[NODE_JUMP_IF_ZERO] = true;
+        set_node_type_used(NODE_JUMP_IF_ZERO);
         current_svm_nodes.push_back_slow(make_int4(NODE_JUMP_IF_ZERO, 0, stack_assign(facin), 0));
         int node_jump_skip_index = current_svm_nodes.size() - 1;
 
@@ -867,20 +878,47 @@ void SVMCompiler::compile_type(Shader *shader, ShaderGraph *graph, ShaderType ty
   }
 }
 
+static bool node_cache_enabled();
+static bool node_cache_supported(Shader *shader);
+static string node_cache_filepath(const string &key);
+
 void SVMCompiler::compile(Shader *shader, array<int4> &svm_nodes, int index, Summary *summary)
 {
-  svm_node_types_used[NODE_SHADER_JUMP] = true;
-  svm_nodes.push_back_slow(make_int4(NODE_SHADER_JUMP, 0, 0, 0));
-
   /* copy graph for shader with bump mapping */
   ShaderNode *output = shader->graph->output();
-  int start_num_svm_nodes = svm_nodes.size();
 
   const double time_start = time_dt();
 
   bool has_bump = (shader->get_displacement_method() != DISPLACE_TRUE) &&
                   output->input("Surface")->link && output->input("Displacement")->link;
 
+  /* Restore the compiled nodes from the on-disk cache when enabled. Only
+   * supported when the whole array belongs to this shader, as in
+   * SVMShaderManager::device_update_shader(). */
+  const bool use_node_cache = node_cache_enabled() && index == 0 && svm_nodes.size() == 0 &&
+                              node_cache_supported(shader);
+  string cache_key;
+  if (use_node_cache) {
+    cache_key = node_cache_key(shader, has_bump);
+    if (node_cache_load(cache_key, shader, svm_nodes)) {
+      /* Keep the finalized graph and emission estimate consistent with the
+       * compiled path, both are used outside of the SVM manager. */
+      shader->graph->finalize(scene, has_bump, shader->get_displacement_method() == DISPLACE_BOTH);
+      shader->estimate_emission();
+
+      if (summary != NULL) {
+        summary->num_svm_nodes = svm_nodes.size() - 1;
+        summary->time_total = time_dt() - time_start;
+      }
+      return;
+    }
+  }
+
+  set_node_type_used(NODE_SHADER_JUMP);
+  svm_nodes.push_back_slow(make_int4(NODE_SHADER_JUMP, 0, 0, 0));
+
+  int start_num_svm_nodes = svm_nodes.size();
+
   /* finalize */
   {
     scoped_timer timer((summary != NULL) ? &summary->time_finalize : NULL);
@@ -944,10 +982,258 @@ void SVMCompiler::compile(Shader *shader, array<int4> &svm_nodes, int index, Sum
     summary->num_svm_nodes = svm_nodes.size() - start_num_svm_nodes;
   }
 
+  if (use_node_cache && !compile_failed) {
+    node_cache_store(cache_key, shader, svm_nodes);
+  }
+
   /* Estimate emission for MIS. */
   shader->estimate_emission();
 }
 
+/* On-disk node cache.
+ *
+ * Stores the compiled node array of each shader keyed by a content hash of
+ * its graph, so that unchanged materials skip node generation on consecutive
+ * renders. Opt-in through the CYCLES_SVM_CACHE_DIR environment variable,
+ * which render farm jobs can point at job-local storage. */
+
+static const uint32_t NODE_CACHE_VERSION = 2;
+
+/* Flags of the shader which are set as a side effect of compilation and thus
+ * need to be restored from the cache together with the nodes. */
+enum {
+  NODE_CACHE_HAS_SURFACE = (1 << 0),
+  NODE_CACHE_HAS_SURFACE_TRANSPARENT = (1 << 1),
+  NODE_CACHE_HAS_SURFACE_RAYTRACE = (1 << 2),
+  NODE_CACHE_HAS_SURFACE_BSSRDF = (1 << 3),
+  NODE_CACHE_HAS_BUMP = (1 << 4),
+  NODE_CACHE_HAS_BSSRDF_BUMP = (1 << 5),
+  NODE_CACHE_HAS_VOLUME = (1 << 6),
+  NODE_CACHE_HAS_DISPLACEMENT = (1 << 7),
+  NODE_CACHE_HAS_SURFACE_SPATIAL_VARYING = (1 << 8),
+  NODE_CACHE_HAS_VOLUME_SPATIAL_VARYING = (1 << 9),
+  NODE_CACHE_HAS_VOLUME_ATTRIBUTE_DEPENDENCY = (1 << 10),
+};
+
+static bool node_cache_enabled()
+{
+  static const char *cache_dir = getenv("CYCLES_SVM_CACHE_DIR");
+  return cache_dir != NULL && cache_dir[0] != '\0';
+}
+
+static string node_cache_filepath(const string &key)
+{
+  static const char *cache_dir = getenv("CYCLES_SVM_CACHE_DIR");
+  return path_join(cache_dir, key + ".svm");
+}
+
+static bool node_cache_supported(Shader *shader)
+{
+  /* Image, sky, point density and IES nodes compile to slot indices that the image and light
+   * managers assign first-come per session. A cached copy of such nodes would keep referring to
+   * the slots of the session that wrote it, so these shaders are always compiled. */
+  foreach (ShaderNode *node, shader->graph->nodes) {
+    if (node->special_type == SHADER_SPECIAL_TYPE_IMAGE_SLOT) {
+      return false;
+    }
+    if (node->type == SkyTextureNode::get_node_type() ||
+        node->type == PointDensityTextureNode::get_node_type() ||
+        node->type == IESLightNode::get_node_type())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+string SVMCompiler::node_cache_key(Shader *shader, bool has_bump)
+{
+  MD5Hash md5;
+
+  /* Compilation settings which affect the generated nodes. */
+  const uint32_t version = NODE_CACHE_VERSION;
+  const int displacement_method = shader->get_displacement_method();
+  const bool used = (shader->reference_count() != 0);
+  md5.append((uint8_t *)&version, sizeof(version));
+  md5.append((uint8_t *)&displacement_method, sizeof(displacement_method));
+  md5.append((uint8_t *)&has_bump, sizeof(has_bump));
+  md5.append((uint8_t *)&background, sizeof(background));
+  md5.append((uint8_t *)&used, sizeof(used));
+
+  /* Graph topology and parameters. Socket values are part of the node hash,
+   * so editing a parameter creates a new cache entry. */
+  foreach (ShaderNode *node, shader->graph->nodes) {
+    node->hash(md5);
+    foreach (ShaderInput *input, node->inputs) {
+      int link_id = (input->link) ? input->link->parent->id : 0;
+      md5.append((uint8_t *)&link_id, sizeof(link_id));
+      md5.append((input->link) ? input->link->name().c_str() : "");
+    }
+  }
+
+  return md5.get_hex();
+}
+
+bool SVMCompiler::node_cache_load(const string &key, Shader *shader, array<int4> &svm_nodes)
+{
+  const string filepath = node_cache_filepath(key);
+  if (!path_exists(filepath)) {
+    return false;
+  }
+
+  vector<uint8_t> binary;
+  if (!path_read_binary(filepath, binary)) {
+    return false;
+  }
+
+  const size_t header_size = sizeof(uint32_t) * 4 + NODE_NUM;
+  if (binary.size() < header_size) {
+    return false;
+  }
+
+  const uint8_t *data = binary.data();
+  uint32_t version, flags, num_attributes, num_nodes;
+  memcpy(&version, data, sizeof(version));
+  data += sizeof(version);
+  memcpy(&flags, data, sizeof(flags));
+  data += sizeof(flags);
+  memcpy(&num_attributes, data, sizeof(num_attributes));
+  data += sizeof(num_attributes);
+  memcpy(&num_nodes, data, sizeof(num_nodes));
+  data += sizeof(num_nodes);
+
+  if (version != NODE_CACHE_VERSION) {
+    return false;
+  }
+
+  const uint8_t *node_type_map = data;
+  data += NODE_NUM;
+  size_t remaining = binary.size() - header_size;
+
+  /* Validate the named attribute ids baked into the nodes. They are assigned first-come by the
+   * shader manager, so the ids of the session that wrote the cache only remain valid when this
+   * session resolves every name to the same id. Resolving them here also assigns ids to a fresh
+   * manager in the stored order, which keeps warm sessions with identical shaders on the fast
+   * path. On any mismatch the shader is recompiled, which refreshes the cache entry. */
+  for (uint32_t i = 0; i < num_attributes; i++) {
+    uint32_t name_length;
+    if (remaining < sizeof(name_length)) {
+      return false;
+    }
+    memcpy(&name_length, data, sizeof(name_length));
+    data += sizeof(name_length);
+    remaining -= sizeof(name_length);
+
+    if (remaining < name_length + sizeof(uint64_t)) {
+      return false;
+    }
+    const ustring name(string((const char *)data, name_length));
+    data += name_length;
+    remaining -= name_length;
+
+    uint64_t id;
+    memcpy(&id, data, sizeof(id));
+    data += sizeof(id);
+    remaining -= sizeof(id);
+
+    if (scene->shader_manager->get_attribute_id(name) != id) {
+      VLOG_WORK << "Attribute id mismatch for shader " << shader->name << ", recompiling.";
+      return false;
+    }
+  }
+
+  if (remaining != num_nodes * sizeof(int4)) {
+    return false;
+  }
+
+  /* Restore node type usage for kernel feature detection. */
+  for (int i = 0; i < NODE_NUM; i++) {
+    if (node_type_map[i]) {
+      svm_node_types_used[i] = true;
+    }
+  }
+
+  /* Restore shader flags which compilation would have set. */
+  shader->has_surface = (flags & NODE_CACHE_HAS_SURFACE) != 0;
+  shader->has_surface_transparent = (flags & NODE_CACHE_HAS_SURFACE_TRANSPARENT) != 0;
+  shader->has_surface_raytrace = (flags & NODE_CACHE_HAS_SURFACE_RAYTRACE) != 0;
+  shader->has_surface_bssrdf = (flags & NODE_CACHE_HAS_SURFACE_BSSRDF) != 0;
+  shader->has_bump = (flags & NODE_CACHE_HAS_BUMP) != 0;
+  shader->has_bssrdf_bump = (flags & NODE_CACHE_HAS_BSSRDF_BUMP) != 0;
+  shader->has_volume = (flags & NODE_CACHE_HAS_VOLUME) != 0;
+  shader->has_displacement = (flags & NODE_CACHE_HAS_DISPLACEMENT) != 0;
+  shader->has_surface_spatial_varying = (flags & NODE_CACHE_HAS_SURFACE_SPATIAL_VARYING) != 0;
+  shader->has_volume_spatial_varying = (flags & NODE_CACHE_HAS_VOLUME_SPATIAL_VARYING) != 0;
+  shader->has_volume_attribute_dependency = (flags & NODE_CACHE_HAS_VOLUME_ATTRIBUTE_DEPENDENCY) !=
+                                            0;
+
+  svm_nodes.resize(num_nodes);
+  memcpy(svm_nodes.data(), data, num_nodes * sizeof(int4));
+
+  VLOG_WORK << "Restored shader " << shader->name << " from node cache.";
+
+  return true;
+}
+
+void SVMCompiler::node_cache_store(const string &key, Shader *shader, const array<int4> &svm_nodes)
+{
+  uint32_t flags = 0;
+  flags |= (shader->has_surface) ? NODE_CACHE_HAS_SURFACE : 0;
+  flags |= (shader->has_surface_transparent) ? NODE_CACHE_HAS_SURFACE_TRANSPARENT : 0;
+  flags |= (shader->has_surface_raytrace) ? NODE_CACHE_HAS_SURFACE_RAYTRACE : 0;
+  flags |= (shader->has_surface_bssrdf) ? NODE_CACHE_HAS_SURFACE_BSSRDF : 0;
+  flags |= (shader->has_bump) ? NODE_CACHE_HAS_BUMP : 0;
+  flags |= (shader->has_bssrdf_bump) ? NODE_CACHE_HAS_BSSRDF_BUMP : 0;
+  flags |= (shader->has_volume) ? NODE_CACHE_HAS_VOLUME : 0;
+  flags |= (shader->has_displacement) ? NODE_CACHE_HAS_DISPLACEMENT : 0;
+  flags |= (shader->has_surface_spatial_varying) ? NODE_CACHE_HAS_SURFACE_SPATIAL_VARYING : 0;
+  flags |= (shader->has_volume_spatial_varying) ? NODE_CACHE_HAS_VOLUME_SPATIAL_VARYING : 0;
+  flags |= (shader->has_volume_attribute_dependency) ? NODE_CACHE_HAS_VOLUME_ATTRIBUTE_DEPENDENCY :
+                                                       0;
+
+  const uint32_t num_attributes = named_attributes_used.size();
+  const uint32_t num_nodes = svm_nodes.size();
+
+  size_t attributes_size = 0;
+  foreach (const auto &attr, named_attributes_used) {
+    attributes_size += sizeof(uint32_t) + attr.first.size() + sizeof(uint64_t);
+  }
+
+  vector<uint8_t> binary(sizeof(uint32_t) * 4 + NODE_NUM + attributes_size +
+                         num_nodes * sizeof(int4));
+  uint8_t *data = binary.data();
+  memcpy(data, &NODE_CACHE_VERSION, sizeof(NODE_CACHE_VERSION));
+  data += sizeof(NODE_CACHE_VERSION);
+  memcpy(data, &flags, sizeof(flags));
+  data += sizeof(flags);
+  memcpy(data, &num_attributes, sizeof(num_attributes));
+  data += sizeof(num_attributes);
+  memcpy(data, &num_nodes, sizeof(num_nodes));
+  data += sizeof(num_nodes);
+  for (int i = 0; i < NODE_NUM; i++) {
+    data[i] = node_types_used_record[i] ? 1 : 0;
+  }
+  data += NODE_NUM;
+  /* Store which id each named attribute resolved to, node_cache_load() validates these against
+   * the session that reads the cache back. */
+  foreach (const auto &attr, named_attributes_used) {
+    const uint32_t name_length = attr.first.size();
+    const uint64_t id = attr.second;
+    memcpy(data, &name_length, sizeof(name_length));
+    data += sizeof(name_length);
+    memcpy(data, attr.first.c_str(), name_length);
+    data += name_length;
+    memcpy(data, &id, sizeof(id));
+    data += sizeof(id);
+  }
+  memcpy(data, svm_nodes.data(), num_nodes * sizeof(int4));
+
+  const string filepath = node_cache_filepath(key);
+  if (!path_write_binary(filepath, binary)) {
+    VLOG_WARNING << "Failed to write shader " << shader->name << " to node cache.";
+  }
+}
+
 /* Compiler summary implementation. */
 
 SVMCompiler::Summary::Summary()
@@ -10,6 +10,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/set.h"
 #include "util/string.h"
 #include "util/thread.h"
@@ -220,7 +221,22 @@ class SVMCompiler {
   /* compile */
   void compile_type(Shader *shader, ShaderGraph *graph, ShaderType type);
 
+  /* On-disk cache of compiled node arrays, keyed by a content hash of the
+   * shader graph (see svm.cpp). */
+  string node_cache_key(Shader *shader, bool has_bump);
+  bool node_cache_load(const string &key, Shader *shader, array<int4> &svm_nodes);
+  void node_cache_store(const string &key, Shader *shader, const array<int4> &svm_nodes);
+
+  /* Mark a node type as used, both in the kernel data and in the local record
+   * of the current shader which is stored in the node cache. */
+  void set_node_type_used(ShaderNodeType type);
+
   std::atomic_int *svm_node_types_used;
+  vector<bool> node_types_used_record;
+  /* Named attribute ids resolved while compiling the current shader. These are assigned
+   * first-come by the shader manager, so the node cache stores them alongside the nodes and
+   * re-validates them against the loading session (see svm.cpp). */
+  map<ustring, uint64_t> named_attributes_used;
   array<int4> current_svm_nodes;
   ShaderType current_type;
   Shader *current_shader;
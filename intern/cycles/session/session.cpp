@@ -27,6 +27,7 @@
 #include "util/function.h"
 #include "util/log.h"
 #include "util/math.h"
+#include "util/path.h"
 #include "util/task.h"
 #include "util/time.h"
 
@@ -214,6 +215,55 @@ void Session::run_main_render_loop()
       break;
     }
   }
+
+  write_stats_json();
+}
+
+void Session::write_stats_json()
+{
+  const char *stats_dir = getenv("CYCLES_STATS_JSON_DIR");
+  if (stats_dir == nullptr || stats_dir[0] == '\0') {
+    return;
+  }
+
+  double total_time, render_time;
+  progress.get_time(total_time, render_time);
+
+  string json = "{\n";
+  json += string_printf("  \"frame\": %d,\n", stats_json_frame_number_);
+  json += string_printf("  \"total_time\": %f,\n", total_time);
+  json += string_printf("  \"render_time\": %f,\n", render_time);
+  json += string_printf("  \"mem_used\": %zu,\n", stats.mem_used);
+  json += string_printf("  \"mem_peak\": %zu,\n", stats.mem_peak);
+  json += string_printf("  \"copy_to_device_bytes\": %zu,\n", stats.copy_to_device_bytes);
+  json += string_printf("  \"copy_to_device_count\": %zu,\n", stats.copy_to_device_count);
+  json += string_printf("  \"copy_from_device_bytes\": %zu,\n", stats.copy_from_device_bytes);
+  json += string_printf("  \"copy_from_device_count\": %zu,\n", stats.copy_from_device_count);
+
+  /* Kernel times are keyed by the combination of kernels which were enqueued between
+   * synchronization points. Per-kernel granularity is achieved by additionally setting
+   * CYCLES_DEBUG_PER_KERNEL_PERFORMANCE. */
+  json += "  \"kernel_time\": {\n";
+  map<DeviceKernelMask, double> kernel_time_stats;
+  path_trace_->collect_kernel_time_stats(kernel_time_stats);
+  bool is_first = true;
+  for (const auto &[mask, time] : kernel_time_stats) {
+    if (!is_first) {
+      json += ",\n";
+    }
+    json += string_printf("    \"%s\": %f", device_kernel_mask_as_string(mask).c_str(), time);
+    is_first = false;
+  }
+  json += "\n  }\n";
+  json += "}\n";
+
+  const string filename = path_join(
+      stats_dir, string_printf("cycles_stats_%04d.json", stats_json_frame_number_));
+  if (!path_write_text(filename, json)) {
+    VLOG_WARNING << "Failed to write statistics to " << filename;
+  }
+
+  stats_json_frame_number_++;
 }
 
 void Session::thread_run()
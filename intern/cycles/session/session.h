@@ -194,6 +194,10 @@ class Session {
 
   void run_main_render_loop();
 
+  /* Write accumulated session statistics as a JSON file into the directory pointed at by the
+   * CYCLES_STATS_JSON_DIR environment variable. Does nothing when the variable is not set. */
+  void write_stats_json();
+
   bool update_scene(int width, int height);
 
   void update_status_time(bool show_pause = false, bool show_done = false);
@@ -217,6 +221,9 @@ class Session {
   bool pause_ = false;
   bool new_work_added_ = false;
 
+  /* Sequential number of the JSON statistics file written by this session. */
+  int stats_json_frame_number_ = 0;
+
   thread_condition_variable pause_cond_;
   thread_mutex pause_mutex_;
   thread_mutex tile_mutex_;
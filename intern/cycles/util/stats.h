@@ -14,7 +14,15 @@ class Stats {
  public:
   enum static_init_t { static_init = 0 };
 
-  Stats() : mem_used(0), mem_peak(0) {}
+  Stats()
+      : mem_used(0),
+        mem_peak(0),
+        copy_to_device_bytes(0),
+        copy_to_device_count(0),
+        copy_from_device_bytes(0),
+        copy_from_device_count(0)
+  {
+  }
   explicit Stats(static_init_t) {}
 
   void mem_alloc(size_t size)
@@ -29,8 +37,26 @@ class Stats {
     atomic_sub_and_fetch_z(&mem_used, size);
   }
 
+  void mem_copy_to_device(size_t size)
+  {
+    atomic_add_and_fetch_z(&copy_to_device_bytes, size);
+    atomic_add_and_fetch_z(&copy_to_device_count, 1);
+  }
+
+  void mem_copy_from_device(size_t size)
+  {
+    atomic_add_and_fetch_z(&copy_from_device_bytes, size);
+    atomic_add_and_fetch_z(&copy_from_device_count, 1);
+  }
+
   size_t mem_used;
   size_t mem_peak;
+
+  /* Cumulative counters of memory transfers between host and device. */
+  size_t copy_to_device_bytes;
+  size_t copy_to_device_count;
+  size_t copy_from_device_bytes;
+  size_t copy_from_device_count;
 };
 
 CCL_NAMESPACE_END
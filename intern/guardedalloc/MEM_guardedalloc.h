@@ -185,6 +185,32 @@ extern void (*MEM_reset_peak_memory)(void);
 /** Get the peak memory usage in bytes, including `mmap` allocations. */
 extern size_t (*MEM_get_peak_memory)(void) ATTR_WARN_UNUSED_RESULT;
 
+/**
+ * Push a named allocation domain for the current thread. Until the matching #MEM_domain_pop, all
+ * allocations made by this thread are attributed to the domain, so memory usage can be broken
+ * down by subsystem in running sessions. Pushing while another domain is active creates a child
+ * domain, forming a tree (see #MEM_printmemlist_domains).
+ *
+ * The name must be a static string, only the pointed-to characters are copied on first use.
+ *
+ * \note Per-block attribution is only recorded by the default lock-free allocator. With the
+ * guarded allocator (a debugging tool with its own per-block name tracking), pushed domains
+ * nest but report zero usage.
+ */
+void MEM_domain_push(const char *name) ATTR_NONNULL(1);
+
+/** Pop the domain pushed by the last #MEM_domain_push on this thread. */
+void MEM_domain_pop(void);
+
+/**
+ * Get the memory in use attributed to all domains with the given name (including their child
+ * domains), in bytes.
+ */
+size_t MEM_domain_memory_in_use(const char *name) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+
+/** Print the tree of allocation domains with their current memory usage. */
+void MEM_printmemlist_domains(void);
+
 #ifdef __cplusplus
 #  define MEM_SAFE_FREE(v) \
     do { \
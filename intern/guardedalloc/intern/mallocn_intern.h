@@ -117,6 +117,12 @@ size_t memory_usage_current(void);
 size_t memory_usage_peak(void);
 void memory_usage_peak_reset(void);
 
+/* Allocation domains (see MEM_domain_push). Id 0 is the implicit "untagged" domain,
+ * allocations made while it is current are not counted separately. */
+short memory_usage_domain_current(void);
+void memory_usage_domain_block_alloc(short domain, size_t size);
+void memory_usage_domain_block_free(short domain, size_t size);
+
 /**
  * Clear the listbase of allocated memory blocks.
  *
@@ -9,11 +9,14 @@
  */
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h> /* printf */
 #include <stdlib.h>
 #include <string.h> /* memcpy */
 #include <sys/types.h>
 
+#include <mutex>
+
 #include "MEM_guardedalloc.h"
 
 /* Quiet warnings when dealing with allocated data written into the blend file.
@@ -48,13 +51,31 @@ static void (*error_callback)(const char *) = nullptr;
 
 enum {
   MEMHEAD_ALIGN_FLAG = 1,
+  MEMHEAD_SLAB_FLAG = 2,
 };
 
+/* On 64 bit platforms the allocation domain id (see MEM_domain_push) is packed into the high bits
+ * of `len`, allocation sizes come nowhere near 2^48 so these bits are unused otherwise. On 32 bit
+ * platforms there is no room, so frees are not attributed back to domains there. */
+#if UINTPTR_MAX > 0xffffffff
+#  define MEMHEAD_DOMAIN_SHIFT 48
+#  define MEMHEAD_DOMAIN_MASK (size_t(0xffff) << MEMHEAD_DOMAIN_SHIFT)
+#  define MEMHEAD_DOMAIN(memhead) (short(((memhead)->len >> MEMHEAD_DOMAIN_SHIFT) & 0xffff))
+#  define MEMHEAD_DOMAIN_PACK(domain) (((size_t)(unsigned short)(domain)) << MEMHEAD_DOMAIN_SHIFT)
+#else
+#  define MEMHEAD_DOMAIN_MASK size_t(0)
+#  define MEMHEAD_DOMAIN(memhead) short(0)
+#  define MEMHEAD_DOMAIN_PACK(domain) size_t(0)
+#endif
+
 #define MEMHEAD_FROM_PTR(ptr) (((MemHead *)ptr) - 1)
 #define PTR_FROM_MEMHEAD(memhead) (memhead + 1)
 #define MEMHEAD_ALIGNED_FROM_PTR(ptr) (((MemHeadAligned *)ptr) - 1)
 #define MEMHEAD_IS_ALIGNED(memhead) ((memhead)->len & size_t(MEMHEAD_ALIGN_FLAG))
-#define MEMHEAD_LEN(memhead) ((memhead)->len & ~size_t(MEMHEAD_ALIGN_FLAG))
+#define MEMHEAD_IS_SLAB(memhead) ((memhead)->len & size_t(MEMHEAD_SLAB_FLAG))
+#define MEMHEAD_LEN(memhead) \
+  ((memhead)->len & \
+   ~(MEMHEAD_DOMAIN_MASK | size_t(MEMHEAD_ALIGN_FLAG) | size_t(MEMHEAD_SLAB_FLAG)))
 
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 2)))
@@ -75,6 +96,164 @@ print_error(const char *str, ...)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/* Slab layer for small allocations.
+ *
+ * Sub-64-byte blocks (node sockets, RNA paths, list links) cause heavy malloc/free churn on
+ * evaluation hot paths. They are carved in batches from larger slabs instead and recycled through
+ * size-segregated thread-local free lists, with a mutex protected global pool for batch
+ * refill/return. Blocks keep their regular MemHead so MEM_allocN_len and the usage counters
+ * behave exactly as for plain allocations; a spare low bit of `len` marks slab blocks so any
+ * thread can free them. Slab memory is never returned to the system, the cached blocks settle at
+ * the high-water mark of small allocation usage.
+ *
+ * The layer is bypassed under valgrind and with `--debug-memory`, where recycling would hide
+ * use-after-free errors. */
+
+#ifdef WITH_MEM_VALGRIND
+#  define USE_SLAB_ALLOC 0
+#else
+#  define USE_SLAB_ALLOC 1
+#endif
+
+#define SLAB_CLASS_STRIDE 16
+#define SLAB_CLASSES_NUM 4
+#define SLAB_MAX_LEN (SLAB_CLASS_STRIDE * SLAB_CLASSES_NUM)
+/* Number of blocks carved from a new slab, also the batch size for moving blocks between the
+ * thread-local lists and the global pool. */
+#define SLAB_BATCH_NUM 64
+/* Limit of cached blocks per class on one thread before a batch is returned to the global pool. */
+#define SLAB_LOCAL_MAX_NUM 256
+
+/* Free blocks are linked through their payload. */
+typedef struct SlabFreeBlock {
+  struct SlabFreeBlock *next;
+} SlabFreeBlock;
+static_assert(sizeof(SlabFreeBlock) <= SLAB_CLASS_STRIDE, "Slab blocks too small for free list");
+
+typedef struct SlabFreeList {
+  SlabFreeBlock *head;
+  int count;
+} SlabFreeList;
+
+static SlabFreeList slab_global_pool[SLAB_CLASSES_NUM];
+
+static std::mutex &slab_global_mutex()
+{
+  /* Leaked on purpose so the pool stays usable during static destruction. */
+  static std::mutex *mutex = new std::mutex();
+  return *mutex;
+}
+
+static int slab_class_from_len(const size_t len)
+{
+  return int((len - 1) / SLAB_CLASS_STRIDE);
+}
+
+static void slab_list_push(SlabFreeList *list, MemHead *memh)
+{
+  SlabFreeBlock *block = (SlabFreeBlock *)PTR_FROM_MEMHEAD(memh);
+  block->next = list->head;
+  list->head = block;
+  list->count++;
+}
+
+static MemHead *slab_list_pop(SlabFreeList *list)
+{
+  SlabFreeBlock *block = list->head;
+  if (block == nullptr) {
+    return nullptr;
+  }
+  list->head = block->next;
+  list->count--;
+  return MEMHEAD_FROM_PTR(block);
+}
+
+/* Move up to `num` blocks from `src` to `dst`, returns the number moved. */
+static int slab_list_transfer(SlabFreeList *dst, SlabFreeList *src, const int num)
+{
+  int moved = 0;
+  while (moved < num && src->head != nullptr) {
+    slab_list_push(dst, slab_list_pop(src));
+    moved++;
+  }
+  return moved;
+}
+
+typedef struct SlabCache {
+  SlabFreeList lists[SLAB_CLASSES_NUM];
+  /* Set when this thread is shutting down, allocations fall back to plain malloc then. */
+  bool destructed;
+
+  ~SlabCache()
+  {
+    std::lock_guard<std::mutex> lock(slab_global_mutex());
+    for (int i = 0; i < SLAB_CLASSES_NUM; i++) {
+      slab_list_transfer(&slab_global_pool[i], &lists[i], lists[i].count);
+    }
+    destructed = true;
+  }
+} SlabCache;
+
+static thread_local SlabCache slab_cache = {{{nullptr, 0}}, false};
+
+static MemHead *slab_alloc(const size_t len)
+{
+  SlabCache &cache = slab_cache;
+  if (UNLIKELY(cache.destructed)) {
+    return nullptr;
+  }
+  const int class_index = slab_class_from_len(len);
+  SlabFreeList *list = &cache.lists[class_index];
+
+  MemHead *memh = slab_list_pop(list);
+  if (LIKELY(memh != nullptr)) {
+    return memh;
+  }
+
+  /* Batch refill from the global pool. */
+  {
+    std::lock_guard<std::mutex> lock(slab_global_mutex());
+    slab_list_transfer(list, &slab_global_pool[class_index], SLAB_BATCH_NUM);
+  }
+  if (list->head != nullptr) {
+    return slab_list_pop(list);
+  }
+
+  /* Carve a new slab, the first block is returned directly. */
+  const size_t block_size = sizeof(MemHead) + size_t(class_index + 1) * SLAB_CLASS_STRIDE;
+  char *slab = (char *)malloc(block_size * SLAB_BATCH_NUM);
+  if (UNLIKELY(slab == nullptr)) {
+    return nullptr;
+  }
+  for (int i = 1; i < SLAB_BATCH_NUM; i++) {
+    slab_list_push(list, (MemHead *)(slab + size_t(i) * block_size));
+  }
+  return (MemHead *)slab;
+}
+
+static void slab_free(MemHead *memh)
+{
+  const int class_index = slab_class_from_len(MEMHEAD_LEN(memh));
+  SlabCache &cache = slab_cache;
+  if (UNLIKELY(cache.destructed)) {
+    std::lock_guard<std::mutex> lock(slab_global_mutex());
+    slab_list_push(&slab_global_pool[class_index], memh);
+    return;
+  }
+  SlabFreeList *list = &cache.lists[class_index];
+  slab_list_push(list, memh);
+  if (UNLIKELY(list->count > SLAB_LOCAL_MAX_NUM)) {
+    std::lock_guard<std::mutex> lock(slab_global_mutex());
+    slab_list_transfer(&slab_global_pool[class_index], list, SLAB_BATCH_NUM);
+  }
+}
+
+static bool slab_is_eligible(const size_t len)
+{
+  return USE_SLAB_ALLOC && len != 0 && len <= SLAB_MAX_LEN && LIKELY(!malloc_debug_memset);
+}
+
 size_t MEM_lockfree_allocN_len(const void *vmemh)
 {
   if (LIKELY(vmemh)) {
@@ -100,13 +279,20 @@ void MEM_lockfree_freeN(void *vmemh)
 
   MemHead *memh = MEMHEAD_FROM_PTR(vmemh);
   size_t len = MEMHEAD_LEN(memh);
+  const short domain = MEMHEAD_DOMAIN(memh);
 
   memory_usage_block_free(len);
+  if (UNLIKELY(domain != 0)) {
+    memory_usage_domain_block_free(domain, len);
+  }
 
   if (UNLIKELY(malloc_debug_memset && len)) {
     memset(memh + 1, 255, len);
   }
-  if (UNLIKELY(MEMHEAD_IS_ALIGNED(memh))) {
+  if (UNLIKELY(MEMHEAD_IS_SLAB(memh))) {
+    slab_free(memh);
+  }
+  else if (UNLIKELY(MEMHEAD_IS_ALIGNED(memh))) {
     MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
     aligned_free(MEMHEAD_REAL_PTR(memh_aligned));
   }
@@ -214,14 +400,25 @@ void *MEM_lockfree_recallocN_id(void *vmemh, size_t len, const char *str)
 void *MEM_lockfree_callocN(size_t len, const char *str)
 {
   MemHead *memh;
+  size_t slab_flag = 0;
 
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)calloc(1, len + sizeof(MemHead));
+  if (slab_is_eligible(len) && (memh = slab_alloc(len))) {
+    memset(PTR_FROM_MEMHEAD(memh), 0, len);
+    slab_flag = size_t(MEMHEAD_SLAB_FLAG);
+  }
+  else {
+    memh = (MemHead *)calloc(1, len + sizeof(MemHead));
+  }
 
   if (LIKELY(memh)) {
-    memh->len = len;
+    const short domain = memory_usage_domain_current();
+    memh->len = len | slab_flag | MEMHEAD_DOMAIN_PACK(domain);
     memory_usage_block_alloc(len);
+    if (UNLIKELY(domain != 0)) {
+      memory_usage_domain_block_alloc(domain, len);
+    }
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -253,13 +450,19 @@ void *MEM_lockfree_calloc_arrayN(size_t len, size_t size, const char *str)
 void *MEM_lockfree_mallocN(size_t len, const char *str)
 {
   MemHead *memh;
+  size_t slab_flag = 0;
 
 #ifdef WITH_MEM_VALGRIND
   const size_t len_unaligned = len;
 #endif
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)malloc(len + sizeof(MemHead));
+  if (slab_is_eligible(len) && (memh = slab_alloc(len))) {
+    slab_flag = size_t(MEMHEAD_SLAB_FLAG);
+  }
+  else {
+    memh = (MemHead *)malloc(len + sizeof(MemHead));
+  }
 
   if (LIKELY(memh)) {
 
@@ -277,8 +480,12 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif /* WITH_MEM_VALGRIND */
     }
 
-    memh->len = len;
+    const short domain = memory_usage_domain_current();
+    memh->len = len | slab_flag | MEMHEAD_DOMAIN_PACK(domain);
     memory_usage_block_alloc(len);
+    if (UNLIKELY(domain != 0)) {
+      memory_usage_domain_block_alloc(domain, len);
+    }
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -358,9 +565,13 @@ void *MEM_lockfree_mallocN_aligned(size_t len, size_t alignment, const char *str
 #endif /* WITH_MEM_VALGRIND */
     }
 
-    memh->len = len | size_t(MEMHEAD_ALIGN_FLAG);
+    const short domain = memory_usage_domain_current();
+    memh->len = len | size_t(MEMHEAD_ALIGN_FLAG) | MEMHEAD_DOMAIN_PACK(domain);
     memh->alignment = short(alignment);
     memory_usage_block_alloc(len);
+    if (UNLIKELY(domain != 0)) {
+      memory_usage_domain_block_alloc(domain, len);
+    }
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -273,3 +275,171 @@ void memory_usage_peak_reset()
   Global &global = get_global();
   global.peak = memory_usage_current();
 }
+
+/* -------------------------------------------------------------------- */
+/* Allocation domains.
+ *
+ * Domains form a tree: pushing a domain while another one is active on the same thread registers
+ * it as a child. Registration only happens on the first push of a (parent, name) pair, after that
+ * pushing is a thread-local write. Per-domain counters are plain global atomics: unlike the
+ * per-block counters above they are only touched while a domain is explicitly pushed, so the
+ * common untagged allocation path stays free of shared-cache-line traffic. */
+
+namespace {
+
+/** Arbitrary but more than enough for per-subsystem tagging, ids are packed into 16 bits of the
+ * lock-free allocator's MemHead. */
+constexpr int domains_max = 256;
+constexpr int domain_name_max = 64;
+constexpr int domain_stack_max = 16;
+
+struct DomainInfo {
+  char name[domain_name_max];
+  /** Index of the parent domain, 0 for top-level domains. */
+  short parent;
+};
+
+/**
+ * Thread local stack of pushed domains. Trivially destructible on purpose, so that allocations
+ * during thread shutdown (after thread-locals are destructed) safely read an empty stack.
+ */
+struct DomainStack {
+  short stack[domain_stack_max];
+  /** May exceed #domain_stack_max, deeper pushes keep attributing to the deepest stored domain. */
+  int depth;
+};
+
+}  // namespace
+
+static std::mutex domains_mutex;
+/* Index 0 is reserved for the implicit "untagged" domain. Guarded by #domains_mutex. */
+static DomainInfo domains[domains_max];
+static int domains_num = 1;
+
+static std::atomic<int64_t> domain_mem_in_use[domains_max];
+static std::atomic<int64_t> domain_blocks_num[domains_max];
+
+static thread_local DomainStack domain_stack = {{0}, 0};
+
+short memory_usage_domain_current()
+{
+  const DomainStack &stack = domain_stack;
+  if (LIKELY(stack.depth == 0)) {
+    return 0;
+  }
+  return stack.stack[std::min(stack.depth, domain_stack_max) - 1];
+}
+
+void memory_usage_domain_block_alloc(const short domain, const size_t size)
+{
+  domain_blocks_num[domain].fetch_add(1, std::memory_order_relaxed);
+  domain_mem_in_use[domain].fetch_add(int64_t(size), std::memory_order_relaxed);
+}
+
+void memory_usage_domain_block_free(const short domain, const size_t size)
+{
+  domain_blocks_num[domain].fetch_sub(1, std::memory_order_relaxed);
+  domain_mem_in_use[domain].fetch_sub(int64_t(size), std::memory_order_relaxed);
+}
+
+static short domain_id_ensure(const char *name, const short parent)
+{
+  std::lock_guard lock{domains_mutex};
+  for (int i = 1; i < domains_num; i++) {
+    if (domains[i].parent == parent && std::strncmp(domains[i].name, name, domain_name_max) == 0)
+    {
+      return short(i);
+    }
+  }
+  if (domains_num == domains_max) {
+    /* Out of domain ids, attribute to the parent instead of losing the allocations. */
+    return parent;
+  }
+  DomainInfo &info = domains[domains_num];
+  std::strncpy(info.name, name, domain_name_max - 1);
+  info.name[domain_name_max - 1] = '\0';
+  info.parent = parent;
+  return short(domains_num++);
+}
+
+void MEM_domain_push(const char *name)
+{
+  DomainStack &stack = domain_stack;
+  if (stack.depth < domain_stack_max) {
+    stack.stack[stack.depth] = domain_id_ensure(name, memory_usage_domain_current());
+  }
+  stack.depth++;
+}
+
+void MEM_domain_pop()
+{
+  DomainStack &stack = domain_stack;
+  assert(stack.depth > 0);
+  if (stack.depth > 0) {
+    stack.depth--;
+  }
+}
+
+size_t MEM_domain_memory_in_use(const char *name)
+{
+  std::lock_guard lock{domains_mutex};
+  int64_t mem_in_use = 0;
+  for (int i = 1; i < domains_num; i++) {
+    /* Match when the domain itself or any ancestor has the given name,
+     * so child domains are included. */
+    for (int id = i; id != 0; id = domains[id].parent) {
+      if (std::strncmp(domains[id].name, name, domain_name_max) == 0) {
+        mem_in_use += domain_mem_in_use[i].load(std::memory_order_relaxed);
+        break;
+      }
+    }
+  }
+  return size_t(std::max<int64_t>(mem_in_use, 0));
+}
+
+static int64_t domain_print_recursive(const int id, const int indent)
+{
+  int64_t mem_subtree = domain_mem_in_use[id].load(std::memory_order_relaxed);
+  const int64_t blocks = domain_blocks_num[id].load(std::memory_order_relaxed);
+  const int64_t mem_self = mem_subtree;
+
+  for (int i = 1; i < domains_num; i++) {
+    if (domains[i].parent == id && i != id) {
+      mem_subtree += domain_print_recursive(i, indent + 2);
+    }
+  }
+
+  if (id != 0) {
+    printf("%*s%-*s %12.3f MB (self %.3f MB in %lld blocks)\n",
+           indent,
+           "",
+           domain_name_max / 2 - indent,
+           domains[id].name,
+           double(mem_subtree) / double(1024 * 1024),
+           double(mem_self) / double(1024 * 1024),
+           (long long)blocks);
+  }
+  return mem_subtree;
+}
+
+void MEM_printmemlist_domains()
+{
+  std::lock_guard lock{domains_mutex};
+  const int64_t mem_total = int64_t(memory_usage_current());
+
+  printf("Memory usage by domain:\n");
+  int64_t mem_tagged = 0;
+  for (int i = 1; i < domains_num; i++) {
+    if (domains[i].parent == 0) {
+      mem_tagged += domain_print_recursive(i, 2);
+    }
+  }
+  printf("  %-*s %12.3f MB\n",
+         domain_name_max / 2 - 2,
+         "<untagged>",
+         double(mem_total - mem_tagged) / double(1024 * 1024));
+  printf("  %-*s %12.3f MB\n",
+         domain_name_max / 2 - 2,
+         "<total>",
+         double(mem_total) / double(1024 * 1024));
+}
@@ -0,0 +1,40 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "guardedalloc_test_base.h"
+
+TEST_F(LockFreeAllocatorTest, DomainAttribution)
+{
+  MEM_domain_push("test_domain_a");
+  void *mem_a = MEM_mallocN(1024, "mem_a");
+
+  /* Nested push creates a child domain, its usage counts towards the parent too. */
+  MEM_domain_push("test_domain_b");
+  void *mem_b = MEM_mallocN(2048, "mem_b");
+  MEM_domain_pop();
+
+  MEM_domain_pop();
+
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_a"), 1024 + 2048);
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_b"), 2048);
+
+  /* Frees are attributed to the domain that allocated the block,
+   * not to whatever domain is active when freeing. */
+  MEM_freeN(mem_b);
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_a"), 1024);
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_b"), 0);
+
+  MEM_freeN(mem_a);
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_a"), 0);
+}
+
+TEST_F(LockFreeAllocatorTest, DomainUnbalancedQuery)
+{
+  /* A name that was never pushed reports no usage. */
+  EXPECT_EQ(MEM_domain_memory_in_use("test_domain_never_pushed"), 0);
+}
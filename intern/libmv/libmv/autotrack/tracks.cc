@@ -30,22 +30,41 @@
 
 namespace mv {
 
+namespace {
+
+std::tuple<int, int, int> MarkerKey(int clip, int frame, int track) {
+  return std::make_tuple(clip, frame, track);
+}
+
+std::tuple<int, int, int> MarkerKey(const Marker& marker) {
+  return MarkerKey(marker.clip, marker.frame, marker.track);
+}
+
+}  // namespace
+
 Tracks::Tracks(const Tracks& other) {
   markers_ = other.markers_;
+  marker_index_ = other.marker_index_;
 }
 
 Tracks::Tracks(const vector<Marker>& markers) : markers_(markers) {
+  RebuildMarkerIndex();
 }
 
-bool Tracks::GetMarker(int clip, int frame, int track, Marker* marker) const {
+void Tracks::RebuildMarkerIndex() {
+  marker_index_.clear();
   for (int i = 0; i < markers_.size(); ++i) {
-    if (markers_[i].clip == clip && markers_[i].frame == frame &&
-        markers_[i].track == track) {
-      *marker = markers_[i];
-      return true;
-    }
+    marker_index_[MarkerKey(markers_[i])] = i;
   }
-  return false;
+}
+
+bool Tracks::GetMarker(int clip, int frame, int track, Marker* marker) const {
+  const auto it = marker_index_.find(MarkerKey(clip, frame, track));
+  if (it == marker_index_.end()) {
+    return false;
+  }
+  *marker = markers_[it->second];
+  return true;
 }
 
 void Tracks::GetMarkersForTrack(int track, vector<Marker>* markers) const {
@@ -118,33 +137,34 @@ void Tracks::GetMarkersForTracksInBothImages(int clip1,
 }
 
 void Tracks::AddMarker(const Marker& marker) {
-  // TODO(keir): This is quadratic for repeated insertions. Fix this by adding
-  // a smarter data structure like a set<>.
-  for (int i = 0; i < markers_.size(); ++i) {
-    if (markers_[i].clip == marker.clip && markers_[i].frame == marker.frame &&
-        markers_[i].track == marker.track) {
-      markers_[i] = marker;
-      return;
-    }
+  const auto it = marker_index_.find(MarkerKey(marker));
+  if (it != marker_index_.end()) {
+    markers_[it->second] = marker;
+    return;
   }
+  marker_index_[MarkerKey(marker)] = markers_.size();
   markers_.push_back(marker);
 }
 
 void Tracks::SetMarkers(vector<Marker>* markers) {
   std::swap(markers_, *markers);
+  RebuildMarkerIndex();
 }
 
 bool Tracks::RemoveMarker(int clip, int frame, int track) {
-  int size = markers_.size();
-  for (int i = 0; i < markers_.size(); ++i) {
-    if (markers_[i].clip == clip && markers_[i].frame == frame &&
-        markers_[i].track == track) {
-      markers_[i] = markers_[size - 1];
-      markers_.resize(size - 1);
-      return true;
-    }
+  const auto it = marker_index_.find(MarkerKey(clip, frame, track));
+  if (it == marker_index_.end()) {
+    return false;
+  }
+  const int index = it->second;
+  const int size = markers_.size();
+  marker_index_.erase(it);
+  if (index != size - 1) {
+    markers_[index] = markers_[size - 1];
+    marker_index_[MarkerKey(markers_[index])] = index;
   }
-  return false;
+  markers_.resize(size - 1);
+  return true;
 }
 
 void Tracks::RemoveMarkersForTrack(int track) {
@@ -155,6 +175,7 @@ void Tracks::RemoveMarkersForTrack(int track) {
     }
   }
   markers_.resize(size);
+  RebuildMarkerIndex();
 }
 
 int Tracks::MaxClip() const {
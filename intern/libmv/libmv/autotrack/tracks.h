@@ -23,6 +23,9 @@
 #ifndef LIBMV_AUTOTRACK_TRACKS_H_
 #define LIBMV_AUTOTRACK_TRACKS_H_
 
+#include <map>
+#include <tuple>
+
 #include "libmv/autotrack/marker.h"
 #include "libmv/base/vector.h"
 
@@ -73,10 +76,17 @@ class Tracks {
   const vector<Marker>& markers() const { return markers_; }
 
  private:
+  void RebuildMarkerIndex();
+
   vector<Marker> markers_;
 
-  // TODO(keir): Consider adding access-map data structures to avoid all the
-  // linear lookup penalties for the accessors.
+  // Maps (clip, frame, track) to the marker's index in markers_, so that
+  // marker lookup and insertion don't degrade to linear scans as the number
+  // of tracked markers grows over long frame ranges.
+  std::map<std::tuple<int, int, int>, int> marker_index_;
+
+  // TODO(keir): Consider adding access-map data structures to avoid the
+  // linear lookup penalties for the remaining accessors.
 };
 
 }  // namespace mv
@@ -42,6 +42,7 @@
  */
 
 #include "MEM_Allocator.h"
+#include <algorithm>
 #include <list>
 #include <queue>
 #include <vector>
@@ -193,15 +194,46 @@ template<class T> class MEM_CacheLimiter {
       return;
     }
 
-    while (!queue.empty() && mem_in_use > max) {
-      MEM_CacheElementPtr elem = get_least_priority_destroyable_element();
+    /* Gather all destroyable elements together with their priority and size
+     * in a single pass. Evicting one element at a time re-scanned the whole
+     * queue for the next least priority element, which made trimming the
+     * cache after a large insert quadratic in the number of cached items.
+     * Priorities only depend on the items themselves, so collecting them
+     * once gives the same eviction order. */
+    std::vector<EvictionCandidate, MEM_Allocator<EvictionCandidate>> candidates;
+    candidates.reserve(queue.size());
 
-      if (!elem) {
-        break;
+    int i;
+    for (i = 0; i < queue.size(); i++) {
+      MEM_CacheElementPtr elem = queue[i];
+
+      if (!can_destroy_element(elem)) {
+        continue;
       }
 
+      EvictionCandidate candidate;
+      /* By default 0 means highest priority element. */
+      /* Casting a size type to int is questionable,
+       * but unlikely to cause problems. */
+      candidate.priority = -((int)(queue.size()) - i - 1);
+      if (item_priority_func) {
+        candidate.priority = item_priority_func(elem->get()->get_data(), candidate.priority);
+      }
+      candidate.size = data_size_func ? data_size_func(elem->get()->get_data()) : 0;
+      candidate.elem = elem;
+      candidates.push_back(candidate);
+    }
+
+    /* Evict lowest priority elements first; among equal priorities prefer
+     * the largest element, so fewer items need to be destroyed to get back
+     * under the limit. */
+    std::stable_sort(candidates.begin(), candidates.end());
+
+    for (i = 0; i < candidates.size() && mem_in_use > max; i++) {
+      MEM_CacheElementPtr elem = candidates[i].elem;
+
       if (data_size_func) {
-        cur_size = data_size_func(elem->get()->get_data());
+        cur_size = candidates[i].size;
       }
       else {
         cur_size = mem_in_use;
@@ -263,50 +295,20 @@ template<class T> class MEM_CacheLimiter {
     return true;
   }
 
-  MEM_CacheElementPtr get_least_priority_destroyable_element(void)
-  {
-    if (queue.empty()) {
-      return NULL;
-    }
-
-    MEM_CacheElementPtr best_match_elem = NULL;
+  /* Element scheduled for destruction by enforce_limits(). */
+  struct EvictionCandidate {
+    int priority;
+    size_t size;
+    MEM_CacheElementPtr elem;
 
-    if (!item_priority_func) {
-      for (iterator it = queue.begin(); it != queue.end(); it++) {
-        MEM_CacheElementPtr elem = *it;
-        if (!can_destroy_element(elem)) {
-          continue;
-        }
-        best_match_elem = elem;
-        break;
+    bool operator<(const EvictionCandidate &other) const
+    {
+      if (priority != other.priority) {
+        return priority < other.priority;
       }
+      return size > other.size;
     }
-    else {
-      int best_match_priority = 0;
-      int i;
-
-      for (i = 0; i < queue.size(); i++) {
-        MEM_CacheElementPtr elem = queue[i];
-
-        if (!can_destroy_element(elem)) {
-          continue;
-        }
-
-        /* By default 0 means highest priority element. */
-        /* Casting a size type to int is questionable,
-         * but unlikely to cause problems. */
-        int priority = -((int)(queue.size()) - i - 1);
-        priority = item_priority_func(elem->get()->get_data(), priority);
-
-        if (priority < best_match_priority || best_match_elem == NULL) {
-          best_match_priority = priority;
-          best_match_elem = elem;
-        }
-      }
-    }
-
-    return best_match_elem;
-  }
+  };
 
   MEM_CacheQueue queue;
   MEM_CacheLimiter_DataSize_Func data_size_func;
@@ -45,12 +45,16 @@
 #include "LinearMath/btConvexHullComputer.h"
 #include "LinearMath/btMatrix3x3.h"
 #include "LinearMath/btScalar.h"
+#include "LinearMath/btThreads.h"
 #include "LinearMath/btTransform.h"
 #include "LinearMath/btVector3.h"
 
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
 #include "BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h"
 #include "BulletCollision/Gimpact/btGImpactCollisionAlgorithm.h"
 #include "BulletCollision/Gimpact/btGImpactShape.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
 
 struct rbDynamicsWorld {
   btDiscreteDynamicsWorld *dynamicsWorld;
@@ -58,6 +62,8 @@ struct rbDynamicsWorld {
   btDispatcher *dispatcher;
   btBroadphaseInterface *pairCache;
   btConstraintSolver *constraintSolver;
+  /* Only used by the multi-threaded world, for islands too large for the solver pool. */
+  btConstraintSolver *constraintSolverMt;
   btOverlapFilterCallback *filterCallback;
 };
 struct rbRigidBody {
@@ -125,10 +131,23 @@ rbDynamicsWorld *RB_dworld_new(const float gravity[3])
 {
   rbDynamicsWorld *world = new rbDynamicsWorld;
 
+  /* Threaded dispatch needs a task scheduler, shared by all worlds. When Bullet
+   * is built without BT_THREADSAFE no scheduler is available (the create
+   * function returns NULL) and the single threaded world is used instead. */
+  if (btGetTaskScheduler() == NULL) {
+    btSetTaskScheduler(btCreateDefaultTaskScheduler());
+  }
+  const bool threaded = (btGetTaskScheduler() != NULL);
+
   /* collision detection/handling */
   world->collisionConfiguration = new btDefaultCollisionConfiguration();
 
-  world->dispatcher = new btCollisionDispatcher(world->collisionConfiguration);
+  if (threaded) {
+    world->dispatcher = new btCollisionDispatcherMt(world->collisionConfiguration);
+  }
+  else {
+    world->dispatcher = new btCollisionDispatcher(world->collisionConfiguration);
+  }
   btGImpactCollisionAlgorithm::registerAlgorithm((btCollisionDispatcher *)world->dispatcher);
 
   world->pairCache = new btDbvtBroadphase();
@@ -136,12 +155,33 @@ rbDynamicsWorld *RB_dworld_new(const float gravity[3])
   world->filterCallback = new rbFilterCallback();
   world->pairCache->getOverlappingPairCache()->setOverlapFilterCallback(world->filterCallback);
 
-  /* constraint solving */
-  world->constraintSolver = new btSequentialImpulseConstraintSolver();
+  /* constraint solving & world */
+  if (threaded) {
+    /* Independent simulation islands are solved in parallel, each by one
+     * solver from the pool. Islands too large to wait for each other share
+     * the multi-threaded solver, which solves constraint batches within the
+     * island in parallel. */
+    const int num_solvers = btMin(int(btGetTaskScheduler()->getNumThreads()),
+                                  int(BT_MAX_THREAD_COUNT));
+    btConstraintSolverPoolMt *solverPool = new btConstraintSolverPoolMt(num_solvers);
+    world->constraintSolver = solverPool;
+    world->constraintSolverMt = new btSequentialImpulseConstraintSolverMt();
+
+    world->dynamicsWorld = new btDiscreteDynamicsWorldMt(world->dispatcher,
+                                                         world->pairCache,
+                                                         solverPool,
+                                                         world->constraintSolverMt,
+                                                         world->collisionConfiguration);
+  }
+  else {
+    world->constraintSolver = new btSequentialImpulseConstraintSolver();
+    world->constraintSolverMt = NULL;
 
-  /* world */
-  world->dynamicsWorld = new btDiscreteDynamicsWorld(
-      world->dispatcher, world->pairCache, world->constraintSolver, world->collisionConfiguration);
+    world->dynamicsWorld = new btDiscreteDynamicsWorld(world->dispatcher,
+                                                       world->pairCache,
+                                                       world->constraintSolver,
+                                                       world->collisionConfiguration);
+  }
 
   RB_dworld_set_gravity(world, gravity);
 
@@ -152,6 +192,7 @@ void RB_dworld_delete(rbDynamicsWorld *world)
 {
   /* bullet doesn't like if we free these in a different order */
   delete world->dynamicsWorld;
+  delete world->constraintSolverMt;
   delete world->constraintSolver;
   delete world->pairCache;
   delete world->dispatcher;
@@ -403,6 +403,8 @@ class TOPBAR_MT_blender_system(Menu):
         layout.separator()
 
         layout.operator("wm.memory_statistics")
+        layout.operator("wm.trace_record_toggle")
+        layout.operator("wm.trace_dump")
         layout.operator("wm.debug_menu")
         layout.operator_menu_enum("wm.redraw_timer", "type")
 
@@ -753,6 +753,7 @@ class USERPREF_PT_system_memory(SystemPanel, CenterAlignMixIn, Panel):
         col = layout.column()
         col.prop(system, "texture_time_out", text="Texture Time Out")
         col.prop(system, "texture_collection_rate", text="Garbage Collection Rate")
+        col.prop(system, "gpu_texture_budget", text="GPU Texture Budget (MB)")
 
         layout.separator()
 
@@ -534,16 +534,21 @@ static SingleKeyingResult insert_keyframe_fcurve_value(Main *bmain,
                                                        const float fcurve_frame,
                                                        float curval,
                                                        eBezTriple_KeyframeType keytype,
-                                                       eInsertKeyFlags flag)
+                                                       eInsertKeyFlags flag,
+                                                       FCurve *existing_fcu = nullptr)
 {
   /* Make sure the F-Curve exists.
    * - if we're replacing keyframes only, DO NOT create new F-Curves if they do not exist yet
    *   but still try to get the F-Curve if it exists...
+   * Callers keying several indices of one path can pass a pre-found curve to avoid searching
+   * the whole channel list once per index.
    */
   const bool can_create_curve = (flag & (INSERTKEY_REPLACE | INSERTKEY_AVAILABLE)) == 0;
-  FCurve *fcu = can_create_curve ?
-                    action_fcurve_ensure(bmain, act, group, ptr, rna_path, array_index) :
-                    action_fcurve_find(act, rna_path, array_index);
+  FCurve *fcu = existing_fcu;
+  if (fcu == nullptr) {
+    fcu = can_create_curve ? action_fcurve_ensure(bmain, act, group, ptr, rna_path, array_index) :
+                             action_fcurve_find(act, rna_path, array_index);
+  }
 
   /* We may not have a F-Curve when we're replacing only. */
   if (!fcu) {
@@ -624,6 +629,20 @@ CombinedKeyingResult insert_keyframe(Main *bmain,
                                         &force_all,
                                         successful_remaps);
 
+  /* Find the F-Curves of all array indices in a single pass over the channel list, instead of
+   * one list search per index (which is quadratic when keying every channel of a character). */
+  Vector<FCurve *> existing_fcurves(values.size(), nullptr);
+  LISTBASE_FOREACH (FCurve *, fcu, &act->curves) {
+    if (fcu->rna_path == nullptr || !STREQ(fcu->rna_path, rna_path)) {
+      continue;
+    }
+    if (fcu->array_index >= 0 && fcu->array_index < existing_fcurves.size() &&
+        existing_fcurves[fcu->array_index] == nullptr)
+    {
+      existing_fcurves[fcu->array_index] = fcu;
+    }
+  }
+
   /* Key the entire array. */
   int key_count = 0;
   if (array_index == -1 || force_all) {
@@ -645,7 +664,8 @@ CombinedKeyingResult insert_keyframe(Main *bmain,
                                                                        nla_mapped_frame,
                                                                        values[array_index],
                                                                        keytype,
-                                                                       flag);
+                                                                       flag,
+                                                                       existing_fcurves[array_index]);
         combined_result.add(result);
         if (result == SingleKeyingResult::SUCCESS) {
           key_count++;
@@ -673,7 +693,8 @@ CombinedKeyingResult insert_keyframe(Main *bmain,
                                                                            nla_mapped_frame,
                                                                            values[array_index],
                                                                            keytype,
-                                                                           flag);
+                                                                           flag,
+                                                                           existing_fcurves[array_index]);
             combined_result.add(result);
             if (result == SingleKeyingResult::SUCCESS) {
               key_count++;
@@ -699,7 +720,8 @@ CombinedKeyingResult insert_keyframe(Main *bmain,
                                                                        nla_mapped_frame,
                                                                        values[array_index],
                                                                        keytype,
-                                                                       flag);
+                                                                       flag,
+                                                                       existing_fcurves[array_index]);
         combined_result.add(result);
         if (result == SingleKeyingResult::SUCCESS) {
           key_count++;
@@ -720,7 +742,8 @@ CombinedKeyingResult insert_keyframe(Main *bmain,
                                                                      nla_mapped_frame,
                                                                      values[array_index],
                                                                      keytype,
-                                                                     flag);
+                                                                     flag,
+                                                                     existing_fcurves[array_index]);
       combined_result.add(result);
       if (result == SingleKeyingResult::SUCCESS) {
         key_count++;
@@ -20,9 +20,15 @@
  * \endcode
  */
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <fcntl.h>
 #ifndef WIN32
@@ -89,10 +95,82 @@ static eThumbStatus extract_png_from_blend_file(const char *src_blend, const cha
   return err;
 }
 
+/**
+ * Extract thumbnails for a manifest of blend files, one `<input.blend>\t<output.png>` pair per
+ * line (`-` reads the manifest from stdin). Entries are processed concurrently so large asset
+ * libraries can be indexed without one process invocation per file.
+ * Returns the number of failed entries (clamped to 255), failures are reported on stderr.
+ */
+static int extract_png_from_blend_file_batch(const char *manifest_path)
+{
+  std::vector<std::pair<std::string, std::string>> entries;
+  std::ifstream manifest_file;
+  if (!STREQ(manifest_path, "-")) {
+    manifest_file.open(manifest_path);
+    if (!manifest_file.is_open()) {
+      std::cerr << "Unable to open manifest: " << manifest_path << std::endl;
+      return -1;
+    }
+  }
+  std::istream &manifest = manifest_file.is_open() ? manifest_file : std::cin;
+
+  std::string line;
+  while (std::getline(manifest, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    const size_t sep = line.find('\t');
+    if (sep == std::string::npos || sep == 0 || sep + 1 == line.size()) {
+      std::cerr << "Skipping malformed manifest line: " << line << std::endl;
+      continue;
+    }
+    entries.emplace_back(line.substr(0, sep), line.substr(sep + 1));
+  }
+
+  /* Extraction is short seeks & reads, a modest thread count saturates the file-system. */
+  const uint threads_num = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+  std::atomic<size_t> next_entry = 0;
+  std::atomic<int> fail_count = 0;
+
+  std::vector<std::thread> threads;
+  threads.reserve(threads_num);
+  for (uint i = 0; i < threads_num; i++) {
+    threads.emplace_back([&]() {
+      while (true) {
+        const size_t entry_index = next_entry.fetch_add(1);
+        if (entry_index >= entries.size()) {
+          break;
+        }
+        const auto &entry = entries[entry_index];
+        const eThumbStatus err = extract_png_from_blend_file(entry.first.c_str(),
+                                                             entry.second.c_str());
+        if (err != BT_OK) {
+          std::cerr << "Failed to extract thumbnail (" << int(err) << "): " << entry.first
+                    << std::endl;
+          fail_count.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  return std::min(fail_count.load(), 255);
+}
+
 int main(int argc, char *argv[])
 {
+  if (argc == 3 && STREQ(argv[1], "--batch")) {
+    return extract_png_from_blend_file_batch(argv[2]);
+  }
+
   if (argc < 3) {
-    std::cerr << "Usage: blender-thumbnailer <input.blend> <output.png>" << std::endl;
+    std::cerr << "Usage: blender-thumbnailer <input.blend> <output.png>\n"
+                 "       blender-thumbnailer --batch <manifest>\n"
+                 "The manifest holds one '<input.blend>\\t<output.png>' pair per line,\n"
+                 "'-' reads it from stdin."
+              << std::endl;
     return -1;
   }
 
@@ -271,6 +271,11 @@ void BKE_animsys_nla_remap_keyframe_values(struct NlaKeyframingContext *context,
  */
 void BKE_animsys_free_nla_keyframing_context_cache(struct ListBase *cache);
 
+/**
+ * Discard the compiled NLA plan cached for this AnimData (called when it is freed).
+ */
+void BKE_animsys_nla_plan_free(const struct AnimData *adt);
+
 /* ************************************* */
 /* Evaluation API */
 
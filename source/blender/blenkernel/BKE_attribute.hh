@@ -431,6 +431,13 @@ struct AttributeAccessorFunctions {
   int (*domain_size)(const void *owner, AttrDomain domain);
   bool (*is_builtin)(const void *owner, const AttributeIDRef &attribute_id);
   GAttributeReader (*lookup)(const void *owner, const AttributeIDRef &attribute_id);
+  /**
+   * Resolve multiple attributes with a single pass over the underlying storage where possible.
+   * May be null, in which case the attributes are looked up one by one.
+   */
+  void (*lookup_many)(const void *owner,
+                      Span<AttributeIDRef> attribute_ids,
+                      MutableSpan<GAttributeReader> r_attributes);
   GVArray (*adapt_domain)(const void *owner,
                           const GVArray &varray,
                           AttrDomain from_domain,
@@ -527,6 +534,14 @@ class AttributeAccessor {
     return fn_->lookup(owner_, attribute_id);
   }
 
+  /**
+   * Get read-only access to multiple attributes at once. This can be faster than separate
+   * #lookup calls because attributes stored together (e.g. in the same #CustomData) are resolved
+   * with a single pass over the storage. The result has the same size and order as
+   * \a attribute_ids; entries for attributes that don't exist are empty.
+   */
+  Vector<GAttributeReader> lookup_many(Span<AttributeIDRef> attribute_ids) const;
+
   /**
    * Get read-only access to the attribute. If necessary, the attribute is interpolated to the
    * given domain, and converted to the given type, in that order.  The result may be empty.
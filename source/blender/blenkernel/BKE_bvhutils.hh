@@ -181,6 +181,12 @@ void free_bvhtree_from_pointcloud(BVHTreeFromPointCloud *data);
 
 bool bvhcache_has_tree(const BVHCache *bvh_cache, const BVHTree *tree);
 BVHCache *bvhcache_init();
+/**
+ * Tell the BVH cache that the vertex positions of the mesh changed. The cached trees are kept
+ * when the change is detectable through the implicit-sharing version of the position data, so
+ * they can be refitted in place on the next lookup; otherwise they are discarded.
+ */
+void bvhcache_tag_positions_changed(const Mesh &mesh);
 /**
  * Frees a BVH-cache.
  */
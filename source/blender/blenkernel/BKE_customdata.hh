@@ -538,6 +538,15 @@ int CustomData_get_named_layer_index(const CustomData *data,
                                      eCustomDataType type,
                                      blender::StringRef name);
 int CustomData_get_named_layer_index_notype(const CustomData *data, blender::StringRef name);
+/**
+ * Find the layer indices of multiple named layers of the same type at once (-1 for layers that
+ * don't exist). For more than a handful of names this builds a temporary name to index map over
+ * the layers of the type, making it much cheaper than separate lookups when many layers exist.
+ */
+void CustomData_get_named_layer_indices(const CustomData *data,
+                                        eCustomDataType type,
+                                        blender::Span<blender::StringRef> names,
+                                        blender::MutableSpan<int> r_indices);
 int CustomData_get_active_layer_index(const CustomData *data, eCustomDataType type);
 int CustomData_get_render_layer_index(const CustomData *data, eCustomDataType type);
 int CustomData_get_clone_layer_index(const CustomData *data, eCustomDataType type);
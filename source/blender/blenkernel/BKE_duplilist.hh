@@ -8,9 +8,10 @@
  * \ingroup bke
  */
 
+#include "BLI_vector.hh"
+
 struct Depsgraph;
 struct ID;
-struct ListBase;
 struct Object;
 struct ParticleSystem;
 struct Scene;
@@ -23,21 +24,7 @@ struct GeometrySet;
 /* ---------------------------------------------------- */
 /* Dupli-Geometry */
 
-/**
- * \return a #ListBase of #DupliObject.
- */
-ListBase *object_duplilist(Depsgraph *depsgraph, Scene *sce, Object *ob);
-/**
- * \return a #ListBase of #DupliObject for the preview geometry referenced by the #ViewerPath.
- */
-ListBase *object_duplilist_preview(Depsgraph *depsgraph,
-                                   Scene *scene,
-                                   Object *ob,
-                                   const ViewerPath *viewer_path);
-void free_object_duplilist(ListBase *lb);
-
 struct DupliObject {
-  DupliObject *next, *prev;
   /* Object whose geometry is instanced. */
   Object *ob;
   /* Data owned by the object above that is instanced. This might not be the same as `ob->data`. */
@@ -74,6 +61,26 @@ struct DupliObject {
   unsigned int random_id;
 };
 
+/**
+ * Flat container for generated instances, replaces per-instance allocation through #ListBase.
+ * Pointers into the vector stay valid as long as it is not resized.
+ */
+using DupliList = blender::Vector<DupliObject>;
+
+/**
+ * Fill \a r_duplilist with a #DupliObject for every instance generated by \a ob.
+ */
+void object_duplilist(Depsgraph *depsgraph, Scene *sce, Object *ob, DupliList &r_duplilist);
+/**
+ * Fill \a r_duplilist with a #DupliObject for every instance of the preview geometry referenced
+ * by the #ViewerPath.
+ */
+void object_duplilist_preview(Depsgraph *depsgraph,
+                              Scene *scene,
+                              Object *ob,
+                              const ViewerPath *viewer_path,
+                              DupliList &r_duplilist);
+
 /**
  * Look up the RGBA value of a uniform shader attribute.
  * \return true if the attribute was found; if not, r_value is also set to zero.
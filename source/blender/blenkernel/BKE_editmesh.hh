@@ -21,6 +21,7 @@
 
 #include "bmesh.hh"
 
+struct BMEditMeshBVHCache;
 struct BMLoop;
 struct BMPartialUpdate;
 struct BMesh;
@@ -59,6 +60,12 @@ struct BMEditMesh {
   /** Temp variables for x-mirror editing (-1 when the layer does not exist). */
   int mirror_cdlayer;
 
+  /**
+   * Lazily built spatial index shared by interactive tools,
+   * see #BKE_editmesh_bvh_cache_get. Never read directly.
+   */
+  BMEditMeshBVHCache *bvh_cache = nullptr;
+
   /**
    * ID data is older than edit-mode data.
    * Set #Main.is_memfile_undo_flush_needed when enabling.
@@ -41,6 +41,28 @@ BMBVHTree *BKE_bmbvh_new(struct BMesh *bm,
 void BKE_bmbvh_free(BMBVHTree *tree);
 struct BVHTree *BKE_bmbvh_tree_get(BMBVHTree *tree);
 
+/**
+ * Refit the bounding volumes to the current vertex coordinates without rebuilding the tree.
+ * Only valid for trees whose leaves map 1:1 onto the looptris (built without a face filter).
+ */
+void BKE_bmbvh_refit(BMBVHTree *tree);
+
+/**
+ * Return a BVH over the edit-mesh looptris that persists across tool invocations, owned by
+ * \a em. The cached tree is rebuilt when the topology or the tessellation changed and refitted
+ * to the current vertex coordinates otherwise, so repeated lookups (knife, snapping) avoid
+ * paying a full rebuild each time.
+ *
+ * \note \a flag must not contain #BMBVH_RESPECT_SELECT or #BMBVH_RESPECT_HIDDEN: selection and
+ * hiding can change without anything this cache can detect, such trees cannot be reused safely.
+ * The returned tree remains owned by \a em, don't free it.
+ */
+BMBVHTree *BKE_editmesh_bvh_cache_get(struct BMEditMesh *em, int flag);
+/**
+ * Free the cached tree (if it exists), called when the edit-mesh is freed.
+ */
+void BKE_editmesh_bvh_cache_free(struct BMEditMesh *em);
+
 struct BMFace *BKE_bmbvh_ray_cast(BMBVHTree *tree,
                                   const float co[3],
                                   const float dir[3],
@@ -69,6 +69,13 @@ class DrawingRuntime {
    * and remove a drawing if it has zero users.
    */
   mutable std::atomic<int> user_count = 1;
+
+  /**
+   * Version counter for the geometry of this drawing, incremented whenever the strokes are
+   * tagged changed. Allows the draw cache to cheaply detect that a drawing is unchanged (e.g.
+   * while playback moves between frames held by the same keyframes) without comparing geometry.
+   */
+  std::atomic<int64_t> geometry_version = 0;
 };
 
 class Drawing : public ::GreasePencilDrawing {
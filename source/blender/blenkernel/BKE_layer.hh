@@ -158,6 +158,13 @@ void BKE_scene_collection_sync(const Scene *scene);
  * and on file loaded in case linked data changed or went missing.
  */
 void BKE_layer_collection_sync(const Scene *scene, ViewLayer *view_layer);
+/**
+ * Recompute only the visibility and selectability flags of the existing layer collection tree
+ * and object bases. This is much cheaper than #BKE_layer_collection_sync but is only valid when
+ * the collection hierarchy and memberships did not change,
+ * see #BKE_view_layer_need_visibility_resync_tag.
+ */
+void BKE_layer_collection_visibility_sync(const Scene *scene, ViewLayer *view_layer);
 void BKE_layer_collection_local_sync(const Scene *scene, ViewLayer *view_layer, const View3D *v3d);
 /**
  * Sync the local collection for all the 3D Viewports.
@@ -543,6 +550,12 @@ Base *BKE_view_layer_active_base_get(ViewLayer *view_layer);
 LayerCollection *BKE_view_layer_active_collection_get(ViewLayer *view_layer);
 
 void BKE_view_layer_need_resync_tag(ViewLayer *view_layer);
+/**
+ * Tag the view layer for the cheap visibility-only re-sync. Only valid when the change is limited
+ * to visibility/selectability flags (hide, holdout, indirect only, restrict flags): any change to
+ * the collection hierarchy or to collection memberships needs #BKE_view_layer_need_resync_tag.
+ */
+void BKE_view_layer_need_visibility_resync_tag(ViewLayer *view_layer);
 void BKE_view_layer_synced_ensure(const Scene *scene, ViewLayer *view_layer);
 
 void BKE_scene_view_layers_synced_ensure(const Scene *scene);
@@ -36,6 +36,10 @@ struct Scene;
 /* TODO: Move to `BKE_mesh_types.hh` when possible. */
 enum eMeshBatchDirtyMode {
   BKE_MESH_BATCH_DIRTY_ALL = 0,
+  /* Vertex positions changed but topology and attribute contents did not (deform-only update).
+   * Index buffers, UVs and generic attribute data are kept, only position dependent buffers are
+   * extracted again. */
+  BKE_MESH_BATCH_DIRTY_DEFORM,
   BKE_MESH_BATCH_DIRTY_SELECT,
   BKE_MESH_BATCH_DIRTY_SELECT_PAINT,
   BKE_MESH_BATCH_DIRTY_SHADING,
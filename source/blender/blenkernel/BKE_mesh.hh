@@ -49,6 +49,13 @@ void corner_tris_calc_with_normals(Span<float3> vert_positions,
 
 void corner_tris_calc_face_indices(OffsetIndices<int> faces, MutableSpan<int> tri_faces);
 
+/**
+ * Calculate a hash of the topology the face triangulation depends on (the face offsets and the
+ * corner vertices). When the hash is unchanged, a cached triangulation is still valid even if
+ * vertex positions changed, since it only consists of corner indices.
+ */
+uint64_t corner_tris_topology_hash(OffsetIndices<int> faces, Span<int> corner_verts);
+
 /**
  * Convert triangles encoded as face corner indices to triangles encoded as vertex indices.
  */
@@ -93,6 +100,9 @@ void normals_calc_faces(Span<float3> vert_positions,
 /**
  * Calculate vertex normals directly into the result array.
  *
+ * \param verts_to_calc: The vertices to calculate normals for. Other values in \a vert_normals
+ * are left untouched, so they must already be valid if only a subset is calculated.
+ *
  * \note Vertex and face normals can be calculated at the same time with
  * #normals_calc_faces_and_verts, which can have performance benefits in some cases.
  *
@@ -104,6 +114,7 @@ void normals_calc_verts(Span<float3> vert_positions,
                         Span<int> corner_verts,
                         GroupedSpan<int> vert_to_face_map,
                         Span<float3> face_normals,
+                        const IndexMask &verts_to_calc,
                         MutableSpan<float3> vert_normals);
 
 /** \} */
@@ -168,6 +179,9 @@ short2 corner_space_custom_normal_to_data(const CornerNormalSpace &lnor_space,
  * each side of the edge.
  * \param sharp_faces: Optional array of sharp face tags, used to split the evaluated normals on
  * the face's edges.
+ * \param verts_to_update: Optional selection of vertices (of the size of \a vert_positions) to
+ * limit the calculation to the fans around those vertices. Other values in \a r_corner_normals
+ * are left untouched, so they must already be valid. Only supported without \a r_lnors_spacearr.
  * \param r_lnors_spacearr: Optional return data filled with information about the custom
  * normals spaces for each grouped fan of face corners.
  */
@@ -181,6 +195,7 @@ void normals_calc_corners(Span<float3> vert_positions,
                           Span<float3> face_normals,
                           Span<bool> sharp_edges,
                           Span<bool> sharp_faces,
+                          Span<bool> verts_to_update,
                           const short2 *clnors_data,
                           CornerNormalSpaceArray *r_lnors_spacearr,
                           MutableSpan<float3> r_corner_normals);
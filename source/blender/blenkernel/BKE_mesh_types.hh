@@ -10,11 +10,13 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 
 #include "BLI_array.hh"
 #include "BLI_bit_vector.hh"
 #include "BLI_bounds_types.hh"
 #include "BLI_implicit_sharing.hh"
+#include "BLI_index_range.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_shared_cache.hh"
 #include "BLI_vector.hh"
@@ -140,13 +142,27 @@ struct MeshRuntime {
    */
   void *batch_cache = nullptr;
 
-  /** Cache for derived triangulation of the mesh, accessed with #Mesh::corner_tris(). */
-  SharedCache<Array<int3>> corner_tris_cache;
+  /**
+   * Cache for derived triangulation of the mesh, accessed with #Mesh::corner_tris(). The hash of
+   * the topology the triangulation was computed from is stored along with it, so that a
+   * position-only (deform) change can reuse the triangulation instead of re-tessellating all
+   * faces (see #mesh::corner_tris_topology_hash).
+   */
+  struct CornerTrisCache {
+    uint64_t topology_hash = 0;
+    Array<int3> tris;
+  };
+  SharedCache<CornerTrisCache> corner_tris_cache;
   /** Cache for triangle to original face index map, accessed with #Mesh::corner_tri_faces(). */
   SharedCache<Array<int>> corner_tri_faces_cache;
 
-  /** Cache for BVH trees generated for the mesh. Defined in 'BKE_bvhutil.c' */
-  BVHCache *bvh_cache = nullptr;
+  /**
+   * Cache for BVH trees generated for the mesh. Defined in `bvhutils.cc`. The cache is shared
+   * with copies of the mesh; the trees are keyed by the implicit-sharing versions of the arrays
+   * they were built from, so a copy (e.g. a re-evaluated static object) can keep using the trees
+   * as long as it references the exact same geometry arrays.
+   */
+  std::shared_ptr<BVHCache> bvh_cache;
 
   /** Needed in case we need to lazily initialize the mesh. */
   CustomData_MeshMasks cd_mask_extra = {};
@@ -186,6 +202,15 @@ struct MeshRuntime {
   /** Lazily computed face corner normals (#Mesh::corner_normals()). */
   SharedCache<Vector<float3>> corner_normals_cache;
 
+  /**
+   * A range of vertices whose positions changed since the normal caches were last computed, set
+   * by #Mesh::tag_positions_changed_partial and applied to the caches before they are accessed
+   * next. Used to avoid recomputing all normals when only a small region of the mesh changed.
+   * Protected by #dirty_normal_verts_mutex.
+   */
+  std::optional<IndexRange> dirty_normal_verts;
+  std::mutex dirty_normal_verts_mutex;
+
   /**
    * Cache of offsets for vert to face/corner maps. The same offsets array is used to group
    * indices for both the vertex to face and vertex to corner maps.
@@ -50,6 +50,18 @@ struct PackedFile *BKE_packedfile_new(struct ReportList *reports,
                                       const char *basepath);
 struct PackedFile *BKE_packedfile_new_from_memory(void *mem, int memlen);
 
+/**
+ * Compress the packed data with zstd to reduce resident memory,
+ * accessing the contents decompresses it again transparently.
+ * A no-op when the payload is small or compression does not pay off.
+ */
+void BKE_packedfile_compress(struct PackedFile *pf);
+/**
+ * The raw file contents, decompressing them in place first when needed.
+ * The buffer remains owned by \a pf. Not thread-safe for compressed files.
+ */
+const void *BKE_packedfile_data_get(struct PackedFile *pf);
+
 /**
  * No libraries for now.
  */
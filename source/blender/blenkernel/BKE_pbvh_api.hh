@@ -7,6 +7,14 @@
 /** \file
  * \ingroup bke
  * \brief A BVH for high poly meshes.
+ *
+ * Brush evaluation is CPU-side by design: the three PBVH backends store their vertex data in
+ * mesh attribute arrays, multires CCG grids and BMesh structures respectively, and strokes
+ * interleave vertex updates with undo logging, dynamic topology changes and re-evaluation of
+ * modifier stacks that all operate on that CPU data. Moving brush evaluation to GPU compute
+ * would require keeping a persistent GPU mirror of whichever backend is active and syncing it
+ * through every one of those code paths, not just the vertex loops; the GPU is only involved
+ * here through the per-node draw buffers, which are re-uploaded for nodes tagged as changed.
  */
 
 #include <optional>
@@ -356,6 +364,14 @@ namespace blender::bke::pbvh {
 void update_bounds(PBVH &pbvh, int flags);
 void update_mask(PBVH &pbvh);
 void update_visibility(PBVH &pbvh);
+/**
+ * Recalculate normals for all nodes tagged with #PBVH_UpdateNormals and clear the tag.
+ *
+ * Brush steps only tag nodes, so consecutive stroke samples within one display refresh coalesce
+ * into a single recalculation here, triggered from the draw code just before the node draw
+ * buffers are updated. Vertices on node boundaries are deduplicated across nodes so shared
+ * normals are not computed once per node.
+ */
 void update_normals(PBVH &pbvh, SubdivCCG *subdiv_ccg);
 }  // namespace blender::bke::pbvh
 
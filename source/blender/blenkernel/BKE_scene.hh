@@ -9,10 +9,11 @@
 
 #include "BLI_sys_types.h"
 
+#include "BKE_duplilist.hh"
+
 struct Base;
 struct Collection;
 struct Depsgraph;
-struct DupliObject;
 struct GHash;
 struct Main;
 struct ListBase;
@@ -74,7 +75,7 @@ Object *BKE_scene_object_find_by_name(const Scene *scene, const char *name);
  * Define struct here, so no need to bother with alloc/free it.
  */
 struct SceneBaseIter {
-  ListBase *duplilist;
+  DupliList *duplilist;
   DupliObject *dupob;
   float omat[4][4];
   Object *dupli_refob;
@@ -305,6 +306,16 @@ Depsgraph *BKE_scene_get_depsgraph(const Scene *scene, const ViewLayer *view_lay
  */
 Depsgraph *BKE_scene_ensure_depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer);
 
+/**
+ * Take ownership of the built depsgraphs before a memfile undo step, so they can be given back
+ * to the matching scene/view-layer afterwards via #BKE_scene_undo_depsgraphs_restore. Reusing the
+ * graph skips the full rebuild and keeps the evaluated copies: the relation rebuild matches IDs
+ * by session UID, which the undo-time file read preserves.
+ *
+ * \note This warm start is only possible within a session. The graph topology cannot be written
+ * to the blend file: operation nodes reference evaluation callbacks and runtime-only pointers,
+ * and session UIDs are assigned anew on every regular file read.
+ */
 GHash *BKE_scene_undo_depsgraphs_extract(Main *bmain);
 void BKE_scene_undo_depsgraphs_restore(Main *bmain, GHash *depsgraph_extract);
 
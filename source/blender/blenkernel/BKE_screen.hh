@@ -212,6 +212,12 @@ struct ARegionType {
   int (*snap_size)(const ARegion *region, int size, int axis);
   /* contextual changes should be handled here */
   void (*listener)(const wmRegionListenerParams *params);
+  /**
+   * Optional mask of `NOTE_CATEGORY_MASK(NC_*)` bits for the notifier categories #listener
+   * responds to, notifiers from other categories skip the listener. Zero means the categories
+   * are not declared and the listener is called for every notifier.
+   */
+  int listener_category_mask;
   /* Optional callback to generate subscriptions. */
   void (*message_subscribe)(const wmRegionMessageSubscribeParams *params);
 
@@ -160,6 +160,10 @@ struct Subdiv {
    * topology to OpenSubdiv. It can be shared by both evaluator and GL mesh
    * drawer. */
   OpenSubdiv_TopologyRefiner *topology_refiner;
+  /* Hash of the coarse mesh topology the refiner was built from. Used by update_from_mesh() to
+   * detect that the refiner can be reused without walking the full topology again. Zero when
+   * unknown (i.e. the descriptor was built directly from a converter). */
+  uint64_t topology_hash;
   /* CPU side evaluator. */
   OpenSubdiv_Evaluator *evaluator;
   /* Optional displacement evaluator. */
@@ -142,6 +142,12 @@ struct SubdivCCG {
    */
   blender::Array<SubdivCCGAdjacentVertex> adjacent_verts;
 
+  /* Boundary graph: coarse vertex and edge index for every grid (i.e. face corner), indexed by
+   * grid index. Gives which #adjacent_verts / #adjacent_edges entries share data with a face,
+   * so partial stitch passes only visit boundary sets adjacent to modified faces. */
+  blender::Array<int> grid_adjacent_vert;
+  blender::Array<int> grid_adjacent_edge;
+
   /** Store the visibility of the items in each grid. If empty, everything is visible. */
   blender::BitGroupVector<> grid_hidden;
 
@@ -17,6 +17,7 @@
 #define MAX_GPU_SUBDIV_SSBOS 12
 
 struct Mesh;
+struct MultiresModifierData;
 struct Object;
 struct Scene;
 struct SubsurfModifierData;
@@ -79,6 +80,17 @@ bool BKE_subsurf_modifier_can_do_gpu_subdiv(const Scene *scene,
                                             const SubsurfModifierData *smd,
                                             int required_mode);
 
+/**
+ * Same as #BKE_subsurf_modifier_can_do_gpu_subdiv, for the Multires modifier. Only possible as
+ * long as the mesh carries no sculpted displacement: the draw-side evaluator has no displacement
+ * stage, so grids have to keep using the CPU path.
+ */
+bool BKE_multires_modifier_can_do_gpu_subdiv(const Scene *scene,
+                                             const Object *ob,
+                                             const Mesh *mesh,
+                                             const MultiresModifierData *mmd,
+                                             int required_mode);
+
 bool BKE_subsurf_modifier_has_gpu_subdiv(const Mesh *mesh);
 
 extern void (*BKE_subsurf_modifier_free_gpu_cache_cb)(blender::bke::subdiv::Subdiv *subdiv);
@@ -32,6 +32,11 @@ struct BakeMaterialsList;
 /* Module */
 
 void BKE_volumes_init();
+/**
+ * Stop background loading of volume sequence frames. Needs the task scheduler, so must be called
+ * before it is freed.
+ */
+void BKE_volumes_exit();
 
 /* Data-block Management */
 
@@ -54,6 +54,23 @@ GridsFromFile get_all_grids_from_file(StringRef file_path, int simplify_level =
  */
 void unload_unused();
 
+/**
+ * Queue the given `.vdb` files (typically the upcoming frames of a volume sequence) for loading
+ * on a low priority background thread, so that stepping to them during playback does not block
+ * on disk I/O. Loaded frames are kept resident in a sliding window that is trimmed once its
+ * total size exceeds \a memory_budget (in bytes), with the least recently requested frames
+ * released first.
+ *
+ * Residency of an individual grid can be checked with #VolumeGridData::is_loaded, which allows
+ * display code to show a placeholder while the full tree is still streaming in.
+ */
+void prefetch_frames(Span<std::string> file_paths, int64_t memory_budget);
+
+/**
+ * Wait for in-flight prefetch tasks and release all resident frames. Called on exit.
+ */
+void prefetch_exit();
+
 }  // namespace blender::bke::volume_grid::file_cache
 
 #endif
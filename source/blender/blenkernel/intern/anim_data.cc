@@ -252,6 +252,7 @@ void BKE_animdata_free(ID *id, const bool do_id_user)
 
       /* free nla data */
       BKE_nla_tracks_free(&adt->nla_tracks, do_id_user);
+      BKE_animsys_nla_plan_free(adt);
 
       /* free drivers - stored as a list of F-Curves */
       BKE_fcurves_free(&adt->drivers);
@@ -11,18 +11,25 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_bit_vector.hh"
 #include "BLI_blenlib.h"
 #include "BLI_dynstr.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
+#include "BLI_math_base.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -341,6 +348,36 @@ static bool is_fcurve_evaluatable(const FCurve *fcu)
   return true;
 }
 
+/**
+ * Checks performed on an already resolved path (`r_result->ptr` and `r_result->prop` are
+ * expected to be set), shared between the string and the compiled path resolving.
+ */
+static bool animsys_rna_path_validate(PointerRNA *ptr,
+                                      const char *rna_path,
+                                      const int array_index,
+                                      PathResolvedRNA *r_result)
+{
+  if (ptr->owner_id != nullptr && !RNA_property_animateable(&r_result->ptr, r_result->prop)) {
+    return false;
+  }
+
+  int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+  if (array_len && array_index >= array_len) {
+    if (G.debug & G_DEBUG) {
+      CLOG_WARN(&LOG,
+                "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
+                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+                rna_path,
+                array_index,
+                array_len - 1);
+    }
+    return false;
+  }
+
+  r_result->prop_index = array_len ? array_index : -1;
+  return true;
+}
+
 bool BKE_animsys_rna_path_resolve(
     PointerRNA *ptr, /* typically 'fcu->rna_path', 'fcu->array_index' */
     const char *rna_path,
@@ -366,25 +403,51 @@ bool BKE_animsys_rna_path_resolve(
     return false;
   }
 
-  if (ptr->owner_id != nullptr && !RNA_property_animateable(&r_result->ptr, r_result->prop)) {
+  return animsys_rna_path_validate(ptr, rna_path, array_index, r_result);
+}
+
+/**
+ * #BKE_animsys_rna_path_resolve for an F-Curve, caching the parsed path on the F-Curve so that
+ * per-frame evaluation doesn't re-parse the path string, see #RNA_path_compile.
+ */
+static bool animsys_fcurve_rna_path_resolve(PointerRNA *ptr,
+                                            const FCurve *fcu,
+                                            PathResolvedRNA *r_result)
+{
+  if (fcu->rna_path == nullptr) {
     return false;
   }
 
-  int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
-  if (array_len && array_index >= array_len) {
-    if (G.debug & G_DEBUG) {
-      CLOG_WARN(&LOG,
-                "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
-                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
-                path,
-                array_index,
-                array_len - 1);
+  RNACompiledPath *compiled = static_cast<RNACompiledPath *>(
+      atomic_load_ptr(&fcu->rna_path_compiled));
+  if (compiled == nullptr) {
+    compiled = RNA_path_compile(fcu->rna_path);
+    if (compiled != nullptr) {
+      void *existing = atomic_cas_ptr(
+          (void **)&const_cast<FCurve *>(fcu)->rna_path_compiled, nullptr, compiled);
+      if (existing != nullptr) {
+        /* Another evaluation thread compiled the path first, use its result. */
+        RNA_path_compiled_free(compiled);
+        compiled = static_cast<RNACompiledPath *>(existing);
+      }
     }
-    return false;
+  }
+  else if (!STREQ(RNA_path_compiled_path_get(compiled), fcu->rna_path)) {
+    /* The path changed behind our back (it should be updated through #BKE_fcurve_rnapath_set,
+     * which drops the compiled path, but not all code goes through it). The stale compiled path
+     * cannot be replaced here, other threads may still be resolving it. */
+    compiled = nullptr;
   }
 
-  r_result->prop_index = array_len ? array_index : -1;
-  return true;
+  if (compiled != nullptr &&
+      RNA_path_compiled_resolve_property(ptr, compiled, &r_result->ptr, &r_result->prop))
+  {
+    return animsys_rna_path_validate(ptr, fcu->rna_path, fcu->array_index, r_result);
+  }
+
+  /* The path could not be compiled, uses syntax the compiled resolver doesn't support, or
+   * genuinely fails to resolve: fall back to full string parsing (which also logs failures). */
+  return BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, r_result);
 }
 
 /* less than 1.0 evaluates to false, use epsilon to avoid float error */
@@ -565,7 +628,9 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
-  /* Calculate then execute each curve. */
+  /* Resolve the RNA pointers serially, then batch the curve evaluations: they are independent
+   * of each other, only the RNA writes have to stay on this thread. */
+  blender::Vector<std::pair<FCurve *, PathResolvedRNA>> fcurves;
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
     if (!is_fcurve_evaluatable(fcu)) {
@@ -573,12 +638,23 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
-      const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
-      BKE_animsys_write_to_rna_path(&anim_rna, curval);
-      if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
-      }
+    if (animsys_fcurve_rna_path_resolve(ptr, fcu, &anim_rna)) {
+      fcurves.append({fcu, anim_rna});
+    }
+  }
+
+  blender::Array<float> values(fcurves.size());
+  blender::threading::parallel_for(fcurves.index_range(), 32, [&](const blender::IndexRange range) {
+    for (const int i : range) {
+      values[i] = calculate_fcurve(&fcurves[i].second, fcurves[i].first, anim_eval_context);
+    }
+  });
+
+  for (const int i : fcurves.index_range()) {
+    FCurve *fcu = fcurves[i].first;
+    BKE_animsys_write_to_rna_path(&fcurves[i].second, values[i]);
+    if (flush_to_original) {
+      animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, values[i]);
     }
   }
 }
@@ -683,7 +759,7 @@ static void animsys_blend_in_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (!BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (!animsys_fcurve_rna_path_resolve(ptr, fcu, &anim_rna)) {
       continue;
     }
 
@@ -770,7 +846,7 @@ static void animsys_evaluate_drivers(PointerRNA *ptr,
          * NOTE: for 'layering' option later on, we should check if we should remove old value
          * before adding new to only be done when drivers only changed. */
         PathResolvedRNA anim_rna;
-        if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+        if (animsys_fcurve_rna_path_resolve(ptr, fcu, &anim_rna)) {
           const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
           ok = BKE_animsys_write_to_rna_path(&anim_rna, curval);
         }
@@ -852,7 +928,7 @@ void animsys_evaluate_action_group(PointerRNA *ptr,
     /* check if this curve should be skipped */
     if ((fcu->flag & (FCURVE_MUTED | FCURVE_DISABLED)) == 0 && !BKE_fcurve_is_empty(fcu)) {
       PathResolvedRNA anim_rna;
-      if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+      if (animsys_fcurve_rna_path_resolve(ptr, fcu, &anim_rna)) {
         const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
         BKE_animsys_write_to_rna_path(&anim_rna, curval);
       }
@@ -953,16 +1029,15 @@ static void nlastrip_evaluate_controls(NlaStrip *strip,
   }
 }
 
-NlaEvalStrip *nlastrips_ctime_get_strip(ListBase *list,
-                                        ListBase *strips,
-                                        short index,
-                                        const AnimationEvalContext *anim_eval_context,
-                                        const bool flush_to_original)
+/**
+ * Find the strip that governs \a ctime in the given strip list, without evaluating it.
+ * \return the strip (may be a held neighbor of the current time), or null when no strip
+ * contributes. \a r_side is set to the NES_TIME_* relation of \a ctime to the strip.
+ */
+static NlaStrip *nlastrips_ctime_find_strip(ListBase *strips, const float ctime, short *r_side)
 {
   NlaStrip *estrip = nullptr;
-  NlaEvalStrip *nes;
   short side = 0;
-  float ctime = anim_eval_context->eval_time;
 
   /* loop over strips, checking if they fall within the range */
   LISTBASE_FOREACH (NlaStrip *, strip, strips) {
@@ -1040,6 +1115,28 @@ NlaEvalStrip *nlastrips_ctime_get_strip(ListBase *list,
     return nullptr;
   }
 
+  *r_side = side;
+  return estrip;
+}
+
+/**
+ * Evaluate the controls of a strip found by #nlastrips_ctime_find_strip and append an
+ * #NlaEvalStrip for it to \a list (second half of #nlastrips_ctime_get_strip).
+ */
+static NlaEvalStrip *nlastrip_ctime_eval_strip(ListBase *list,
+                                               NlaStrip *estrip,
+                                               const short side,
+                                               const short index,
+                                               const AnimationEvalContext *anim_eval_context,
+                                               const bool flush_to_original)
+{
+  NlaEvalStrip *nes;
+  float ctime = anim_eval_context->eval_time;
+
+  if (estrip == nullptr) {
+    return nullptr;
+  }
+
   /* if ctime was not within the boundaries of the strip, clamp! */
   switch (side) {
     case NES_TIME_BEFORE: /* extend first frame only */
@@ -1103,6 +1200,17 @@ NlaEvalStrip *nlastrips_ctime_get_strip(ListBase *list,
   return nes;
 }
 
+NlaEvalStrip *nlastrips_ctime_get_strip(ListBase *list,
+                                        ListBase *strips,
+                                        short index,
+                                        const AnimationEvalContext *anim_eval_context,
+                                        const bool flush_to_original)
+{
+  short side = 0;
+  NlaStrip *estrip = nlastrips_ctime_find_strip(strips, anim_eval_context->eval_time, &side);
+  return nlastrip_ctime_eval_strip(list, estrip, side, index, anim_eval_context, flush_to_original);
+}
+
 static NlaEvalStrip *nlastrips_ctime_get_strip_single(
     ListBase *dst_list,
     NlaStrip *single_strip,
@@ -3331,6 +3439,171 @@ static NlaTrack *nlatrack_find_tweaked(const AnimData *adt)
   return nullptr;
 }
 
+/* ---------------------- */
+
+/**
+ * Compiled NLA plan: a flattened, per-track timeline of which strip governs which time range,
+ * derived once from the strip configuration and only regenerated when strips are edited. With
+ * it, the per-frame evaluation walks an array and does a couple of float compares per track
+ * instead of re-deriving the active strip from the track list-bases.
+ */
+
+/** One piece of a track timeline. Segments cover the whole timeline in order, so the first
+ * segment whose end lies at or after the evaluation time is the governing one. */
+struct NlaPlanSegment {
+  float end;
+  /** Whether a time exactly at #end belongs to this segment (strip ranges are inclusive,
+   * the gaps and extends between them are not). */
+  bool end_inclusive;
+  /** Strip to evaluate, null when nothing contributes in this range. */
+  NlaStrip *strip;
+  /** NES_TIME_* relation of times in this range to #strip. */
+  short side;
+};
+
+struct NlaPlanTrack {
+  NlaTrack *track;
+  short track_index;
+  blender::Vector<NlaPlanSegment> segments;
+};
+
+struct NlaCompiledPlan {
+  uint64_t signature;
+  bool has_strips;
+  /** False when the configuration uses features the plan does not model (e.g. tweak mode). */
+  bool usable;
+  blender::Vector<NlaPlanTrack> tracks;
+};
+
+/** Plans of evaluated AnimData, keyed by the data they were compiled from. Erased when the
+ * AnimData is freed; guarded since multiple IDs are animated in parallel by the depsgraph. */
+static blender::Map<const AnimData *, std::unique_ptr<NlaCompiledPlan>> g_nla_plans;
+static std::mutex g_nla_plans_mutex;
+
+static uint64_t nla_plan_hash(uint64_t hash, const uint64_t value)
+{
+  return hash * 65599 + value;
+}
+
+static uint64_t nla_plan_hash_float(uint64_t hash, const float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return nla_plan_hash(hash, bits);
+}
+
+/** Hash everything the strip search decisions depend on, to detect strip edits. */
+static uint64_t nla_plan_signature(const AnimData *adt)
+{
+  uint64_t hash = nla_plan_hash(0, uint64_t(adt->flag));
+  LISTBASE_FOREACH (NlaTrack *, nlt, &adt->nla_tracks) {
+    hash = nla_plan_hash(hash, uintptr_t(nlt));
+    hash = nla_plan_hash(hash, uint64_t(nlt->flag));
+    LISTBASE_FOREACH (NlaStrip *, strip, &nlt->strips) {
+      hash = nla_plan_hash(hash, uintptr_t(strip));
+      hash = nla_plan_hash(hash, uint64_t(strip->flag));
+      hash = nla_plan_hash(hash, uint64_t(strip->extendmode));
+      hash = nla_plan_hash(hash, uint64_t(strip->type));
+      hash = nla_plan_hash_float(hash, strip->start);
+      hash = nla_plan_hash_float(hash, strip->end);
+    }
+  }
+  return hash;
+}
+
+/** Mirrors the case analysis of #nlastrips_ctime_find_strip, segment by segment. */
+static void nla_plan_track_build(NlaTrack *nlt, const short track_index, NlaPlanTrack &r_track)
+{
+  r_track.track = nlt;
+  r_track.track_index = track_index;
+
+  NlaStrip *first = static_cast<NlaStrip *>(nlt->strips.first);
+  if (first == nullptr) {
+    return;
+  }
+
+  auto strip_or_null = [](NlaStrip *strip) {
+    return (strip->flag & NLASTRIP_FLAG_MUTED) ? nullptr : strip;
+  };
+
+  /* Before the first strip: only used when it extends backwards in time too. */
+  NlaStrip *held = (first->extendmode == NLASTRIP_EXTEND_HOLD) ? strip_or_null(first) : nullptr;
+  r_track.segments.append({first->start, false, held, NES_TIME_BEFORE});
+
+  LISTBASE_FOREACH (NlaStrip *, strip, &nlt->strips) {
+    /* Within the strip boundaries (inclusive on both sides). */
+    r_track.segments.append({strip->end, true, strip_or_null(strip), NES_TIME_WITHIN});
+
+    /* After the strip: held until the next one begins (or forever for the last strip),
+     * unless the strip is not being held. */
+    const float gap_end = strip->next ? strip->next->start : FLT_MAX;
+    held = (strip->extendmode != NLASTRIP_EXTEND_NOTHING) ? strip_or_null(strip) : nullptr;
+    r_track.segments.append({gap_end, false, held, NES_TIME_AFTER});
+  }
+}
+
+static std::unique_ptr<NlaCompiledPlan> nla_plan_build(const AnimData *adt,
+                                                       const uint64_t signature)
+{
+  std::unique_ptr<NlaCompiledPlan> plan = std::make_unique<NlaCompiledPlan>();
+  plan->signature = signature;
+  plan->has_strips = false;
+  plan->usable = true;
+
+  short track_index = 0;
+  LISTBASE_FOREACH_INDEX (NlaTrack *, nlt, &adt->nla_tracks, track_index) {
+    if (!is_nlatrack_evaluatable(adt, nlt)) {
+      continue;
+    }
+    if (nlt->strips.first) {
+      plan->has_strips = true;
+    }
+    LISTBASE_FOREACH (NlaStrip *, strip, &nlt->strips) {
+      if (strip->flag & NLASTRIP_FLAG_NO_TIME_MAP) {
+        /* Only synthesized action-track/tweak strips use this, never planned tracks. */
+        plan->usable = false;
+        return plan;
+      }
+    }
+    NlaPlanTrack ptrack;
+    nla_plan_track_build(nlt, track_index, ptrack);
+    plan->tracks.append(std::move(ptrack));
+  }
+  return plan;
+}
+
+/** Get the (lazily compiled) plan for this AnimData, or null when a plan cannot be used. */
+static const NlaCompiledPlan *animsys_nla_plan_ensure(const AnimData *adt)
+{
+  const uint64_t signature = nla_plan_signature(adt);
+
+  std::lock_guard lock(g_nla_plans_mutex);
+  std::unique_ptr<NlaCompiledPlan> &plan = g_nla_plans.lookup_or_add_default(adt);
+  if (!plan || plan->signature != signature) {
+    plan = nla_plan_build(adt, signature);
+  }
+  return plan->usable ? plan.get() : nullptr;
+}
+
+static NlaStrip *nla_plan_track_find_strip(const NlaPlanTrack &ptrack,
+                                           const float ctime,
+                                           short *r_side)
+{
+  for (const NlaPlanSegment &segment : ptrack.segments) {
+    if (ctime < segment.end || (segment.end_inclusive && ctime == segment.end)) {
+      *r_side = segment.side;
+      return segment.strip;
+    }
+  }
+  return nullptr;
+}
+
+void BKE_animsys_nla_plan_free(const AnimData *adt)
+{
+  std::lock_guard lock(g_nla_plans_mutex);
+  g_nla_plans.remove(adt);
+}
+
 /**
  * NLA Evaluation function - values are calculated and stored in temporary "NlaEvalChannels"
  * \param[out] echannels: Evaluation channels with calculated values
@@ -3351,30 +3624,49 @@ static bool animsys_evaluate_nla_for_flush(NlaEvalData *echannels,
 
   NlaTrack *tweaked_track = nlatrack_find_tweaked(adt);
 
-  /* Get the stack of strips to evaluate at current time (influence calculated here). */
-  for (nlt = static_cast<NlaTrack *>(adt->nla_tracks.first); nlt; nlt = nlt->next, track_index++) {
+  /* Tweak mode swaps strips in and out per frame, which the compiled plan does not model. */
+  const NlaCompiledPlan *plan = (tweaked_track == nullptr) ? animsys_nla_plan_ensure(adt) :
+                                                             nullptr;
 
-    if (!is_nlatrack_evaluatable(adt, nlt)) {
-      continue;
+  /* Get the stack of strips to evaluate at current time (influence calculated here). */
+  if (plan != nullptr) {
+    has_strips = plan->has_strips;
+    for (const NlaPlanTrack &ptrack : plan->tracks) {
+      short side = 0;
+      NlaStrip *estrip = nla_plan_track_find_strip(ptrack, anim_eval_context->eval_time, &side);
+      nes = nlastrip_ctime_eval_strip(
+          &estrips, estrip, side, ptrack.track_index, anim_eval_context, flush_to_original);
+      if (nes) {
+        nes->track = ptrack.track;
+      }
     }
+  }
+  else {
+    for (nlt = static_cast<NlaTrack *>(adt->nla_tracks.first); nlt;
+         nlt = nlt->next, track_index++) {
 
-    if (nlt->strips.first) {
-      has_strips = true;
-    }
+      if (!is_nlatrack_evaluatable(adt, nlt)) {
+        continue;
+      }
 
-    /** Append strip to evaluate for this track. */
-    if (nlt == tweaked_track) {
-      /** Tweaked strip is evaluated differently. */
-      animsys_create_tweak_strip(adt, false, &tweak_strip);
-      nes = nlastrips_ctime_get_strip_single(
-          &estrips, &tweak_strip, anim_eval_context, flush_to_original);
-    }
-    else {
-      nes = nlastrips_ctime_get_strip(
-          &estrips, &nlt->strips, track_index, anim_eval_context, flush_to_original);
-    }
-    if (nes) {
-      nes->track = nlt;
+      if (nlt->strips.first) {
+        has_strips = true;
+      }
+
+      /** Append strip to evaluate for this track. */
+      if (nlt == tweaked_track) {
+        /** Tweaked strip is evaluated differently. */
+        animsys_create_tweak_strip(adt, false, &tweak_strip);
+        nes = nlastrips_ctime_get_strip_single(
+            &estrips, &tweak_strip, anim_eval_context, flush_to_original);
+      }
+      else {
+        nes = nlastrips_ctime_get_strip(
+            &estrips, &nlt->strips, track_index, anim_eval_context, flush_to_original);
+      }
+      if (nes) {
+        nes->track = nlt;
+      }
     }
   }
 
@@ -4183,7 +4475,7 @@ void BKE_animsys_eval_driver(Depsgraph *depsgraph, ID *id, int driver_index, FCu
       // printf("\told val = %f\n", fcu->curval);
 
       PathResolvedRNA anim_rna;
-      if (BKE_animsys_rna_path_resolve(&id_ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+      if (animsys_fcurve_rna_path_resolve(&id_ptr, fcu, &anim_rna)) {
         /* Evaluate driver, and write results to copy-on-eval-domain destination */
         const float ctime = DEG_get_ctime(depsgraph);
         const AnimationEvalContext anim_eval_context = BKE_animsys_eval_context_construct(
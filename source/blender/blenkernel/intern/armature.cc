@@ -20,6 +20,7 @@
 #include "BLI_alloca.h"
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
@@ -28,7 +29,9 @@
 #include "BLI_span.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 #include "BLT_translation.hh"
 
 #include "DNA_defaults.h"
@@ -2938,6 +2941,80 @@ void BKE_pose_where_is_bone(Depsgraph *depsgraph,
   BKE_pose_where_is_bone_tail(pchan);
 }
 
+/**
+ * Partition the pose channels into "lanes" (one per root subtree) that can be solved in
+ * parallel. This is only possible when no bone depends on a bone of another subtree, so a lane
+ * assignment is rejected when a constraint, an IK/Spline-IK chain or a B-Bone custom handle
+ * reaches across subtrees.
+ *
+ * Channel order within each lane follows #bPose::chanbase, which is sorted from roots to
+ * children, so in-lane dependencies keep being solved in the right order.
+ *
+ * \return true when the pose can be solved as independent lanes.
+ */
+static bool pose_channels_assign_lanes(Object *ob,
+                                       blender::Vector<blender::Vector<bPoseChannel *>> &r_lanes)
+{
+  bPose *pose = ob->pose;
+
+  blender::Map<const bPoseChannel *, int> lane_by_channel;
+  LISTBASE_FOREACH (bPoseChannel *, pchan, &pose->chanbase) {
+    int lane;
+    if (pchan->parent) {
+      /* Parents are guaranteed to have been visited already. */
+      lane = lane_by_channel.lookup(pchan->parent);
+    }
+    else {
+      lane = r_lanes.append_and_get_index({});
+    }
+    lane_by_channel.add_new(pchan, lane);
+    r_lanes[lane].append(pchan);
+  }
+
+  if (r_lanes.size() < 2) {
+    return false;
+  }
+
+  LISTBASE_FOREACH (bPoseChannel *, pchan, &pose->chanbase) {
+    const int lane = lane_by_channel.lookup(pchan);
+
+    /* The iTaSC solver keeps its state on the pose, its trees cannot run concurrently. */
+    if ((pchan->flag & POSE_IKTREE) && (pose->iksolver == IKSOLVER_ITASC)) {
+      return false;
+    }
+
+    /* B-Bone custom handles read the pose matrices of arbitrary bones. */
+    if ((pchan->bbone_prev && lane_by_channel.lookup(pchan->bbone_prev) != lane) ||
+        (pchan->bbone_next && lane_by_channel.lookup(pchan->bbone_next) != lane))
+    {
+      return false;
+    }
+
+    /* Constraints targeting a bone of another subtree (includes IK chain & pole targets). */
+    LISTBASE_FOREACH (bConstraint *, con, &pchan->constraints) {
+      ListBase targets = {nullptr, nullptr};
+      bool crosses_lanes = false;
+      if (BKE_constraint_targets_get(con, &targets)) {
+        LISTBASE_FOREACH (bConstraintTarget *, ct, &targets) {
+          if (ct->tar == ob && ct->subtarget[0] != '\0') {
+            const bPoseChannel *target_pchan = BKE_pose_channel_find_name(pose, ct->subtarget);
+            if (target_pchan && lane_by_channel.lookup(target_pchan) != lane) {
+              crosses_lanes = true;
+              break;
+            }
+          }
+        }
+        BKE_constraint_targets_flush(con, &targets, true);
+      }
+      if (crosses_lanes) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 void BKE_pose_where_is(Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   bArmature *arm;
@@ -2987,8 +3064,10 @@ void BKE_pose_where_is(Depsgraph *depsgraph, Scene *scene, Object *ob)
      */
     BKE_pose_splineik_init_tree(scene, ob, ctime);
 
-    /* 3. the main loop, channels are already hierarchical sorted from root to children */
-    LISTBASE_FOREACH (bPoseChannel *, pchan, &ob->pose->chanbase) {
+    /* 3. the main loop, channels are already hierarchical sorted from root to children.
+     * Subtrees without cross dependencies are solved as parallel lanes, with the same
+     * root-to-children order within each lane. */
+    auto solve_channel = [&](bPoseChannel *pchan) {
       /* 4a. if we find an IK root, we handle it separated */
       if (pchan->flag & POSE_IKTREE) {
         BIK_execute_tree(depsgraph, scene, ob, pchan, ctime);
@@ -3001,6 +3080,23 @@ void BKE_pose_where_is(Depsgraph *depsgraph, Scene *scene, Object *ob)
       else if (!(pchan->flag & POSE_DONE)) {
         BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, true);
       }
+    };
+
+    blender::Vector<blender::Vector<bPoseChannel *>> lanes;
+    if (pose_channels_assign_lanes(ob, lanes)) {
+      blender::threading::parallel_for(
+          lanes.index_range(), 1, [&](const blender::IndexRange range) {
+            for (const int i : range) {
+              for (bPoseChannel *pchan : lanes[i]) {
+                solve_channel(pchan);
+              }
+            }
+          });
+    }
+    else {
+      LISTBASE_FOREACH (bPoseChannel *, pchan, &ob->pose->chanbase) {
+        solve_channel(pchan);
+      }
     }
     /* 6. release the IK tree */
     BIK_release_tree(scene, ob, ctime);
@@ -201,7 +201,32 @@ static float dist_bone_deform(const bPoseChannel *pchan,
   return contrib;
 }
 
-static void pchan_bone_deform(const bPoseChannel *pchan,
+/**
+ * Per vertex-group entry of the packed deform table.
+ *
+ * The per-vertex weight loop is by far the hottest part of armature deform, and reading through
+ * #bPoseChannel & #Bone pointers there scatters loads all over memory. Everything the simple
+ * (non B-Bone) deform needs is copied into this flat table, indexed by the vertex-group index,
+ * so the inner loop mostly reads consecutive entries of one allocation.
+ */
+struct BoneDeformEntry {
+  /** Null when the vertex group doesn't correspond to a deforming bone. */
+  const bPoseChannel *pchan;
+
+  float chan_mat[4][4];
+  DualQuat deform_dq;
+
+  /** Envelope parameters, for #BONE_MULT_VG_ENV. */
+  float arm_head[3];
+  float arm_tail[3];
+  float rad_head, rad_tail, dist;
+
+  /** B-Bones keep deforming through the segment data on `pchan`. */
+  bool use_bbone;
+  bool mult_vg_env;
+};
+
+static void pchan_bone_deform(const BoneDeformEntry *entry,
                               const float weight,
                               float vec[3],
                               DualQuat *dq,
@@ -210,18 +235,16 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
                               const bool full_deform,
                               float *contrib)
 {
-  const Bone *bone = pchan->bone;
-
   if (!weight) {
     return;
   }
 
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
-    b_bone_deform(pchan, co, weight, vec, dq, mat, full_deform);
+  if (entry->use_bbone) {
+    b_bone_deform(entry->pchan, co, weight, vec, dq, mat, full_deform);
   }
   else {
     pchan_deform_accumulate(
-        &pchan->runtime.deform_dual_quat, pchan->chan_mat, co, weight, vec, dq, mat, full_deform);
+        &entry->deform_dq, entry->chan_mat, co, weight, vec, dq, mat, full_deform);
   }
 
   (*contrib) += weight;
@@ -252,7 +275,7 @@ struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const BoneDeformEntry *deform_table;
   int defbase_len;
 
   float premat[4][4];
@@ -344,18 +367,21 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     uint j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
+      if (index < data->defbase_len) {
+        const BoneDeformEntry *entry = &data->deform_table[index];
+        if (entry->pchan == nullptr) {
+          continue;
+        }
         float weight = dw->weight;
-        const Bone *bone = pchan->bone;
 
         deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
+        if (entry->mult_vg_env) {
           weight *= distfactor_to_bone(
-              co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
+              co, entry->arm_head, entry->arm_tail, entry->rad_head, entry->rad_tail, entry->dist);
         }
 
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, full_deform, &contrib);
+        pchan_bone_deform(entry, weight, vec, dq, smat, co, full_deform, &contrib);
       }
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
@@ -493,7 +519,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         bGPDstroke *gps_target)
 {
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
-  bPoseChannel **pchan_from_defbase = nullptr;
+  BoneDeformEntry *deform_table = nullptr;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
   const bool invert_vgroup = (deformflag & ARM_DEF_INVERT_VGROUP) != 0;
@@ -557,21 +583,33 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = static_cast<bPoseChannel **>(
-            MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone"));
+        deform_table = static_cast<BoneDeformEntry *>(
+            MEM_calloc_arrayN(size_t(defbase_len), sizeof(*deform_table), "boneDeformTable"));
         /* TODO(sergey): Some considerations here:
          *
          * - Check whether keeping this consistent across frames gives speedup.
          */
         int i;
         LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = nullptr;
-            }
+          if (pchan == nullptr || (pchan->bone->flag & BONE_NO_DEFORM)) {
+            continue;
           }
+          const Bone *bone = pchan->bone;
+          BoneDeformEntry *entry = &deform_table[i];
+
+          entry->pchan = pchan;
+          copy_m4_m4(entry->chan_mat, pchan->chan_mat);
+          entry->deform_dq = pchan->runtime.deform_dual_quat;
+          copy_v3_v3(entry->arm_head, bone->arm_head);
+          copy_v3_v3(entry->arm_tail, bone->arm_tail);
+          entry->rad_head = bone->rad_head;
+          entry->rad_tail = bone->rad_tail;
+          entry->dist = bone->dist;
+          entry->use_bbone = (bone->segments > 1 &&
+                              pchan->runtime.bbone_segments == bone->segments);
+          entry->mult_vg_env = (bone->flag & BONE_MULT_VG_ENV) != 0;
         }
       }
     }
@@ -590,7 +628,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.armature_def_nr = armature_def_nr;
   data.dverts = dverts.data();
   data.dverts_len = dverts.size();
-  data.pchan_from_defbase = pchan_from_defbase;
+  data.deform_table = deform_table;
   data.defbase_len = defbase_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
@@ -624,8 +662,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
   }
 
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
+  if (deform_table) {
+    MEM_freeN(deform_table);
   }
 }
 
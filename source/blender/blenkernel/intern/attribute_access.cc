@@ -481,6 +481,38 @@ GAttributeReader CustomDataAttributeProvider::try_get_for_read(
   return {};
 }
 
+void CustomDataAttributeProvider::try_get_for_read_many(
+    const void *owner,
+    const Span<AttributeIDRef> attribute_ids,
+    MutableSpan<bool> handled,
+    MutableSpan<GAttributeReader> r_attributes) const
+{
+  const CustomData *custom_data = custom_data_access_.get_const_custom_data(owner);
+  if (custom_data == nullptr) {
+    return;
+  }
+  const int element_num = custom_data_access_.get_element_num(owner);
+  /* A single pass over the layers resolves all requested attributes, instead of scanning the
+   * layer array again for every attribute. */
+  for (const CustomDataLayer &layer : Span(custom_data->layers, custom_data->totlayer)) {
+    const CPPType *type = custom_data_type_to_cpp_type((eCustomDataType)layer.type);
+    if (type == nullptr) {
+      continue;
+    }
+    for (const int i : attribute_ids.index_range()) {
+      if (handled[i]) {
+        continue;
+      }
+      if (!custom_data_layer_matches_attribute_id(layer, attribute_ids[i])) {
+        continue;
+      }
+      GSpan data{*type, layer.data, element_num};
+      r_attributes[i] = {GVArray::ForSpan(data), domain_, layer.sharing_info};
+      handled[i] = true;
+    }
+  }
+}
+
 GAttributeWriter CustomDataAttributeProvider::try_get_for_write(
     void *owner, const AttributeIDRef &attribute_id) const
 {
@@ -613,6 +645,21 @@ GAttributeReader AttributeAccessor::lookup(const AttributeIDRef &attribute_id,
   return attribute;
 }
 
+Vector<GAttributeReader> AttributeAccessor::lookup_many(
+    const Span<AttributeIDRef> attribute_ids) const
+{
+  Vector<GAttributeReader> attributes(attribute_ids.size());
+  if (fn_->lookup_many != nullptr) {
+    fn_->lookup_many(owner_, attribute_ids, attributes);
+  }
+  else {
+    for (const int i : attribute_ids.index_range()) {
+      attributes[i] = this->lookup(attribute_ids[i]);
+    }
+  }
+  return attributes;
+}
+
 GAttributeReader AttributeAccessor::lookup_or_default(const AttributeIDRef &attribute_id,
                                                       const AttrDomain domain,
                                                       const eCustomDataType data_type,
@@ -2,6 +2,7 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_array.hh"
 #include "BLI_map.hh"
 #include "BLI_span.hh"
 #include "BLI_string_ref.hh"
@@ -96,6 +97,27 @@ class DynamicAttributesProvider {
  public:
   virtual GAttributeReader try_get_for_read(const void *owner,
                                             const AttributeIDRef &attribute_id) const = 0;
+  /**
+   * Resolve multiple attributes at once, with a single pass over the underlying storage when the
+   * provider supports that. Entries with `handled[i]` set are resolved already (possibly by a
+   * previous provider) and must be skipped; the provider sets the flag for every attribute it
+   * resolves.
+   */
+  virtual void try_get_for_read_many(const void *owner,
+                                     const Span<AttributeIDRef> attribute_ids,
+                                     MutableSpan<bool> handled,
+                                     MutableSpan<GAttributeReader> r_attributes) const
+  {
+    for (const int i : attribute_ids.index_range()) {
+      if (handled[i]) {
+        continue;
+      }
+      if (GAttributeReader attribute = this->try_get_for_read(owner, attribute_ids[i])) {
+        r_attributes[i] = std::move(attribute);
+        handled[i] = true;
+      }
+    }
+  }
   virtual GAttributeWriter try_get_for_write(void *owner,
                                              const AttributeIDRef &attribute_id) const = 0;
   virtual bool try_delete(void *owner, const AttributeIDRef &attribute_id) const = 0;
@@ -134,6 +156,11 @@ class CustomDataAttributeProvider final : public DynamicAttributesProvider {
   GAttributeReader try_get_for_read(const void *owner,
                                     const AttributeIDRef &attribute_id) const final;
 
+  void try_get_for_read_many(const void *owner,
+                             Span<AttributeIDRef> attribute_ids,
+                             MutableSpan<bool> handled,
+                             MutableSpan<GAttributeReader> r_attributes) const final;
+
   GAttributeWriter try_get_for_write(void *owner, const AttributeIDRef &attribute_id) const final;
 
   bool try_delete(void *owner, const AttributeIDRef &attribute_id) const final;
@@ -281,6 +308,32 @@ inline GAttributeReader lookup(const void *owner, const AttributeIDRef &attribut
   return {};
 }
 
+template<const ComponentAttributeProviders &providers>
+inline void lookup_many(const void *owner,
+                        const Span<AttributeIDRef> attribute_ids,
+                        MutableSpan<GAttributeReader> r_attributes)
+{
+  Array<bool, 16> handled(attribute_ids.size(), false);
+  for (const int i : attribute_ids.index_range()) {
+    const AttributeIDRef &attribute_id = attribute_ids[i];
+    if (attribute_id.is_anonymous()) {
+      continue;
+    }
+    if (const BuiltinAttributeProvider *provider =
+            providers.builtin_attribute_providers().lookup_default_as(attribute_id.name(),
+                                                                      nullptr))
+    {
+      /* Builtin names are always handled here, matching #lookup, even when the attribute does
+       * not exist currently. */
+      r_attributes[i] = provider->try_get_for_read(owner);
+      handled[i] = true;
+    }
+  }
+  for (const DynamicAttributesProvider *provider : providers.dynamic_attribute_providers()) {
+    provider->try_get_for_read_many(owner, attribute_ids, handled, r_attributes);
+  }
+}
+
 template<const ComponentAttributeProviders &providers>
 inline bool for_all(const void *owner,
                     FunctionRef<bool(const AttributeIDRef &, const AttributeMetaData &)> fn)
@@ -439,6 +492,7 @@ inline AttributeAccessorFunctions accessor_functions_for_providers()
                                     nullptr,
                                     is_builtin<providers>,
                                     lookup<providers>,
+                                    lookup_many<providers>,
                                     nullptr,
                                     for_all<providers>,
                                     lookup_validator<providers>,
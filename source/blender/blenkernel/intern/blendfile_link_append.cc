@@ -33,6 +33,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -1813,12 +1814,13 @@ void BKE_blendfile_override(BlendfileLinkAppendContext *lapp_context,
 /** \name Library relocating code.
  * \{ */
 
-static void blendfile_library_relocate_remap(Main *bmain,
-                                             ID *old_id,
-                                             ID *new_id,
-                                             ReportList *reports,
-                                             const bool do_reload,
-                                             const int remap_flags)
+/**
+ * Post-process a single `old_id` -> `new_id` replacement, after all usages have been remapped in a
+ * single batched pass over the whole Main data-base. Handles fake user transfer, library hierarchy
+ * updates, and the fallback renaming of old IDs that could not be fully remapped.
+ */
+static void blendfile_library_relocate_id_postprocess(
+    Main *bmain, ID *old_id, ID *new_id, ReportList *reports, const bool do_reload)
 {
   BLI_assert(old_id);
   if (do_reload) {
@@ -1827,14 +1829,6 @@ static void blendfile_library_relocate_remap(Main *bmain,
     BLI_assert(new_id);
   }
   if (new_id) {
-    CLOG_INFO(&LOG,
-              4,
-              "Before remap of %s, old_id users: %d, new_id users: %d",
-              old_id->name,
-              old_id->us,
-              new_id->us);
-    BKE_libblock_remap_locked(bmain, old_id, new_id, remap_flags);
-
     if (old_id->flag & LIB_FAKEUSER) {
       id_fake_user_clear(old_id);
       id_fake_user_set(new_id);
@@ -1990,6 +1984,16 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
   /* Note that in reload case, we also want to replace indirect usages. */
   const int remap_flags = ID_REMAP_SKIP_NEVER_NULL_USAGE |
                           (do_reload ? 0 : ID_REMAP_SKIP_INDIRECT_USAGE);
+
+  /* Collect all `old_id -> new_id` mappings first, such that all usages can be remapped in a
+   * single pass over the whole Main data-base, instead of one full pass per reloaded ID. */
+  struct RelocateDetachedKey {
+    Key **key_p;
+    Key *old_key;
+    Key *new_key;
+  };
+  blender::bke::id::IDRemapper remapper;
+  blender::Vector<RelocateDetachedKey> detached_keys;
   for (item_idx = 0, itemlink = lapp_context->items.list; itemlink;
        item_idx++, itemlink = itemlink->next)
   {
@@ -1998,10 +2002,18 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
     ID *old_id = static_cast<ID *>(item->userdata);
     ID *new_id = item->new_id;
 
-    blendfile_library_relocate_remap(bmain, old_id, new_id, reports, do_reload, remap_flags);
+    BLI_assert(old_id);
     if (new_id == nullptr) {
       continue;
     }
+    CLOG_INFO(&LOG,
+              4,
+              "Before remap of %s, old_id users: %d, new_id users: %d",
+              old_id->name,
+              old_id->us,
+              new_id->us);
+    remapper.add(old_id, new_id);
+
     /* Usual special code for ShapeKeys snowflakes... */
     Key **old_key_p = BKE_key_from_id_p(old_id);
     if (old_key_p == nullptr) {
@@ -2010,14 +2022,39 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
     Key *old_key = *old_key_p;
     Key *new_key = BKE_key_from_id(new_id);
     if (old_key != nullptr) {
+      /* Detach the old key from its owner, such that the batched remap pass does not replace the
+       * old obdata's own shape-key pointer. It is re-attached once remapping is done. */
       *old_key_p = nullptr;
       id_us_min(&old_key->id);
-      blendfile_library_relocate_remap(
-          bmain, &old_key->id, &new_key->id, reports, do_reload, remap_flags);
-      *old_key_p = old_key;
-      id_us_plus_no_lib(&old_key->id);
+      if (new_key != nullptr) {
+        remapper.add(&old_key->id, &new_key->id);
+      }
+      detached_keys.append({old_key_p, old_key, new_key});
     }
   }
+
+  if (!remapper.is_empty()) {
+    BKE_libblock_remap_multiple_locked(bmain, remapper, remap_flags);
+  }
+
+  for (item_idx = 0, itemlink = lapp_context->items.list; itemlink;
+       item_idx++, itemlink = itemlink->next)
+  {
+    BlendfileLinkAppendContextItem *item = static_cast<BlendfileLinkAppendContextItem *>(
+        itemlink->link);
+    ID *old_id = static_cast<ID *>(item->userdata);
+    ID *new_id = item->new_id;
+
+    blendfile_library_relocate_id_postprocess(bmain, old_id, new_id, reports, do_reload);
+  }
+  for (const RelocateDetachedKey &detached_key : detached_keys) {
+    Key *old_key = detached_key.old_key;
+    Key *new_key = detached_key.new_key;
+    blendfile_library_relocate_id_postprocess(
+        bmain, &old_key->id, (new_key != nullptr) ? &new_key->id : nullptr, reports, do_reload);
+    *detached_key.key_p = old_key;
+    id_us_plus_no_lib(&old_key->id);
+  }
   BKE_layer_collection_resync_allow();
   BKE_main_collection_sync_remap(bmain);
 
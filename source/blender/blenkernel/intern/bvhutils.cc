@@ -34,11 +34,235 @@ struct BVHCacheItem {
   BVHTree *tree;
 };
 
+/**
+ * Identifies one of the geometry arrays the cached trees were built from. The sharing info is
+ * only referenced weakly: it is used to detect whether a mesh (or a copy sharing this cache)
+ * still references the exact same data, via pointer identity and the implicit-sharing version.
+ */
+struct BVHCacheGeometryKey {
+  const blender::ImplicitSharingInfo *sharing_info;
+  int64_t version;
+};
+
+enum {
+  BVHCACHE_KEY_POSITIONS = 0,
+  BVHCACHE_KEY_EDGES = 1,
+  BVHCACHE_KEY_CORNER_VERTS = 2,
+  BVHCACHE_KEY_FACE_OFFSETS = 3,
+  /* The `.hide_*` attributes only influence the `*_NO_HIDDEN` trees, but they still have to be
+   * part of the key: a hide-only change keeps all topology arrays shared with the previous
+   * state, which would otherwise reuse trees built from the old visibility. */
+  BVHCACHE_KEY_HIDE_VERT = 4,
+  BVHCACHE_KEY_HIDE_EDGE = 5,
+  BVHCACHE_KEY_HIDE_POLY = 6,
+  BVHCACHE_GEOMETRY_KEYS_NUM = 7,
+};
+
 struct BVHCache {
   BVHCacheItem items[BVHTREE_MAX_ITEM];
+  BVHCacheGeometryKey keys[BVHCACHE_GEOMETRY_KEYS_NUM];
   ThreadMutex mutex;
 };
 
+/**
+ * Gather the sharing info of every mesh array the cached trees depend on. Missing layers (e.g. on
+ * an empty mesh, or when nothing is hidden) are simply null.
+ */
+static void bvhcache_geometry_sharing_info_get(
+    const Mesh &mesh, const blender::ImplicitSharingInfo *r_infos[BVHCACHE_GEOMETRY_KEYS_NUM])
+{
+  const blender::bke::AttributeAccessor attributes = mesh.attributes();
+  r_infos[BVHCACHE_KEY_POSITIONS] = attributes.lookup("position").sharing_info;
+  r_infos[BVHCACHE_KEY_EDGES] = attributes.lookup(".edge_verts").sharing_info;
+  r_infos[BVHCACHE_KEY_CORNER_VERTS] = attributes.lookup(".corner_vert").sharing_info;
+  r_infos[BVHCACHE_KEY_FACE_OFFSETS] = mesh.runtime->face_offsets_sharing_info;
+  r_infos[BVHCACHE_KEY_HIDE_VERT] = attributes.lookup(".hide_vert").sharing_info;
+  r_infos[BVHCACHE_KEY_HIDE_EDGE] = attributes.lookup(".hide_edge").sharing_info;
+  r_infos[BVHCACHE_KEY_HIDE_POLY] = attributes.lookup(".hide_poly").sharing_info;
+}
+
+/**
+ * True when the cached trees were built from exactly the data the mesh currently references.
+ * Pointer identity alone is not enough because data with a single owner is modified in place;
+ * that bumps the implicit-sharing version (see #ImplicitSharingInfo::tag_ensured_mutable).
+ */
+static bool bvhcache_keys_match(
+    const BVHCache &bvh_cache,
+    const blender::ImplicitSharingInfo *const infos[BVHCACHE_GEOMETRY_KEYS_NUM])
+{
+  for (const int i : IndexRange(BVHCACHE_GEOMETRY_KEYS_NUM)) {
+    const BVHCacheGeometryKey &key = bvh_cache.keys[i];
+    if (key.sharing_info != infos[i]) {
+      return false;
+    }
+    if (key.sharing_info && key.sharing_info->version() != key.version) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::shared_ptr<BVHCache> bvhcache_init_shared(
+    const blender::ImplicitSharingInfo *const infos[BVHCACHE_GEOMETRY_KEYS_NUM])
+{
+  std::shared_ptr<BVHCache> cache(bvhcache_init(), [](BVHCache *ptr) { bvhcache_free(ptr); });
+  for (const int i : IndexRange(BVHCACHE_GEOMETRY_KEYS_NUM)) {
+    cache->keys[i].sharing_info = infos[i];
+    if (infos[i]) {
+      infos[i]->add_weak_user();
+      cache->keys[i].version = infos[i]->version();
+    }
+  }
+  return cache;
+}
+
+static void bvhcache_item_clear(BVHCacheItem &item)
+{
+  BLI_bvhtree_free(item.tree);
+  item.tree = nullptr;
+  item.is_filled = false;
+}
+
+/**
+ * Update the cached trees in place after a position-only change (same topology arrays, new
+ * vertex positions). Leaf bounds are recomputed and propagated bottom-up with
+ * #BLI_bvhtree_update_tree, which is much cheaper than building and balancing new trees. Trees
+ * built with an element mask (loose/no-hidden variants) store their leaves in compacted insertion
+ * order which cannot be mapped back to element indices here; those are freed and rebuilt on
+ * demand.
+ *
+ * \return False when the trees cannot be refitted because a topology array changed as well.
+ */
+static bool bvhcache_try_refit_for_positions(
+    BVHCache &bvh_cache,
+    const Mesh &mesh,
+    const blender::ImplicitSharingInfo *const infos[BVHCACHE_GEOMETRY_KEYS_NUM])
+{
+  using blender::int2;
+  /* Only the positions may differ; when any topology array changed, the cached leaf indices no
+   * longer reference the right elements, and when visibility changed the `*_NO_HIDDEN` trees
+   * include the wrong elements. */
+  for (const int i : IndexRange(1, BVHCACHE_GEOMETRY_KEYS_NUM - 1)) {
+    const BVHCacheGeometryKey &key = bvh_cache.keys[i];
+    if (key.sharing_info != infos[i]) {
+      return false;
+    }
+    if (key.sharing_info && key.sharing_info->version() != key.version) {
+      return false;
+    }
+  }
+
+  const Span<float3> positions = mesh.vert_positions();
+
+  for (int t = 0; t < BVHTREE_MAX_ITEM; t++) {
+    BVHCacheItem &item = bvh_cache.items[t];
+    if (!item.is_filled) {
+      continue;
+    }
+    const int leafs_num = item.tree ? BLI_bvhtree_get_len(item.tree) : 0;
+    switch (BVHCacheType(t)) {
+      case BVHTREE_FROM_VERTS: {
+        if (leafs_num != positions.size()) {
+          bvhcache_item_clear(item);
+          break;
+        }
+        for (const int i : positions.index_range()) {
+          BLI_bvhtree_update_node(item.tree, i, positions[i], nullptr, 1);
+        }
+        break;
+      }
+      case BVHTREE_FROM_EDGES: {
+        const Span<int2> edges = mesh.edges();
+        if (leafs_num != edges.size()) {
+          bvhcache_item_clear(item);
+          break;
+        }
+        for (const int i : edges.index_range()) {
+          float co[2][3];
+          copy_v3_v3(co[0], positions[edges[i][0]]);
+          copy_v3_v3(co[1], positions[edges[i][1]]);
+          BLI_bvhtree_update_node(item.tree, i, co[0], nullptr, 2);
+        }
+        break;
+      }
+      case BVHTREE_FROM_FACES: {
+        const MFace *face = (const MFace *)CustomData_get_layer(&mesh.fdata_legacy, CD_MFACE);
+        if (leafs_num != mesh.totface_legacy || face == nullptr) {
+          bvhcache_item_clear(item);
+          break;
+        }
+        for (int i = 0; i < mesh.totface_legacy; i++) {
+          float co[4][3];
+          copy_v3_v3(co[0], positions[face[i].v1]);
+          copy_v3_v3(co[1], positions[face[i].v2]);
+          copy_v3_v3(co[2], positions[face[i].v3]);
+          if (face[i].v4) {
+            copy_v3_v3(co[3], positions[face[i].v4]);
+          }
+          BLI_bvhtree_update_node(item.tree, i, co[0], nullptr, face[i].v4 ? 4 : 3);
+        }
+        break;
+      }
+      case BVHTREE_FROM_CORNER_TRIS: {
+        const Span<int> corner_verts = mesh.corner_verts();
+        const Span<int3> corner_tris = mesh.corner_tris();
+        if (leafs_num != corner_tris.size()) {
+          bvhcache_item_clear(item);
+          break;
+        }
+        for (const int i : corner_tris.index_range()) {
+          float co[3][3];
+          copy_v3_v3(co[0], positions[corner_verts[corner_tris[i][0]]]);
+          copy_v3_v3(co[1], positions[corner_verts[corner_tris[i][1]]]);
+          copy_v3_v3(co[2], positions[corner_verts[corner_tris[i][2]]]);
+          BLI_bvhtree_update_node(item.tree, i, co[0], nullptr, 3);
+        }
+        break;
+      }
+      default: {
+        bvhcache_item_clear(item);
+        break;
+      }
+    }
+    if (item.is_filled && item.tree) {
+      BLI_bvhtree_update_tree(item.tree);
+    }
+  }
+
+  /* The trees now reflect the current positions. */
+  BVHCacheGeometryKey &key = bvh_cache.keys[BVHCACHE_KEY_POSITIONS];
+  if (key.sharing_info) {
+    key.sharing_info->remove_weak_user_and_delete_if_last();
+  }
+  key.sharing_info = infos[BVHCACHE_KEY_POSITIONS];
+  if (key.sharing_info) {
+    key.sharing_info->add_weak_user();
+    key.version = key.sharing_info->version();
+  }
+  return true;
+}
+
+void bvhcache_tag_positions_changed(const Mesh &mesh)
+{
+  std::shared_ptr<BVHCache> &bvh_cache_p = mesh.runtime->bvh_cache;
+  if (!bvh_cache_p) {
+    return;
+  }
+  const blender::ImplicitSharingInfo *positions_info =
+      mesh.attributes().lookup("position").sharing_info;
+  const BVHCacheGeometryKey &key = bvh_cache_p->keys[BVHCACHE_KEY_POSITIONS];
+  if (key.sharing_info == positions_info &&
+      (!positions_info || positions_info->version() == key.version))
+  {
+    /* The change is not detectable through the implicit-sharing version (the data was modified
+     * through a pointer acquired before the trees were built). Without a version to compare
+     * against, the trees cannot be validated or refitted later, so drop them. */
+    bvh_cache_p.reset();
+  }
+  /* Otherwise keep the trees: the next #BKE_bvhtree_from_mesh_get detects the version change and
+   * refits them in place instead of rebuilding. */
+}
+
 /**
  * Queries a bvhcache for the cache bvhtree of the request type
  *
@@ -47,28 +271,32 @@ struct BVHCache {
  *
  * When `r_locked` is used the `mesh_eval_mutex` must contain the `MeshRuntime.eval_mutex`.
  */
-static bool bvhcache_find(BVHCache **bvh_cache_p,
+static bool bvhcache_find(std::shared_ptr<BVHCache> &bvh_cache_p,
                           BVHCacheType type,
                           BVHTree **r_tree,
                           bool *r_locked,
-                          std::mutex *mesh_eval_mutex)
+                          std::mutex *mesh_eval_mutex,
+                          const blender::ImplicitSharingInfo *const
+                              geometry_infos[BVHCACHE_GEOMETRY_KEYS_NUM])
 {
   bool do_lock = r_locked;
   if (r_locked) {
     *r_locked = false;
   }
-  if (*bvh_cache_p == nullptr) {
+  if (!bvh_cache_p || !bvhcache_keys_match(*bvh_cache_p, geometry_infos)) {
     if (!do_lock) {
-      /* Cache does not exist and no lock is requested. */
+      /* Cache does not exist (or is stale) and no lock is requested. */
       return false;
     }
-    /* Lazy initialization of the bvh_cache using the `mesh_eval_mutex`. */
+    /* Lazy initialization of the bvh_cache using the `mesh_eval_mutex`. When the cache is stale
+     * (typically inherited from a copy whose geometry has since diverged), only this mesh's
+     * reference is replaced; other meshes sharing the old cache keep their trees. */
     std::lock_guard lock{*mesh_eval_mutex};
-    if (*bvh_cache_p == nullptr) {
-      *bvh_cache_p = bvhcache_init();
+    if (!bvh_cache_p || !bvhcache_keys_match(*bvh_cache_p, geometry_infos)) {
+      bvh_cache_p = bvhcache_init_shared(geometry_infos);
     }
   }
-  BVHCache *bvh_cache = *bvh_cache_p;
+  BVHCache *bvh_cache = bvh_cache_p.get();
 
   if (bvh_cache->items[type].is_filled) {
     *r_tree = bvh_cache->items[type].tree;
@@ -76,7 +304,7 @@ static bool bvhcache_find(BVHCache **bvh_cache_p,
   }
   if (do_lock) {
     BLI_mutex_lock(&bvh_cache->mutex);
-    bool in_cache = bvhcache_find(bvh_cache_p, type, r_tree, nullptr, nullptr);
+    bool in_cache = bvhcache_find(bvh_cache_p, type, r_tree, nullptr, nullptr, geometry_infos);
     if (in_cache) {
       BLI_mutex_unlock(&bvh_cache->mutex);
       return in_cache;
@@ -136,6 +364,11 @@ void bvhcache_free(BVHCache *bvh_cache)
     BLI_bvhtree_free(item->tree);
     item->tree = nullptr;
   }
+  for (const int i : IndexRange(BVHCACHE_GEOMETRY_KEYS_NUM)) {
+    if (bvh_cache->keys[i].sharing_info) {
+      bvh_cache->keys[i].sharing_info->remove_weak_user_and_delete_if_last();
+    }
+  }
   BLI_mutex_end(&bvh_cache->mutex);
   MEM_freeN(bvh_cache);
 }
@@ -903,7 +1136,10 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
 {
   using namespace blender;
   using namespace blender::bke;
-  BVHCache **bvh_cache_p = (BVHCache **)&mesh->runtime->bvh_cache;
+  std::shared_ptr<BVHCache> &bvh_cache_p = mesh->runtime->bvh_cache;
+
+  const ImplicitSharingInfo *geometry_infos[BVHCACHE_GEOMETRY_KEYS_NUM];
+  bvhcache_geometry_sharing_info_get(*mesh, geometry_infos);
 
   Span<int3> corner_tris;
   if (ELEM(bvh_cache_type, BVHTREE_FROM_CORNER_TRIS, BVHTREE_FROM_CORNER_TRIS_NO_HIDDEN)) {
@@ -924,9 +1160,25 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
                                (const MFace *)CustomData_get_layer(&mesh->fdata_legacy, CD_MFACE),
                                data);
 
+  /* For a purely deforming change (same topology arrays, new positions), update the cached trees
+   * in place instead of rebuilding them. This is only possible when no other mesh shares the
+   * cache, since other meshes may still reference the previous positions. */
+  if (bvh_cache_p && !bvhcache_keys_match(*bvh_cache_p, geometry_infos)) {
+    std::lock_guard lock{mesh->runtime->eval_mutex};
+    if (bvh_cache_p && bvh_cache_p.use_count() == 1 &&
+        !bvhcache_keys_match(*bvh_cache_p, geometry_infos))
+    {
+      bvhcache_try_refit_for_positions(*bvh_cache_p, *mesh, geometry_infos);
+    }
+  }
+
   bool lock_started = false;
-  data->cached = bvhcache_find(
-      bvh_cache_p, bvh_cache_type, &data->tree, &lock_started, &mesh->runtime->eval_mutex);
+  data->cached = bvhcache_find(bvh_cache_p,
+                               bvh_cache_type,
+                               &data->tree,
+                               &lock_started,
+                               &mesh->runtime->eval_mutex,
+                               geometry_infos);
 
   if (data->cached) {
     BLI_assert(lock_started == false);
@@ -1014,8 +1266,8 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
   // printf("BVHTree built and saved on cache\n");
   BLI_assert(data->cached == false);
   data->cached = true;
-  bvhcache_insert(*bvh_cache_p, data->tree, bvh_cache_type);
-  bvhcache_unlock(*bvh_cache_p, lock_started);
+  bvhcache_insert(bvh_cache_p.get(), data->tree, bvh_cache_type);
+  bvhcache_unlock(bvh_cache_p.get(), lock_started);
 
 #ifndef NDEBUG
   if (data->tree != nullptr) {
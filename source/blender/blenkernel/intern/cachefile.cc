@@ -18,6 +18,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -47,6 +48,12 @@
 #endif
 
 static void cachefile_handle_free(CacheFile *cache_file);
+static void cachefile_prefetch_discard(const CacheFile *cache_file);
+static bool cachefile_filepath_get(const Main *bmain,
+                                   const Depsgraph *depsgraph,
+                                   const CacheFile *cache_file,
+                                   double ctime,
+                                   char r_filepath[FILE_MAX]);
 
 static void cache_file_init_data(ID *id)
 {
@@ -78,6 +85,9 @@ static void cache_file_free_data(ID *id)
 {
   CacheFile *cache_file = (CacheFile *)id;
   cachefile_handle_free(cache_file);
+  if ((id->tag & LIB_TAG_COPIED_ON_EVAL) == 0) {
+    cachefile_prefetch_discard(cache_file);
+  }
   BLI_freelistN(&cache_file->object_paths);
   BLI_freelistN(&cache_file->layers);
 }
@@ -153,6 +163,242 @@ IDTypeInfo IDType_ID_CF = {
 /* TODO: make this per cache file to avoid global locks. */
 static SpinLock spin;
 
+/* -------------------------------------------------------------------- */
+/** \name Handle Prefetching for File Sequences
+ *
+ * For per-frame cache file sequences, every frame change has to open and parse a whole new
+ * archive, which makes playback hitch on each frame's disk read. While the handle for the current
+ * frame is in use, a background task already opens the archive for the next frame in the
+ * sequence; the next evaluation then adopts the prefetched handle instead of blocking on the open
+ * itself.
+ * \{ */
+
+#if defined(WITH_ALEMBIC) || defined(WITH_USD)
+
+struct PrefetchedHandle {
+  char type; /* eCacheFileType */
+  char filepath[FILE_MAX];
+  CacheArchiveHandle *handle;
+  ListBase object_paths;
+};
+
+struct PrefetchTask {
+  /** Original #CacheFile this prefetch is for; only used as a key. */
+  const CacheFile *key;
+  Main *bmain;
+  char type; /* eCacheFileType */
+  char filepath[FILE_MAX];
+  /** Copy of the evaluated cache file's layers; the evaluated copy may be freed concurrently. */
+  ListBase layers;
+};
+
+/** Opens archives in the background, one at a time. Created lazily, guarded by `spin`. */
+static TaskPool *prefetch_pool = nullptr;
+/** Maps original #CacheFile IDs to their prefetched handle, if any. Guarded by `spin`. */
+static GHash *prefetched_handles = nullptr;
+
+static void prefetched_handle_free(PrefetchedHandle *prefetched)
+{
+  if (prefetched->handle) {
+    switch (prefetched->type) {
+      case CACHEFILE_TYPE_ALEMBIC:
+#  ifdef WITH_ALEMBIC
+        ABC_free_handle(prefetched->handle);
+#  endif
+        break;
+      case CACHEFILE_TYPE_USD:
+#  ifdef WITH_USD
+        blender::io::usd::USD_free_handle(prefetched->handle);
+#  endif
+        break;
+      case CACHE_FILE_TYPE_INVALID:
+        break;
+    }
+  }
+  BLI_freelistN(&prefetched->object_paths);
+  MEM_freeN(prefetched);
+}
+
+static void prefetched_handle_free_cb(void *prefetched)
+{
+  prefetched_handle_free(static_cast<PrefetchedHandle *>(prefetched));
+}
+
+static void cachefile_prefetch_task_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  PrefetchTask *task = static_cast<PrefetchTask *>(taskdata);
+
+  /* Skip if an earlier task already prefetched this file path. */
+  BLI_spin_lock(&spin);
+  PrefetchedHandle *existing = prefetched_handles ?
+                                   static_cast<PrefetchedHandle *>(
+                                       BLI_ghash_lookup(prefetched_handles, task->key)) :
+                                   nullptr;
+  const bool already_done = existing && STREQ(existing->filepath, task->filepath);
+  BLI_spin_unlock(&spin);
+  if (already_done) {
+    return;
+  }
+
+  CacheArchiveHandle *handle = nullptr;
+  ListBase object_paths = {nullptr, nullptr};
+
+  switch (task->type) {
+    case CACHEFILE_TYPE_ALEMBIC:
+#  ifdef WITH_ALEMBIC
+      handle = ABC_create_handle(task->bmain,
+                                 task->filepath,
+                                 static_cast<const CacheFileLayer *>(task->layers.first),
+                                 &object_paths);
+#  endif
+      break;
+    case CACHEFILE_TYPE_USD:
+#  ifdef WITH_USD
+      handle = blender::io::usd::USD_create_handle(task->bmain, task->filepath, &object_paths);
+#  endif
+      break;
+    case CACHE_FILE_TYPE_INVALID:
+      break;
+  }
+
+  if (handle == nullptr) {
+    BLI_freelistN(&object_paths);
+    return;
+  }
+
+  PrefetchedHandle *prefetched = MEM_cnew<PrefetchedHandle>(__func__);
+  prefetched->type = task->type;
+  STRNCPY(prefetched->filepath, task->filepath);
+  prefetched->handle = handle;
+  prefetched->object_paths = object_paths;
+
+  BLI_spin_lock(&spin);
+  if (prefetched_handles == nullptr) {
+    prefetched_handles = BLI_ghash_ptr_new("CacheFile prefetched handles");
+  }
+  PrefetchedHandle *old = static_cast<PrefetchedHandle *>(
+      BLI_ghash_popkey(prefetched_handles, (void *)task->key, nullptr));
+  BLI_ghash_insert(prefetched_handles, (void *)task->key, prefetched);
+  BLI_spin_unlock(&spin);
+
+  if (old) {
+    prefetched_handle_free(old);
+  }
+}
+
+static void cachefile_prefetch_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  PrefetchTask *task = static_cast<PrefetchTask *>(taskdata);
+  BLI_freelistN(&task->layers);
+  MEM_freeN(task);
+}
+
+#endif /* WITH_ALEMBIC || WITH_USD */
+
+/**
+ * Take over a handle that a background task opened for this file path, if there is one.
+ * On success the handle, object paths and handle file path of \a cache_file are set.
+ */
+static bool cachefile_prefetched_handle_adopt(CacheFile *cache_file, const char *filepath)
+{
+#if defined(WITH_ALEMBIC) || defined(WITH_USD)
+  const CacheFile *key = (const CacheFile *)DEG_get_original_id(&cache_file->id);
+
+  BLI_spin_lock(&spin);
+  PrefetchedHandle *prefetched = prefetched_handles ?
+                                     static_cast<PrefetchedHandle *>(BLI_ghash_popkey(
+                                         prefetched_handles, (void *)key, nullptr)) :
+                                     nullptr;
+  BLI_spin_unlock(&spin);
+
+  if (prefetched == nullptr) {
+    return false;
+  }
+  if (!STREQ(prefetched->filepath, filepath)) {
+    /* Prefetched for a frame we did not end up on (e.g. when scrubbing); discard. */
+    prefetched_handle_free(prefetched);
+    return false;
+  }
+
+  cache_file->type = prefetched->type;
+  cache_file->handle = prefetched->handle;
+  cache_file->object_paths = prefetched->object_paths;
+  STRNCPY(cache_file->handle_filepath, filepath);
+  MEM_freeN(prefetched);
+  return true;
+#else
+  UNUSED_VARS(cache_file, filepath);
+  return false;
+#endif
+}
+
+/**
+ * Open the archive for the next frame of the sequence in the background, so the next frame
+ * change can adopt it instead of blocking on the disk read.
+ */
+static void cachefile_prefetch_schedule(Main *bmain, Depsgraph *depsgraph, CacheFile *cache_file)
+{
+#if defined(WITH_ALEMBIC) || defined(WITH_USD)
+  Scene *scene = DEG_get_evaluated_scene(depsgraph);
+  /* Prefetch in forward playback direction only. */
+  const double next_ctime = double(BKE_scene_ctime_get(scene)) + double(scene->r.frame_step);
+
+  char filepath[FILE_MAX];
+  if (!cachefile_filepath_get(bmain, depsgraph, cache_file, next_ctime, filepath)) {
+    return;
+  }
+  if (STREQ(filepath, cache_file->handle_filepath)) {
+    return;
+  }
+
+  PrefetchTask *task = MEM_cnew<PrefetchTask>(__func__);
+  task->key = (const CacheFile *)DEG_get_original_id(&cache_file->id);
+  task->bmain = bmain;
+  task->type = cache_file->type;
+  STRNCPY(task->filepath, filepath);
+  BLI_duplicatelist(&task->layers, &cache_file->layers);
+
+  BLI_spin_lock(&spin);
+  if (prefetch_pool == nullptr) {
+    prefetch_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  BLI_spin_unlock(&spin);
+
+  BLI_task_pool_push(
+      prefetch_pool, cachefile_prefetch_task_run, task, true, cachefile_prefetch_task_free);
+#else
+  UNUSED_VARS(bmain, depsgraph, cache_file);
+#endif
+}
+
+static void cachefile_prefetch_discard(const CacheFile *cache_file)
+{
+#if defined(WITH_ALEMBIC) || defined(WITH_USD)
+  /* Stop pending background opens first; they might still insert a handle for this file, which
+   * would leave a stale entry keyed by a freed ID. */
+  BLI_spin_lock(&spin);
+  TaskPool *pool = prefetch_pool;
+  BLI_spin_unlock(&spin);
+  if (pool) {
+    BLI_task_pool_cancel(pool);
+  }
+
+  BLI_spin_lock(&spin);
+  PrefetchedHandle *prefetched = prefetched_handles ?
+                                     static_cast<PrefetchedHandle *>(BLI_ghash_popkey(
+                                         prefetched_handles, (void *)cache_file, nullptr)) :
+                                     nullptr;
+  BLI_spin_unlock(&spin);
+  if (prefetched) {
+    prefetched_handle_free(prefetched);
+  }
+#else
+  UNUSED_VARS(cache_file);
+#endif
+}
+
+/** \} */
+
 void BKE_cachefiles_init()
 {
   BLI_spin_init(&spin);
@@ -160,6 +406,16 @@ void BKE_cachefiles_init()
 
 void BKE_cachefiles_exit()
 {
+#if defined(WITH_ALEMBIC) || defined(WITH_USD)
+  if (prefetch_pool) {
+    BLI_task_pool_free(prefetch_pool);
+    prefetch_pool = nullptr;
+  }
+  if (prefetched_handles) {
+    BLI_ghash_free(prefetched_handles, nullptr, prefetched_handle_free_cb);
+    prefetched_handles = nullptr;
+  }
+#endif
   BLI_spin_end(&spin);
 }
 
@@ -351,8 +607,11 @@ void BKE_cachefile_eval(Main *bmain, Depsgraph *depsgraph, CacheFile *cache_file
   cachefile_handle_free(cache_file);
   BLI_freelistN(&cache_file->object_paths);
 
+  /* Use a handle that was already opened in the background for this file path, if any. */
+  const bool adopted = cachefile_prefetched_handle_adopt(cache_file, filepath);
+
 #ifdef WITH_ALEMBIC
-  if (BLI_path_extension_check_glob(filepath, "*abc")) {
+  if (!adopted && BLI_path_extension_check_glob(filepath, "*abc")) {
     cache_file->type = CACHEFILE_TYPE_ALEMBIC;
     cache_file->handle = ABC_create_handle(
         bmain,
@@ -363,13 +622,22 @@ void BKE_cachefile_eval(Main *bmain, Depsgraph *depsgraph, CacheFile *cache_file
   }
 #endif
 #ifdef WITH_USD
-  if (BLI_path_extension_check_glob(filepath, "*.usd;*.usda;*.usdc;*.usdz")) {
+  if (!adopted && BLI_path_extension_check_glob(filepath, "*.usd;*.usda;*.usdc;*.usdz")) {
     cache_file->type = CACHEFILE_TYPE_USD;
     cache_file->handle = blender::io::usd::USD_create_handle(
         bmain, filepath, &cache_file->object_paths);
     STRNCPY(cache_file->handle_filepath, filepath);
   }
 #endif
+#if !defined(WITH_ALEMBIC) && !defined(WITH_USD)
+  UNUSED_VARS(adopted);
+#endif
+
+  /* While this frame's handle is in use, already open the archive for the next frame of the
+   * sequence in the background. */
+  if (cache_file->is_sequence && cache_file->handle) {
+    cachefile_prefetch_schedule(bmain, depsgraph, cache_file);
+  }
 
   if (DEG_is_active(depsgraph)) {
     /* Flush object paths back to original data-block for UI. */
@@ -379,10 +647,11 @@ void BKE_cachefile_eval(Main *bmain, Depsgraph *depsgraph, CacheFile *cache_file
   }
 }
 
-bool BKE_cachefile_filepath_get(const Main *bmain,
-                                const Depsgraph *depsgraph,
-                                const CacheFile *cache_file,
-                                char r_filepath[FILE_MAX])
+static bool cachefile_filepath_get(const Main *bmain,
+                                   const Depsgraph *depsgraph,
+                                   const CacheFile *cache_file,
+                                   const double ctime,
+                                   char r_filepath[FILE_MAX])
 {
   BLI_strncpy(r_filepath, cache_file->filepath, FILE_MAX);
   BLI_path_abs(r_filepath, ID_BLEND_PATH(bmain, &cache_file->id));
@@ -392,9 +661,8 @@ bool BKE_cachefile_filepath_get(const Main *bmain,
 
   if (cache_file->is_sequence && BLI_path_frame_get(r_filepath, &fframe, &frame_len)) {
     Scene *scene = DEG_get_evaluated_scene(depsgraph);
-    const float ctime = BKE_scene_ctime_get(scene);
     const double fps = double(scene->r.frs_sec) / double(scene->r.frs_sec_base);
-    const int frame = int(BKE_cachefile_time_offset(cache_file, double(ctime), fps));
+    const int frame = int(BKE_cachefile_time_offset(cache_file, ctime, fps));
 
     char ext[32];
     BLI_path_frame_strip(r_filepath, ext, sizeof(ext));
@@ -408,6 +676,16 @@ bool BKE_cachefile_filepath_get(const Main *bmain,
   return true;
 }
 
+bool BKE_cachefile_filepath_get(const Main *bmain,
+                                const Depsgraph *depsgraph,
+                                const CacheFile *cache_file,
+                                char r_filepath[FILE_MAX])
+{
+  const Scene *scene = DEG_get_evaluated_scene(depsgraph);
+  const double ctime = double(BKE_scene_ctime_get(scene));
+  return cachefile_filepath_get(bmain, depsgraph, cache_file, ctime, r_filepath);
+}
+
 double BKE_cachefile_time_offset(const CacheFile *cache_file, const double time, const double fps)
 {
   const double time_offset = double(cache_file->frame_offset) / fps;
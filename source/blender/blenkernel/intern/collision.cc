@@ -621,9 +621,31 @@ DO_INLINE void collision_interpolateOnTriangle(float to[3],
   VECADDMUL(to, v3, w3);
 }
 
+/* Per-vertex impulse accumulator, mirroring #ClothVertex::impulse and
+ * #ClothVertex::impulse_count. Collision responses for individual pairs run in
+ * parallel, each task accumulating into its own copy of the array. The copies
+ * are merged by #cloth_collision_response_reduce; since the element-wise
+ * abs-max used by #cloth_collision_impulse_vert is commutative, the merged
+ * result matches serial accumulation. */
+struct ColResponseVertImpulse {
+  float impulse[3];
+  int impulse_count;
+};
+
+struct ColResponseData {
+  ClothModifierData *clmd;
+  /* Collision object data, null for self-collision. */
+  CollisionModifierData *collmd;
+  Object *collob;
+  CollPair *collisions;
+  float dt;
+  /* Shared flag, only ever written `true` (compare #ColDetectData::collided). */
+  bool responded;
+};
+
 static void cloth_collision_impulse_vert(const float clamp_sq,
                                          const float impulse[3],
-                                         ClothVertex *vert)
+                                         ColResponseVertImpulse *r_vert_impulse)
 {
   float impulse_len_sq = len_squared_v3(impulse);
 
@@ -631,256 +653,280 @@ static void cloth_collision_impulse_vert(const float clamp_sq,
     return;
   }
 
-  if (fabsf(vert->impulse[0]) < fabsf(impulse[0])) {
-    vert->impulse[0] = impulse[0];
+  if (fabsf(r_vert_impulse->impulse[0]) < fabsf(impulse[0])) {
+    r_vert_impulse->impulse[0] = impulse[0];
   }
 
-  if (fabsf(vert->impulse[1]) < fabsf(impulse[1])) {
-    vert->impulse[1] = impulse[1];
+  if (fabsf(r_vert_impulse->impulse[1]) < fabsf(impulse[1])) {
+    r_vert_impulse->impulse[1] = impulse[1];
   }
 
-  if (fabsf(vert->impulse[2]) < fabsf(impulse[2])) {
-    vert->impulse[2] = impulse[2];
+  if (fabsf(r_vert_impulse->impulse[2]) < fabsf(impulse[2])) {
+    r_vert_impulse->impulse[2] = impulse[2];
   }
 
-  vert->impulse_count++;
+  r_vert_impulse->impulse_count++;
 }
 
-static int cloth_collision_response_static(ClothModifierData *clmd,
-                                           CollisionModifierData *collmd,
-                                           Object *collob,
-                                           CollPair *collpair,
-                                           uint collision_count,
-                                           const float dt)
+static void cloth_collision_response(void *__restrict userdata,
+                                     const int index,
+                                     const TaskParallelTLS *__restrict tls)
 {
-  int result = 0;
+  ColResponseData *data = static_cast<ColResponseData *>(userdata);
+  ClothModifierData *clmd = data->clmd;
+  CollisionModifierData *collmd = data->collmd;
   Cloth *cloth = clmd->clothObject;
-  const float clamp_sq = square_f(clmd->coll_parms->clamp * dt);
+  CollPair *collpair = &data->collisions[index];
+  ColResponseVertImpulse *vert_impulses = static_cast<ColResponseVertImpulse *>(
+      tls->userdata_chunk);
+
+  const float clamp_sq = square_f(clmd->coll_parms->clamp * data->dt);
   const float time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
   const float epsilon2 = BLI_bvhtree_get_epsilon(collmd->bvhtree);
   const float min_distance = (clmd->coll_parms->epsilon + epsilon2) * (8.0f / 9.0f);
-
   const bool is_hair = (clmd->hairdata != nullptr);
-  for (int i = 0; i < collision_count; i++, collpair++) {
-    float i1[3], i2[3], i3[3];
-    float v1[3], v2[3], relativeVelocity[3];
-    zero_v3(i1);
-    zero_v3(i2);
-    zero_v3(i3);
-
-    /* Only handle static collisions here. */
-    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
-      continue;
-    }
 
-    /* Compute barycentric coordinates and relative "velocity" for both collision points. */
-    float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
-    float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
+  int result = 0;
+  float i1[3], i2[3], i3[3];
+  float v1[3], v2[3], relativeVelocity[3];
+  zero_v3(i1);
+  zero_v3(i2);
+  zero_v3(i3);
+
+  /* Only handle static collisions here. */
+  if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+    return;
+  }
 
-    if (is_hair) {
-      interp_v3_v3v3(v1, cloth->verts[collpair->ap1].tv, cloth->verts[collpair->ap2].tv, w2);
-    }
-    else {
-      collision_interpolateOnTriangle(v1,
-                                      cloth->verts[collpair->ap1].tv,
-                                      cloth->verts[collpair->ap2].tv,
-                                      cloth->verts[collpair->ap3].tv,
-                                      w1,
-                                      w2,
-                                      w3);
-    }
+  /* Compute barycentric coordinates and relative "velocity" for both collision points. */
+  float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
+  float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
 
-    collision_interpolateOnTriangle(v2,
-                                    collmd->current_v[collpair->bp1],
-                                    collmd->current_v[collpair->bp2],
-                                    collmd->current_v[collpair->bp3],
-                                    u1,
-                                    u2,
-                                    u3);
-
-    sub_v3_v3v3(relativeVelocity, v2, v1);
-
-    /* Calculate the normal component of the relative velocity
-     * (actually only the magnitude - the direction is stored in 'normal'). */
-    const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
-    const float d = min_distance - collpair->distance;
-
-    /* If magrelVel < 0 the edges are approaching each other. */
-    if (magrelVel > 0.0f) {
-      /* Calculate Impulse magnitude to stop all motion in normal direction. */
-      float magtangent = 0, repulse = 0;
-      double impulse = 0.0;
-      float vrel_t_pre[3];
-      float temp[3];
-
-      /* Calculate tangential velocity. */
-      copy_v3_v3(temp, collpair->normal);
-      mul_v3_fl(temp, magrelVel);
-      sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
-
-      /* Decrease in magnitude of relative tangential velocity due to coulomb friction
-       * in original formula "magrelVel" should be the
-       * "change of relative velocity in normal direction". */
-      magtangent = min_ff(collob->pd->pdef_cfrict * 0.01f * magrelVel, len_v3(vrel_t_pre));
-
-      /* Apply friction impulse. */
-      if (magtangent > ALMOST_ZERO) {
-        normalize_v3(vrel_t_pre);
-
-        impulse = magtangent / 1.5;
-
-        VECADDMUL(i1, vrel_t_pre, double(w1) * impulse);
-        VECADDMUL(i2, vrel_t_pre, double(w2) * impulse);
-
-        if (!is_hair) {
-          VECADDMUL(i3, vrel_t_pre, double(w3) * impulse);
-        }
-      }
+  if (is_hair) {
+    interp_v3_v3v3(v1, cloth->verts[collpair->ap1].tv, cloth->verts[collpair->ap2].tv, w2);
+  }
+  else {
+    collision_interpolateOnTriangle(v1,
+                                    cloth->verts[collpair->ap1].tv,
+                                    cloth->verts[collpair->ap2].tv,
+                                    cloth->verts[collpair->ap3].tv,
+                                    w1,
+                                    w2,
+                                    w3);
+  }
+
+  collision_interpolateOnTriangle(v2,
+                                  collmd->current_v[collpair->bp1],
+                                  collmd->current_v[collpair->bp2],
+                                  collmd->current_v[collpair->bp3],
+                                  u1,
+                                  u2,
+                                  u3);
 
-      /* Apply velocity stopping impulse. */
-      impulse = magrelVel / 1.5f;
+  sub_v3_v3v3(relativeVelocity, v2, v1);
 
-      VECADDMUL(i1, collpair->normal, double(w1) * impulse);
-      VECADDMUL(i2, collpair->normal, double(w2) * impulse);
-      if (!is_hair) {
-        VECADDMUL(i3, collpair->normal, double(w3) * impulse);
-      }
+  /* Calculate the normal component of the relative velocity
+   * (actually only the magnitude - the direction is stored in 'normal'). */
+  const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
+  const float d = min_distance - collpair->distance;
 
-      if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
-        repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
+  /* If magrelVel < 0 the edges are approaching each other. */
+  if (magrelVel > 0.0f) {
+    /* Calculate Impulse magnitude to stop all motion in normal direction. */
+    float magtangent = 0, repulse = 0;
+    double impulse = 0.0;
+    float vrel_t_pre[3];
+    float temp[3];
 
-        /* Stay on the safe side and clamp repulse. */
-        if (impulse > ALMOST_ZERO) {
-          repulse = min_ff(repulse, 5.0f * impulse);
-        }
+    /* Calculate tangential velocity. */
+    copy_v3_v3(temp, collpair->normal);
+    mul_v3_fl(temp, magrelVel);
+    sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
 
-        repulse = max_ff(impulse, repulse);
+    /* Decrease in magnitude of relative tangential velocity due to coulomb friction
+     * in original formula "magrelVel" should be the
+     * "change of relative velocity in normal direction". */
+    magtangent = min_ff(data->collob->pd->pdef_cfrict * 0.01f * magrelVel, len_v3(vrel_t_pre));
 
-        impulse = repulse / 1.5f;
+    /* Apply friction impulse. */
+    if (magtangent > ALMOST_ZERO) {
+      normalize_v3(vrel_t_pre);
 
-        VECADDMUL(i1, collpair->normal, impulse);
-        VECADDMUL(i2, collpair->normal, impulse);
-        if (!is_hair) {
-          VECADDMUL(i3, collpair->normal, impulse);
-        }
+      impulse = magtangent / 1.5;
+
+      VECADDMUL(i1, vrel_t_pre, double(w1) * impulse);
+      VECADDMUL(i2, vrel_t_pre, double(w2) * impulse);
+
+      if (!is_hair) {
+        VECADDMUL(i3, vrel_t_pre, double(w3) * impulse);
       }
+    }
+
+    /* Apply velocity stopping impulse. */
+    impulse = magrelVel / 1.5f;
 
-      result = 1;
+    VECADDMUL(i1, collpair->normal, double(w1) * impulse);
+    VECADDMUL(i2, collpair->normal, double(w2) * impulse);
+    if (!is_hair) {
+      VECADDMUL(i3, collpair->normal, double(w3) * impulse);
     }
-    else if (d > ALMOST_ZERO) {
-      /* Stay on the safe side and clamp repulse. */
-      float repulse = d / time_multiplier;
-      float impulse = repulse / 4.5f;
 
-      VECADDMUL(i1, collpair->normal, w1 * impulse);
-      VECADDMUL(i2, collpair->normal, w2 * impulse);
+    if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
+      repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
 
-      if (!is_hair) {
-        VECADDMUL(i3, collpair->normal, w3 * impulse);
+      /* Stay on the safe side and clamp repulse. */
+      if (impulse > ALMOST_ZERO) {
+        repulse = min_ff(repulse, 5.0f * impulse);
       }
 
-      result = 1;
-    }
+      repulse = max_ff(impulse, repulse);
 
-    if (result) {
-      cloth_collision_impulse_vert(clamp_sq, i1, &cloth->verts[collpair->ap1]);
-      cloth_collision_impulse_vert(clamp_sq, i2, &cloth->verts[collpair->ap2]);
+      impulse = repulse / 1.5f;
+
+      VECADDMUL(i1, collpair->normal, impulse);
+      VECADDMUL(i2, collpair->normal, impulse);
       if (!is_hair) {
-        cloth_collision_impulse_vert(clamp_sq, i3, &cloth->verts[collpair->ap3]);
+        VECADDMUL(i3, collpair->normal, impulse);
       }
     }
+
+    result = 1;
+  }
+  else if (d > ALMOST_ZERO) {
+    /* Stay on the safe side and clamp repulse. */
+    float repulse = d / time_multiplier;
+    float impulse = repulse / 4.5f;
+
+    VECADDMUL(i1, collpair->normal, w1 * impulse);
+    VECADDMUL(i2, collpair->normal, w2 * impulse);
+
+    if (!is_hair) {
+      VECADDMUL(i3, collpair->normal, w3 * impulse);
+    }
+
+    result = 1;
   }
 
-  return result;
+  if (result) {
+    cloth_collision_impulse_vert(clamp_sq, i1, &vert_impulses[collpair->ap1]);
+    cloth_collision_impulse_vert(clamp_sq, i2, &vert_impulses[collpair->ap2]);
+    if (!is_hair) {
+      cloth_collision_impulse_vert(clamp_sq, i3, &vert_impulses[collpair->ap3]);
+    }
+
+    data->responded = true;
+  }
 }
 
-static int cloth_selfcollision_response_static(ClothModifierData *clmd,
-                                               CollPair *collpair,
-                                               uint collision_count,
-                                               const float dt)
+static void cloth_selfcollision_response(void *__restrict userdata,
+                                         const int index,
+                                         const TaskParallelTLS *__restrict tls)
 {
-  int result = 0;
+  ColResponseData *data = static_cast<ColResponseData *>(userdata);
+  ClothModifierData *clmd = data->clmd;
   Cloth *cloth = clmd->clothObject;
-  const float clamp_sq = square_f(clmd->coll_parms->self_clamp * dt);
+  CollPair *collpair = &data->collisions[index];
+  ColResponseVertImpulse *vert_impulses = static_cast<ColResponseVertImpulse *>(
+      tls->userdata_chunk);
+
+  const float clamp_sq = square_f(clmd->coll_parms->self_clamp * data->dt);
   const float time_multiplier = 1.0f / (clmd->sim_parms->dt * clmd->sim_parms->timescale);
   const float min_distance = (2.0f * clmd->coll_parms->selfepsilon) * (8.0f / 9.0f);
 
-  for (int i = 0; i < collision_count; i++, collpair++) {
-    float ia[3][3] = {{0.0f}};
-    float ib[3][3] = {{0.0f}};
-    float v1[3], v2[3], relativeVelocity[3];
+  int result = 0;
+  float ia[3][3] = {{0.0f}};
+  float ib[3][3] = {{0.0f}};
+  float v1[3], v2[3], relativeVelocity[3];
 
-    /* Only handle static collisions here. */
-    if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
-      continue;
+  /* Only handle static collisions here. */
+  if (collpair->flag & (COLLISION_IN_FUTURE | COLLISION_INACTIVE)) {
+    return;
+  }
+
+  /* Retrieve barycentric coordinates for both collision points. */
+  float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
+  float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
+
+  /* Calculate relative "velocity". */
+  collision_interpolateOnTriangle(v1,
+                                  cloth->verts[collpair->ap1].tv,
+                                  cloth->verts[collpair->ap2].tv,
+                                  cloth->verts[collpair->ap3].tv,
+                                  w1,
+                                  w2,
+                                  w3);
+
+  collision_interpolateOnTriangle(v2,
+                                  cloth->verts[collpair->bp1].tv,
+                                  cloth->verts[collpair->bp2].tv,
+                                  cloth->verts[collpair->bp3].tv,
+                                  u1,
+                                  u2,
+                                  u3);
+
+  sub_v3_v3v3(relativeVelocity, v2, v1);
+
+  /* Calculate the normal component of the relative velocity
+   * (actually only the magnitude - the direction is stored in 'normal'). */
+  const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
+  const float d = min_distance - collpair->distance;
+
+  /* TODO: Impulses should be weighed by mass as this is self col,
+   * this has to be done after mass distribution is implemented. */
+
+  /* If magrelVel < 0 the edges are approaching each other. */
+  if (magrelVel > 0.0f) {
+    /* Calculate Impulse magnitude to stop all motion in normal direction. */
+    float magtangent = 0, repulse = 0;
+    double impulse = 0.0;
+    float vrel_t_pre[3];
+    float temp[3];
+
+    /* Calculate tangential velocity. */
+    copy_v3_v3(temp, collpair->normal);
+    mul_v3_fl(temp, magrelVel);
+    sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
+
+    /* Decrease in magnitude of relative tangential velocity due to coulomb friction
+     * in original formula "magrelVel" should be the
+     * "change of relative velocity in normal direction". */
+    magtangent = min_ff(clmd->coll_parms->self_friction * 0.01f * magrelVel, len_v3(vrel_t_pre));
+
+    /* Apply friction impulse. */
+    if (magtangent > ALMOST_ZERO) {
+      normalize_v3(vrel_t_pre);
+
+      impulse = magtangent / 1.5;
+
+      VECADDMUL(ia[0], vrel_t_pre, double(w1) * impulse);
+      VECADDMUL(ia[1], vrel_t_pre, double(w2) * impulse);
+      VECADDMUL(ia[2], vrel_t_pre, double(w3) * impulse);
+
+      VECADDMUL(ib[0], vrel_t_pre, double(u1) * -impulse);
+      VECADDMUL(ib[1], vrel_t_pre, double(u2) * -impulse);
+      VECADDMUL(ib[2], vrel_t_pre, double(u3) * -impulse);
     }
 
-    /* Retrieve barycentric coordinates for both collision points. */
-    float w1 = collpair->aw1, w2 = collpair->aw2, w3 = collpair->aw3;
-    float u1 = collpair->bw1, u2 = collpair->bw2, u3 = collpair->bw3;
+    /* Apply velocity stopping impulse. */
+    impulse = magrelVel / 3.0f;
 
-    /* Calculate relative "velocity". */
-    collision_interpolateOnTriangle(v1,
-                                    cloth->verts[collpair->ap1].tv,
-                                    cloth->verts[collpair->ap2].tv,
-                                    cloth->verts[collpair->ap3].tv,
-                                    w1,
-                                    w2,
-                                    w3);
+    VECADDMUL(ia[0], collpair->normal, double(w1) * impulse);
+    VECADDMUL(ia[1], collpair->normal, double(w2) * impulse);
+    VECADDMUL(ia[2], collpair->normal, double(w3) * impulse);
 
-    collision_interpolateOnTriangle(v2,
-                                    cloth->verts[collpair->bp1].tv,
-                                    cloth->verts[collpair->bp2].tv,
-                                    cloth->verts[collpair->bp3].tv,
-                                    u1,
-                                    u2,
-                                    u3);
-
-    sub_v3_v3v3(relativeVelocity, v2, v1);
-
-    /* Calculate the normal component of the relative velocity
-     * (actually only the magnitude - the direction is stored in 'normal'). */
-    const float magrelVel = dot_v3v3(relativeVelocity, collpair->normal);
-    const float d = min_distance - collpair->distance;
-
-    /* TODO: Impulses should be weighed by mass as this is self col,
-     * this has to be done after mass distribution is implemented. */
-
-    /* If magrelVel < 0 the edges are approaching each other. */
-    if (magrelVel > 0.0f) {
-      /* Calculate Impulse magnitude to stop all motion in normal direction. */
-      float magtangent = 0, repulse = 0;
-      double impulse = 0.0;
-      float vrel_t_pre[3];
-      float temp[3];
-
-      /* Calculate tangential velocity. */
-      copy_v3_v3(temp, collpair->normal);
-      mul_v3_fl(temp, magrelVel);
-      sub_v3_v3v3(vrel_t_pre, relativeVelocity, temp);
-
-      /* Decrease in magnitude of relative tangential velocity due to coulomb friction
-       * in original formula "magrelVel" should be the
-       * "change of relative velocity in normal direction". */
-      magtangent = min_ff(clmd->coll_parms->self_friction * 0.01f * magrelVel, len_v3(vrel_t_pre));
-
-      /* Apply friction impulse. */
-      if (magtangent > ALMOST_ZERO) {
-        normalize_v3(vrel_t_pre);
-
-        impulse = magtangent / 1.5;
-
-        VECADDMUL(ia[0], vrel_t_pre, double(w1) * impulse);
-        VECADDMUL(ia[1], vrel_t_pre, double(w2) * impulse);
-        VECADDMUL(ia[2], vrel_t_pre, double(w3) * impulse);
-
-        VECADDMUL(ib[0], vrel_t_pre, double(u1) * -impulse);
-        VECADDMUL(ib[1], vrel_t_pre, double(u2) * -impulse);
-        VECADDMUL(ib[2], vrel_t_pre, double(u3) * -impulse);
+    VECADDMUL(ib[0], collpair->normal, double(u1) * -impulse);
+    VECADDMUL(ib[1], collpair->normal, double(u2) * -impulse);
+    VECADDMUL(ib[2], collpair->normal, double(u3) * -impulse);
+
+    if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
+      repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
+
+      if (impulse > ALMOST_ZERO) {
+        repulse = min_ff(repulse, 5.0 * impulse);
       }
 
-      /* Apply velocity stopping impulse. */
-      impulse = magrelVel / 3.0f;
+      repulse = max_ff(impulse, repulse);
+      impulse = repulse / 1.5f;
 
       VECADDMUL(ia[0], collpair->normal, double(w1) * impulse);
       VECADDMUL(ia[1], collpair->normal, double(w2) * impulse);
@@ -889,56 +935,136 @@ static int cloth_selfcollision_response_static(ClothModifierData *clmd,
       VECADDMUL(ib[0], collpair->normal, double(u1) * -impulse);
       VECADDMUL(ib[1], collpair->normal, double(u2) * -impulse);
       VECADDMUL(ib[2], collpair->normal, double(u3) * -impulse);
+    }
 
-      if ((magrelVel < 0.1f * d * time_multiplier) && (d > ALMOST_ZERO)) {
-        repulse = std::min(d / time_multiplier, 0.1f * d * time_multiplier - magrelVel);
+    result = 1;
+  }
+  else if (d > ALMOST_ZERO) {
+    /* Stay on the safe side and clamp repulse. */
+    float repulse = d * 1.0f / time_multiplier;
+    float impulse = repulse / 9.0f;
 
-        if (impulse > ALMOST_ZERO) {
-          repulse = min_ff(repulse, 5.0 * impulse);
-        }
+    VECADDMUL(ia[0], collpair->normal, w1 * impulse);
+    VECADDMUL(ia[1], collpair->normal, w2 * impulse);
+    VECADDMUL(ia[2], collpair->normal, w3 * impulse);
 
-        repulse = max_ff(impulse, repulse);
-        impulse = repulse / 1.5f;
+    VECADDMUL(ib[0], collpair->normal, u1 * -impulse);
+    VECADDMUL(ib[1], collpair->normal, u2 * -impulse);
+    VECADDMUL(ib[2], collpair->normal, u3 * -impulse);
 
-        VECADDMUL(ia[0], collpair->normal, double(w1) * impulse);
-        VECADDMUL(ia[1], collpair->normal, double(w2) * impulse);
-        VECADDMUL(ia[2], collpair->normal, double(w3) * impulse);
+    result = 1;
+  }
 
-        VECADDMUL(ib[0], collpair->normal, double(u1) * -impulse);
-        VECADDMUL(ib[1], collpair->normal, double(u2) * -impulse);
-        VECADDMUL(ib[2], collpair->normal, double(u3) * -impulse);
-      }
+  if (result) {
+    cloth_collision_impulse_vert(clamp_sq, ia[0], &vert_impulses[collpair->ap1]);
+    cloth_collision_impulse_vert(clamp_sq, ia[1], &vert_impulses[collpair->ap2]);
+    cloth_collision_impulse_vert(clamp_sq, ia[2], &vert_impulses[collpair->ap3]);
 
-      result = 1;
-    }
-    else if (d > ALMOST_ZERO) {
-      /* Stay on the safe side and clamp repulse. */
-      float repulse = d * 1.0f / time_multiplier;
-      float impulse = repulse / 9.0f;
+    cloth_collision_impulse_vert(clamp_sq, ib[0], &vert_impulses[collpair->bp1]);
+    cloth_collision_impulse_vert(clamp_sq, ib[1], &vert_impulses[collpair->bp2]);
+    cloth_collision_impulse_vert(clamp_sq, ib[2], &vert_impulses[collpair->bp3]);
 
-      VECADDMUL(ia[0], collpair->normal, w1 * impulse);
-      VECADDMUL(ia[1], collpair->normal, w2 * impulse);
-      VECADDMUL(ia[2], collpair->normal, w3 * impulse);
+    data->responded = true;
+  }
+}
 
-      VECADDMUL(ib[0], collpair->normal, u1 * -impulse);
-      VECADDMUL(ib[1], collpair->normal, u2 * -impulse);
-      VECADDMUL(ib[2], collpair->normal, u3 * -impulse);
+static void cloth_collision_response_reduce(const void *__restrict userdata,
+                                            void *__restrict chunk_join,
+                                            void *__restrict chunk)
+{
+  const ColResponseData *data = static_cast<const ColResponseData *>(userdata);
+  const int mvert_num = data->clmd->clothObject->mvert_num;
+  ColResponseVertImpulse *join = static_cast<ColResponseVertImpulse *>(chunk_join);
+  const ColResponseVertImpulse *other = static_cast<const ColResponseVertImpulse *>(chunk);
 
-      result = 1;
+  for (int i = 0; i < mvert_num; i++) {
+    if (other[i].impulse_count == 0) {
+      continue;
     }
 
-    if (result) {
-      cloth_collision_impulse_vert(clamp_sq, ia[0], &cloth->verts[collpair->ap1]);
-      cloth_collision_impulse_vert(clamp_sq, ia[1], &cloth->verts[collpair->ap2]);
-      cloth_collision_impulse_vert(clamp_sq, ia[2], &cloth->verts[collpair->ap3]);
+    for (int j = 0; j < 3; j++) {
+      if (fabsf(join[i].impulse[j]) < fabsf(other[i].impulse[j])) {
+        join[i].impulse[j] = other[i].impulse[j];
+      }
+    }
+
+    join[i].impulse_count += other[i].impulse_count;
+  }
+}
+
+static int cloth_collision_response_dispatch(ColResponseData *data,
+                                             const uint collision_count,
+                                             TaskParallelRangeFunc response_func)
+{
+  Cloth *cloth = data->clmd->clothObject;
+  ClothVertex *verts = cloth->verts;
+  const int mvert_num = cloth->mvert_num;
+
+  ColResponseVertImpulse *vert_impulses = MEM_cnew_array<ColResponseVertImpulse>(
+      mvert_num, "ColResponseVertImpulse");
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  /* Every task copies the whole per-vertex array, so only thread when there is
+   * enough work per task to win that cost back. */
+  settings.use_threading = (collision_count > 100);
+  settings.min_iter_per_thread = 100;
+  settings.userdata_chunk = vert_impulses;
+  settings.userdata_chunk_size = sizeof(*vert_impulses) * size_t(mvert_num);
+  settings.func_reduce = cloth_collision_response_reduce;
+  BLI_task_parallel_range(0, int(collision_count), data, response_func, &settings);
+
+  if (data->responded) {
+    for (int i = 0; i < mvert_num; i++) {
+      if (vert_impulses[i].impulse_count == 0) {
+        continue;
+      }
+
+      for (int j = 0; j < 3; j++) {
+        if (fabsf(verts[i].impulse[j]) < fabsf(vert_impulses[i].impulse[j])) {
+          verts[i].impulse[j] = vert_impulses[i].impulse[j];
+        }
+      }
 
-      cloth_collision_impulse_vert(clamp_sq, ib[0], &cloth->verts[collpair->bp1]);
-      cloth_collision_impulse_vert(clamp_sq, ib[1], &cloth->verts[collpair->bp2]);
-      cloth_collision_impulse_vert(clamp_sq, ib[2], &cloth->verts[collpair->bp3]);
+      verts[i].impulse_count += vert_impulses[i].impulse_count;
     }
   }
 
-  return result;
+  MEM_freeN(vert_impulses);
+
+  return data->responded ? 1 : 0;
+}
+
+static int cloth_collision_response_static(ClothModifierData *clmd,
+                                           CollisionModifierData *collmd,
+                                           Object *collob,
+                                           CollPair *collpair,
+                                           uint collision_count,
+                                           const float dt)
+{
+  ColResponseData data{};
+  data.clmd = clmd;
+  data.collmd = collmd;
+  data.collob = collob;
+  data.collisions = collpair;
+  data.dt = dt;
+  data.responded = false;
+
+  return cloth_collision_response_dispatch(&data, collision_count, cloth_collision_response);
+}
+
+static int cloth_selfcollision_response_static(ClothModifierData *clmd,
+                                               CollPair *collpair,
+                                               uint collision_count,
+                                               const float dt)
+{
+  ColResponseData data{};
+  data.clmd = clmd;
+  data.collisions = collpair;
+  data.dt = dt;
+  data.responded = false;
+
+  return cloth_collision_response_dispatch(&data, collision_count, cloth_selfcollision_response);
 }
 
 #ifdef __GNUC__
@@ -135,7 +135,7 @@ void BKE_crazyspace_set_quats_editmesh(BMEditMesh *em,
       BM_elem_flag_disable(v, BM_ELEM_TAG);
       BM_elem_index_set(v, index); /* set_inline */
     }
-    em->bm->elem_index_dirty &= ~BM_VERT;
+    BM_mesh_elem_index_dirty_clear(em->bm, BM_VERT);
   }
 
   BM_ITER_MESH (f, &iter, em->bm, BM_FACES_OF_MESH) {
@@ -182,28 +182,33 @@ static void fill_mesh_positions(const int main_point_num,
                                 const Span<float> radii,
                                 MutableSpan<float3> mesh_positions)
 {
+  /* Compute the scaled frame axes directly instead of building a full 4x4 matrix per ring
+   * (equivalent to #math::from_orthonormal_axes with a uniform radius scale); sweeping the
+   * profile then reduces to multiply-adds over contiguous data which vectorize well. */
   if (profile_point_num == 1) {
+    const float3 profile = profile_positions.first();
     for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = math::from_orthonormal_axes<float4x4>(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
-      if (!radii.is_empty()) {
-        point_matrix = math::scale(point_matrix, float3(radii[i_ring]));
-      }
-      mesh_positions[i_ring] = math::transform_point(point_matrix, profile_positions.first());
+      const float radius = radii.is_empty() ? 1.0f : radii[i_ring];
+      const float3 axis_x = normals[i_ring] * radius;
+      const float3 axis_y = math::cross(tangents[i_ring], normals[i_ring]) * radius;
+      const float3 axis_z = tangents[i_ring] * radius;
+      mesh_positions[i_ring] = main_positions[i_ring] + axis_x * profile.x + axis_y * profile.y +
+                               axis_z * profile.z;
     }
   }
   else {
     for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = math::from_orthonormal_axes<float4x4>(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
-      if (!radii.is_empty()) {
-        point_matrix = math::scale(point_matrix, float3(radii[i_ring]));
-      }
+      const float radius = radii.is_empty() ? 1.0f : radii[i_ring];
+      const float3 center = main_positions[i_ring];
+      const float3 axis_x = normals[i_ring] * radius;
+      const float3 axis_y = math::cross(tangents[i_ring], normals[i_ring]) * radius;
+      const float3 axis_z = tangents[i_ring] * radius;
 
       const int ring_vert_start = i_ring * profile_point_num;
       for (const int i_profile : IndexRange(profile_point_num)) {
-        mesh_positions[ring_vert_start + i_profile] = math::transform_point(
-            point_matrix, profile_positions[i_profile]);
+        const float3 profile = profile_positions[i_profile];
+        mesh_positions[ring_vert_start + i_profile] = center + axis_x * profile.x +
+                                                      axis_y * profile.y + axis_z * profile.z;
       }
     }
   }
@@ -332,6 +337,33 @@ static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool
   return result;
 }
 
+/**
+ * Whether every combination of main and profile curve produces the same mesh topology, i.e. all
+ * main curves have the same evaluated point count and cyclic flag and the same holds for all
+ * profile curves. This is the common case for procedurally generated cables and hair cards: many
+ * curves of equal resolution swept with a single profile.
+ */
+static bool result_topology_is_uniform(const CurvesInfo &info)
+{
+  const OffsetIndices<int> main_offsets = info.main.evaluated_points_by_curve();
+  const OffsetIndices<int> profile_offsets = info.profile.evaluated_points_by_curve();
+  const int main_point_num = main_offsets[0].size();
+  const int profile_point_num = profile_offsets[0].size();
+  for (const int64_t i : main_offsets.index_range()) {
+    if (main_offsets[i].size() != main_point_num || info.main_cyclic[i] != info.main_cyclic[0]) {
+      return false;
+    }
+  }
+  for (const int64_t i : profile_offsets.index_range()) {
+    if (profile_offsets[i].size() != profile_point_num ||
+        info.profile_cyclic[i] != info.profile_cyclic[0])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 static AttrDomain get_attribute_domain_for_mesh(const AttributeAccessor &mesh_attributes,
                                                 const AttributeIDRef &attribute_id)
 {
@@ -823,21 +855,61 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
   MutableSpan<int> corner_edges = mesh->corner_edges_for_write();
   MutableAttributeAccessor mesh_attributes = mesh->attributes_for_write();
 
-  foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
-    fill_mesh_topology(info.vert_range.start(),
-                       info.edge_range.start(),
-                       info.face_range.start(),
-                       info.loop_range.start(),
-                       info.main_points.size(),
-                       info.profile_points.size(),
-                       info.main_cyclic,
-                       info.profile_cyclic,
+  if (offsets.total > 1 && result_topology_is_uniform(curves_info)) {
+    /* All combinations produce the same connectivity, only shifted by constant offsets. Build the
+     * index buffers once for the first combination and offset them for all others, which is much
+     * cheaper than recomputing the connectivity for every curve. */
+    const IndexRange edges_template(offsets.edge[1]);
+    const IndexRange faces_template(offsets.face[1]);
+    const IndexRange loops_template(offsets.loop[1]);
+    fill_mesh_topology(0,
+                       0,
+                       0,
+                       0,
+                       curves_info.main.evaluated_points_by_curve()[0].size(),
+                       curves_info.profile.evaluated_points_by_curve()[0].size(),
+                       curves_info.main_cyclic[0],
+                       curves_info.profile_cyclic[0],
                        fill_caps,
                        edges,
                        corner_verts,
                        corner_edges,
                        face_offsets);
-  });
+    threading::parallel_for(IndexRange(1, offsets.total - 1), 512, [&](IndexRange range) {
+      for (const int i : range) {
+        const int vert_delta = offsets.vert[i];
+        const int edge_delta = offsets.edge[i];
+        const int loop_delta = offsets.loop[i];
+        for (const int i_edge : edges_template) {
+          edges[edge_delta + i_edge] = edges[i_edge] + int2(vert_delta);
+        }
+        for (const int i_loop : loops_template) {
+          corner_verts[loop_delta + i_loop] = corner_verts[i_loop] + vert_delta;
+          corner_edges[loop_delta + i_loop] = corner_edges[i_loop] + edge_delta;
+        }
+        for (const int i_face : faces_template) {
+          face_offsets[offsets.face[i] + i_face] = face_offsets[i_face] + loop_delta;
+        }
+      }
+    });
+  }
+  else {
+    foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
+      fill_mesh_topology(info.vert_range.start(),
+                         info.edge_range.start(),
+                         info.face_range.start(),
+                         info.loop_range.start(),
+                         info.main_points.size(),
+                         info.profile_points.size(),
+                         info.main_cyclic,
+                         info.profile_cyclic,
+                         fill_caps,
+                         edges,
+                         corner_verts,
+                         corner_edges,
+                         face_offsets);
+    });
+  }
 
   if (fill_caps) {
     /* TODO: This is used to keep the tests passing after refactoring mesh shade smooth flags. It
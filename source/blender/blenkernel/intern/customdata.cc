@@ -23,6 +23,7 @@
 #include "BLI_color.hh"
 #include "BLI_endian_switch.h"
 #include "BLI_index_range.hh"
+#include "BLI_map.hh"
 #include "BLI_math_color_blend.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_quaternion_types.hh"
@@ -2385,6 +2386,15 @@ static bool customdata_merge_internal(const CustomData *source,
 {
   bool changed = false;
 
+  /* The names of the layers that already exist in the destination, to avoid a linear scan over
+   * all destination layers for every source layer. Names are copied because adding layers may
+   * reallocate the destination layer array. */
+  Set<std::pair<int, std::string>> dest_layer_names;
+  dest_layer_names.reserve(dest->totlayer);
+  for (const int i : IndexRange(dest->totlayer)) {
+    dest_layer_names.add({dest->layers[i].type, dest->layers[i].name});
+  }
+
   int last_type = -1;
   int last_active = 0;
   int last_render = 0;
@@ -2427,7 +2437,7 @@ static bool customdata_merge_internal(const CustomData *source,
       /* Don't merge this layer because the maximum amount of layers of this type is reached. */
       continue;
     }
-    if (CustomData_get_named_layer_index(dest, type, src_layer.name) != -1) {
+    if (!dest_layer_names.add({src_layer.type, src_layer.name})) {
       /* Don't merge this layer because it exists in the destination already. */
       continue;
     }
@@ -2804,25 +2814,76 @@ int CustomData_get_layer_index_n(const CustomData *data, const eCustomDataType t
   return i;
 }
 
+/**
+ * Equality between a fixed-size layer name and a name of known length. Comparing through
+ * #StringRef would first compute the length of every candidate layer name.
+ */
+static bool layer_name_equals(const char *layer_name, const StringRef name)
+{
+  const int64_t size = name.size();
+  if (size >= MAX_CUSTOMDATA_LAYER_NAME) {
+    return false;
+  }
+  return layer_name[size] == '\0' && memcmp(layer_name, name.data(), size_t(size)) == 0;
+}
+
 int CustomData_get_named_layer_index(const CustomData *data,
                                      const eCustomDataType type,
                                      const StringRef name)
 {
-  for (int i = 0; i < data->totlayer; i++) {
-    if (data->layers[i].type == type) {
-      if (data->layers[i].name == name) {
-        return i;
-      }
+  /* Layers are ordered by type, so only the contiguous block of layers of the given type has to
+   * be scanned instead of all layers. */
+  BLI_assert(customdata_typemap_is_valid(data));
+  for (int i = data->typemap[type]; i != -1 && i < data->totlayer && data->layers[i].type == type;
+       i++)
+  {
+    if (layer_name_equals(data->layers[i].name, name)) {
+      return i;
     }
   }
 
   return -1;
 }
 
+void CustomData_get_named_layer_indices(const CustomData *data,
+                                        const eCustomDataType type,
+                                        const Span<StringRef> names,
+                                        MutableSpan<int> r_indices)
+{
+  BLI_assert(names.size() == r_indices.size());
+  BLI_assert(customdata_typemap_is_valid(data));
+  const int first_index = data->typemap[type];
+  if (first_index == -1) {
+    r_indices.fill(-1);
+    return;
+  }
+  int layers_num = 0;
+  while (first_index + layers_num < data->totlayer &&
+         data->layers[first_index + layers_num].type == type)
+  {
+    layers_num++;
+  }
+  /* For few lookups or layers, separate scans are cheaper than building a map. */
+  if (names.size() * layers_num <= 64) {
+    for (const int i : names.index_range()) {
+      r_indices[i] = CustomData_get_named_layer_index(data, type, names[i]);
+    }
+    return;
+  }
+  blender::Map<StringRef, int> index_by_name;
+  index_by_name.reserve(layers_num);
+  for (const int i : IndexRange(first_index, layers_num)) {
+    index_by_name.add(data->layers[i].name, i);
+  }
+  for (const int i : names.index_range()) {
+    r_indices[i] = index_by_name.lookup_default(names[i], -1);
+  }
+}
+
 int CustomData_get_named_layer_index_notype(const CustomData *data, const StringRef name)
 {
   for (int i = 0; i < data->totlayer; i++) {
-    if (data->layers[i].name == name) {
+    if (layer_name_equals(data->layers[i].name, name)) {
       return i;
     }
   }
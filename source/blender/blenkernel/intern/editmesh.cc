@@ -18,6 +18,7 @@
 
 #include "BKE_customdata.hh"
 #include "BKE_editmesh.hh"
+#include "BKE_editmesh_bvh.h"
 #include "BKE_mesh.hh"
 #include "BKE_mesh_iterators.hh"
 #include "BKE_mesh_runtime.hh"
@@ -53,6 +54,9 @@ BMEditMesh *BKE_editmesh_copy(BMEditMesh *em)
    * tessellation only when/if that copy ends up getting used. */
   em_copy->looptris = {};
 
+  /* The cache holds pointers into the original edit-mesh, never share it. */
+  em_copy->bvh_cache = nullptr;
+
   /* Copy various settings. */
   em_copy->selectmode = em->selectmode;
   em_copy->mat_nr = em->mat_nr;
@@ -119,6 +123,8 @@ void BKE_editmesh_looptris_and_normals_calc_with_partial(BMEditMesh *em, BMParti
 
 void BKE_editmesh_free_data(BMEditMesh *em)
 {
+  BKE_editmesh_bvh_cache_free(em);
+
   em->looptris = {};
 
   if (em->bm) {
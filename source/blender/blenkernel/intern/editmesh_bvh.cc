@@ -182,6 +182,88 @@ BVHTree *BKE_bmbvh_tree_get(BMBVHTree *bmtree)
   return bmtree->tree;
 }
 
+void BKE_bmbvh_refit(BMBVHTree *bmtree)
+{
+  /* Leaves of filtered trees don't map 1:1 onto the looptris, they can't be refitted. */
+  BLI_assert(BLI_bvhtree_get_len(bmtree->tree) == bmtree->looptris.size());
+
+  float cos[3][3];
+  for (const int i : bmtree->looptris.index_range()) {
+    if (bmtree->cos_cage) {
+      copy_v3_v3(cos[0], bmtree->cos_cage[BM_elem_index_get(bmtree->looptris[i][0]->v)]);
+      copy_v3_v3(cos[1], bmtree->cos_cage[BM_elem_index_get(bmtree->looptris[i][1]->v)]);
+      copy_v3_v3(cos[2], bmtree->cos_cage[BM_elem_index_get(bmtree->looptris[i][2]->v)]);
+    }
+    else {
+      copy_v3_v3(cos[0], bmtree->looptris[i][0]->v->co);
+      copy_v3_v3(cos[1], bmtree->looptris[i][1]->v->co);
+      copy_v3_v3(cos[2], bmtree->looptris[i][2]->v->co);
+    }
+    BLI_bvhtree_update_node(bmtree->tree, i, (float *)cos, nullptr, 3);
+  }
+  BLI_bvhtree_update_tree(bmtree->tree);
+}
+
+/* -------------------------------------------------------------------- */
+/* Edit-mesh owned cache */
+
+struct BMEditMeshBVHCache {
+  BMBVHTree *tree;
+
+  /* State the tree was built from, to detect when a rebuild is needed. */
+  int flag;
+  uint elem_index_gen;
+  const std::array<BMLoop *, 3> *looptris_data;
+  int64_t looptris_len;
+};
+
+BMBVHTree *BKE_editmesh_bvh_cache_get(BMEditMesh *em, const int flag)
+{
+  BMesh *bm = em->bm;
+
+  BLI_assert((flag & (BMBVH_RESPECT_SELECT | BMBVH_RESPECT_HIDDEN)) == 0);
+
+  /* Recalculates any dirty indices and bumps #BMesh.elem_index_gen doing so.
+   * Topology changes always mark indices dirty, so comparing the generation
+   * afterwards reliably detects them. */
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+
+  BMEditMeshBVHCache *cache = em->bvh_cache;
+  if (cache && (cache->flag == flag) && (cache->elem_index_gen == bm->elem_index_gen) &&
+      (cache->looptris_data == em->looptris.data()) &&
+      (cache->looptris_len == em->looptris.size()))
+  {
+    /* Vertices may have moved without a topology change, refit the bounds. */
+    BKE_bmbvh_refit(cache->tree);
+    return cache->tree;
+  }
+
+  if (cache) {
+    BKE_bmbvh_free(cache->tree);
+  }
+  else {
+    cache = static_cast<BMEditMeshBVHCache *>(MEM_callocN(sizeof(*cache), __func__));
+    em->bvh_cache = cache;
+  }
+
+  cache->tree = BKE_bmbvh_new(bm, em->looptris, flag, nullptr, false);
+  cache->flag = flag;
+  cache->elem_index_gen = bm->elem_index_gen;
+  cache->looptris_data = em->looptris.data();
+  cache->looptris_len = em->looptris.size();
+
+  return cache->tree;
+}
+
+void BKE_editmesh_bvh_cache_free(BMEditMesh *em)
+{
+  if (em->bvh_cache) {
+    BKE_bmbvh_free(em->bvh_cache->tree);
+    MEM_freeN(em->bvh_cache);
+    em->bvh_cache = nullptr;
+  }
+}
+
 /* -------------------------------------------------------------------- */
 /* Utility BMesh cast/intersect functions */
 
@@ -42,7 +42,7 @@ Span<float3> BKE_editmesh_cache_ensure_face_normals(BMEditMesh &em,
     BM_elem_index_set(efa, i); /* set_inline */
     BM_face_calc_normal_vcos(bm, efa, emd.face_normals[i], emd.vert_positions);
   }
-  bm->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
   return emd.face_normals;
 }
 
@@ -85,6 +85,7 @@ void BKE_fcurve_free(FCurve *fcu)
 
   /* Free RNA-path, as this were allocated when getting the path string. */
   MEM_SAFE_FREE(fcu->rna_path);
+  RNA_path_compiled_free(static_cast<RNACompiledPath *>(fcu->rna_path_compiled));
 
   /* Free extra data - i.e. modifiers, and driver. */
   fcurve_free_driver(fcu);
@@ -138,8 +139,9 @@ FCurve *BKE_fcurve_copy(const FCurve *fcu)
   fcu_d->bezt = static_cast<BezTriple *>(MEM_dupallocN(fcu_d->bezt));
   fcu_d->fpt = static_cast<FPoint *>(MEM_dupallocN(fcu_d->fpt));
 
-  /* Copy rna-path. */
+  /* Copy rna-path. The compiled form is owned by the source curve, it is re-created on demand. */
   fcu_d->rna_path = static_cast<char *>(MEM_dupallocN(fcu_d->rna_path));
+  fcu_d->rna_path_compiled = nullptr;
 
   /* Copy driver. */
   fcu_d->driver = fcurve_copy_driver(fcu_d->driver);
@@ -172,6 +174,10 @@ void BKE_fcurve_rnapath_set(FCurve &fcu, blender::StringRef rna_path)
 {
   MEM_SAFE_FREE(fcu.rna_path);
   fcu.rna_path = BLI_strdupn(rna_path.data(), rna_path.size());
+
+  /* The compiled path no longer matches, drop it so it gets re-created on demand. */
+  RNA_path_compiled_free(static_cast<RNACompiledPath *>(fcu.rna_path_compiled));
+  fcu.rna_path_compiled = nullptr;
 }
 
 void BKE_fmodifier_name_set(FModifier *fcm, const char *name)
@@ -2099,9 +2105,7 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
   /* Evaluation-time occurs somewhere in the middle of the curve. */
   bool exact = false;
 
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
+  /* The threshold here has the following constraints:
    * - 0.001 is too coarse:
    *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
    *
@@ -2109,7 +2113,41 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
    *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
    *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
    */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  const float threshold = 0.0001;
+
+  /* Try the segment hit by the previous evaluation (and the one right after it) before falling
+   * back to the binary search. Playback accesses the curve at closely spaced increasing times,
+   * so this is almost always an O(1) hit. Concurrent evaluations of a shared F-Curve may race
+   * on the hint, but every stored value is validated before use (compare #FCurve::curval). */
+  bool found = false;
+  const int hint = fcu->last_eval_index;
+  for (int candidate = hint; candidate <= hint + 1 && !found; candidate++) {
+    if (candidate < 0 || candidate >= int(fcu->totvert)) {
+      continue;
+    }
+    if (IS_EQT(evaltime, bezts[candidate].vec[1][0], threshold)) {
+      /* The binary search would have flagged this key as an exact hit. */
+      a = candidate;
+      exact = true;
+      found = true;
+    }
+    else if (candidate > 0 && bezts[candidate - 1].vec[1][0] < evaltime &&
+             evaltime < bezts[candidate].vec[1][0] &&
+             !IS_EQT(evaltime, bezts[candidate - 1].vec[1][0], threshold))
+    {
+      a = candidate;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, threshold, &exact);
+  }
+  if (int(a) != hint) {
+    /* The evaluation functions take a const F-Curve, cast away constness for the runtime hint
+     * just like #calculate_fcurve does for #FCurve::curval. */
+    const_cast<FCurve *>(fcu)->last_eval_index = int(a);
+  }
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
@@ -2680,6 +2718,8 @@ void BKE_fcurve_blend_read_data(BlendDataReader *reader, FCurve *fcu)
 
   /* rna path */
   BLO_read_string(reader, &fcu->rna_path);
+  /* Runtime compiled path needs to be re-created (old pointer may still be set here). */
+  fcu->rna_path_compiled = nullptr;
 
   /* group */
   BLO_read_struct(reader, bActionGroup, &fcu->grp);
@@ -1287,6 +1287,36 @@ static void compute_obstaclesemission(Scene *scene,
   }
 }
 
+/* Grid reset helpers, all of them accept grids that aren't allocated (and do nothing then).
+ * Resetting grid by grid instead of interleaved per-cell keeps the loops branch-free so they
+ * compile down to vectorized fills / plain memory copies. */
+
+static void fluid_grid_fill(float *grid, const float value, const size_t cell_count)
+{
+  if (grid == nullptr) {
+    return;
+  }
+  for (size_t i = 0; i < cell_count; i++) {
+    grid[i] = value;
+  }
+}
+
+static void fluid_grid_zero(float *grid, const size_t cell_count)
+{
+  if (grid == nullptr) {
+    return;
+  }
+  memset(grid, 0, cell_count * sizeof(float));
+}
+
+static void fluid_grid_copy(float *dst, const float *src, const size_t cell_count)
+{
+  if (dst == nullptr || src == nullptr) {
+    return;
+  }
+  memcpy(dst, src, cell_count * sizeof(float));
+}
+
 static void update_obstacles(Depsgraph *depsgraph,
                              Scene *scene,
                              Object *ob,
@@ -1336,41 +1366,32 @@ static void update_obstacles(Depsgraph *depsgraph,
   float *phi_guide_in = manta_get_phiguide_in(fds->fluid);
   float *num_obstacles = manta_get_num_obstacle(fds->fluid);
   float *num_guides = manta_get_num_guide(fds->fluid);
-  uint z;
 
   bool use_adaptivedomain = (fds->flags & FLUID_DOMAIN_USE_ADAPTIVE_DOMAIN);
 
+  const size_t cell_count = size_t(fds->res[0]) * fds->res[1] * fds->res[2];
+
   /* Grid reset before writing again. */
-  for (z = 0; z < fds->res[0] * fds->res[1] * fds->res[2]; z++) {
 
-    /* Use big value that's not inf to initialize levelset grids. */
-    if (phi_obs_in) {
-      phi_obs_in[z] = PHI_MAX;
-    }
-    /* Only reset static effectors on first frame. Only use static effectors without adaptive
-     * domains. */
-    if (phi_obsstatic_in && (is_first_frame || use_adaptivedomain)) {
-      phi_obsstatic_in[z] = PHI_MAX;
-    }
-    if (phi_guide_in) {
-      phi_guide_in[z] = PHI_MAX;
-    }
-    if (num_obstacles) {
-      num_obstacles[z] = 0;
-    }
-    if (num_guides) {
-      num_guides[z] = 0;
-    }
-    if (vel_x && vel_y && vel_z) {
-      vel_x[z] = 0.0f;
-      vel_y[z] = 0.0f;
-      vel_z[z] = 0.0f;
-    }
-    if (vel_x_guide && vel_y_guide && vel_z_guide) {
-      vel_x_guide[z] = 0.0f;
-      vel_y_guide[z] = 0.0f;
-      vel_z_guide[z] = 0.0f;
-    }
+  /* Use big value that's not inf to initialize levelset grids. */
+  fluid_grid_fill(phi_obs_in, PHI_MAX, cell_count);
+  /* Only reset static effectors on first frame. Only use static effectors without adaptive
+   * domains. */
+  if (is_first_frame || use_adaptivedomain) {
+    fluid_grid_fill(phi_obsstatic_in, PHI_MAX, cell_count);
+  }
+  fluid_grid_fill(phi_guide_in, PHI_MAX, cell_count);
+  fluid_grid_zero(num_obstacles, cell_count);
+  fluid_grid_zero(num_guides, cell_count);
+  if (vel_x && vel_y && vel_z) {
+    fluid_grid_zero(vel_x, cell_count);
+    fluid_grid_zero(vel_y, cell_count);
+    fluid_grid_zero(vel_z, cell_count);
+  }
+  if (vel_x_guide && vel_y_guide && vel_z_guide) {
+    fluid_grid_zero(vel_x_guide, cell_count);
+    fluid_grid_zero(vel_y_guide, cell_count);
+    fluid_grid_zero(vel_z_guide, cell_count);
   }
 
   /* Prepare grids from effector objects. */
@@ -2909,52 +2930,41 @@ static void update_flowsfluids(Depsgraph *depsgraph,
   BLI_assert((velx_initial && vely_initial && velz_initial) ||
              (!velx_initial && !vely_initial && !velz_initial));
 
-  uint z;
+  const size_t cell_count = size_t(fds->res[0]) * fds->res[1] * fds->res[2];
+
   /* Grid reset before writing again. */
-  for (z = 0; z < fds->res[0] * fds->res[1] * fds->res[2]; z++) {
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phistatic_in && is_first_frame) {
-      phistatic_in[z] = PHI_MAX;
-    }
-    if (phi_in) {
-      phi_in[z] = PHI_MAX;
-    }
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phioutstatic_in && is_first_frame) {
-      phioutstatic_in[z] = PHI_MAX;
-    }
-    if (phiout_in) {
-      phiout_in[z] = PHI_MAX;
-    }
-    /* Sync smoke inflow grids with their counterparts (simulation grids). */
-    if (density_in) {
-      density_in[z] = density[z];
-    }
-    if (heat_in) {
-      heat_in[z] = heat[z];
-    }
-    if (color_r_in && color_g_in && color_b_in) {
-      color_r_in[z] = color_r[z];
-      color_g_in[z] = color_b[z];
-      color_b_in[z] = color_g[z];
-    }
-    if (fuel_in) {
-      fuel_in[z] = fuel[z];
-      react_in[z] = react[z];
-    }
-    if (emission_in) {
-      emission_in[z] = 0.0f;
-    }
-    if (velx_initial && vely_initial && velz_initial) {
-      velx_initial[z] = 0.0f;
-      vely_initial[z] = 0.0f;
-      velz_initial[z] = 0.0f;
-    }
-    /* Reset forces here as update_effectors() is skipped when no external forces are present. */
-    forcex[z] = 0.0f;
-    forcey[z] = 0.0f;
-    forcez[z] = 0.0f;
-  }
+
+  /* Only reset static phi on first frame, dynamic phi gets reset every time. */
+  if (is_first_frame) {
+    fluid_grid_fill(phistatic_in, PHI_MAX, cell_count);
+    fluid_grid_fill(phioutstatic_in, PHI_MAX, cell_count);
+  }
+  fluid_grid_fill(phi_in, PHI_MAX, cell_count);
+  fluid_grid_fill(phiout_in, PHI_MAX, cell_count);
+
+  /* Sync smoke inflow grids with their counterparts (simulation grids). */
+  fluid_grid_copy(density_in, density, cell_count);
+  fluid_grid_copy(heat_in, heat, cell_count);
+  if (color_r_in && color_g_in && color_b_in) {
+    fluid_grid_copy(color_r_in, color_r, cell_count);
+    /* NOTE: the green/blue swap matches the previous per-cell loop. */
+    fluid_grid_copy(color_g_in, color_b, cell_count);
+    fluid_grid_copy(color_b_in, color_g, cell_count);
+  }
+  if (fuel_in) {
+    fluid_grid_copy(fuel_in, fuel, cell_count);
+    fluid_grid_copy(react_in, react, cell_count);
+  }
+  fluid_grid_zero(emission_in, cell_count);
+  if (velx_initial && vely_initial && velz_initial) {
+    fluid_grid_zero(velx_initial, cell_count);
+    fluid_grid_zero(vely_initial, cell_count);
+    fluid_grid_zero(velz_initial, cell_count);
+  }
+  /* Reset forces here as update_effectors() is skipped when no external forces are present. */
+  fluid_grid_zero(forcex, cell_count);
+  fluid_grid_zero(forcey, cell_count);
+  fluid_grid_zero(forcez, cell_count);
 
   /* Apply emission data for every flow object. */
   for (int flow_index = 0; flow_index < numflowobjs; flow_index++) {
@@ -731,6 +731,7 @@ MutableSpan<ColorGeometry4f> Drawing::fill_colors_for_write()
 void Drawing::tag_texture_matrices_changed()
 {
   this->runtime->curve_texture_matrices.tag_dirty();
+  this->runtime->geometry_version++;
 }
 
 void Drawing::tag_positions_changed()
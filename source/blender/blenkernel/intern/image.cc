@@ -4202,7 +4202,7 @@ static ImBuf *load_image_single(Image *ima,
     LISTBASE_FOREACH (ImagePackedFile *, imapf, &ima->packedfiles) {
       if (imapf->view == view_id && imapf->tile_number == tile_number) {
         if (imapf->packedfile) {
-          ibuf = IMB_ibImageFromMemory((uchar *)imapf->packedfile->data,
+          ibuf = IMB_ibImageFromMemory((uchar *)BKE_packedfile_data_get(imapf->packedfile),
                                        imapf->packedfile->size,
                                        flag,
                                        ima->colorspace_settings.name,
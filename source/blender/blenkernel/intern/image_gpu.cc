@@ -13,6 +13,9 @@
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
+
+#include <algorithm>
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -350,6 +353,101 @@ void BKE_image_ensure_gpu_texture(Image *image, ImageUser *image_user)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Progressive Residency
+ *
+ * Large images are not uploaded at full resolution on first use. A reduced resolution
+ * placeholder is created instead so the first draw is not stalled by a huge upload, and the full
+ * resolution texture replaces it on a later redraw, throttled so that several pending images
+ * spread their uploads over multiple frames. Since the placeholder is simply a texture smaller
+ * than the image buffer, partial updates keep working on it the same way they do for textures
+ * clamped by the GPU size limit.
+ *
+ * \note Uploads have to happen on the thread owning the GPU context, so the streaming is time
+ * sliced over redraws instead of using a worker pool.
+ * \{ */
+
+/** Images with more pixels than this get a placeholder texture on first use. */
+constexpr int64_t IMAGE_GPU_PLACEHOLDER_PIXELS_MIN = int64_t(4096) * 4096;
+/** Longest side of a placeholder texture. */
+constexpr int IMAGE_GPU_PLACEHOLDER_SIZE = 2048;
+/** Minimum time between two full resolution uploads, in seconds. */
+constexpr double IMAGE_GPU_PROMOTE_INTERVAL = 0.05;
+
+static double gpu_texture_promote_last_time = 0.0;
+
+static bool image_gpu_texture_use_placeholder(const ImBuf *ibuf)
+{
+  if (!GPU_mipmap_enabled()) {
+    return false;
+  }
+  return int64_t(ibuf->x) * int64_t(ibuf->y) >= IMAGE_GPU_PLACEHOLDER_PIXELS_MIN;
+}
+
+static GPUTexture *image_gpu_texture_placeholder_create(Image *ima, ImBuf *ibuf)
+{
+  int width = ibuf->x;
+  int height = ibuf->y;
+  while (max_ii(width, height) > IMAGE_GPU_PLACEHOLDER_SIZE) {
+    width = max_ii(width / 2, 1);
+    height = max_ii(height / 2, 1);
+  }
+
+  ImBuf *scaled_ibuf = IMB_dupImBuf(ibuf);
+  if (scaled_ibuf == nullptr) {
+    return nullptr;
+  }
+  IMB_scaleImBuf(scaled_ibuf, width, height);
+
+  const bool use_high_bitdepth = (ima->flag & IMA_HIGH_BITDEPTH);
+  const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima,
+                                                                                 scaled_ibuf);
+  GPUTexture *tex = IMB_create_gpu_texture(
+      ima->id.name + 2, scaled_ibuf, use_high_bitdepth, store_premultiplied);
+  IMB_freeImBuf(scaled_ibuf);
+  return tex;
+}
+
+/** Replace a placeholder texture by the full resolution one, within the time budget. */
+static void image_gpu_texture_promote(Image *ima,
+                                      ImageUser *iuser,
+                                      const bool use_viewers,
+                                      GPUTexture **tex)
+{
+  const double now = BLI_time_now_seconds();
+  if (now - gpu_texture_promote_last_time < IMAGE_GPU_PROMOTE_INTERVAL) {
+    /* Budget for this frame is spent, try again on a later redraw. */
+    return;
+  }
+
+  void *lock;
+  ImBuf *ibuf = BKE_image_acquire_ibuf(ima, iuser, (use_viewers) ? &lock : nullptr);
+  if (ibuf == nullptr) {
+    BKE_image_release_ibuf(ima, ibuf, (use_viewers) ? lock : nullptr);
+    return;
+  }
+
+  const bool use_high_bitdepth = (ima->flag & IMA_HIGH_BITDEPTH);
+  const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima, ibuf);
+  GPUTexture *full_tex = IMB_create_gpu_texture(
+      ima->id.name + 2, ibuf, use_high_bitdepth, store_premultiplied);
+  if (full_tex) {
+    GPU_texture_extend_mode(full_tex, GPU_SAMPLER_EXTEND_MODE_REPEAT);
+    GPU_texture_update_mipmap_chain(full_tex);
+    GPU_texture_mipmap_mode(full_tex, true, true);
+    GPU_texture_original_size_set(full_tex, ibuf->x, ibuf->y);
+    GPU_texture_free(*tex);
+    *tex = full_tex;
+    ima->gpuflag |= IMA_GPU_MIPMAP_COMPLETE;
+    ima->gpuflag &= ~IMA_GPU_PARTIAL_RESIDENT;
+    gpu_texture_promote_last_time = now;
+  }
+
+  BKE_image_release_ibuf(ima, ibuf, (use_viewers) ? lock : nullptr);
+}
+
+/** \} */
+
 static ImageGPUTextures image_get_gpu_texture(Image *ima,
                                               ImageUser *iuser,
                                               const bool use_viewers,
@@ -409,6 +507,9 @@ static ImageGPUTextures image_get_gpu_texture(Image *ima,
   }
   GPUTexture **tex = get_image_gpu_texture_ptr(ima, textarget, current_view);
   if (*tex) {
+    if (textarget == TEXTARGET_2D && (ima->gpuflag & IMA_GPU_PARTIAL_RESIDENT)) {
+      image_gpu_texture_promote(ima, iuser, use_viewers, tex);
+    }
     result.texture = *tex;
     result.tile_mapping = *get_image_gpu_texture_ptr(ima, TEXTARGET_TILE_MAPPING, current_view);
     return result;
@@ -446,10 +547,19 @@ static ImageGPUTextures image_get_gpu_texture(Image *ima,
   }
   else {
     /* Single image texture. */
-    const bool use_high_bitdepth = (ima->flag & IMA_HIGH_BITDEPTH);
-    const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima, ibuf);
+    if (image_gpu_texture_use_placeholder(ibuf)) {
+      *tex = image_gpu_texture_placeholder_create(ima, ibuf);
+      if (*tex) {
+        ima->gpuflag |= IMA_GPU_PARTIAL_RESIDENT;
+      }
+    }
+    if (*tex == nullptr) {
+      const bool use_high_bitdepth = (ima->flag & IMA_HIGH_BITDEPTH);
+      const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima, ibuf);
 
-    *tex = IMB_create_gpu_texture(ima->id.name + 2, ibuf, use_high_bitdepth, store_premultiplied);
+      *tex = IMB_create_gpu_texture(
+          ima->id.name + 2, ibuf, use_high_bitdepth, store_premultiplied);
+    }
     result.texture = *tex;
 
     if (*tex) {
@@ -552,7 +662,7 @@ static void image_free_gpu(Image *ima, const bool immediate)
     }
   }
 
-  ima->gpuflag &= ~IMA_GPU_MIPMAP_COMPLETE;
+  ima->gpuflag &= ~(IMA_GPU_MIPMAP_COMPLETE | IMA_GPU_PARTIAL_RESIDENT);
 }
 
 void BKE_image_free_gputextures(Image *ima)
@@ -580,11 +690,54 @@ void BKE_image_free_anim_gputextures(Main *bmain)
   }
 }
 
+/**
+ * Evict textures of the least recently used images until the configured GPU texture
+ * budget is met again. Images used in the current second are never evicted.
+ */
+static void image_free_gputextures_over_budget(Main *bmain, const int ctime)
+{
+  if (U.gpu_texture_budget == 0) {
+    return;
+  }
+  const size_t budget = size_t(U.gpu_texture_budget) * 1024 * 1024;
+  if (GPU_texture_memory_usage_get() <= budget) {
+    return;
+  }
+
+  blender::Vector<Image *> candidates;
+  LISTBASE_FOREACH (Image *, ima, &bmain->images) {
+    if ((ima->flag & IMA_NOCOLLECT) == 0 && ima->lastused != ctime &&
+        BKE_image_has_opengl_texture(ima))
+    {
+      candidates.append(ima);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const Image *a, const Image *b) {
+    return a->lastused < b->lastused;
+  });
+
+  for (Image *ima : candidates) {
+    if (GPU_texture_memory_usage_get() <= budget) {
+      break;
+    }
+    BKE_image_free_gputextures(ima);
+    /* Same "second chance" tag as the time based collector below. */
+    ima->lastused = ctime;
+  }
+}
+
 void BKE_image_free_old_gputextures(Main *bmain)
 {
   static int lasttime = 0;
   int ctime = int(BLI_time_now_seconds());
 
+  /* of course not! */
+  if (G.is_rendering) {
+    return;
+  }
+
+  image_free_gputextures_over_budget(bmain, ctime);
+
   /*
    * Run garbage collector once for every collecting period of time
    * if textimeout is 0, that's the option to NOT run the collector
@@ -593,11 +746,6 @@ void BKE_image_free_old_gputextures(Main *bmain)
     return;
   }
 
-  /* of course not! */
-  if (G.is_rendering) {
-    return;
-  }
-
   lasttime = ctime;
 
   LISTBASE_FOREACH (Image *, ima, &bmain->images) {
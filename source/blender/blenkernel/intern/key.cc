@@ -15,10 +15,13 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_endian_switch.h"
+#include "BLI_index_mask.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -866,6 +869,89 @@ static void cp_cu_key(Curve *cu,
   }
 }
 
+/**
+ * Fast path of #key_evaluate_relative for mesh and lattice data, where each
+ * element is a plain coordinate. All contributing key blocks are gathered
+ * first and accumulated in a single threaded pass over the output, skipping
+ * the vertices a key doesn't move at all, which is most of them for typical
+ * facial rigs with many localized shapes.
+ */
+static void key_evaluate_relative_coords(const int start,
+                                         const int end,
+                                         const int tot,
+                                         char *basispoin,
+                                         Key *key,
+                                         KeyBlock *actkb,
+                                         float **per_keyblock_weights)
+{
+  struct AccumKeyBlock {
+    const float *from;
+    const float *reffrom;
+    /** Per-element influence weights from the vertex group, may be null. */
+    const float *weights;
+    float icuval;
+    char *freefrom;
+  };
+
+  blender::Vector<AccumKeyBlock, 16> blocks;
+
+  int keyblock_index;
+  LISTBASE_FOREACH_INDEX (KeyBlock *, kb, &key->block, keyblock_index) {
+    if (kb == key->refkey) {
+      continue;
+    }
+    const float icuval = kb->curval;
+
+    /* only with value, and no difference allowed */
+    if ((kb->flag & KEYBLOCK_MUTE) || icuval == 0.0f || kb->totelem != tot) {
+      continue;
+    }
+    const KeyBlock *refb = static_cast<const KeyBlock *>(
+        BLI_findlink(&key->block, kb->relative));
+    if (refb == nullptr) {
+      continue;
+    }
+
+    AccumKeyBlock acc;
+    acc.from = reinterpret_cast<const float *>(key_block_get_data(key, actkb, kb, &acc.freefrom));
+    /* For meshes, use the original values instead of the bmesh values to
+     * maintain a constant offset. */
+    acc.reffrom = static_cast<const float *>(refb->data);
+    acc.weights = per_keyblock_weights ? per_keyblock_weights[keyblock_index] : nullptr;
+    acc.icuval = icuval;
+    blocks.append(acc);
+  }
+
+  blender::threading::parallel_for(
+      blender::IndexRange(end - start), 8192, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          const int elem = (start + i) * KEYELEM_FLOAT_LEN_COORD;
+          float *co = reinterpret_cast<float *>(basispoin) + elem;
+
+          for (const AccumKeyBlock &acc : blocks) {
+            const float weight = acc.weights ? acc.weights[i] * acc.icuval : acc.icuval;
+            if (weight == 0.0f) {
+              continue;
+            }
+            const float d0 = acc.from[elem + 0] - acc.reffrom[elem + 0];
+            const float d1 = acc.from[elem + 1] - acc.reffrom[elem + 1];
+            const float d2 = acc.from[elem + 2] - acc.reffrom[elem + 2];
+            if (d0 != 0.0f || d1 != 0.0f || d2 != 0.0f) {
+              co[0] += d0 * weight;
+              co[1] += d1 * weight;
+              co[2] += d2 * weight;
+            }
+          }
+        }
+      });
+
+  for (const AccumKeyBlock &acc : blocks) {
+    if (acc.freefrom) {
+      MEM_freeN(acc.freefrom);
+    }
+  }
+}
+
 static void key_evaluate_relative(const int start,
                                   int end,
                                   const int tot,
@@ -904,6 +990,13 @@ static void key_evaluate_relative(const int start,
 
   /* step 2: do it */
 
+  if (mode == KEY_MODE_DUMMY && step == 1 && poinsize == key->elemsize &&
+      key->elemsize == sizeof(float[KEYELEM_FLOAT_LEN_COORD]))
+  {
+    key_evaluate_relative_coords(start, end, tot, basispoin, key, actkb, per_keyblock_weights);
+    return;
+  }
+
   for (kb = static_cast<KeyBlock *>(key->block.first), keyblock_index = 0; kb;
        kb = kb->next, keyblock_index++)
   {
@@ -2260,6 +2353,7 @@ void BKE_keyblock_mesh_calc_normals(const KeyBlock *kb,
         corner_verts,
         mesh->vert_to_face_map(),
         {reinterpret_cast<const blender::float3 *>(face_normals), faces.size()},
+        positions.index_range(),
         {reinterpret_cast<blender::float3 *>(vert_normals), mesh->verts_num});
   }
   if (loop_normals_needed) {
@@ -2279,6 +2373,7 @@ void BKE_keyblock_mesh_calc_normals(const KeyBlock *kb,
         {reinterpret_cast<blender::float3 *>(face_normals), faces.size()},
         sharp_edges,
         sharp_faces,
+        {},
         clnors,
         nullptr,
         {reinterpret_cast<blender::float3 *>(r_loop_normals), corner_verts.size()});
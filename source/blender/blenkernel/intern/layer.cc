@@ -986,6 +986,11 @@ void BKE_view_layer_need_resync_tag(ViewLayer *view_layer)
   view_layer->flag |= VIEW_LAYER_OUT_OF_SYNC;
 }
 
+void BKE_view_layer_need_visibility_resync_tag(ViewLayer *view_layer)
+{
+  view_layer->flag |= VIEW_LAYER_OUT_OF_SYNC_VISIBILITY;
+}
+
 void BKE_view_layer_synced_ensure(const Scene *scene, ViewLayer *view_layer)
 {
   BLI_assert(scene);
@@ -993,7 +998,11 @@ void BKE_view_layer_synced_ensure(const Scene *scene, ViewLayer *view_layer)
 
   if (view_layer->flag & VIEW_LAYER_OUT_OF_SYNC) {
     BKE_layer_collection_sync(scene, view_layer);
-    view_layer->flag &= ~VIEW_LAYER_OUT_OF_SYNC;
+    view_layer->flag &= ~(VIEW_LAYER_OUT_OF_SYNC | VIEW_LAYER_OUT_OF_SYNC_VISIBILITY);
+  }
+  else if (view_layer->flag & VIEW_LAYER_OUT_OF_SYNC_VISIBILITY) {
+    BKE_layer_collection_visibility_sync(scene, view_layer);
+    view_layer->flag &= ~VIEW_LAYER_OUT_OF_SYNC_VISIBILITY;
   }
 }
 
@@ -1416,6 +1425,140 @@ void BKE_layer_collection_sync(const Scene *scene, ViewLayer *view_layer)
   }
 }
 
+static void layer_collection_objects_visibility_sync(ViewLayer *view_layer,
+                                                     LayerCollection *layer,
+                                                     const short collection_restrict,
+                                                     const short layer_restrict)
+{
+  /* No need to sync objects if the collection is excluded. */
+  if ((layer->flag & LAYER_COLLECTION_EXCLUDE) != 0) {
+    return;
+  }
+
+  LISTBASE_FOREACH (CollectionObject *, cob, &layer->collection->gobject) {
+    if (cob->ob == nullptr) {
+      continue;
+    }
+
+    /* Memberships did not change, so every object already has a base. */
+    Base *base = static_cast<Base *>(BLI_ghash_lookup(view_layer->object_bases_hash, cob->ob));
+    BLI_assert(base != nullptr);
+
+    if ((collection_restrict & COLLECTION_HIDE_VIEWPORT) == 0) {
+      base->flag_from_collection |= (BASE_ENABLED_VIEWPORT |
+                                     BASE_ENABLED_AND_MAYBE_VISIBLE_IN_VIEWPORT);
+      if ((layer_restrict & LAYER_COLLECTION_HIDE) == 0) {
+        base->flag_from_collection |= BASE_ENABLED_AND_VISIBLE_IN_DEFAULT_VIEWPORT;
+      }
+      if ((collection_restrict & COLLECTION_HIDE_SELECT) == 0) {
+        base->flag_from_collection |= BASE_SELECTABLE;
+      }
+    }
+
+    if ((collection_restrict & COLLECTION_HIDE_RENDER) == 0) {
+      base->flag_from_collection |= BASE_ENABLED_RENDER;
+    }
+
+    /* Holdout and indirect only */
+    if (layer->flag & LAYER_COLLECTION_HOLDOUT) {
+      base->flag_from_collection |= BASE_HOLDOUT;
+    }
+    if (layer->flag & LAYER_COLLECTION_INDIRECT_ONLY) {
+      base->flag_from_collection |= BASE_INDIRECT_ONLY;
+    }
+
+    layer->runtime_flag |= LAYER_COLLECTION_HAS_OBJECTS;
+  }
+}
+
+/**
+ * Flag-only counterpart of #layer_collection_sync: walks the existing layer collection tree in
+ * the same order and recomputes the same runtime/base flags, without rebuilding the tree or the
+ * object base list. Keep the flag logic in sync with #layer_collection_sync.
+ */
+static void layer_collection_visibility_sync(ViewLayer *view_layer,
+                                             LayerCollection *layer,
+                                             const short parent_collection_restrict,
+                                             const short parent_layer_restrict)
+{
+  LISTBASE_FOREACH (LayerCollection *, child_layer, &layer->layer_collections) {
+    Collection *child_collection = child_layer->collection;
+    if (child_collection == nullptr) {
+      continue;
+    }
+
+    /* Collection restrict is inherited. */
+    short child_collection_restrict = parent_collection_restrict;
+    short child_layer_restrict = parent_layer_restrict;
+    if (!(child_collection->flag & COLLECTION_IS_MASTER)) {
+      child_collection_restrict |= child_collection->flag;
+      child_layer_restrict |= child_layer->flag;
+    }
+
+    layer_collection_visibility_sync(
+        view_layer, child_layer, child_collection_restrict, child_layer_restrict);
+
+    /* Layer collection exclude is not inherited. */
+    child_layer->runtime_flag = 0;
+    if (child_layer->flag & LAYER_COLLECTION_EXCLUDE) {
+      continue;
+    }
+
+    if (child_collection_restrict & COLLECTION_HIDE_VIEWPORT) {
+      child_layer->runtime_flag |= LAYER_COLLECTION_HIDE_VIEWPORT;
+    }
+
+    if (((child_layer->runtime_flag & LAYER_COLLECTION_HIDE_VIEWPORT) == 0) &&
+        ((child_layer_restrict & LAYER_COLLECTION_HIDE) == 0))
+    {
+      child_layer->runtime_flag |= LAYER_COLLECTION_VISIBLE_VIEW_LAYER;
+    }
+  }
+
+  layer_collection_objects_visibility_sync(
+      view_layer, layer, parent_collection_restrict, parent_layer_restrict);
+}
+
+void BKE_layer_collection_visibility_sync(const Scene *scene, ViewLayer *view_layer)
+{
+  if (no_resync) {
+    return;
+  }
+
+  if (BLI_listbase_is_empty(&view_layer->layer_collections) || !view_layer->object_bases_hash) {
+    /* Never fully synced before, the cheap path has nothing valid to start from. */
+    BKE_layer_collection_sync(scene, view_layer);
+    return;
+  }
+
+  /* Clear visible and selectable flags to be reset. */
+  LISTBASE_FOREACH (Base *, base, &view_layer->object_bases) {
+    base->flag &= ~g_base_collection_flags;
+    base->flag_from_collection &= ~g_base_collection_flags;
+  }
+
+  const short parent_restrict = 0, parent_layer_restrict = 0;
+  layer_collection_visibility_sync(
+      view_layer,
+      static_cast<LayerCollection *>(view_layer->layer_collections.first),
+      parent_restrict,
+      parent_layer_restrict);
+
+  LISTBASE_FOREACH (Base *, base, &view_layer->object_bases) {
+    BKE_base_eval_flags(base);
+  }
+
+  /* Always set a valid active collection. */
+  LayerCollection *active = view_layer->active_collection;
+  if (active && layer_collection_hidden(view_layer, active)) {
+    BKE_layer_collection_activate_parent(view_layer, active);
+  }
+  else if (active == nullptr) {
+    view_layer->active_collection = static_cast<LayerCollection *>(
+        view_layer->layer_collections.first);
+  }
+}
+
 void BKE_scene_collection_sync(const Scene *scene)
 {
   if (no_resync) {
@@ -1601,7 +1744,7 @@ void BKE_base_set_visible(Scene *scene, ViewLayer *view_layer, Base *base, bool
     base->flag ^= BASE_HIDDEN;
   }
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
 }
 
 bool BKE_base_is_visible(const View3D *v3d, const Base *base)
@@ -1726,7 +1869,7 @@ void BKE_layer_collection_isolate_global(Scene * /*scene*/,
     BKE_layer_collection_activate(view_layer, lc);
   }
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
 }
 
 static void layer_collection_local_visibility_set_recursive(LayerCollection *layer_collection,
@@ -811,6 +811,35 @@ struct LibOverrideGroupTagData {
     return is_missing;
   }
 
+  /**
+   * All `Main.relations` entries tagged as processed by the recursive tagging functions using
+   * this data.
+   *
+   * Allows clearing those tags again in time proportional to the processed hierarchy, instead of
+   * iterating over all of `Main.relations` with #BKE_main_relations_tag_set. The latter becomes
+   * very costly when done for every processed hierarchy root during resync of files using many
+   * independent liboverride hierarchies, see #relations_tags_clear. */
+  blender::Vector<MainIDRelationsEntry *> processed_relations_entries;
+
+  void relations_entry_processed_tag(MainIDRelationsEntry *entry, const uint entry_tag)
+  {
+    entry->tags |= entry_tag;
+    processed_relations_entries.append(entry);
+  }
+
+  /** Clear the `PROCESSED` tags of all entries tagged through #relations_entry_processed_tag.
+   *
+   * NOTE: This potentially clears more entries than strictly necessary (entries from previously
+   * processed hierarchies are only removed from the list here), which is harmless, as a full
+   * #BKE_main_relations_tag_set clear would affect them too. */
+  void relations_tags_clear()
+  {
+    for (MainIDRelationsEntry *entry : processed_relations_entries) {
+      entry->tags &= ~MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+    }
+    processed_relations_entries.clear();
+  }
+
   /* Mapping linked objects to all their instantiating collections (as a linked list).
    * Avoids calling #BKE_collection_object_find over and over, this function is very expansive. */
   GHash *linked_object_to_instantiating_collections;
@@ -819,6 +848,7 @@ struct LibOverrideGroupTagData {
   void clear()
   {
     linked_ids_hierarchy_default_override.clear();
+    processed_relations_entries.clear_and_shrink();
     BLI_ghash_free(linked_object_to_instantiating_collections, nullptr, nullptr);
     BLI_memarena_free(mem_arena);
 
@@ -950,7 +980,7 @@ static void lib_override_hierarchy_dependencies_recursive_tag_from(LibOverrideGr
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_FROM;
+  data->relations_entry_processed_tag(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_FROM);
 
   for (MainIDRelationsEntryItem *from_id_entry = entry->from_ids; from_id_entry != nullptr;
        from_id_entry = from_id_entry->next)
@@ -993,7 +1023,7 @@ static bool lib_override_hierarchy_dependencies_recursive_tag(LibOverrideGroupTa
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_TO;
+  data->relations_entry_processed_tag(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED_TO);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -1042,7 +1072,7 @@ static void lib_override_linked_group_tag_recursive(LibOverrideGroupTagData *dat
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  data->relations_entry_processed_tag(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -1206,7 +1236,7 @@ static void lib_override_linked_group_tag(LibOverrideGroupTagData *data)
     /* Do not override objects used as bone shapes, nor their collections if possible. */
     lib_override_linked_group_tag_clear_boneshapes_objects(data);
 
-    BKE_main_relations_tag_set(bmain, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED, false);
+    data->relations_tags_clear();
     data->root_set(id_root);
     data->do_create_linked_overrides_set = false;
   }
@@ -1311,7 +1341,7 @@ static void lib_override_overrides_group_tag_recursive(LibOverrideGroupTagData *
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  data->relations_entry_processed_tag(entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != nullptr;
        to_id_entry = to_id_entry->next)
@@ -3287,9 +3317,9 @@ static bool lib_override_library_main_resync_on_library_indirect_level(
 
     data.root_set(id->override_library->reference);
     lib_override_linked_group_tag(&data);
-    BKE_main_relations_tag_set(bmain, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED, false);
+    data.relations_tags_clear();
     lib_override_hierarchy_dependencies_recursive_tag(&data);
-    BKE_main_relations_tag_set(bmain, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED, false);
+    data.relations_tags_clear();
   }
   FOREACH_MAIN_ID_END;
   data.clear();
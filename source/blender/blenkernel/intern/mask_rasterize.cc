@@ -84,6 +84,10 @@
 /* found this gives best performance for high detail masks, values between 2 and 8 work best */
 #define BUCKET_PIXELS_PER_CELL 4
 
+/* tile size for the buffer fill, tiles with no geometry get a constant fill
+ * without any per-pixel bucket lookups */
+#define BUFFER_TILE_SIZE 64
+
 #define SF_EDGE_IS_BOUNDARY 0xff
 #define SF_KEYINDEX_TEMP_ID uint(-1)
 
@@ -1329,6 +1333,37 @@ static float layer_bucket_depth_from_xy(MaskRasterLayer *layer, const float xy[2
   return 1.0f;
 }
 
+/**
+ * Check if none of the buckets overlapping \a rect contain any geometry,
+ * in that case every sample in the rect evaluates to a depth of 1.0
+ * (a layer value of zero, before invert/blending is applied).
+ */
+static bool layer_bucket_range_is_empty(const MaskRasterLayer *layer, const rctf *rect)
+{
+  /* Clamp to the layer bounds, the caller ensures the bounds intersect. */
+  const float xmin = max_ff(rect->xmin, layer->bounds.xmin);
+  const float xmax = min_ff(rect->xmax, layer->bounds.xmax);
+  const float ymin = max_ff(rect->ymin, layer->bounds.ymin);
+  const float ymax = min_ff(rect->ymax, layer->bounds.ymax);
+
+  const uint xi_min = uint((xmin - layer->bounds.xmin) * layer->buckets_xy_scalar[0]);
+  const uint yi_min = uint((ymin - layer->bounds.ymin) * layer->buckets_xy_scalar[1]);
+  const uint xi_max = min_uu(uint((xmax - layer->bounds.xmin) * layer->buckets_xy_scalar[0]),
+                             layer->buckets_x - 1);
+  const uint yi_max = min_uu(uint((ymax - layer->bounds.ymin) * layer->buckets_xy_scalar[1]),
+                             layer->buckets_y - 1);
+
+  for (uint yi = yi_min; yi <= yi_max; yi++) {
+    const uint *const *buckets_row = layer->buckets_face + (yi * layer->buckets_x);
+    for (uint xi = xi_min; xi <= xi_max; xi++) {
+      if (buckets_row[xi] != nullptr) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 float BKE_maskrasterize_handle_sample(MaskRasterHandle *mr_handle, const float xy[2])
 {
   /* can't do this because some layers may invert */
@@ -1430,13 +1465,41 @@ struct MaskRasterizeBufferData {
   MaskRasterHandle *mr_handle;
   float x_inv, y_inv;
   float x_px_ofs, y_px_ofs;
-  uint width;
+  uint width, height;
+  uint tiles_x;
+  /* value for pixels where no layer has any geometry */
+  float value_empty;
 
   float *buffer;
 };
 
+/**
+ * Check if any layer can contribute geometry to pixels in \a tile_bounds,
+ * when it can't (the common case for most tiles of a high resolution buffer),
+ * every pixel in the tile evaluates to the same constant.
+ *
+ * \note inverted layers make pixels outside the layer bounds non-zero,
+ * so this can't simply skip the tile, see #BKE_maskrasterize_handle_sample.
+ */
+static bool maskrasterize_buffer_tile_is_empty(MaskRasterHandle *mr_handle,
+                                               const rctf *tile_bounds)
+{
+  const uint layers_tot = mr_handle->layers_tot;
+  const MaskRasterLayer *layer = mr_handle->layers;
+
+  for (uint i = 0; i < layers_tot; i++, layer++) {
+    /* also used as signal for unused layer (when render is disabled) */
+    if (layer->alpha != 0.0f && BLI_rctf_isect(&layer->bounds, tile_bounds, nullptr) &&
+        !layer_bucket_range_is_empty(layer, tile_bounds))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 static void maskrasterize_buffer_cb(void *__restrict userdata,
-                                    const int y,
+                                    const int tile_index,
                                     const TaskParallelTLS *__restrict /*tls*/)
 {
   MaskRasterizeBufferData *data = static_cast<MaskRasterizeBufferData *>(userdata);
@@ -1446,15 +1509,41 @@ static void maskrasterize_buffer_cb(void *__restrict userdata,
 
   const uint width = data->width;
   const float x_inv = data->x_inv;
+  const float y_inv = data->y_inv;
   const float x_px_ofs = data->x_px_ofs;
+  const float y_px_ofs = data->y_px_ofs;
+
+  const uint x_min = (uint(tile_index) % data->tiles_x) * BUFFER_TILE_SIZE;
+  const uint y_min = (uint(tile_index) / data->tiles_x) * BUFFER_TILE_SIZE;
+  const uint x_max = min_uu(x_min + BUFFER_TILE_SIZE, width);
+  const uint y_max = min_uu(y_min + BUFFER_TILE_SIZE, data->height);
+
+  rctf tile_bounds;
+  tile_bounds.xmin = float(x_min) * x_inv;
+  tile_bounds.xmax = float(x_max) * x_inv;
+  tile_bounds.ymin = float(y_min) * y_inv;
+  tile_bounds.ymax = float(y_max) * y_inv;
+
+  if (maskrasterize_buffer_tile_is_empty(mr_handle, &tile_bounds)) {
+    const float value_empty = data->value_empty;
+    for (uint y = y_min; y < y_max; y++) {
+      float *buffer_row = buffer + (size_t(y) * width);
+      for (uint x = x_min; x < x_max; x++) {
+        buffer_row[x] = value_empty;
+      }
+    }
+    return;
+  }
 
-  uint i = uint(y) * width;
   float xy[2];
-  xy[1] = (float(y) * data->y_inv) + data->y_px_ofs;
-  for (uint x = 0; x < width; x++, i++) {
-    xy[0] = (float(x) * x_inv) + x_px_ofs;
+  for (uint y = y_min; y < y_max; y++) {
+    float *buffer_row = buffer + (size_t(y) * width);
+    xy[1] = (float(y) * y_inv) + y_px_ofs;
+    for (uint x = x_min; x < x_max; x++) {
+      xy[0] = (float(x) * x_inv) + x_px_ofs;
 
-    buffer[i] = BKE_maskrasterize_handle_sample(mr_handle, xy);
+      buffer_row[x] = BKE_maskrasterize_handle_sample(mr_handle, xy);
+    }
   }
 }
 
@@ -1468,6 +1557,10 @@ void BKE_maskrasterize_buffer(MaskRasterHandle *mr_handle,
   const float x_inv = 1.0f / float(width);
   const float y_inv = 1.0f / float(height);
 
+  /* Sampling anywhere outside the handle bounds gives the value empty tiles share,
+   * this isn't necessarily zero since layers may invert. */
+  const float xy_outside[2] = {mr_handle->bounds.xmin - 1.0f, mr_handle->bounds.ymin - 1.0f};
+
   MaskRasterizeBufferData data{};
   data.mr_handle = mr_handle;
   data.x_inv = x_inv;
@@ -1475,9 +1568,15 @@ void BKE_maskrasterize_buffer(MaskRasterHandle *mr_handle,
   data.x_px_ofs = x_inv * 0.5f;
   data.y_px_ofs = y_inv * 0.5f;
   data.width = width;
+  data.height = height;
+  data.tiles_x = (width + BUFFER_TILE_SIZE - 1) / BUFFER_TILE_SIZE;
+  data.value_empty = BKE_maskrasterize_handle_sample(mr_handle, xy_outside);
   data.buffer = buffer;
+
+  const uint tiles_y = (height + BUFFER_TILE_SIZE - 1) / BUFFER_TILE_SIZE;
   TaskParallelSettings settings;
   BLI_parallel_range_settings_defaults(&settings);
   settings.use_threading = (size_t(height) * width > 10000);
-  BLI_task_parallel_range(0, int(height), &data, maskrasterize_buffer_cb, &settings);
+  BLI_task_parallel_range(
+      0, int(data.tiles_x * tiles_y), &data, maskrasterize_buffer_cb, &settings);
 }
@@ -143,6 +143,12 @@ static void mesh_copy_data(Main *bmain,
   mesh_dst->runtime->vert_normals_cache = mesh_src->runtime->vert_normals_cache;
   mesh_dst->runtime->face_normals_cache = mesh_src->runtime->face_normals_cache;
   mesh_dst->runtime->corner_normals_cache = mesh_src->runtime->corner_normals_cache;
+  {
+    /* The shared normal caches may still have a pending partial update that the copy has to
+     * apply as well, since it also copies the already changed vertex positions. */
+    std::lock_guard lock(mesh_src->runtime->dirty_normal_verts_mutex);
+    mesh_dst->runtime->dirty_normal_verts = mesh_src->runtime->dirty_normal_verts;
+  }
   mesh_dst->runtime->loose_verts_cache = mesh_src->runtime->loose_verts_cache;
   mesh_dst->runtime->verts_no_face_cache = mesh_src->runtime->verts_no_face_cache;
   mesh_dst->runtime->loose_edges_cache = mesh_src->runtime->loose_edges_cache;
@@ -152,6 +158,9 @@ static void mesh_copy_data(Main *bmain,
   mesh_dst->runtime->vert_to_face_map_cache = mesh_src->runtime->vert_to_face_map_cache;
   mesh_dst->runtime->vert_to_corner_map_cache = mesh_src->runtime->vert_to_corner_map_cache;
   mesh_dst->runtime->corner_to_face_map_cache = mesh_src->runtime->corner_to_face_map_cache;
+  /* The BVH trees are keyed by the implicit-sharing versions of the arrays they were built from,
+   * so the copy can keep using them until its geometry actually diverges (see #BVHCache). */
+  mesh_dst->runtime->bvh_cache = mesh_src->runtime->bvh_cache;
   if (mesh_src->runtime->bake_materials) {
     mesh_dst->runtime->bake_materials = std::make_unique<blender::bke::bake::BakeMaterialsList>(
         *mesh_src->runtime->bake_materials);
@@ -6,11 +6,11 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
 #include "BLI_array_utils.hh"
 #include "BLI_ordered_edge.hh"
 #include "BLI_task.hh"
-#include "BLI_threads.h"
-#include "BLI_vector_set.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -21,94 +21,196 @@ namespace blender::bke {
 namespace calc_edges {
 
 /**
- * Return a hash value that is likely to be different in the low bits from the normal `hash()`
- * function. This is necessary to avoid collisions in #mesh_calc_edges.
+ * The number of buckets the keys are partitioned into before sorting. More buckets give more
+ * parallelism in the sorting stage but make the counting stage more expensive.
  */
-static uint64_t edge_hash_2(const OrderedEdge &edge)
-{
-  return edge.v_low;
-}
+static constexpr int64_t buckets_num = 1024;
+/** The number of keys counted and scattered per task in the partitioning stage. */
+static constexpr int64_t partition_chunk_size = 1 << 17;
 
-using EdgeMap = VectorSet<OrderedEdge,
-                          DefaultProbingStrategy,
-                          DefaultHash<OrderedEdge>,
-                          DefaultEquality<OrderedEdge>,
-                          SimpleVectorSetSlot<OrderedEdge, int>,
-                          GuardedAllocator>;
+/**
+ * Key used by degenerate face corners that don't produce an edge. It compares larger than any
+ * valid edge key and is dropped when the keys are partitioned.
+ */
+static constexpr uint64_t no_edge_key = ~uint64_t(0);
 
-static void reserve_hash_maps(const Mesh &mesh,
-                              const bool keep_existing_edges,
-                              MutableSpan<EdgeMap> edge_maps)
+/**
+ * Pack an edge into a 64-bit key. The key order matches #OrderedEdge::operator<, so sorting the
+ * keys results in a deterministic edge order independent of the face order.
+ */
+static uint64_t edge_key(const OrderedEdge edge)
 {
-  const int totedge_guess = std::max(keep_existing_edges ? mesh.edges_num : 0, mesh.faces_num * 2);
-  threading::parallel_for_each(
-      edge_maps, [&](EdgeMap &edge_map) { edge_map.reserve(totedge_guess / edge_maps.size()); });
+  return (uint64_t(edge.v_low) << 32) | uint64_t(uint32_t(edge.v_high));
 }
 
-static void add_existing_edges_to_hash_maps(const Mesh &mesh,
-                                            const uint32_t parallel_mask,
-                                            MutableSpan<EdgeMap> edge_maps)
+static int2 key_to_edge(const uint64_t key)
 {
-  /* Assume existing edges are valid. */
-  const Span<int2> edges = mesh.edges();
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    for (const int2 edge : edges) {
-      const OrderedEdge ordered_edge(edge);
-      /* Only add the edge when it belongs into this map. */
-      if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-        edge_map.add(ordered_edge);
-      }
-    }
-  });
+  return int2(int(key >> 32), int(key & 0xffffffff));
 }
 
-static void add_face_edges_to_hash_maps(const Mesh &mesh,
-                                        const uint32_t parallel_mask,
-                                        MutableSpan<EdgeMap> edge_maps)
+static void calc_face_edge_keys(const OffsetIndices<int> faces,
+                                const Span<int> corner_verts,
+                                MutableSpan<uint64_t> keys)
 {
-  const OffsetIndices<int> faces = mesh.faces();
-  const Span<int> corner_verts = mesh.corner_verts();
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    for (const int face_i : faces.index_range()) {
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_i : range) {
       const IndexRange face = faces[face_i];
       for (const int corner : face) {
         const int vert = corner_verts[corner];
         const int vert_prev = corner_verts[bke::mesh::face_corner_prev(face, corner)];
         /* Can only be the same when the mesh data is invalid. */
-        if (LIKELY(vert_prev != vert)) {
-          const OrderedEdge ordered_edge(vert_prev, vert);
-          /* Only add the edge when it belongs into this map. */
-          if (task_index == (parallel_mask & edge_hash_2(ordered_edge))) {
-            edge_map.add(ordered_edge);
-          }
+        keys[corner] = LIKELY(vert_prev != vert) ? edge_key(OrderedEdge(vert_prev, vert)) :
+                                                   no_edge_key;
+      }
+    }
+  });
+}
+
+static void calc_existing_edge_keys(const Span<int2> edges, MutableSpan<uint64_t> keys)
+{
+  /* Assume existing edges are valid. */
+  threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      keys[i] = edge_key(OrderedEdge(edges[i]));
+    }
+  });
+}
+
+/**
+ * How far keys have to be shifted down so that the remaining most significant bits index a
+ * bucket. Using the most significant bits that can actually vary (based on the number of
+ * vertices) fills the buckets roughly uniformly for typical meshes. Equal keys always end up in
+ * the same bucket, and the bucket order matches the key order.
+ */
+static int calc_bucket_shift(const int verts_num)
+{
+  const uint64_t key_limit = uint64_t(std::max(verts_num, 2)) << 32;
+  int shift = 0;
+  while (((key_limit - 1) >> shift) >= uint64_t(buckets_num)) {
+    shift++;
+  }
+  return shift;
+}
+
+/**
+ * A single parallel most-significant-digit radix pass: count the keys per bucket and scatter them
+ * into ordered buckets in \a r_sorted_keys, so each bucket can be sorted independently
+ * afterwards. The pass streams through the key array twice and is memory-bandwidth bound.
+ * #no_edge_key entries are dropped, so only the first `r_bucket_offsets.last()` values of
+ * \a r_sorted_keys are initialized.
+ */
+static void partition_keys_into_buckets(const Span<uint64_t> keys,
+                                        const int shift,
+                                        MutableSpan<uint64_t> r_sorted_keys,
+                                        MutableSpan<int64_t> r_bucket_offsets)
+{
+  BLI_assert(r_bucket_offsets.size() == buckets_num + 1);
+  const int64_t chunks_num = (keys.size() + partition_chunk_size - 1) / partition_chunk_size;
+  Array<int64_t> chunk_histograms(chunks_num * buckets_num, 0);
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      MutableSpan<int64_t> histogram = chunk_histograms.as_mutable_span().slice(
+          chunk * buckets_num, buckets_num);
+      const int64_t start = chunk * partition_chunk_size;
+      for (const uint64_t key : keys.slice(start, std::min(partition_chunk_size,
+                                                           keys.size() - start))) {
+        if (key != no_edge_key) {
+          histogram[key >> shift]++;
+        }
+      }
+    }
+  });
+
+  /* Turn the per-chunk counts into the write position of every chunk-bucket combination. */
+  int64_t offset = 0;
+  for (const int64_t bucket : IndexRange(buckets_num)) {
+    r_bucket_offsets[bucket] = offset;
+    for (const int64_t chunk : IndexRange(chunks_num)) {
+      int64_t &count = chunk_histograms[chunk * buckets_num + bucket];
+      const int64_t chunk_start = offset;
+      offset += count;
+      count = chunk_start;
+    }
+  }
+  r_bucket_offsets[buckets_num] = offset;
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      MutableSpan<int64_t> positions = chunk_histograms.as_mutable_span().slice(
+          chunk * buckets_num, buckets_num);
+      const int64_t start = chunk * partition_chunk_size;
+      for (const uint64_t key : keys.slice(start, std::min(partition_chunk_size,
+                                                           keys.size() - start))) {
+        if (key != no_edge_key) {
+          r_sorted_keys[positions[key >> shift]++] = key;
         }
       }
     }
   });
 }
 
-static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
-                                                        const OffsetIndices<int> edge_offsets,
-                                                        MutableSpan<int2> new_edges)
+/**
+ * Sort every bucket and move its unique keys to the bucket start, returning the number of unique
+ * keys per bucket (the deduplicated edge counts).
+ */
+static void sort_and_deduplicate_buckets(MutableSpan<uint64_t> sorted_keys,
+                                         const Span<int64_t> bucket_offsets,
+                                         MutableSpan<int64_t> r_unique_counts)
 {
-  threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
-    const int task_index = &edge_map - edge_maps.data();
-    if (edge_offsets[task_index].is_empty()) {
-      return;
+  threading::parallel_for(IndexRange(buckets_num), 1, [&](const IndexRange range) {
+    for (const int64_t bucket : range) {
+      MutableSpan<uint64_t> bucket_keys = sorted_keys.slice(
+          bucket_offsets[bucket], bucket_offsets[bucket + 1] - bucket_offsets[bucket]);
+      std::sort(bucket_keys.begin(), bucket_keys.end());
+      r_unique_counts[bucket] = std::unique(bucket_keys.begin(), bucket_keys.end()) -
+                                bucket_keys.begin();
     }
+  });
+}
 
-    MutableSpan<int2> result_edges = new_edges.slice(edge_offsets[task_index]);
-    result_edges.copy_from(edge_map.as_span().cast<int2>());
+static void write_deduplicated_edges(const Span<uint64_t> sorted_keys,
+                                     const Span<int64_t> bucket_offsets,
+                                     const Span<int64_t> unique_counts,
+                                     const Span<int64_t> unique_offsets,
+                                     MutableSpan<uint64_t> r_unique_keys,
+                                     MutableSpan<int2> r_edges)
+{
+  threading::parallel_for(IndexRange(buckets_num), 1, [&](const IndexRange range) {
+    for (const int64_t bucket : range) {
+      const Span<uint64_t> bucket_keys = sorted_keys.slice(bucket_offsets[bucket],
+                                                           unique_counts[bucket]);
+      const int64_t offset = unique_offsets[bucket];
+      r_unique_keys.slice(offset, bucket_keys.size()).copy_from(bucket_keys);
+      for (const int64_t i : bucket_keys.index_range()) {
+        r_edges[offset + i] = key_to_edge(bucket_keys[i]);
+      }
+    }
   });
 }
 
+/**
+ * Find the index of an edge that is known to be in the deduplicated edge array, by binary search
+ * within its bucket.
+ */
+static int lookup_edge_index(const Span<uint64_t> unique_keys,
+                             const Span<int64_t> unique_offsets,
+                             const int shift,
+                             const uint64_t key)
+{
+  const int64_t bucket = key >> shift;
+  const Span<uint64_t> bucket_keys = unique_keys.slice(
+      unique_offsets[bucket], unique_offsets[bucket + 1] - unique_offsets[bucket]);
+  const uint64_t *it = std::lower_bound(bucket_keys.begin(), bucket_keys.end(), key);
+  BLI_assert(it != bucket_keys.end() && *it == key);
+  return int(unique_offsets[bucket] + (it - bucket_keys.begin()));
+}
+
 static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
                                               const Span<int> corner_verts,
-                                              const Span<EdgeMap> edge_maps,
-                                              const uint32_t parallel_mask,
-                                              const OffsetIndices<int> edge_offsets,
+                                              const Span<uint64_t> unique_keys,
+                                              const Span<int64_t> unique_offsets,
+                                              const int shift,
                                               MutableSpan<int> corner_edges)
 {
   threading::parallel_for(faces.index_range(), 100, [&](IndexRange range) {
@@ -116,8 +218,8 @@ static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
       const IndexRange face = faces[face_index];
       for (const int corner : face) {
         const int vert = corner_verts[corner];
-        const int vert_prev = corner_verts[bke::mesh::face_corner_next(face, corner)];
-        if (UNLIKELY(vert == vert_prev)) {
+        const int vert_next = corner_verts[bke::mesh::face_corner_next(face, corner)];
+        if (UNLIKELY(vert == vert_next)) {
           /* This is an invalid edge; normally this does not happen in Blender,
            * but it can be part of an imported mesh with invalid geometry. See
            * #76514. */
@@ -125,48 +227,23 @@ static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
           continue;
         }
 
-        const OrderedEdge ordered_edge(vert_prev, vert);
-        const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-        const EdgeMap &edge_map = edge_maps[task_index];
-        const int edge_i = edge_map.index_of(ordered_edge);
-        const int edge_index = edge_offsets[task_index][edge_i];
-        corner_edges[corner] = edge_index;
+        const uint64_t key = edge_key(OrderedEdge(vert_next, vert));
+        corner_edges[corner] = lookup_edge_index(unique_keys, unique_offsets, shift, key);
       }
     }
   });
 }
 
-static int get_parallel_maps_count(const Mesh &mesh)
-{
-  /* Don't use parallelization when the mesh is small. */
-  if (mesh.faces_num < 1000) {
-    return 1;
-  }
-  /* Use at most 8 separate hash tables. Using more threads has diminishing returns. These threads
-   * are better off doing something more useful instead. */
-  const int system_thread_count = BLI_system_thread_count();
-  return power_of_2_min_i(std::min(8, system_thread_count));
-}
-
-static void clear_hash_tables(MutableSpan<EdgeMap> edge_maps)
-{
-  threading::parallel_for_each(edge_maps, [](EdgeMap &edge_map) { edge_map.clear_and_shrink(); });
-}
-
-static void deselect_known_edges(const OffsetIndices<int> edge_offsets,
-                                 const Span<EdgeMap> edge_maps,
-                                 const uint32_t parallel_mask,
+static void deselect_known_edges(const Span<uint64_t> unique_keys,
+                                 const Span<int64_t> unique_offsets,
+                                 const int shift,
                                  const Span<int2> known_edges,
                                  MutableSpan<bool> selection)
 {
   threading::parallel_for(known_edges.index_range(), 2048, [&](const IndexRange range) {
     for (const int2 original_edge : known_edges.slice(range)) {
-      const OrderedEdge ordered_edge(original_edge);
-      const int task_index = parallel_mask & edge_hash_2(ordered_edge);
-      const EdgeMap &edge_map = edge_maps[task_index];
-      const int edge_i = edge_map.index_of(ordered_edge);
-      const int edge_index = edge_offsets[task_index][edge_i];
-      selection[edge_index] = false;
+      const uint64_t key = edge_key(OrderedEdge(original_edge));
+      selection[lookup_edge_index(unique_keys, unique_offsets, shift, key)] = false;
     }
   });
 }
@@ -175,38 +252,52 @@ static void deselect_known_edges(const OffsetIndices<int> edge_offsets,
 
 void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new_edges)
 {
-  /* Parallelization is achieved by having multiple hash tables for different subsets of edges.
-   * Each edge is assigned to one of the hash maps based on the lower bits of a hash value. */
-  const int parallel_maps = calc_edges::get_parallel_maps_count(mesh);
-  BLI_assert(is_power_of_2_i(parallel_maps));
-  const uint32_t parallel_mask = uint32_t(parallel_maps) - 1;
-  Array<calc_edges::EdgeMap> edge_maps(parallel_maps);
-  calc_edges::reserve_hash_maps(mesh, keep_existing_edges, edge_maps);
-
-  /* Add all edges. */
+  /* Edges are derived by sorting instead of hashing: every face corner packs its edge into a
+   * 64-bit key, the keys are partitioned into ordered buckets with a single parallel radix pass,
+   * and each bucket is sorted and deduplicated independently. This scales across all cores and is
+   * memory-bandwidth bound on large meshes, where hash tables are latency bound. */
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+
+  const int64_t face_keys_num = mesh.corners_num;
+  const int64_t keys_num = face_keys_num + (keep_existing_edges ? mesh.edges_num : 0);
+  Array<uint64_t> keys(keys_num);
+  calc_edges::calc_face_edge_keys(
+      faces, corner_verts, keys.as_mutable_span().take_front(face_keys_num));
   if (keep_existing_edges) {
-    calc_edges::add_existing_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
+    calc_edges::calc_existing_edge_keys(mesh.edges(),
+                                        keys.as_mutable_span().drop_front(face_keys_num));
   }
-  calc_edges::add_face_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
 
-  Array<int> edge_sizes(edge_maps.size() + 1);
-  for (const int i : edge_maps.index_range()) {
-    edge_sizes[i] = edge_maps[i].size();
+  const int shift = calc_edges::calc_bucket_shift(mesh.verts_num);
+  Array<uint64_t> sorted_keys(keys_num);
+  Array<int64_t> bucket_offsets(calc_edges::buckets_num + 1);
+  calc_edges::partition_keys_into_buckets(keys, shift, sorted_keys, bucket_offsets);
+  /* Free the unsorted keys early, they are not needed anymore. */
+  keys = {};
+
+  Array<int64_t> unique_counts(calc_edges::buckets_num);
+  calc_edges::sort_and_deduplicate_buckets(sorted_keys, bucket_offsets, unique_counts);
+
+  Array<int64_t> unique_offsets(calc_edges::buckets_num + 1);
+  int64_t new_edges_num = 0;
+  for (const int64_t bucket : IndexRange(calc_edges::buckets_num)) {
+    unique_offsets[bucket] = new_edges_num;
+    new_edges_num += unique_counts[bucket];
   }
-  const OffsetIndices<int> edge_offsets = offset_indices::accumulate_counts_to_offsets(edge_sizes);
+  unique_offsets[calc_edges::buckets_num] = new_edges_num;
 
   /* Create new edges. */
   MutableAttributeAccessor attributes = mesh.attributes_for_write();
   attributes.add<int>(".corner_edge", AttrDomain::Corner, AttributeInitConstruct());
-  MutableSpan<int2> new_edges(MEM_cnew_array<int2>(edge_offsets.total_size(), __func__),
-                              edge_offsets.total_size());
-  calc_edges::serialize_and_initialize_deduplicated_edges(edge_maps, edge_offsets, new_edges);
-  calc_edges::update_edge_indices_in_face_loops(mesh.faces(),
-                                                mesh.corner_verts(),
-                                                edge_maps,
-                                                parallel_mask,
-                                                edge_offsets,
-                                                mesh.corner_edges_for_write());
+  MutableSpan<int2> new_edges(MEM_cnew_array<int2>(size_t(new_edges_num), __func__),
+                              new_edges_num);
+  Array<uint64_t> unique_keys(new_edges_num);
+  calc_edges::write_deduplicated_edges(
+      sorted_keys, bucket_offsets, unique_counts, unique_offsets, unique_keys, new_edges);
+  sorted_keys = {};
+  calc_edges::update_edge_indices_in_face_loops(
+      faces, corner_verts, unique_keys, unique_offsets, shift, mesh.corner_edges_for_write());
 
   Array<int2> original_edges;
   if (keep_existing_edges && select_new_edges) {
@@ -217,7 +308,7 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   /* Free old CustomData and assign new one. */
   CustomData_free(&mesh.edge_data, mesh.edges_num);
   CustomData_reset(&mesh.edge_data);
-  mesh.edges_num = edge_offsets.total_size();
+  mesh.edges_num = int(new_edges_num);
   attributes.add<int2>(".edge_verts", AttrDomain::Edge, AttributeInitMoveArray(new_edges.data()));
 
   if (select_new_edges) {
@@ -228,7 +319,7 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
       select_edge.span.fill(true);
       if (!original_edges.is_empty()) {
         calc_edges::deselect_known_edges(
-            edge_offsets, edge_maps, parallel_mask, original_edges, select_edge.span);
+            unique_keys, unique_offsets, shift, original_edges, select_edge.span);
       }
       select_edge.finish();
     }
@@ -238,9 +329,6 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
     /* All edges are rebuilt from the faces, so there are no loose edges. */
     mesh.tag_loose_edges_none();
   }
-
-  /* Explicitly clear edge maps, because that way it can be parallelized. */
-  calc_edges::clear_hash_tables(edge_maps);
 }
 
 }  // namespace blender::bke
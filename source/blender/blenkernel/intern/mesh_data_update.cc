@@ -1150,6 +1150,39 @@ void mesh_data_update(Depsgraph &depsgraph,
    * they aren't cleaned up properly on mode switch, causing crashes, e.g #58150. */
   BLI_assert(ob.id.tag & LIB_TAG_COPIED_ON_EVAL);
 
+  /* A deform-only modifier stack keeps the input topology, so GPU buffers of the previous result
+   * which do not depend on vertex positions (index buffers, UVs, generic attributes) remain
+   * valid. Salvage the batch cache before the old result is freed, and hand it over to the new
+   * result below when the topology provably did not change. */
+  void *batch_cache_salvaged = nullptr;
+  const ImplicitSharingInfo *salvaged_corner_verts = nullptr;
+  const ImplicitSharingInfo *salvaged_edges = nullptr;
+  if (ob.runtime->data_eval && GS(ob.runtime->data_eval->name) == ID_ME &&
+      (ob.mode & OB_MODE_ALL_SCULPT) == 0)
+  {
+    Mesh *mesh_eval_prev = reinterpret_cast<Mesh *>(ob.runtime->data_eval);
+    if (mesh_eval_prev->runtime->deformed_only && !mesh_eval_prev->runtime->edit_mesh) {
+      /* Deform-only results share the topology arrays of the original mesh through implicit
+       * sharing, and any topology change un-shares them. Hold a strong user of both sharing
+       * infos across the rebuild so the arrays cannot be freed and their addresses reused by
+       * unrelated allocations; comparing the sharing-info pointers against the new result is
+       * then a reliable equality check. */
+      const AttributeAccessor attributes = mesh_eval_prev->attributes();
+      salvaged_corner_verts = attributes.lookup(".corner_vert").sharing_info;
+      salvaged_edges = attributes.lookup(".edge_verts").sharing_info;
+      if (salvaged_corner_verts && salvaged_edges) {
+        salvaged_corner_verts->add_user();
+        salvaged_edges->add_user();
+        batch_cache_salvaged = mesh_eval_prev->runtime->batch_cache;
+        mesh_eval_prev->runtime->batch_cache = nullptr;
+      }
+      else {
+        salvaged_corner_verts = nullptr;
+        salvaged_edges = nullptr;
+      }
+    }
+  }
+
   BKE_object_free_derived_caches(&ob);
   if (DEG_is_active(&depsgraph)) {
     BKE_sculpt_update_object_before_eval(&ob);
@@ -1171,6 +1204,25 @@ void mesh_data_update(Depsgraph &depsgraph,
   else {
     mesh_build_data(depsgraph, scene, ob, cddata_masks, need_mapping);
   }
+
+  if (batch_cache_salvaged) {
+    Mesh *mesh_eval = (ob.runtime->data_eval && GS(ob.runtime->data_eval->name) == ID_ME) ?
+                          reinterpret_cast<Mesh *>(ob.runtime->data_eval) :
+                          nullptr;
+    if (mesh_eval && mesh_eval->runtime->deformed_only &&
+        mesh_eval->runtime->batch_cache == nullptr &&
+        mesh_eval->attributes().lookup(".corner_vert").sharing_info == salvaged_corner_verts &&
+        mesh_eval->attributes().lookup(".edge_verts").sharing_info == salvaged_edges)
+    {
+      mesh_eval->runtime->batch_cache = batch_cache_salvaged;
+      BKE_mesh_batch_cache_dirty_tag(mesh_eval, BKE_MESH_BATCH_DIRTY_DEFORM);
+    }
+    else {
+      BKE_mesh_batch_cache_free(batch_cache_salvaged);
+    }
+    salvaged_corner_verts->remove_user_and_delete_if_last();
+    salvaged_edges->remove_user_and_delete_if_last();
+  }
 }
 
 Mesh *mesh_get_eval_deform(Depsgraph *depsgraph,
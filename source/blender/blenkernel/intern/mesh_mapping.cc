@@ -11,8 +11,6 @@
 
 #include "MEM_guardedalloc.h"
 
-#include "atomic_ops.h"
-
 #include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_buffer.h"
@@ -305,14 +303,125 @@ static Array<int> create_reverse_offsets(const Span<int> indices, const int item
   return offsets;
 }
 
-static void sort_small_groups(const OffsetIndices<int> groups,
-                              const int grain_size,
-                              MutableSpan<int> indices)
+/**
+ * The number of buckets the sources are partitioned into before the final scatter. More buckets
+ * give more parallelism in the scatter stage but make the counting stage more expensive.
+ */
+static constexpr int64_t reverse_buckets_num = 1024;
+/** The number of sources counted and scattered per task in the partitioning stage. */
+static constexpr int64_t reverse_chunk_size = 1 << 17;
+
+/**
+ * How far group indices have to be shifted down so that the remaining most significant bits index
+ * a bucket. Every bucket then covers a contiguous range of groups, and the bucket order matches
+ * the group order.
+ */
+static int calc_group_bucket_shift(const int64_t groups_num)
+{
+  int shift = 0;
+  while (((std::max<int64_t>(groups_num, 2) - 1) >> shift) >= reverse_buckets_num) {
+    shift++;
+  }
+  return shift;
+}
+
+/**
+ * Stably partition the source indices (positions in \a group_indices) into buckets of adjacent
+ * groups. Per-chunk histograms give every chunk-bucket combination its own write range, so the
+ * scatter needs no atomics, and chunks write in order within each bucket, which keeps the
+ * partition stable.
+ */
+static void partition_sources_into_buckets(const Span<int> group_indices,
+                                           const int shift,
+                                           MutableSpan<int> r_partitioned,
+                                           MutableSpan<int64_t> r_bucket_offsets)
 {
-  threading::parallel_for(groups.index_range(), grain_size, [&](const IndexRange range) {
-    for (const int64_t index : range) {
-      MutableSpan<int> group = indices.slice(groups[index]);
-      std::sort(group.begin(), group.end());
+  BLI_assert(r_bucket_offsets.size() == reverse_buckets_num + 1);
+  const int64_t chunks_num = (group_indices.size() + reverse_chunk_size - 1) / reverse_chunk_size;
+  Array<int64_t> chunk_histograms(chunks_num * reverse_buckets_num, 0);
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      MutableSpan<int64_t> histogram = chunk_histograms.as_mutable_span().slice(
+          chunk * reverse_buckets_num, reverse_buckets_num);
+      const int64_t start = chunk * reverse_chunk_size;
+      for (const int group : group_indices.slice(
+               start, std::min(reverse_chunk_size, group_indices.size() - start)))
+      {
+        histogram[group >> shift]++;
+      }
+    }
+  });
+
+  /* Turn the per-chunk counts into the write position of every chunk-bucket combination. */
+  int64_t offset = 0;
+  for (const int64_t bucket : IndexRange(reverse_buckets_num)) {
+    r_bucket_offsets[bucket] = offset;
+    for (const int64_t chunk : IndexRange(chunks_num)) {
+      int64_t &count = chunk_histograms[chunk * reverse_buckets_num + bucket];
+      const int64_t chunk_start = offset;
+      offset += count;
+      count = chunk_start;
+    }
+  }
+  r_bucket_offsets[reverse_buckets_num] = offset;
+
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      MutableSpan<int64_t> positions = chunk_histograms.as_mutable_span().slice(
+          chunk * reverse_buckets_num, reverse_buckets_num);
+      const int64_t start = chunk * reverse_chunk_size;
+      for (const int64_t i :
+           IndexRange(start, std::min(reverse_chunk_size, group_indices.size() - start)))
+      {
+        r_partitioned[positions[group_indices[i] >> shift]++] = int(i);
+      }
+    }
+  });
+}
+
+/**
+ * For every group, gather the values derived from the sources referencing it, with a two-pass
+ * parallel counting sort: the sources are first stably partitioned into coarse buckets of
+ * adjacent groups, then every bucket is scattered to its final positions in parallel. Buckets
+ * cover disjoint group ranges, so the per-group write cursors need no atomics, and since both
+ * passes are stable, every group's values end up ordered by source index without sorting.
+ */
+template<typename ValueFn>
+static void reverse_indices_by_counting_sort(const Span<int> group_indices,
+                                             const OffsetIndices<int> offsets,
+                                             const ValueFn value_fn,
+                                             MutableSpan<int> results)
+{
+  if (group_indices.size() < reverse_chunk_size) {
+    /* A single serial pass over the sources is stable too and avoids the partition overhead. */
+    Array<int> cursors(offsets.size());
+    for (const int64_t group : offsets.index_range()) {
+      cursors[group] = int(offsets[group].start());
+    }
+    for (const int64_t i : group_indices.index_range()) {
+      results[cursors[group_indices[i]]++] = value_fn(i);
+    }
+    return;
+  }
+
+  const int shift = calc_group_bucket_shift(offsets.size());
+  Array<int> partitioned(group_indices.size());
+  Array<int64_t> bucket_offsets(reverse_buckets_num + 1);
+  partition_sources_into_buckets(group_indices, shift, partitioned, bucket_offsets);
+
+  Array<int> cursors(offsets.size());
+  threading::parallel_for(offsets.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t group : range) {
+      cursors[group] = int(offsets[group].start());
+    }
+  });
+  threading::parallel_for(IndexRange(reverse_buckets_num), 1, [&](const IndexRange range) {
+    for (const int64_t bucket : range) {
+      const int64_t start = bucket_offsets[bucket];
+      for (const int i : partitioned.as_span().slice(start, bucket_offsets[bucket + 1] - start)) {
+        results[cursors[group_indices[i]]++] = value_fn(i);
+      }
     }
   });
 }
@@ -326,21 +435,9 @@ static Array<int> reverse_indices_in_groups(const Span<int> group_indices,
   BLI_assert(*std::max_element(group_indices.begin(), group_indices.end()) < offsets.size());
   BLI_assert(*std::min_element(group_indices.begin(), group_indices.end()) >= 0);
 
-  /* `counts` keeps track of how many elements have been added to each group, and is incremented
-   * atomically by many threads in parallel. `calloc` can be measurably faster than a parallel fill
-   * of zero. Alternatively the offsets could be copied and incremented directly, but the cost of
-   * the copy is slightly higher than the cost of `calloc`. */
-  int *counts = MEM_cnew_array<int>(size_t(offsets.size()), __func__);
-  BLI_SCOPED_DEFER([&]() { MEM_freeN(counts); })
   Array<int> results(group_indices.size());
-  threading::parallel_for(group_indices.index_range(), 1024, [&](const IndexRange range) {
-    for (const int64_t i : range) {
-      const int group_index = group_indices[i];
-      const int index_in_group = atomic_fetch_and_add_int32(&counts[group_index], 1);
-      results[offsets[group_index][index_in_group]] = int(i);
-    }
-  });
-  sort_small_groups(offsets, 1024, results);
+  reverse_indices_by_counting_sort(
+      group_indices, offsets, [](const int64_t i) { return int(i); }, results);
   return results;
 }
 
@@ -350,17 +447,12 @@ static void reverse_group_indices_in_groups(const OffsetIndices<int> groups,
                                             const OffsetIndices<int> offsets,
                                             MutableSpan<int> results)
 {
-  int *counts = MEM_cnew_array<int>(size_t(offsets.size()), __func__);
-  BLI_SCOPED_DEFER([&]() { MEM_freeN(counts); })
-  threading::parallel_for(groups.index_range(), 1024, [&](const IndexRange range) {
-    for (const int64_t face : range) {
-      for (const int elem : group_to_elem.slice(groups[face])) {
-        const int index_in_group = atomic_fetch_and_add_int32(&counts[elem], 1);
-        results[offsets[elem][index_in_group]] = int(face);
-      }
-    }
-  });
-  sort_small_groups(offsets, 1024, results);
+  /* Flatten the group of every source element first, so the counting sort can work from a simple
+   * key array instead of iterating the groups. */
+  Array<int> elem_to_group(group_to_elem.size());
+  offset_indices::build_reverse_map(groups, elem_to_group);
+  reverse_indices_by_counting_sort(
+      group_to_elem, offsets, [&](const int64_t i) { return elem_to_group[i]; }, results);
 }
 
 static GroupedSpan<int> gather_groups(const Span<int> group_indices,
@@ -389,18 +481,9 @@ GroupedSpan<int> build_vert_to_edge_map(const Span<int2> edges,
   const OffsetIndices<int> offsets(r_offsets);
   r_indices.reinitialize(offsets.total_size());
 
-  /* Version of #reverse_indices_in_groups that accounts for storing two indices for each edge. */
-  int *counts = MEM_cnew_array<int>(size_t(offsets.size()), __func__);
-  BLI_SCOPED_DEFER([&]() { MEM_freeN(counts); })
-  threading::parallel_for(edges.index_range(), 1024, [&](const IndexRange range) {
-    for (const int64_t edge : range) {
-      for (const int vert : {edges[edge][0], edges[edge][1]}) {
-        const int index_in_group = atomic_fetch_and_add_int32(&counts[vert], 1);
-        r_indices[offsets[vert][index_in_group]] = int(edge);
-      }
-    }
-  });
-  sort_small_groups(offsets, 1024, r_indices);
+  /* Every edge contributes two consecutive sources, one for each of its vertices. */
+  reverse_indices_by_counting_sort(
+      edges.cast<int>(), offsets, [](const int64_t i) { return int(i / 2); }, r_indices);
   return {offsets, r_indices};
 }
 
@@ -19,6 +19,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -160,30 +161,166 @@ void normals_calc_verts(const Span<float3> vert_positions,
                         const Span<int> corner_verts,
                         const GroupedSpan<int> vert_to_face_map,
                         const Span<float3> face_normals,
+                        const IndexMask &verts_to_calc,
                         MutableSpan<float3> vert_normals)
 {
   const Span<float3> positions = vert_positions;
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
+  verts_to_calc.foreach_index(GrainSize(1024), [&](const int vert) {
+    const Span<int> vert_faces = vert_to_face_map[vert];
+    if (vert_faces.is_empty()) {
+      vert_normals[vert] = math::normalize(positions[vert]);
+      return;
+    }
 
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+    float3 vert_normal(0);
+    for (const int face : vert_faces) {
+      const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
+      const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+      const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+      const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
 
-        vert_normal += face_normals[face] * factor;
-      }
+      vert_normal += face_normals[face] * factor;
+    }
+
+    vert_normals[vert] = math::normalize(vert_normal);
+  });
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Partial Normal Updates
+ *
+ * See #Mesh::tag_positions_changed_partial. Instead of tagging the normal caches dirty, a range
+ * of changed vertices is stored in the runtime, and the caches are patched in place here before
+ * they are accessed. That avoids recomputing all normals of a large mesh when only a small
+ * region changed, e.g. during sculpting or interactive transform of a few vertices.
+ * \{ */
 
-      vert_normals[vert] = math::normalize(vert_normal);
+static void normals_apply_partial_update(const Mesh &mesh)
+{
+  MeshRuntime &runtime = *mesh.runtime;
+  std::lock_guard lock(runtime.dirty_normal_verts_mutex);
+  if (!runtime.dirty_normal_verts) {
+    return;
+  }
+  const IndexRange dirty_range = *runtime.dirty_normal_verts;
+  runtime.dirty_normal_verts.reset();
+  if (!runtime.vert_normals_cache.is_cached() && !runtime.face_normals_cache.is_cached() &&
+      !runtime.corner_normals_cache.is_cached())
+  {
+    /* All caches have been tagged dirty in the meantime; they will be rebuilt from scratch. */
+    return;
+  }
+
+  const Span<float3> positions = mesh.vert_positions();
+  const OffsetIndices<int> faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const GroupedSpan<int> vert_to_face_map = mesh.vert_to_face_map();
+  BLI_assert(dirty_range.one_after_last() <= positions.size());
+
+  /* The normal of every face using a moved vertex changes, which in turn changes the normals of
+   * every vertex of those faces, not just the vertices that moved themselves. */
+  BitVector<> face_is_dirty(faces.size(), false);
+  for (const int vert : dirty_range) {
+    for (const int face : vert_to_face_map[vert]) {
+      face_is_dirty[face].set();
+    }
+  }
+  IndexMaskMemory memory;
+  const IndexMask dirty_faces = IndexMask::from_bits(face_is_dirty, memory);
+
+  Array<bool> vert_is_dirty(positions.size(), false);
+  dirty_faces.foreach_index([&](const int face) {
+    for (const int vert : corner_verts.slice(faces[face])) {
+      vert_is_dirty[vert] = true;
     }
   });
+  /* Loose vertices are not used by any face, but their normals still follow their position. */
+  for (const int vert : dirty_range) {
+    vert_is_dirty[vert] = true;
+  }
+  const IndexMask dirty_verts = IndexMask::from_bools(vert_is_dirty, memory);
+
+  if (runtime.face_normals_cache.is_cached()) {
+    runtime.face_normals_cache.update([&](Vector<float3> &r_data) {
+      MutableSpan<float3> face_normals = r_data;
+      dirty_faces.foreach_index(GrainSize(1024), [&](const int face) {
+        face_normals[face] = normal_calc_ngon(positions, corner_verts.slice(faces[face]));
+      });
+    });
+  }
+
+  if (runtime.vert_normals_cache.is_cached()) {
+    if (!runtime.face_normals_cache.is_cached()) {
+      /* Vertex normals cannot be patched without valid face normals. */
+      runtime.vert_normals_cache.tag_dirty();
+    }
+    else {
+      const Span<float3> face_normals = runtime.face_normals_cache.data();
+      runtime.vert_normals_cache.update([&](Vector<float3> &r_data) {
+        normals_calc_verts(
+            positions, faces, corner_verts, vert_to_face_map, face_normals, dirty_verts, r_data);
+      });
+    }
+  }
+
+  if (!runtime.corner_normals_cache.is_cached()) {
+    return;
+  }
+  if (!runtime.vert_normals_cache.is_cached() || !runtime.face_normals_cache.is_cached()) {
+    runtime.corner_normals_cache.tag_dirty();
+    return;
+  }
+  switch (mesh.normals_domain()) {
+    case MeshNormalDomain::Point: {
+      const Span<float3> vert_normals = runtime.vert_normals_cache.data();
+      const GroupedSpan<int> vert_to_corner_map = mesh.vert_to_corner_map();
+      runtime.corner_normals_cache.update([&](Vector<float3> &r_data) {
+        MutableSpan<float3> corner_normals = r_data;
+        dirty_verts.foreach_index(GrainSize(1024), [&](const int vert) {
+          for (const int corner : vert_to_corner_map[vert]) {
+            corner_normals[corner] = vert_normals[vert];
+          }
+        });
+      });
+      break;
+    }
+    case MeshNormalDomain::Face: {
+      const Span<float3> face_normals = runtime.face_normals_cache.data();
+      runtime.corner_normals_cache.update([&](Vector<float3> &r_data) {
+        MutableSpan<float3> corner_normals = r_data;
+        dirty_faces.foreach_index(GrainSize(1024), [&](const int face) {
+          corner_normals.slice(faces[face]).fill(face_normals[face]);
+        });
+      });
+      break;
+    }
+    case MeshNormalDomain::Corner: {
+      const AttributeAccessor attributes = mesh.attributes();
+      const VArraySpan sharp_edges = *attributes.lookup<bool>("sharp_edge", AttrDomain::Edge);
+      const VArraySpan sharp_faces = *attributes.lookup<bool>("sharp_face", AttrDomain::Face);
+      const short2 *custom_normals = static_cast<const short2 *>(
+          CustomData_get_layer(&mesh.corner_data, CD_CUSTOMLOOPNORMAL));
+      runtime.corner_normals_cache.update([&](Vector<float3> &r_data) {
+        normals_calc_corners(positions,
+                             mesh.edges(),
+                             faces,
+                             corner_verts,
+                             mesh.corner_edges(),
+                             mesh.corner_to_face_map(),
+                             runtime.vert_normals_cache.data(),
+                             runtime.face_normals_cache.data(),
+                             sharp_edges,
+                             sharp_faces,
+                             vert_is_dirty,
+                             custom_normals,
+                             nullptr,
+                             r_data);
+      });
+      break;
+    }
+  }
 }
 
 /** \} */
@@ -235,6 +372,7 @@ blender::Span<blender::float3> Mesh::vert_normals() const
 {
   using namespace blender;
   using namespace blender::bke;
+  mesh::normals_apply_partial_update(*this);
   if (this->runtime->vert_normals_cache.is_cached()) {
     return this->runtime->vert_normals_cache.data();
   }
@@ -245,7 +383,13 @@ blender::Span<blender::float3> Mesh::vert_normals() const
   const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
   this->runtime->vert_normals_cache.ensure([&](Vector<float3> &r_data) {
     r_data.reinitialize(positions.size());
-    mesh::normals_calc_verts(positions, faces, corner_verts, vert_to_face, face_normals, r_data);
+    mesh::normals_calc_verts(positions,
+                             faces,
+                             corner_verts,
+                             vert_to_face,
+                             face_normals,
+                             positions.index_range(),
+                             r_data);
   });
   return this->runtime->vert_normals_cache.data();
 }
@@ -253,6 +397,7 @@ blender::Span<blender::float3> Mesh::vert_normals() const
 blender::Span<blender::float3> Mesh::face_normals() const
 {
   using namespace blender;
+  bke::mesh::normals_apply_partial_update(*this);
   this->runtime->face_normals_cache.ensure([&](Vector<float3> &r_data) {
     const Span<float3> positions = this->vert_positions();
     const OffsetIndices faces = this->faces();
@@ -267,6 +412,7 @@ blender::Span<blender::float3> Mesh::corner_normals() const
 {
   using namespace blender;
   using namespace blender::bke;
+  mesh::normals_apply_partial_update(*this);
   this->runtime->corner_normals_cache.ensure([&](Vector<float3> &r_data) {
     r_data.reinitialize(this->corners_num);
     const OffsetIndices<int> faces = this->faces();
@@ -300,6 +446,7 @@ blender::Span<blender::float3> Mesh::corner_normals() const
                                    this->face_normals(),
                                    sharp_edges,
                                    sharp_faces,
+                                   {},
                                    custom_normals,
                                    nullptr,
                                    r_data);
@@ -1083,6 +1230,7 @@ static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corne
 }
 
 static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
+                                   const Span<bool> verts_to_update,
                                    Vector<int, 32> &r_single_corners,
                                    Vector<int, 32> &r_fan_corners)
 {
@@ -1105,6 +1253,12 @@ static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
     const IndexRange face = faces[face_index];
 
     for (const int corner : face) {
+      /* A fan is always made up of corners of a single vertex, so when updating only a subset of
+       * vertices, fans around the other vertices can be skipped entirely. */
+      if (!verts_to_update.is_empty() && !verts_to_update[corner_verts[corner]]) {
+        continue;
+      }
+
       const int corner_prev = mesh::face_corner_prev(face, corner);
 
 #if 0
@@ -1173,10 +1327,13 @@ void normals_calc_corners(const Span<float3> vert_positions,
                           const Span<float3> face_normals,
                           const Span<bool> sharp_edges,
                           const Span<bool> sharp_faces,
+                          const Span<bool> verts_to_update,
                           const short2 *clnors_data,
                           CornerNormalSpaceArray *r_lnors_spacearr,
                           MutableSpan<float3> r_corner_normals)
 {
+  /* A partial update would result in an incomplete set of normal spaces. */
+  BLI_assert(verts_to_update.is_empty() || r_lnors_spacearr == nullptr);
   /**
    * Mapping edge -> corners.
    * If that edge is used by more than two corners (faces),
@@ -1221,7 +1378,19 @@ void normals_calc_corners(const Span<float3> vert_positions,
 
   /* Pre-populate all corner normals as if their verts were all smooth.
    * This way we don't have to compute those later! */
-  array_utils::gather(vert_normals, corner_verts, r_corner_normals, 1024);
+  if (verts_to_update.is_empty()) {
+    array_utils::gather(vert_normals, corner_verts, r_corner_normals, 1024);
+  }
+  else {
+    threading::parallel_for(corner_verts.index_range(), 2048, [&](const IndexRange range) {
+      for (const int corner : range) {
+        const int vert = corner_verts[corner];
+        if (verts_to_update[vert]) {
+          r_corner_normals[corner] = vert_normals[vert];
+        }
+      }
+    });
+  }
 
   /* This first corner check which edges are actually smooth, and compute edge vectors. */
   build_edge_to_corner_map_with_flip_and_sharp(
@@ -1229,7 +1398,7 @@ void normals_calc_corners(const Span<float3> vert_positions,
 
   Vector<int, 32> single_corners;
   Vector<int, 32> fan_corners;
-  corner_split_generator(&common_data, single_corners, fan_corners);
+  corner_split_generator(&common_data, verts_to_update, single_corners, fan_corners);
 
   if (r_lnors_spacearr) {
     r_lnors_spacearr->spaces.reinitialize(single_corners.size() + fan_corners.size());
@@ -1306,6 +1475,7 @@ static void mesh_normals_corner_custom_set(const Span<float3> positions,
                        face_normals,
                        sharp_edges,
                        sharp_faces,
+                       {},
                        r_clnors_data.data(),
                        &lnors_spacearr,
                        corner_normals);
@@ -1427,6 +1597,7 @@ static void mesh_normals_corner_custom_set(const Span<float3> positions,
                          face_normals,
                          sharp_edges,
                          sharp_faces,
+                         {},
                          r_clnors_data.data(),
                          &lnors_spacearr,
                          corner_normals);
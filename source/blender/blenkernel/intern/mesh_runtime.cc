@@ -6,6 +6,8 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array_utils.hh"
@@ -43,10 +45,9 @@ static void free_mesh_eval(MeshRuntime &mesh_runtime)
 
 static void free_bvh_cache(MeshRuntime &mesh_runtime)
 {
-  if (mesh_runtime.bvh_cache) {
-    bvhcache_free(mesh_runtime.bvh_cache);
-    mesh_runtime.bvh_cache = nullptr;
-  }
+  /* The cache may be shared with copies of the mesh; only this mesh's reference is dropped, the
+   * trees are freed with the last reference. */
+  mesh_runtime.bvh_cache.reset();
 }
 
 static void free_batch_cache(MeshRuntime &mesh_runtime)
@@ -228,23 +229,34 @@ void Mesh::tag_overlapping_none()
 
 blender::Span<blender::int3> Mesh::corner_tris() const
 {
-  this->runtime->corner_tris_cache.ensure([&](blender::Array<blender::int3> &r_data) {
+  this->runtime->corner_tris_cache.ensure([&](blender::bke::MeshRuntime::CornerTrisCache &r_data) {
     const Span<float3> positions = this->vert_positions();
     const blender::OffsetIndices faces = this->faces();
     const Span<int> corner_verts = this->corner_verts();
 
-    r_data.reinitialize(poly_to_tri_count(faces.size(), corner_verts.size()));
+    const int tris_num = poly_to_tri_count(faces.size(), corner_verts.size());
+    const uint64_t topology_hash = blender::bke::mesh::corner_tris_topology_hash(faces,
+                                                                                corner_verts);
+    if (r_data.tris.size() == tris_num && r_data.topology_hash == topology_hash) {
+      /* Only vertex positions changed since the triangulation was computed, so it is still
+       * valid; it only consists of corner indices. Concave n-gons and non-planar quads may end
+       * up with a triangulation that no longer matches their deformed shape exactly, which is
+       * an accepted trade-off for skipping the full re-tessellation on every deform update. */
+      return;
+    }
+    r_data.topology_hash = topology_hash;
+    r_data.tris.reinitialize(tris_num);
 
     if (BKE_mesh_face_normals_are_dirty(this)) {
-      blender::bke::mesh::corner_tris_calc(positions, faces, corner_verts, r_data);
+      blender::bke::mesh::corner_tris_calc(positions, faces, corner_verts, r_data.tris);
     }
     else {
       blender::bke::mesh::corner_tris_calc_with_normals(
-          positions, faces, corner_verts, this->face_normals(), r_data);
+          positions, faces, corner_verts, this->face_normals(), r_data.tris);
     }
   });
 
-  return this->runtime->corner_tris_cache.data();
+  return this->runtime->corner_tris_cache.data().tris;
 }
 
 blender::Span<int> Mesh::corner_tri_faces() const
@@ -361,10 +373,41 @@ void Mesh::tag_positions_changed()
   this->tag_positions_changed_no_normals();
 }
 
+void Mesh::tag_positions_changed_partial(const blender::IndexRange verts)
+{
+  using namespace blender;
+  bke::MeshRuntime &runtime = *this->runtime;
+  const bool any_normals_cached = runtime.vert_normals_cache.is_cached() ||
+                                  runtime.face_normals_cache.is_cached() ||
+                                  runtime.corner_normals_cache.is_cached();
+  if (!any_normals_cached || verts.is_empty()) {
+    /* There is nothing to update in place, a full recomputation is just as cheap. */
+    this->tag_positions_changed();
+    return;
+  }
+  {
+    std::lock_guard lock(runtime.dirty_normal_verts_mutex);
+    if (runtime.dirty_normal_verts) {
+      const IndexRange prev = *runtime.dirty_normal_verts;
+      runtime.dirty_normal_verts = IndexRange::from_begin_end(
+          std::min(prev.start(), verts.start()),
+          std::max(prev.one_after_last(), verts.one_after_last()));
+    }
+    else {
+      runtime.dirty_normal_verts = verts;
+    }
+  }
+  this->tag_positions_changed_no_normals();
+}
+
 void Mesh::tag_positions_changed_no_normals()
 {
-  free_bvh_cache(*this->runtime);
-  this->runtime->corner_tris_cache.tag_dirty();
+  /* The BVH trees can usually be refitted in place instead of being rebuilt, see
+   * #bvhcache_tag_positions_changed. */
+  bvhcache_tag_positions_changed(*this);
+  /* Keep the triangulation data so #Mesh::corner_tris() can reuse it when only the positions
+   * changed and the topology is the same (detected with the stored topology hash). */
+  this->runtime->corner_tris_cache.tag_dirty_keep_data();
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->shrinkwrap_boundary_cache.tag_dirty();
 }
@@ -372,7 +415,7 @@ void Mesh::tag_positions_changed_no_normals()
 void Mesh::tag_positions_changed_uniformly()
 {
   /* The normals and triangulation didn't change, since all verts moved by the same amount. */
-  free_bvh_cache(*this->runtime);
+  bvhcache_tag_positions_changed(*this);
   this->runtime->bounds_cache.tag_dirty();
 }
 
@@ -22,12 +22,16 @@ BLI_NOINLINE static void sample_point_attribute(const Span<int> corner_verts,
                                                 const IndexMask &mask,
                                                 const MutableSpan<T> dst)
 {
-  mask.foreach_index([&](const int i) {
-    const int3 &tri = corner_tris[tri_indices[i]];
-    dst[i] = attribute_math::mix3(bary_coords[i],
-                                  src[corner_verts[tri[0]]],
-                                  src[corner_verts[tri[1]]],
-                                  src[corner_verts[tri[2]]]);
+  /* Devirtualize the source so the common span case is interpolated in a plain loop over the
+   * sample arrays instead of with a virtual call per triangle corner. */
+  devirtualize_varray(src, [&](const auto &src) {
+    mask.foreach_index_optimized<int>([&](const int i) {
+      const int3 &tri = corner_tris[tri_indices[i]];
+      dst[i] = attribute_math::mix3(bary_coords[i],
+                                    src[corner_verts[tri[0]]],
+                                    src[corner_verts[tri[1]]],
+                                    src[corner_verts[tri[2]]]);
+    });
   });
 }
 
@@ -39,7 +43,7 @@ void sample_point_normals(const Span<int> corner_verts,
                           const IndexMask mask,
                           const MutableSpan<float3> dst)
 {
-  mask.foreach_index([&](const int i) {
+  mask.foreach_index_optimized<int>([&](const int i) {
     const int3 &tri = corner_tris[tri_indices[i]];
     const float3 value = attribute_math::mix3(bary_coords[i],
                                               src[corner_verts[tri[0]]],
@@ -75,15 +79,17 @@ BLI_NOINLINE static void sample_corner_attribute(const Span<int3> corner_tris,
                                                  const IndexMask &mask,
                                                  const MutableSpan<T> dst)
 {
-  mask.foreach_index([&](const int i) {
-    if constexpr (check_indices) {
-      if (tri_indices[i] == -1) {
-        dst[i] = {};
-        return;
+  devirtualize_varray(src, [&](const auto &src) {
+    mask.foreach_index_optimized<int>([&](const int i) {
+      if constexpr (check_indices) {
+        if (tri_indices[i] == -1) {
+          dst[i] = {};
+          return;
+        }
       }
-    }
-    const int3 &tri = corner_tris[tri_indices[i]];
-    dst[i] = sample_corner_attribute_with_bary_coords(bary_coords[i], tri, src);
+      const int3 &tri = corner_tris[tri_indices[i]];
+      dst[i] = attribute_math::mix3<T>(bary_coords[i], src[tri[0]], src[tri[1]], src[tri[2]]);
+    });
   });
 }
 
@@ -94,7 +100,7 @@ void sample_corner_normals(const Span<int3> corner_tris,
                            const IndexMask &mask,
                            const MutableSpan<float3> dst)
 {
-  mask.foreach_index([&](const int i) {
+  mask.foreach_index_optimized<int>([&](const int i) {
     const int3 &tri = corner_tris[tri_indices[i]];
     const float3 value = sample_corner_attribute_with_bary_coords(bary_coords[i], tri, src);
     dst[i] = math::normalize(value);
@@ -125,10 +131,12 @@ void sample_face_attribute(const Span<int> tri_faces,
                            const IndexMask &mask,
                            const MutableSpan<T> dst)
 {
-  mask.foreach_index([&](const int i) {
-    const int tri_index = tri_indices[i];
-    const int face_index = tri_faces[tri_index];
-    dst[i] = src[face_index];
+  devirtualize_varray(src, [&](const auto &src) {
+    mask.foreach_index_optimized<int>([&](const int i) {
+      const int tri_index = tri_indices[i];
+      const int face_index = tri_faces[tri_index];
+      dst[i] = src[face_index];
+    });
   });
 }
 
@@ -156,16 +164,42 @@ static void sample_barycentric_weights(const Span<float3> vert_positions,
                                        const IndexMask &mask,
                                        MutableSpan<float3> bary_coords)
 {
-  mask.foreach_index([&](const int i) {
-    if constexpr (check_indices) {
-      if (tri_indices[i] == -1) {
-        bary_coords[i] = {};
-        return;
+  /* Gather the triangle corners of a chunk of samples into contiguous arrays so the weights can
+   * be computed with #interp_weights_tri_v3_batch instead of one triangle at a time. */
+  constexpr int64_t chunk_size = 256;
+  std::array<float3, chunk_size> v0, v1, v2, co, weights;
+  std::array<int, chunk_size> sample_index;
+
+  mask.foreach_segment([&](const IndexMaskSegment segment) {
+    for (int64_t start = 0; start < segment.size(); start += chunk_size) {
+      const int64_t end = std::min(start + chunk_size, segment.size());
+      int gathered_num = 0;
+      for (const int64_t k : IndexRange::from_begin_end(start, end)) {
+        const int i = int(segment[k]);
+        if constexpr (check_indices) {
+          if (tri_indices[i] == -1) {
+            bary_coords[i] = {};
+            continue;
+          }
+        }
+        const int3 &tri = corner_tris[tri_indices[i]];
+        v0[gathered_num] = vert_positions[corner_verts[tri[0]]];
+        v1[gathered_num] = vert_positions[corner_verts[tri[1]]];
+        v2[gathered_num] = vert_positions[corner_verts[tri[2]]];
+        co[gathered_num] = sample_positions[i];
+        sample_index[gathered_num] = i;
+        gathered_num++;
+      }
+      interp_weights_tri_v3_batch(reinterpret_cast<float(*)[3]>(weights.data()),
+                                  reinterpret_cast<const float(*)[3]>(v0.data()),
+                                  reinterpret_cast<const float(*)[3]>(v1.data()),
+                                  reinterpret_cast<const float(*)[3]>(v2.data()),
+                                  reinterpret_cast<const float(*)[3]>(co.data()),
+                                  gathered_num);
+      for (const int j : IndexRange(gathered_num)) {
+        bary_coords[sample_index[j]] = weights[j];
       }
     }
-    const int3 &tri = corner_tris[tri_indices[i]];
-    bary_coords[i] = compute_bary_coord_in_triangle(
-        vert_positions, corner_verts, tri, sample_positions[i]);
   });
 }
 
@@ -178,7 +212,7 @@ static void sample_nearest_weights(const Span<float3> vert_positions,
                                    const IndexMask &mask,
                                    MutableSpan<float3> bary_coords)
 {
-  mask.foreach_index([&](const int i) {
+  mask.foreach_index_optimized<int>([&](const int i) {
     if constexpr (check_indices) {
       if (tri_indices[i] == -1) {
         bary_coords[i] = {};
@@ -12,11 +12,10 @@
  */
 
 #include "BLI_array_utils.hh"
-#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
-#include "BLI_memarena.h"
+#include "BLI_memarena.hh"
 #include "BLI_polyfill_2d.h"
 #include "BLI_task.hh"
 
@@ -40,7 +39,7 @@ BLI_INLINE void mesh_calc_tessellation_for_face_impl(const Span<int> corner_vert
                                                      const int face_start,
                                                      const int face_size,
                                                      int3 *tri,
-                                                     MemArena **pf_arena_p,
+                                                     MemArenaPool &arena_pool,
                                                      const bool face_normal,
                                                      const float normal_precalc[3])
 {
@@ -99,10 +98,7 @@ BLI_INLINE void mesh_calc_tessellation_for_face_impl(const Span<int> corner_vert
 
       const int totfilltri = face_size - 2;
 
-      MemArena *pf_arena = *pf_arena_p;
-      if (UNLIKELY(pf_arena == nullptr)) {
-        pf_arena = *pf_arena_p = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-      }
+      MemArena *pf_arena = arena_pool.local();
 
       uint(*tris)[3] = static_cast<uint(*)[3]>(
           BLI_memarena_alloc(pf_arena, sizeof(*tris) * size_t(totfilltri)));
@@ -132,10 +128,10 @@ static void mesh_calc_tessellation_for_face(const Span<int> corner_verts,
                                             const int face_start,
                                             const int face_size,
                                             int3 *tri,
-                                            MemArena **pf_arena_p)
+                                            MemArenaPool &arena_pool)
 {
   mesh_calc_tessellation_for_face_impl(
-      corner_verts, positions, face_start, face_size, tri, pf_arena_p, false, nullptr);
+      corner_verts, positions, face_start, face_size, tri, arena_pool, false, nullptr);
 }
 
 static void mesh_calc_tessellation_for_face_with_normal(const Span<int> corner_verts,
@@ -143,34 +139,22 @@ static void mesh_calc_tessellation_for_face_with_normal(const Span<int> corner_v
                                                         const int face_start,
                                                         const int face_size,
                                                         int3 *tri,
-                                                        MemArena **pf_arena_p,
+                                                        MemArenaPool &arena_pool,
                                                         const float normal_precalc[3])
 {
   mesh_calc_tessellation_for_face_impl(
-      corner_verts, positions, face_start, face_size, tri, pf_arena_p, true, normal_precalc);
+      corner_verts, positions, face_start, face_size, tri, arena_pool, true, normal_precalc);
 }
 
-struct LocalData {
-  MemArena *pf_arena = nullptr;
-
-  ~LocalData()
-  {
-    if (pf_arena) {
-      BLI_memarena_free(pf_arena);
-    }
-  }
-};
-
 static void corner_tris_calc_impl(const Span<float3> positions,
                                   const OffsetIndices<int> faces,
                                   const Span<int> corner_verts,
                                   const Span<float3> face_normals,
                                   MutableSpan<int3> corner_tris)
 {
-  threading::EnumerableThreadSpecific<LocalData> all_local_data;
+  MemArenaPool arena_pool;
   if (face_normals.is_empty()) {
     threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
-      LocalData &local_data = all_local_data.local();
       for (const int64_t i : range) {
         const int face_start = int(faces[i].start());
         const int face_size = int(faces[i].size());
@@ -180,13 +164,12 @@ static void corner_tris_calc_impl(const Span<float3> positions,
                                         face_start,
                                         face_size,
                                         &corner_tris[tris_start],
-                                        &local_data.pf_arena);
+                                        arena_pool);
       }
     });
   }
   else {
     threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
-      LocalData &local_data = all_local_data.local();
       for (const int64_t i : range) {
         const int face_start = int(faces[i].start());
         const int face_size = int(faces[i].size());
@@ -196,7 +179,7 @@ static void corner_tris_calc_impl(const Span<float3> positions,
                                                     face_start,
                                                     face_size,
                                                     &corner_tris[tris_start],
-                                                    &local_data.pf_arena,
+                                                    arena_pool,
                                                     face_normals[i]);
       }
     });
@@ -235,6 +218,45 @@ void corner_tris_calc_with_normals(const Span<float3> vert_positions,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Triangulation Topology Hash
+ * \{ */
+
+/**
+ * Hash a span of indices in parallel chunks. Every chunk is mixed with its index, so the combined
+ * hash still depends on the position of every value.
+ */
+static uint64_t hash_indices_parallel(const Span<int> data)
+{
+  constexpr int64_t chunk_size = 1 << 16;
+  const int64_t chunks_num = (data.size() + chunk_size - 1) / chunk_size;
+  Array<uint64_t, 16> chunk_hashes(chunks_num);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const int64_t start = chunk * chunk_size;
+      uint64_t hash = uint64_t(chunk + 1) * 0x9e3779b97f4a7c15ull;
+      for (const int value : data.slice(start, std::min(chunk_size, data.size() - start))) {
+        hash = (hash ^ uint64_t(uint32_t(value))) * 0x2545f4914f6cdd1dull;
+      }
+      chunk_hashes[chunk] = hash;
+    }
+  });
+  uint64_t hash = uint64_t(data.size());
+  for (const uint64_t chunk_hash : chunk_hashes) {
+    hash = (hash * 0x100000001b3ull) ^ chunk_hash;
+  }
+  return hash;
+}
+
+uint64_t corner_tris_topology_hash(const OffsetIndices<int> faces, const Span<int> corner_verts)
+{
+  const uint64_t faces_hash = hash_indices_parallel(faces.data());
+  const uint64_t corner_verts_hash = hash_indices_parallel(corner_verts);
+  return (faces_hash * 0x100000001b3ull) ^ corner_verts_hash;
+}
+
+/** \} */
+
 void vert_tris_from_corner_tris(const Span<int> corner_verts,
                                 const Span<int3> corner_tris,
                                 MutableSpan<int3> vert_tris)
@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdio>
 #include <cstring>
@@ -23,6 +24,7 @@
 #include "BLI_ordered_edge.hh"
 #include "BLI_sort.hh"
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector_set.hh"
 
@@ -162,6 +164,213 @@ static bool search_face_corner_cmp(const SortFace &sp1, const SortFace &sp2)
     } \
   } while (0)
 
+/**
+ * Maximum face size for which the fast scan checks for repeated vertex indices itself. Larger
+ * faces fall back to the thorough scan, which uses a tag array for this.
+ */
+#define FAST_SCAN_FACE_SIZE_MAX 64
+
+/**
+ * Threaded early-exit scan over all element-local invariants checked by the thorough pass in
+ * #BKE_mesh_validate_arrays. Returns true when no anomaly was found, in which case the thorough
+ * pass can be skipped entirely: the only defects it could still detect are duplicates of
+ * otherwise fully valid edges or faces. The scan is conservative, anything that cannot be
+ * verified cheaply counts as an anomaly.
+ */
+static bool mesh_validate_fast_scan(const float (*vert_positions)[3],
+                                    const uint verts_num,
+                                    const blender::int2 *edges,
+                                    const uint edges_num,
+                                    const int *corner_verts,
+                                    const int *corner_edges,
+                                    const uint corners_num,
+                                    const int *face_offsets,
+                                    const uint faces_num,
+                                    const MDeformVert *dverts,
+                                    const blender::Span<int> material_indices)
+{
+  using namespace blender;
+
+  /* With a valid offsets array every corner belongs to exactly one face, which makes the
+   * unused/shared corner analysis of the thorough pass unnecessary. */
+  if (faces_num != 0 && (face_offsets[0] != 0 || uint(face_offsets[faces_num]) != corners_num)) {
+    return false;
+  }
+  if (faces_num == 0 && corners_num != 0) {
+    return false;
+  }
+
+  std::atomic<bool> anomaly = false;
+
+  threading::parallel_for(IndexRange(verts_num), 4096, [&](const IndexRange range) {
+    if (anomaly.load(std::memory_order_relaxed)) {
+      return;
+    }
+    for (const int64_t i : range) {
+      const float *co = vert_positions[i];
+      if (!isfinite(co[0]) || !isfinite(co[1]) || !isfinite(co[2])) {
+        anomaly.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  });
+  if (anomaly) {
+    return false;
+  }
+
+  threading::parallel_for(IndexRange(edges_num), 4096, [&](const IndexRange range) {
+    if (anomaly.load(std::memory_order_relaxed)) {
+      return;
+    }
+    for (const int64_t i : range) {
+      const int2 edge = edges[i];
+      if (edge[0] == edge[1] || uint(edge[0]) >= verts_num || uint(edge[1]) >= verts_num) {
+        anomaly.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  });
+  if (anomaly) {
+    return false;
+  }
+
+  threading::parallel_for(IndexRange(faces_num), 1024, [&](const IndexRange range) {
+    if (anomaly.load(std::memory_order_relaxed)) {
+      return;
+    }
+    for (const int64_t face : range) {
+      const int face_start = face_offsets[face];
+      const int face_size = face_offsets[face + 1] - face_start;
+      if (face_size < 3 || face_size > FAST_SCAN_FACE_SIZE_MAX) {
+        anomaly.store(true, std::memory_order_relaxed);
+        return;
+      }
+      if (!material_indices.is_empty() && material_indices[face] < 0) {
+        anomaly.store(true, std::memory_order_relaxed);
+        return;
+      }
+      for (int j = 0; j < face_size; j++) {
+        const int vert = corner_verts[face_start + j];
+        if (uint(vert) >= verts_num) {
+          anomaly.store(true, std::memory_order_relaxed);
+          return;
+        }
+        for (int k = j + 1; k < face_size; k++) {
+          if (corner_verts[face_start + k] == vert) {
+            anomaly.store(true, std::memory_order_relaxed);
+            return;
+          }
+        }
+        /* When every corner references the edge formed with the next corner, no edges are
+         * missing and all corner edge references are valid. */
+        const int edge_i = corner_edges[face_start + j];
+        if (uint(edge_i) >= edges_num) {
+          anomaly.store(true, std::memory_order_relaxed);
+          return;
+        }
+        const int vert_next = corner_verts[face_start + (j + 1) % face_size];
+        const int2 edge = edges[edge_i];
+        if (!((edge[0] == vert && edge[1] == vert_next) ||
+              (edge[0] == vert_next && edge[1] == vert)))
+        {
+          anomaly.store(true, std::memory_order_relaxed);
+          return;
+        }
+      }
+    }
+  });
+  if (anomaly) {
+    return false;
+  }
+
+  if (dverts) {
+    threading::parallel_for(IndexRange(verts_num), 2048, [&](const IndexRange range) {
+      if (anomaly.load(std::memory_order_relaxed)) {
+        return;
+      }
+      for (const int64_t i : range) {
+        const MDeformVert &dv = dverts[i];
+        for (int j = 0; j < dv.totweight; j++) {
+          const MDeformWeight &dw = dv.dw[j];
+          if (!isfinite(dw.weight) || dw.weight < 0.0f || dw.weight > 1.0f ||
+              dw.def_nr >= INT_MAX)
+          {
+            anomaly.store(true, std::memory_order_relaxed);
+            return;
+          }
+        }
+      }
+    });
+  }
+
+  return !anomaly;
+}
+
+#undef FAST_SCAN_FACE_SIZE_MAX
+
+/**
+ * Validate the selection history stack, freeing it when it references invalid data and fixes are
+ * allowed (setting `*r_freed` accordingly).
+ */
+static bool mesh_validate_mselect(Mesh *mesh,
+                                  const bool do_verbose,
+                                  const bool do_fixes,
+                                  bool *r_freed)
+{
+  bool is_valid = true;
+  bool free_mselect = false;
+  MSelect *msel;
+  uint i;
+
+  for (i = 0, msel = mesh->mselect; i < mesh->totselect; i++, msel++) {
+    int tot_elem = 0;
+
+    if (msel->index < 0) {
+      PRINT_ERR(
+          "\tMesh select element %u type %d index is negative, "
+          "resetting selection stack.\n",
+          i,
+          msel->type);
+      free_mselect = do_fixes;
+      break;
+    }
+
+    switch (msel->type) {
+      case ME_VSEL:
+        tot_elem = mesh->verts_num;
+        break;
+      case ME_ESEL:
+        tot_elem = mesh->edges_num;
+        break;
+      case ME_FSEL:
+        tot_elem = mesh->faces_num;
+        break;
+    }
+
+    if (msel->index > tot_elem) {
+      PRINT_ERR(
+          "\tMesh select element %u type %d index %d is larger than data array size %d, "
+          "resetting selection stack.\n",
+          i,
+          msel->type,
+          msel->index,
+          tot_elem);
+
+      free_mselect = do_fixes;
+      break;
+    }
+  }
+
+  if (free_mselect) {
+    MEM_freeN(mesh->mselect);
+    mesh->mselect = nullptr;
+    mesh->totselect = 0;
+    *r_freed = true;
+  }
+
+  return is_valid;
+}
+
 /* NOLINTNEXTLINE: readability-function-size */
 bool BKE_mesh_validate_arrays(Mesh *mesh,
                               float (*vert_positions)[3],
@@ -234,9 +443,6 @@ bool BKE_mesh_validate_arrays(Mesh *mesh,
     int as_flag;
   } recalc_flag;
 
-  Map<OrderedEdge, int> edge_hash;
-  edge_hash.reserve(edges_num);
-
   BLI_assert(!(do_fixes && mesh == nullptr));
 
   fix_flag.as_flag = 0;
@@ -254,6 +460,44 @@ bool BKE_mesh_validate_arrays(Mesh *mesh,
     recalc_flag.edges = do_fixes;
   }
 
+  /* Fast path: a threaded scan that checks all element-local invariants and exits early on the
+   * first anomaly. When it finds nothing, the thorough analysis below is skipped; meshes that
+   * only contain duplicates of otherwise fully valid edges or faces then go undetected, which is
+   * accepted so that valid large meshes (by far the common case) don't stall on validation.
+   * Legacy tessellated faces always take the thorough path. */
+  if (is_valid && (!legacy_faces || face_offsets) &&
+      mesh_validate_fast_scan(vert_positions,
+                              verts_num,
+                              edges,
+                              edges_num,
+                              corner_verts,
+                              corner_edges,
+                              corners_num,
+                              face_offsets,
+                              faces_num,
+                              dverts,
+                              material_indices_span))
+  {
+    bool mselect_freed = false;
+    if (mesh && mesh->mselect) {
+      is_valid &= mesh_validate_mselect(mesh, do_verbose, do_fixes, &mselect_freed);
+    }
+
+    material_indices_span.save();
+    material_indices.finish();
+
+    PRINT_MSG("%s: fast scan found no anomalies\n\n", __func__);
+
+    *r_changed = mselect_freed;
+
+    BLI_assert((*r_changed == false) || (do_fixes == true));
+
+    return is_valid;
+  }
+
+  Map<OrderedEdge, int> edge_hash;
+  edge_hash.reserve(edges_num);
+
   for (i = 0; i < verts_num; i++) {
     for (j = 0; j < 3; j++) {
       if (!isfinite(vert_positions[i][j])) {
@@ -810,52 +1054,11 @@ bool BKE_mesh_validate_arrays(Mesh *mesh,
   }
 
   if (mesh && mesh->mselect) {
-    MSelect *msel;
-
-    for (i = 0, msel = mesh->mselect; i < mesh->totselect; i++, msel++) {
-      int tot_elem = 0;
-
-      if (msel->index < 0) {
-        PRINT_ERR(
-            "\tMesh select element %u type %d index is negative, "
-            "resetting selection stack.\n",
-            i,
-            msel->type);
-        free_flag.mselect = do_fixes;
-        break;
-      }
-
-      switch (msel->type) {
-        case ME_VSEL:
-          tot_elem = mesh->verts_num;
-          break;
-        case ME_ESEL:
-          tot_elem = mesh->edges_num;
-          break;
-        case ME_FSEL:
-          tot_elem = mesh->faces_num;
-          break;
-      }
-
-      if (msel->index > tot_elem) {
-        PRINT_ERR(
-            "\tMesh select element %u type %d index %d is larger than data array size %d, "
-            "resetting selection stack.\n",
-            i,
-            msel->type,
-            msel->index,
-            tot_elem);
-
-        free_flag.mselect = do_fixes;
-        break;
-      }
-    }
-
-    if (free_flag.mselect) {
-      MEM_freeN(mesh->mselect);
-      mesh->mselect = nullptr;
-      mesh->totselect = 0;
+    bool mselect_freed = false;
+    if (!mesh_validate_mselect(mesh, do_verbose, do_fixes, &mselect_freed)) {
+      is_valid = false;
     }
+    free_flag.mselect = mselect_freed;
   }
 
   material_indices_span.save();
@@ -1976,16 +1976,20 @@ void BKE_movieclip_eval_update(Depsgraph *depsgraph, Main *bmain, MovieClip *cli
 /** \name GPU textures
  * \{ */
 
-static GPUTexture **movieclip_get_gputexture_ptr(MovieClip *clip,
-                                                 MovieClipUser *cuser,
-                                                 eGPUTextureTarget textarget)
+static MovieClip_RuntimeGPUTexture *movieclip_get_gputexture_entry(MovieClip *clip,
+                                                                   MovieClipUser *cuser)
 {
-  /* Check if we have an existing entry for that clip user. */
+  /* Check if we have an existing entry for that clip user. The frame number is ignored for the
+   * comparison: an entry is a persistent texture for the user's display settings, which gets
+   * re-uploaded when the frame changes instead of allocating a texture per frame. */
   MovieClip_RuntimeGPUTexture *tex;
   for (tex = static_cast<MovieClip_RuntimeGPUTexture *>(clip->runtime.gputextures.first); tex;
        tex = static_cast<MovieClip_RuntimeGPUTexture *>(tex->next))
   {
-    if (memcmp(&tex->user, cuser, sizeof(MovieClipUser)) == 0) {
+    MovieClipUser a = tex->user;
+    MovieClipUser b = *cuser;
+    a.framenr = b.framenr = 0;
+    if (memcmp(&a, &b, sizeof(MovieClipUser)) == 0) {
       break;
     }
   }
@@ -2003,7 +2007,7 @@ static GPUTexture **movieclip_get_gputexture_ptr(MovieClip *clip,
     BLI_addtail(&clip->runtime.gputextures, tex);
   }
 
-  return &tex->gputexture[textarget];
+  return tex;
 }
 
 GPUTexture *BKE_movieclip_get_gpu_texture(MovieClip *clip, MovieClipUser *cuser)
@@ -2012,26 +2016,51 @@ GPUTexture *BKE_movieclip_get_gpu_texture(MovieClip *clip, MovieClipUser *cuser)
     return nullptr;
   }
 
-  GPUTexture **tex = movieclip_get_gputexture_ptr(clip, cuser, TEXTARGET_2D);
-  if (*tex) {
+  MovieClip_RuntimeGPUTexture *entry = movieclip_get_gputexture_entry(clip, cuser);
+  GPUTexture **tex = &entry->gputexture[TEXTARGET_2D];
+  if (*tex && entry->user.framenr == cuser->framenr) {
     return *tex;
   }
 
   /* check if we have a valid image buffer */
   ImBuf *ibuf = BKE_movieclip_get_ibuf(clip, cuser);
   if (ibuf == nullptr) {
-    fprintf(stderr, "GPUTexture: Blender Texture Not Loaded!\n");
-    *tex = GPU_texture_create_error(2, false);
+    if (*tex == nullptr) {
+      fprintf(stderr, "GPUTexture: Blender Texture Not Loaded!\n");
+      *tex = GPU_texture_create_error(2, false);
+    }
+    entry->user.framenr = cuser->framenr;
     return *tex;
   }
 
   /* This only means RGBA16F instead of RGBA32F. */
   const bool high_bitdepth = false;
   const bool store_premultiplied = ibuf->float_buffer.data ? false : true;
-  *tex = IMB_create_gpu_texture(clip->id.name + 2, ibuf, high_bitdepth, store_premultiplied);
 
-  /* Do not generate mips for movieclips... too slow. */
-  GPU_texture_mipmap_mode(*tex, false, true);
+  if (*tex) {
+    /* Only the frame changed: re-upload into the existing texture when the size and format still
+     * match, so scrubbing and tracking do not re-allocate GPU memory for every frame. */
+    const eGPUTextureFormat format = IMB_gpu_get_texture_format(ibuf, high_bitdepth, true);
+    if (GPU_texture_width(*tex) == ibuf->x && GPU_texture_height(*tex) == ibuf->y &&
+        GPU_texture_format(*tex) == format)
+    {
+      IMB_update_gpu_texture_sub(
+          *tex, ibuf, 0, 0, 0, ibuf->x, ibuf->y, high_bitdepth, true, store_premultiplied);
+    }
+    else {
+      GPU_texture_free(*tex);
+      *tex = nullptr;
+    }
+  }
+
+  if (*tex == nullptr) {
+    *tex = IMB_create_gpu_texture(clip->id.name + 2, ibuf, high_bitdepth, store_premultiplied);
+
+    /* Do not generate mips for movieclips... too slow. */
+    GPU_texture_mipmap_mode(*tex, false, true);
+  }
+
+  entry->user.framenr = cuser->framenr;
 
   IMB_freeImBuf(ibuf);
 
@@ -125,8 +125,8 @@ struct DupliContext {
 
   const struct DupliGenerator *gen;
 
-  /** Result containers. */
-  ListBase *duplilist; /* Legacy doubly-linked list. */
+  /** Result container, filled in generation order. */
+  DupliList *duplilist;
 };
 
 struct DupliGenerator {
@@ -230,17 +230,14 @@ static DupliObject *make_dupli(const DupliContext *ctx,
                                const GeometrySet *geometry = nullptr,
                                int64_t instance_index = 0)
 {
-  DupliObject *dob;
   int i;
 
   /* Add a #DupliObject instance to the result container. */
-  if (ctx->duplilist) {
-    dob = MEM_cnew<DupliObject>("dupli object");
-    BLI_addtail(ctx->duplilist, dob);
-  }
-  else {
+  if (ctx->duplilist == nullptr) {
     return nullptr;
   }
+  ctx->duplilist->append({});
+  DupliObject *dob = &ctx->duplilist->last();
 
   dob->ob = ob;
   dob->ob_data = const_cast<ID *>(object_data);
@@ -627,12 +624,14 @@ static DupliObject *vertex_dupli(const DupliContext *ctx,
    * this yields the world-space transform for recursive duplis. */
   mul_m4_m4m4(space_mat, obmat, inst_ob->world_to_object().ptr());
 
-  DupliObject *dob = make_dupli(ctx, inst_ob, obmat, index);
+  /* The recursion below can grow the container and reallocate, look the instance up by index. */
+  const int64_t dob_index = ctx->duplilist->size();
+  make_dupli(ctx, inst_ob, obmat, index);
 
   /* Recursion. */
   make_recursive_duplis(ctx, inst_ob, space_mat, index);
 
-  return dob;
+  return &(*ctx->duplilist)[dob_index];
 }
 
 static void make_child_duplis_verts_from_mesh(const DupliContext *ctx,
@@ -1147,12 +1146,14 @@ static DupliObject *face_dupli(const DupliContext *ctx,
    * this yields the world-space transform for recursive duplis. */
   mul_m4_m4m4(space_mat, obmat, inst_ob->world_to_object().ptr());
 
-  DupliObject *dob = make_dupli(ctx, inst_ob, obmat, index);
+  /* The recursion below can grow the container and reallocate, look the instance up by index. */
+  const int64_t dob_index = ctx->duplilist->size();
+  make_dupli(ctx, inst_ob, obmat, index);
 
   /* Recursion. */
   make_recursive_duplis(ctx, inst_ob, space_mat, index);
 
-  return dob;
+  return &(*ctx->duplilist)[dob_index];
 }
 
 static DupliObject *face_dupli_from_mesh(const DupliContext *ctx,
@@ -1761,34 +1762,31 @@ static const DupliGenerator *get_dupli_generator(const DupliContext *ctx)
 /** \name Dupli-Container Implementation
  * \{ */
 
-ListBase *object_duplilist(Depsgraph *depsgraph, Scene *sce, Object *ob)
+void object_duplilist(Depsgraph *depsgraph, Scene *sce, Object *ob, DupliList &r_duplilist)
 {
-  ListBase *duplilist = MEM_cnew<ListBase>("duplilist");
   DupliContext ctx;
   Vector<Object *> instance_stack;
   Vector<short> dupli_gen_type_stack({0});
   instance_stack.append(ob);
   init_context(&ctx, depsgraph, sce, ob, nullptr, instance_stack, dupli_gen_type_stack);
   if (ctx.gen) {
-    ctx.duplilist = duplilist;
+    ctx.duplilist = &r_duplilist;
     ctx.gen->make_duplis(&ctx);
   }
-
-  return duplilist;
 }
 
-ListBase *object_duplilist_preview(Depsgraph *depsgraph,
-                                   Scene *sce,
-                                   Object *ob_eval,
-                                   const ViewerPath *viewer_path)
+void object_duplilist_preview(Depsgraph *depsgraph,
+                              Scene *sce,
+                              Object *ob_eval,
+                              const ViewerPath *viewer_path,
+                              DupliList &r_duplilist)
 {
-  ListBase *duplilist = MEM_cnew<ListBase>("duplilist");
   DupliContext ctx;
   Vector<Object *> instance_stack;
   Vector<short> dupli_gen_type_stack({0});
   instance_stack.append(ob_eval);
   init_context(&ctx, depsgraph, sce, ob_eval, nullptr, instance_stack, dupli_gen_type_stack);
-  ctx.duplilist = duplilist;
+  ctx.duplilist = &r_duplilist;
 
   Object *ob_orig = DEG_get_original_object(ob_eval);
 
@@ -1811,13 +1809,6 @@ ListBase *object_duplilist_preview(Depsgraph *depsgraph,
                                     ob_eval->type == OB_CURVES);
     }
   }
-  return duplilist;
-}
-
-void free_object_duplilist(ListBase *lb)
-{
-  BLI_freelistN(lb);
-  MEM_freeN(lb);
 }
 
 /** \} */
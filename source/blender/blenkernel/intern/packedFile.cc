@@ -18,6 +18,8 @@
 #include "MEM_guardedalloc.h"
 #include <cstring>
 
+#include <zstd.h>
+
 #include "DNA_ID.h"
 #include "DNA_image_types.h"
 #include "DNA_packedFile_types.h"
@@ -42,6 +44,67 @@
 
 #include "BLO_read_write.hh"
 
+/* Payloads below this rarely compress enough to be worth the access overhead. */
+#define PF_COMPRESS_SIZE_MIN (64 * 1024)
+/* Matches the default compression level used for blend files. */
+#define PF_COMPRESS_LEVEL 3
+
+void BKE_packedfile_compress(PackedFile *pf)
+{
+  if (pf->flag & PF_COMPRESSED_ZSTD) {
+    return;
+  }
+  if (pf->size < PF_COMPRESS_SIZE_MIN) {
+    return;
+  }
+
+  const size_t bound = ZSTD_compressBound(size_t(pf->size));
+  void *compressed = MEM_mallocN(bound, "packFile compress");
+  const size_t compressed_size = ZSTD_compress(
+      compressed, bound, pf->data, size_t(pf->size), PF_COMPRESS_LEVEL);
+  /* Only keep the compressed payload when it saves a meaningful amount,
+   * most image formats are compressed already. */
+  if (ZSTD_isError(compressed_size) || compressed_size > size_t(pf->size - pf->size / 8)) {
+    MEM_freeN(compressed);
+    return;
+  }
+
+  void *data = MEM_mallocN(compressed_size, "packFile");
+  memcpy(data, compressed, compressed_size);
+  MEM_freeN(compressed);
+  MEM_freeN(pf->data);
+  pf->data = data;
+  pf->size_compressed = int(compressed_size);
+  pf->flag |= PF_COMPRESSED_ZSTD;
+}
+
+/** Decompress into a new buffer of #PackedFile.size bytes, \a pf is left untouched. */
+static void *packedfile_decompress(const PackedFile *pf)
+{
+  BLI_assert(pf->flag & PF_COMPRESSED_ZSTD);
+  void *data = MEM_mallocN(size_t(pf->size), "packFile");
+  const size_t size = ZSTD_decompress(
+      data, size_t(pf->size), pf->data, size_t(pf->size_compressed));
+  if (ZSTD_isError(size) || size != size_t(pf->size)) {
+    /* Should never happen, the compressed payload was created from this very data. */
+    BLI_assert_unreachable();
+    memset(data, 0, size_t(pf->size));
+  }
+  return data;
+}
+
+const void *BKE_packedfile_data_get(PackedFile *pf)
+{
+  if (pf->flag & PF_COMPRESSED_ZSTD) {
+    void *data = packedfile_decompress(pf);
+    MEM_freeN(pf->data);
+    pf->data = data;
+    pf->size_compressed = 0;
+    pf->flag &= ~PF_COMPRESSED_ZSTD;
+  }
+  return pf->data;
+}
+
 int BKE_packedfile_seek(PackedFile *pf, int offset, int whence)
 {
   int oldseek = -1, seek = 0;
@@ -87,7 +150,7 @@ int BKE_packedfile_read(PackedFile *pf, void *data, int size)
     }
 
     if (size > 0) {
-      memcpy(data, ((char *)pf->data) + pf->seek, size);
+      memcpy(data, static_cast<const char *>(BKE_packedfile_data_get(pf)) + pf->seek, size);
     }
     else {
       size = 0;
@@ -334,7 +397,7 @@ int BKE_packedfile_write_to_file(ReportList *reports,
     ret_value = RET_ERROR;
   }
   else {
-    if (write(file, pf->data, pf->size) != pf->size) {
+    if (write(file, BKE_packedfile_data_get(pf), pf->size) != pf->size) {
       BKE_reportf(reports, RPT_ERROR, "Error writing file '%s'", filepath);
       ret_value = RET_ERROR;
     }
@@ -393,6 +456,12 @@ enum ePF_FileCompare BKE_packedfile_compare_to_file(const char *ref_file_name,
     else {
       ret_val = PF_CMP_EQUAL;
 
+      /* Decompress into a temporary buffer, \a pf is const. */
+      void *decompressed_data = (pf->flag & PF_COMPRESSED_ZSTD) ? packedfile_decompress(pf) :
+                                                                  nullptr;
+      const char *pf_data = static_cast<const char *>(decompressed_data ? decompressed_data :
+                                                                          pf->data);
+
       for (int i = 0; i < pf->size; i += sizeof(buf)) {
         int len = pf->size - i;
         if (len > sizeof(buf)) {
@@ -405,12 +474,16 @@ enum ePF_FileCompare BKE_packedfile_compare_to_file(const char *ref_file_name,
           break;
         }
 
-        if (memcmp(buf, ((const char *)pf->data) + i, len) != 0) {
+        if (memcmp(buf, pf_data + i, len) != 0) {
           ret_val = PF_CMP_DIFFERS;
           break;
         }
       }
 
+      if (decompressed_data) {
+        MEM_freeN(decompressed_data);
+      }
+
       close(file);
     }
   }
@@ -512,9 +585,9 @@ static void unpack_generate_paths(const char *filepath,
       Image *ima = (Image *)id;
       ImagePackedFile *imapf = static_cast<ImagePackedFile *>(ima->packedfiles.last);
       if (imapf != nullptr && imapf->packedfile != nullptr) {
-        const PackedFile *pf = imapf->packedfile;
+        PackedFile *pf = imapf->packedfile;
         enum eImbFileType ftype = eImbFileType(
-            IMB_ispic_type_from_memory((const uchar *)pf->data, pf->size));
+            IMB_ispic_type_from_memory((const uchar *)BKE_packedfile_data_get(pf), pf->size));
         if (ima->source == IMA_SRC_TILED) {
           char tile_number[6];
           SNPRINTF(tile_number, ".%d", imapf->tile_number);
@@ -890,8 +963,21 @@ void BKE_packedfile_blend_write(BlendWriter *writer, const PackedFile *pf)
   if (pf == nullptr) {
     return;
   }
+  if ((pf->flag & PF_COMPRESSED_ZSTD) && !BLO_write_is_undo(writer)) {
+    /* Blend files always store the raw contents, in-memory compression is a runtime
+     * optimization. Undo steps keep the compressed payload since they share the buffer. */
+    PackedFile pf_flat = *pf;
+    pf_flat.flag &= ~PF_COMPRESSED_ZSTD;
+    pf_flat.size_compressed = 0;
+    pf_flat.data = packedfile_decompress(pf);
+    BLO_write_struct_at_address(writer, PackedFile, pf, &pf_flat);
+    BLO_write_raw(writer, pf_flat.size, pf_flat.data);
+    MEM_freeN(pf_flat.data);
+    return;
+  }
   BLO_write_struct(writer, PackedFile, pf);
-  BLO_write_raw(writer, pf->size, pf->data);
+  const int data_size = (pf->flag & PF_COMPRESSED_ZSTD) ? pf->size_compressed : pf->size;
+  BLO_write_raw(writer, data_size, pf->data);
 }
 
 void BKE_packedfile_blend_read(BlendDataReader *reader, PackedFile **pf_p)
@@ -908,5 +994,13 @@ void BKE_packedfile_blend_read(BlendDataReader *reader, PackedFile **pf_p)
      * the whole code assumes this is not possible. See #70315. */
     printf("%s: nullptr packedfile data, cleaning up...\n", __func__);
     MEM_SAFE_FREE(pf);
+    return;
+  }
+
+  if (!BLO_read_data_is_undo(reader)) {
+    /* Files store the raw contents, the flag only survives undo steps. */
+    pf->flag = 0;
+    pf->size_compressed = 0;
+    BKE_packedfile_compress(pf);
   }
 }
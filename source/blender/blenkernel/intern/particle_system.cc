@@ -3717,6 +3717,33 @@ struct DynamicStepSolverTaskData {
   SpinLock spin;
 };
 
+static void dynamics_step_newton_task_cb_ex(void *__restrict userdata,
+                                            const int p,
+                                            const TaskParallelTLS *__restrict /*tls*/)
+{
+  DynamicStepSolverTaskData *data = static_cast<DynamicStepSolverTaskData *>(userdata);
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+  ParticleSettings *part = psys->part;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  /* do global forces & effectors */
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+
+  /* deflection */
+  if (sim->colliders) {
+    collision_check(sim, p, pa->state.time, data->cfra);
+  }
+
+  /* rotations */
+  basic_rotate(part, pa, pa->state.time, data->timestep);
+}
+
 static void dynamics_step_sphdata_reduce(const void *__restrict /*userdata*/,
                                          void *__restrict join_v,
                                          void *__restrict chunk_v)
@@ -3968,19 +3995,22 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
-      LOOP_DYNAMIC_PARTICLES
-      {
-        /* do global forces & effectors */
-        basic_integrate(sim, p, pa->state.time, cfra);
+      DynamicStepSolverTaskData task_data{};
+      task_data.sim = sim;
+      task_data.cfra = cfra;
+      task_data.timestep = timestep;
+      task_data.dtime = dtime;
 
-        /* deflection */
-        if (sim->colliders) {
-          collision_check(sim, p, pa->state.time, cfra);
-        }
+      /* Brownian motion and collision response draw from the shared simulation
+       * RNG in particle order, keep those runs serial so baked results stay
+       * deterministic. */
+      const bool uses_shared_rng = (part->brownfac != 0.0f) || (sim->colliders != nullptr);
 
-        /* rotations */
-        basic_rotate(part, pa, pa->state.time, timestep);
-      }
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (psys->totpart > 100) && !uses_shared_rng;
+      BLI_task_parallel_range(
+          0, psys->totpart, &task_data, dynamics_step_newton_task_cb_ex, &settings);
       break;
     }
     case PART_PHYS_BOIDS: {
@@ -40,9 +40,13 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
+#include "atomic_ops.h"
+
 #include "BLT_translation.hh"
 
 #include "BKE_appdir.hh"
@@ -123,6 +127,10 @@ static int ptcache_extra_datasize[] = {
 };
 
 /* forward declarations */
+static void ptcache_async_write_flush();
+static PTCacheMem *ptcache_prefetch_claim(const char *filepath);
+static void ptcache_prefetch_invalidate();
+static void ptcache_disk_frame_prefetch(PTCacheID *pid, int cfra);
 static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len);
 static int ptcache_file_compressed_write(
     PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode);
@@ -1456,26 +1464,10 @@ static int ptcache_filepath(PTCacheID *pid,
 /**
  * Caller must close after!
  */
-static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
+static PTCacheFile *ptcache_file_open_filepath(const char *filepath, int mode, int cfra)
 {
   PTCacheFile *pf;
   FILE *fp = nullptr;
-  char filepath[MAX_PTCACHE_FILE];
-
-#ifndef DURIAN_POINTCACHE_LIB_OK
-  /* don't allow writing for linked objects */
-  if (pid->owner_id->lib && mode == PTCACHE_FILE_WRITE) {
-    return nullptr;
-  }
-#endif
-  if ((pid->cache->flag & PTCACHE_EXTERNAL) == 0) {
-    const char *blendfile_path = BKE_main_blendfile_path_from_global();
-    if (blendfile_path[0] == '\0') {
-      return nullptr; /* save blend file before using disk pointcache */
-    }
-  }
-
-  ptcache_filepath(pid, filepath, cfra, true, true);
 
   if (mode == PTCACHE_FILE_READ) {
     fp = BLI_fopen(filepath, "rb");
@@ -1500,6 +1492,36 @@ static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
 
   return pf;
 }
+
+static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
+{
+  char filepath[MAX_PTCACHE_FILE];
+
+  /* Make sure pending asynchronous writes don't race with direct file access. */
+  ptcache_async_write_flush();
+
+  if (mode != PTCACHE_FILE_READ) {
+    /* The file is about to change, any staged read-ahead frame may go stale. */
+    ptcache_prefetch_invalidate();
+  }
+
+#ifndef DURIAN_POINTCACHE_LIB_OK
+  /* don't allow writing for linked objects */
+  if (pid->owner_id->lib && mode == PTCACHE_FILE_WRITE) {
+    return nullptr;
+  }
+#endif
+  if ((pid->cache->flag & PTCACHE_EXTERNAL) == 0) {
+    const char *blendfile_path = BKE_main_blendfile_path_from_global();
+    if (blendfile_path[0] == '\0') {
+      return nullptr; /* save blend file before using disk pointcache */
+    }
+  }
+
+  ptcache_filepath(pid, filepath, cfra, true, true);
+
+  return ptcache_file_open_filepath(filepath, mode, cfra);
+}
 static void ptcache_file_close(PTCacheFile *pf)
 {
   if (pf) {
@@ -1938,21 +1960,18 @@ static void ptcache_find_frames_around(PTCacheID *pid, uint frame, int *r_fra1,
   }
 }
 
-static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
+static PTCacheMem *ptcache_mem_frame_read(PTCacheFile *pf,
+                                          const uint type,
+                                          int (*read_header)(PTCacheFile *pf))
 {
-  PTCacheFile *pf = ptcache_file_open(pid, PTCACHE_FILE_READ, cfra);
   PTCacheMem *pm = nullptr;
   uint i, error = 0;
 
-  if (pf == nullptr) {
-    return nullptr;
-  }
-
   if (!ptcache_file_header_begin_read(pf)) {
     error = 1;
   }
 
-  if (!error && (pf->type != pid->type || !pid->read_header(pf))) {
+  if (!error && (pf->type != type || !read_header(pf))) {
     error = 1;
   }
 
@@ -2021,55 +2040,73 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
     pm = nullptr;
   }
 
-  ptcache_file_close(pf);
-
-  if (error && G.debug & G_DEBUG) {
-    printf("Error reading from disk cache\n");
-  }
-
   return pm;
 }
-static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
+
+static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
 {
-  PTCacheFile *pf = nullptr;
-  uint i, error = 0;
+  char filepath[MAX_PTCACHE_FILE];
+  PTCacheMem *pm = nullptr;
 
-  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+  /* The read-ahead task may have this frame decoded and staged already. */
+  if (ptcache_filepath(pid, filepath, cfra, true, true)) {
+    pm = ptcache_prefetch_claim(filepath);
+  }
 
-  pf = ptcache_file_open(pid, PTCACHE_FILE_WRITE, pm->frame);
+  if (pm == nullptr) {
+    PTCacheFile *pf = ptcache_file_open(pid, PTCACHE_FILE_READ, cfra);
 
-  if (pf == nullptr) {
-    if (G.debug & G_DEBUG) {
-      printf("Error opening disk cache file for writing\n");
+    if (pf == nullptr) {
+      return nullptr;
+    }
+
+    pm = ptcache_mem_frame_read(pf, pid->type, pid->read_header);
+
+    ptcache_file_close(pf);
+
+    if (pm == nullptr && G.debug & G_DEBUG) {
+      printf("Error reading from disk cache\n");
     }
-    return 0;
   }
 
+  if (pm) {
+    ptcache_disk_frame_prefetch(pid, cfra);
+  }
+
+  return pm;
+}
+static int ptcache_mem_frame_write(PTCacheFile *pf,
+                                   PTCacheMem *pm,
+                                   const uint type,
+                                   const short compression,
+                                   int (*write_header)(PTCacheFile *pf))
+{
+  uint i, error = 0;
+
   pf->data_types = pm->data_types;
   pf->totpoint = pm->totpoint;
-  pf->type = pid->type;
+  pf->type = type;
   pf->flag = 0;
 
   if (pm->extradata.first) {
     pf->flag |= PTCACHE_TYPEFLAG_EXTRADATA;
   }
 
-  if (pid->cache->compression) {
+  if (compression) {
     pf->flag |= PTCACHE_TYPEFLAG_COMPRESS;
   }
 
-  if (!ptcache_file_header_begin_write(pf) || !pid->write_header(pf)) {
+  if (!ptcache_file_header_begin_write(pf) || !write_header(pf)) {
     error = 1;
   }
 
   if (!error) {
-    if (pid->cache->compression) {
+    if (compression) {
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         if (pm->data[i]) {
           uint in_len = pm->totpoint * ptcache_data_size[i];
           uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-          ptcache_file_compressed_write(
-              pf, (uchar *)(pm->data[i]), in_len, out, pid->cache->compression);
+          ptcache_file_compressed_write(pf, (uchar *)(pm->data[i]), in_len, out, compression);
           MEM_freeN(out);
         }
       }
@@ -2101,11 +2138,10 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
       ptcache_file_write(pf, &extra->type, 1, sizeof(uint));
       ptcache_file_write(pf, &extra->totdata, 1, sizeof(uint));
 
-      if (pid->cache->compression) {
+      if (compression) {
         uint in_len = extra->totdata * ptcache_extra_datasize[extra->type];
         uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-        ptcache_file_compressed_write(
-            pf, (uchar *)(extra->data), in_len, out, pid->cache->compression);
+        ptcache_file_compressed_write(pf, (uchar *)(extra->data), in_len, out, compression);
         MEM_freeN(out);
       }
       else {
@@ -2114,6 +2150,27 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
     }
   }
 
+  return error;
+}
+
+static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
+{
+  PTCacheFile *pf = nullptr;
+  uint error = 0;
+
+  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+
+  pf = ptcache_file_open(pid, PTCACHE_FILE_WRITE, pm->frame);
+
+  if (pf == nullptr) {
+    if (G.debug & G_DEBUG) {
+      printf("Error opening disk cache file for writing\n");
+    }
+    return 0;
+  }
+
+  error = ptcache_mem_frame_write(pf, pm, pid->type, pid->cache->compression, pid->write_header);
+
   ptcache_file_close(pf);
 
   if (error && G.debug & G_DEBUG) {
@@ -2123,6 +2180,286 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
   return error == 0;
 }
 
+/* Asynchronous disk cache writer.
+ *
+ * Disk cache frames are complete in-memory snapshots already (#PTCacheMem), so
+ * instead of compressing and writing them synchronously at frame change, they
+ * are handed to a single background writer thread. Tasks run in submission
+ * order, so a frame that is written twice always ends up with the newest data.
+ * At most two frames are in flight at a time to bound memory use; any code
+ * path that reads, deletes or renames cache files flushes the queue first. */
+
+struct PTCacheAsyncWriteTask {
+  char filepath[MAX_PTCACHE_FILE];
+  uint type;
+  short compression;
+  int (*write_header)(PTCacheFile *pf);
+  /* Owned by the task, freed once written. */
+  PTCacheMem *pm;
+};
+
+static TaskPool *ptcache_async_write_pool = nullptr;
+static ThreadMutex ptcache_async_write_mutex = BLI_MUTEX_INITIALIZER;
+static int32_t ptcache_async_write_pending = 0;
+
+static void ptcache_async_write_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  PTCacheAsyncWriteTask *task = static_cast<PTCacheAsyncWriteTask *>(taskdata);
+  uint error = 0;
+
+  PTCacheFile *pf = ptcache_file_open_filepath(
+      task->filepath, PTCACHE_FILE_WRITE, task->pm->frame);
+
+  if (pf) {
+    error = ptcache_mem_frame_write(pf, task->pm, task->type, task->compression, task->write_header);
+    ptcache_file_close(pf);
+
+    if (error && G.debug & G_DEBUG) {
+      printf("Error writing to disk cache\n");
+    }
+  }
+  else if (G.debug & G_DEBUG) {
+    printf("Error opening disk cache file for writing\n");
+  }
+
+  ptcache_mem_clear(task->pm);
+  MEM_freeN(task->pm);
+
+  atomic_sub_and_fetch_int32(&ptcache_async_write_pending, 1);
+}
+
+static void ptcache_async_write_flush()
+{
+  BLI_mutex_lock(&ptcache_async_write_mutex);
+  if (ptcache_async_write_pool) {
+    BLI_task_pool_work_and_wait(ptcache_async_write_pool);
+  }
+  BLI_mutex_unlock(&ptcache_async_write_mutex);
+}
+
+/* Queue a memory frame for writing, takes ownership of pm. */
+static int ptcache_mem_frame_to_disk_async(PTCacheID *pid, PTCacheMem *pm)
+{
+  PTCacheAsyncWriteTask *task = MEM_cnew<PTCacheAsyncWriteTask>("PTCacheAsyncWriteTask");
+
+  /* No need to clear the frame first: tasks write in submission order and
+   * opening for write truncates, while #BKE_ptcache_write updates the
+   * `cached_frames` bookkeeping itself. */
+  if (ptcache_filepath(pid, task->filepath, pm->frame, true, true) == 0) {
+    MEM_freeN(task);
+    ptcache_mem_clear(pm);
+    MEM_freeN(pm);
+    return 0;
+  }
+
+  task->type = pid->type;
+  task->compression = pid->cache->compression;
+  task->write_header = pid->write_header;
+  task->pm = pm;
+
+  /* A staged read-ahead of this frame would be outdated by the write. */
+  ptcache_prefetch_invalidate();
+
+  /* Bound the queue so a fast simulation cannot pile up frame snapshots faster
+   * than the disk drains them. */
+  if (atomic_add_and_fetch_int32(&ptcache_async_write_pending, 0) >= 2) {
+    ptcache_async_write_flush();
+  }
+
+  BLI_mutex_lock(&ptcache_async_write_mutex);
+  if (ptcache_async_write_pool == nullptr) {
+    ptcache_async_write_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  atomic_add_and_fetch_int32(&ptcache_async_write_pending, 1);
+  BLI_task_pool_push(ptcache_async_write_pool, ptcache_async_write_task, task, true, nullptr);
+  BLI_mutex_unlock(&ptcache_async_write_mutex);
+
+  return 1;
+}
+
+/* Playback read-ahead for disk caches.
+ *
+ * While cached frames are read back in sequence, the next cached frame is
+ * decoded and decompressed on the background thread into a single staging
+ * slot, so stepping to it only swaps in the already decoded #PTCacheMem.
+ * Tasks share the writer's serial pool, which guarantees a queued write of a
+ * frame always lands on disk before a read-ahead of the same frame runs; a
+ * generation counter discards staged frames that a later write made stale. */
+
+struct PTCachePrefetchTask {
+  char filepath[MAX_PTCACHE_FILE];
+  uint type;
+  int (*read_header)(PTCacheFile *pf);
+  int cfra;
+  uint generation;
+};
+
+static ThreadMutex ptcache_prefetch_mutex = BLI_MUTEX_INITIALIZER;
+/* All three below are protected by #ptcache_prefetch_mutex. The file path is
+ * set when a task is queued, the result only once it has finished decoding. */
+static PTCacheMem *ptcache_prefetch_result = nullptr;
+static char ptcache_prefetch_filepath[MAX_PTCACHE_FILE] = "";
+static uint ptcache_prefetch_generation = 0;
+
+static void ptcache_prefetch_invalidate()
+{
+  BLI_mutex_lock(&ptcache_prefetch_mutex);
+  ptcache_prefetch_generation++;
+  if (ptcache_prefetch_result) {
+    ptcache_mem_clear(ptcache_prefetch_result);
+    MEM_freeN(ptcache_prefetch_result);
+    ptcache_prefetch_result = nullptr;
+  }
+  ptcache_prefetch_filepath[0] = '\0';
+  BLI_mutex_unlock(&ptcache_prefetch_mutex);
+}
+
+static void ptcache_prefetch_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  PTCachePrefetchTask *task = static_cast<PTCachePrefetchTask *>(taskdata);
+  PTCacheMem *pm = nullptr;
+
+  PTCacheFile *pf = ptcache_file_open_filepath(task->filepath, PTCACHE_FILE_READ, task->cfra);
+  if (pf) {
+    pm = ptcache_mem_frame_read(pf, task->type, task->read_header);
+    ptcache_file_close(pf);
+  }
+
+  BLI_mutex_lock(&ptcache_prefetch_mutex);
+  if (task->generation == ptcache_prefetch_generation) {
+    if (pm) {
+      if (ptcache_prefetch_result) {
+        ptcache_mem_clear(ptcache_prefetch_result);
+        MEM_freeN(ptcache_prefetch_result);
+      }
+      ptcache_prefetch_result = pm;
+      pm = nullptr;
+    }
+    else {
+      /* Unmark the file so the next read falls back to a direct one. */
+      ptcache_prefetch_filepath[0] = '\0';
+    }
+  }
+  BLI_mutex_unlock(&ptcache_prefetch_mutex);
+
+  if (pm) {
+    /* A write made the staged frame stale while it was decoding. */
+    ptcache_mem_clear(pm);
+    MEM_freeN(pm);
+  }
+}
+
+/* Take the staged frame for this file if the prefetcher has one, waiting for
+ * a decode of it that is still in flight. Returns nullptr otherwise. */
+static PTCacheMem *ptcache_prefetch_claim(const char *filepath)
+{
+  PTCacheMem *pm = nullptr;
+  bool in_flight = false;
+
+  BLI_mutex_lock(&ptcache_prefetch_mutex);
+  if (STREQ(ptcache_prefetch_filepath, filepath)) {
+    if (ptcache_prefetch_result) {
+      pm = ptcache_prefetch_result;
+      ptcache_prefetch_result = nullptr;
+      ptcache_prefetch_filepath[0] = '\0';
+    }
+    else {
+      in_flight = true;
+    }
+  }
+  BLI_mutex_unlock(&ptcache_prefetch_mutex);
+
+  if (in_flight) {
+    /* Wait for the decode task instead of reading the file a second time. */
+    ptcache_async_write_flush();
+
+    BLI_mutex_lock(&ptcache_prefetch_mutex);
+    if (STREQ(ptcache_prefetch_filepath, filepath) && ptcache_prefetch_result) {
+      pm = ptcache_prefetch_result;
+      ptcache_prefetch_result = nullptr;
+      ptcache_prefetch_filepath[0] = '\0';
+    }
+    BLI_mutex_unlock(&ptcache_prefetch_mutex);
+  }
+
+  return pm;
+}
+
+/* Queue background decoding of the next cached frame after cfra. */
+static void ptcache_disk_frame_prefetch(PTCacheID *pid, int cfra)
+{
+  PointCache *cache = pid->cache;
+  int next = -1;
+
+  if (cache->cached_frames == nullptr) {
+    return;
+  }
+
+  for (int fra = std::max(cfra + 1, int(cache->startframe));
+       fra < int(cache->startframe) + cache->cached_frames_len;
+       fra++)
+  {
+    if (cache->cached_frames[fra - cache->startframe]) {
+      next = fra;
+      break;
+    }
+  }
+
+  if (next == -1) {
+    return;
+  }
+
+  PTCachePrefetchTask *task = MEM_cnew<PTCachePrefetchTask>("PTCachePrefetchTask");
+
+  if (ptcache_filepath(pid, task->filepath, next, true, true) == 0) {
+    MEM_freeN(task);
+    return;
+  }
+
+  task->type = pid->type;
+  task->read_header = pid->read_header;
+  task->cfra = next;
+
+  BLI_mutex_lock(&ptcache_prefetch_mutex);
+  if (STREQ(ptcache_prefetch_filepath, task->filepath)) {
+    /* Already staged, or a task for it is still in the queue. */
+    BLI_mutex_unlock(&ptcache_prefetch_mutex);
+    MEM_freeN(task);
+    return;
+  }
+  if (ptcache_prefetch_result) {
+    ptcache_mem_clear(ptcache_prefetch_result);
+    MEM_freeN(ptcache_prefetch_result);
+    ptcache_prefetch_result = nullptr;
+  }
+  /* The slot is retargeted to another file: invalidate any decode task still in flight for the
+   * previous one, so it cannot stage its result under the new file path. */
+  ptcache_prefetch_generation++;
+  STRNCPY(ptcache_prefetch_filepath, task->filepath);
+  task->generation = ptcache_prefetch_generation;
+  BLI_mutex_unlock(&ptcache_prefetch_mutex);
+
+  BLI_mutex_lock(&ptcache_async_write_mutex);
+  if (ptcache_async_write_pool == nullptr) {
+    ptcache_async_write_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  BLI_task_pool_push(ptcache_async_write_pool, ptcache_prefetch_task, task, true, nullptr);
+  BLI_mutex_unlock(&ptcache_async_write_mutex);
+}
+
+void BKE_ptcache_exit()
+{
+  BLI_mutex_lock(&ptcache_async_write_mutex);
+  if (ptcache_async_write_pool) {
+    BLI_task_pool_work_and_wait(ptcache_async_write_pool);
+    BLI_task_pool_free(ptcache_async_write_pool);
+    ptcache_async_write_pool = nullptr;
+  }
+  BLI_mutex_unlock(&ptcache_async_write_mutex);
+
+  ptcache_prefetch_invalidate();
+}
+
 static int ptcache_read_stream(PTCacheID *pid, int cfra)
 {
   PTCacheFile *pf = ptcache_file_open(pid, PTCACHE_FILE_READ, cfra);
@@ -2472,18 +2809,11 @@ static int ptcache_write(PTCacheID *pid, int cfra, int overwrite)
   pm->frame = cfra;
 
   if (cache->flag & PTCACHE_DISK_CACHE) {
-    error += !ptcache_mem_frame_to_disk(pid, pm);
-
-    // if (pm) /* pm is always set */
-    {
-      ptcache_mem_clear(pm);
-      MEM_freeN(pm);
-    }
+    /* The writer tasks take ownership of the frame snapshots. */
+    error += !ptcache_mem_frame_to_disk_async(pid, pm);
 
     if (pm2) {
-      error += !ptcache_mem_frame_to_disk(pid, pm2);
-      ptcache_mem_clear(pm2);
-      MEM_freeN(pm2);
+      error += !ptcache_mem_frame_to_disk_async(pid, pm2);
     }
   }
   else {
@@ -2619,6 +2949,12 @@ void BKE_ptcache_id_clear(PTCacheID *pid, int mode, uint cfra)
     return;
   }
 
+  /* Queued frames would otherwise reappear on disk after the clear. */
+  if (pid->cache->flag & PTCACHE_DISK_CACHE) {
+    ptcache_async_write_flush();
+    ptcache_prefetch_invalidate();
+  }
+
   sta = pid->cache->startframe;
   end = pid->cache->endframe;
 
@@ -2767,6 +3103,8 @@ bool BKE_ptcache_id_exist(PTCacheID *pid, int cfra)
   if (pid->cache->flag & PTCACHE_DISK_CACHE) {
     char filepath[MAX_PTCACHE_FILE];
 
+    ptcache_async_write_flush();
+
     ptcache_filepath(pid, filepath, cfra, true, true);
 
     return BLI_exists(filepath);
@@ -3549,6 +3887,12 @@ void BKE_ptcache_disk_cache_rename(PTCacheID *pid, const char *name_src, const c
     return;
   }
 
+  /* Queued frame writes snapshot their file path at submission, flush them so a pending write
+   * cannot re-create a cache file under the old name after the rename. The staged read-ahead
+   * frame also refers to a file path that is about to change. */
+  ptcache_async_write_flush();
+  ptcache_prefetch_invalidate();
+
   /* save old name */
   STRNCPY(old_name, pid->cache->name);
 
@@ -133,6 +133,7 @@ void BKE_previewimg_clear_single(PreviewImage *prv, enum eIconSizes size)
   MEM_SAFE_FREE(prv->rect[size]);
   if (prv->runtime->gputexture[size]) {
     GPU_texture_free(prv->runtime->gputexture[size]);
+    prv->runtime->gputexture[size] = nullptr;
   }
   prv->h[size] = prv->w[size] = 0;
   prv->flag[size] |= PRV_CHANGED;
@@ -2110,12 +2110,13 @@ int BKE_scene_base_iter_next(
              * this enters eternal loop because of
              * makeDispListMBall getting called inside of collection_duplilist */
             if ((*base)->object->instance_collection == nullptr) {
-              iter->duplilist = object_duplilist(depsgraph, (*scene), (*base)->object);
+              iter->duplilist = MEM_new<DupliList>(__func__);
+              object_duplilist(depsgraph, (*scene), (*base)->object, *iter->duplilist);
 
-              iter->dupob = static_cast<DupliObject *>(iter->duplilist->first);
+              iter->dupob = iter->duplilist->is_empty() ? nullptr : iter->duplilist->begin();
 
               if (!iter->dupob) {
-                free_object_duplilist(iter->duplilist);
+                MEM_delete(iter->duplilist);
                 iter->duplilist = nullptr;
               }
               iter->dupli_refob = nullptr;
@@ -2139,7 +2140,10 @@ int BKE_scene_base_iter_next(
           }
           copy_m4_m4((*ob)->runtime->object_to_world.ptr(), iter->dupob->mat);
 
-          iter->dupob = iter->dupob->next;
+          iter->dupob++;
+          if (iter->dupob == iter->duplilist->end()) {
+            iter->dupob = nullptr;
+          }
         }
         else if (iter->phase == F_DUPLI) {
           iter->phase = F_SCENE;
@@ -2151,7 +2155,7 @@ int BKE_scene_base_iter_next(
             iter->dupli_refob = nullptr;
           }
 
-          free_object_duplilist(iter->duplilist);
+          MEM_delete(iter->duplilist);
           iter->duplilist = nullptr;
           run_again = true;
         }
@@ -13,6 +13,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash_md5.hh"
 #include "BLI_iterator.h"
 #include "BLI_math_rotation.h"
 #include "BLI_threads.h"
@@ -40,6 +41,7 @@
 #  include <AUD_Special.h>
 #endif
 
+#include "BKE_appdir.hh"
 #include "BKE_bpath.hh"
 #include "BKE_global.hh"
 #include "BKE_idtype.hh"
@@ -554,7 +556,7 @@ static void sound_load_audio(Main *bmain, bSound *sound, bool free_waveform)
 
     /* but we need a packed file then */
     if (pf) {
-      sound->handle = AUD_Sound_bufferFile((uchar *)pf->data, pf->size);
+      sound->handle = AUD_Sound_bufferFile((uchar *)BKE_packedfile_data_get(pf), pf->size);
     }
     else {
       /* or else load it from disk */
@@ -1042,6 +1044,136 @@ int BKE_sound_scene_playing(Scene *scene)
   return -1;
 }
 
+/* Waveform peaks are persisted in the user cache directory, keyed by a hash of the source file
+ * path and validated against the source file size and modification time, so re-opening a file
+ * with many sound strips does not re-decode the audio to rebuild the waveforms. */
+
+#  define SOUND_PEAKS_CACHE_VERSION 1
+
+struct SoundPeaksCacheHeader {
+  char magic[8]; /* "BPEAKS" with zero padding. */
+  int32_t version;
+  int32_t samples_per_second;
+  int32_t length;
+  int32_t _pad;
+  int64_t source_size;
+  int64_t source_mtime;
+};
+
+static const char sound_peaks_cache_magic[8] = "BPEAKS";
+
+static bool sound_peaks_cache_path(Main *bmain,
+                                   bSound *sound,
+                                   char r_path[FILE_MAX],
+                                   int64_t *r_source_size,
+                                   int64_t *r_source_mtime)
+{
+  if (sound->packedfile != nullptr) {
+    /* The audio data does not live on disk, there is nothing to validate a cache against. */
+    return false;
+  }
+
+  char fullpath[FILE_MAX];
+  STRNCPY(fullpath, sound->filepath);
+  BLI_path_abs(fullpath, ID_BLEND_PATH(bmain, &sound->id));
+
+  BLI_stat_t status;
+  if (BLI_stat(fullpath, &status) == -1) {
+    return false;
+  }
+  *r_source_size = int64_t(status.st_size);
+  *r_source_mtime = int64_t(status.st_mtime);
+
+  char cache_dir[FILE_MAX];
+  if (!BKE_appdir_folder_caches(cache_dir, sizeof(cache_dir))) {
+    return false;
+  }
+
+  uchar digest[16];
+  char hex_digest[33];
+  BLI_hash_md5_buffer(fullpath, strlen(fullpath), digest);
+  BLI_hash_md5_to_hexdigest(digest, hex_digest);
+
+  char filename[FILE_MAXFILE];
+  SNPRINTF(filename, "%s.peaks", hex_digest);
+  BLI_path_join(r_path, FILE_MAX, cache_dir, "sound-peaks", filename);
+  return true;
+}
+
+static SoundWaveform *sound_peaks_cache_read(const char *path,
+                                             const int64_t source_size,
+                                             const int64_t source_mtime)
+{
+  FILE *file = BLI_fopen(path, "rb");
+  if (file == nullptr) {
+    return nullptr;
+  }
+
+  SoundPeaksCacheHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      memcmp(header.magic, sound_peaks_cache_magic, sizeof(header.magic)) != 0 ||
+      header.version != SOUND_PEAKS_CACHE_VERSION ||
+      header.samples_per_second != SOUND_WAVE_SAMPLES_PER_SECOND || header.length < 0 ||
+      header.source_size != source_size || header.source_mtime != source_mtime)
+  {
+    fclose(file);
+    return nullptr;
+  }
+
+  float *data = nullptr;
+  if (header.length > 0) {
+    data = static_cast<float *>(
+        MEM_mallocN(sizeof(float[3]) * size_t(header.length), "SoundWaveform.samples"));
+    if (fread(data, sizeof(float[3]), header.length, file) != size_t(header.length)) {
+      MEM_freeN(data);
+      fclose(file);
+      return nullptr;
+    }
+  }
+  fclose(file);
+
+  SoundWaveform *waveform = static_cast<SoundWaveform *>(
+      MEM_mallocN(sizeof(SoundWaveform), "SoundWaveform"));
+  waveform->data = data;
+  waveform->length = header.length;
+  return waveform;
+}
+
+static void sound_peaks_cache_write(const char *path,
+                                    const SoundWaveform *waveform,
+                                    const int64_t source_size,
+                                    const int64_t source_mtime)
+{
+  if (!BLI_file_ensure_parent_dir_exists(path)) {
+    return;
+  }
+
+  FILE *file = BLI_fopen(path, "wb");
+  if (file == nullptr) {
+    return;
+  }
+
+  SoundPeaksCacheHeader header = {};
+  memcpy(header.magic, sound_peaks_cache_magic, sizeof(header.magic));
+  header.version = SOUND_PEAKS_CACHE_VERSION;
+  header.samples_per_second = SOUND_WAVE_SAMPLES_PER_SECOND;
+  header.length = waveform->length;
+  header.source_size = source_size;
+  header.source_mtime = source_mtime;
+
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  if (ok && waveform->length > 0) {
+    ok = fwrite(waveform->data, sizeof(float[3]), waveform->length, file) ==
+         size_t(waveform->length);
+  }
+  fclose(file);
+
+  if (!ok) {
+    /* Don't leave a truncated cache file behind. */
+    BLI_delete(path, false, false);
+  }
+}
+
 void BKE_sound_free_waveform(bSound *sound)
 {
   if ((sound->tags & SOUND_TAGS_WAVEFORM_NO_RELOAD) == 0) {
@@ -1061,6 +1193,25 @@ void BKE_sound_free_waveform(bSound *sound)
 
 void BKE_sound_read_waveform(Main *bmain, bSound *sound, bool *stop)
 {
+  char peaks_path[FILE_MAX];
+  int64_t source_size = 0;
+  int64_t source_mtime = 0;
+  const bool use_peaks_cache = sound_peaks_cache_path(
+      bmain, sound, peaks_path, &source_size, &source_mtime);
+
+  if (use_peaks_cache) {
+    SoundWaveform *cached_waveform = sound_peaks_cache_read(peaks_path, source_size, source_mtime);
+    if (cached_waveform != nullptr) {
+      BKE_sound_free_waveform(sound);
+
+      BLI_spin_lock(static_cast<SpinLock *>(sound->spinlock));
+      sound->waveform = cached_waveform;
+      sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
+      BLI_spin_unlock(static_cast<SpinLock *>(sound->spinlock));
+      return;
+    }
+  }
+
   bool need_close_audio_handles = false;
   if (sound->playback_handle == nullptr) {
     /* TODO(sergey): Make it fully independent audio handle. */
@@ -1103,6 +1254,10 @@ void BKE_sound_read_waveform(Main *bmain, bSound *sound, bool *stop)
     return;
   }
 
+  if (use_peaks_cache && waveform->length > 0) {
+    sound_peaks_cache_write(peaks_path, waveform, source_size, source_mtime);
+  }
+
   BKE_sound_free_waveform(sound);
 
   BLI_spin_lock(static_cast<SpinLock *>(sound->spinlock));
@@ -11,8 +11,11 @@
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_hash_mm2a.hh"
 #include "BLI_utildefines.h"
 
+#include "BKE_attribute.hh"
+#include "BKE_customdata.hh"
 #include "BKE_subdiv_modifier.hh"
 
 #include "MEM_guardedalloc.h"
@@ -137,6 +140,48 @@ Subdiv *new_from_mesh(const Settings *settings, const Mesh *mesh)
 
 /* Creation with cached-aware semantic. */
 
+static uint64_t topology_hash_accumulate(const uint64_t hash,
+                                         const void *data,
+                                         const size_t data_len)
+{
+  return hash * 65599 + BLI_hash_mm2(static_cast<const uchar *>(data), data_len, 0x9b4e7285);
+}
+
+/* Hash of all the coarse mesh data the topology refiner is built from: connectivity, creases and
+ * UV coordinates (the latter define the face-varying topology). Coarse vertex positions are
+ * deliberately not part of the hash, as they only feed the evaluator. */
+static uint64_t mesh_topology_hash(const Mesh *mesh)
+{
+  uint64_t hash = mesh->verts_num;
+  hash = hash * 65599 + mesh->edges_num;
+  hash = hash * 65599 + mesh->faces_num;
+  hash = hash * 65599 + mesh->corners_num;
+  const Span<int2> edges = mesh->edges();
+  hash = topology_hash_accumulate(hash, edges.data(), edges.size_in_bytes());
+  const Span<int> face_offsets = mesh->face_offsets();
+  hash = topology_hash_accumulate(hash, face_offsets.data(), face_offsets.size_in_bytes());
+  const Span<int> corner_verts = mesh->corner_verts();
+  hash = topology_hash_accumulate(hash, corner_verts.data(), corner_verts.size_in_bytes());
+  const AttributeAccessor attributes = mesh->attributes();
+  const VArraySpan<float> vert_crease = *attributes.lookup<float>("crease_vert",
+                                                                  AttrDomain::Point);
+  if (!vert_crease.is_empty()) {
+    hash = topology_hash_accumulate(hash, vert_crease.data(), vert_crease.size_in_bytes());
+  }
+  const VArraySpan<float> edge_crease = *attributes.lookup<float>("crease_edge", AttrDomain::Edge);
+  if (!edge_crease.is_empty()) {
+    hash = topology_hash_accumulate(hash, edge_crease.data(), edge_crease.size_in_bytes());
+  }
+  const int num_uv_layers = CustomData_number_of_layers(&mesh->corner_data, CD_PROP_FLOAT2);
+  hash = hash * 65599 + num_uv_layers;
+  for (int layer = 0; layer < num_uv_layers; layer++) {
+    const float(*uvs)[2] = static_cast<const float(*)[2]>(
+        CustomData_get_layer_n(&mesh->corner_data, CD_PROP_FLOAT2, layer));
+    hash = topology_hash_accumulate(hash, uvs, sizeof(float[2]) * size_t(mesh->corners_num));
+  }
+  return hash;
+}
+
 Subdiv *update_from_converter(Subdiv *subdiv,
                               const Settings *settings,
                               OpenSubdiv_Converter *converter)
@@ -169,10 +214,22 @@ Subdiv *update_from_converter(Subdiv *subdiv,
 
 Subdiv *update_from_mesh(Subdiv *subdiv, const Settings *settings, const Mesh *mesh)
 {
+  const uint64_t topology_hash = mesh_topology_hash(mesh);
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr && subdiv->topology_hash != 0 &&
+      subdiv->topology_hash == topology_hash && settings_equal(&subdiv->settings, settings))
+  {
+    /* The refiner was built from identical coarse topology, so it can be reused without
+     * constructing a converter and walking the full topology for comparison. This makes
+     * re-evaluation of animated subdivided meshes only refresh the coarse positions. */
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   converter_init_for_mesh(&converter, settings, mesh);
   subdiv = update_from_converter(subdiv, settings, &converter);
   converter_free(&converter);
+  if (subdiv != nullptr) {
+    subdiv->topology_hash = topology_hash;
+  }
   return subdiv;
 }
 
@@ -10,12 +10,12 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_bit_vector.hh"
 #include "BLI_enumerable_thread_specific.hh"
 #include "BLI_index_mask.hh"
 #include "BLI_math_bits.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
-#include "BLI_set.hh"
 #include "BLI_task.hh"
 #include "BLI_vector_set.hh"
 
@@ -339,6 +339,7 @@ static void subdiv_ccg_init_faces_edge_neighborhood(SubdivCCG &subdiv_ccg)
     return;
   }
   subdiv_ccg_allocate_adjacent_edges(subdiv_ccg, num_edges);
+  subdiv_ccg.grid_adjacent_edge = Array<int>(subdiv_ccg.grids.size());
 
   Vector<int, 64> face_vertices;
   Vector<int, 64> face_edges;
@@ -361,6 +362,7 @@ static void subdiv_ccg_init_faces_edge_neighborhood(SubdivCCG &subdiv_ccg)
       const bool is_edge_flipped = (edge_vertices[0] != vertex_index);
       /* Grid which is adjacent to the current corner. */
       const int current_grid_index = face.start() + corner;
+      subdiv_ccg.grid_adjacent_edge[current_grid_index] = edge_index;
       /* Grid which is adjacent to the next corner. */
       const int next_grid_index = face.start() + (corner + 1) % num_face_grids;
       /* Add new face to the adjacent edge. */
@@ -425,6 +427,7 @@ static void subdiv_ccg_init_faces_vertex_neighborhood(SubdivCCG &subdiv_ccg)
     return;
   }
   subdiv_ccg_allocate_adjacent_vertices(subdiv_ccg, num_vertices);
+  subdiv_ccg.grid_adjacent_vert = Array<int>(subdiv_ccg.grids.size());
   Vector<int, 64> face_vertices;
   /* Store adjacency for all faces. */
   for (const int face_index : faces.index_range()) {
@@ -436,6 +439,7 @@ static void subdiv_ccg_init_faces_vertex_neighborhood(SubdivCCG &subdiv_ccg)
       const int vertex_index = face_vertices[corner];
       /* Grid which is adjacent to the current corner. */
       const int grid_index = face.start() + corner;
+      subdiv_ccg.grid_adjacent_vert[grid_index] = vertex_index;
       /* Add new face to the adjacent edge. */
       SubdivCCGAdjacentVertex &adjacent_vertex = subdiv_ccg.adjacent_verts[vertex_index];
       SubdivCCGCoord *corner_coord = subdiv_ccg_adjacent_vertex_add_face(adjacent_vertex);
@@ -934,24 +938,23 @@ void BKE_subdiv_ccg_average_grids(SubdivCCG &subdiv_ccg)
 
 static void subdiv_ccg_affected_face_adjacency(SubdivCCG &subdiv_ccg,
                                                const IndexMask &face_mask,
-                                               blender::Set<int> &adjacent_verts,
-                                               blender::Set<int> &adjacent_edges)
+                                               blender::BitVector<> &adjacent_verts,
+                                               blender::BitVector<> &adjacent_edges)
 {
-  Subdiv *subdiv = subdiv_ccg.subdiv;
-  const OpenSubdiv_TopologyRefiner *topology_refiner = subdiv->topology_refiner;
-
-  Vector<int, 64> face_vertices;
-  Vector<int, 64> face_edges;
+  adjacent_verts.resize(subdiv_ccg.adjacent_verts.size());
+  adjacent_edges.resize(subdiv_ccg.adjacent_edges.size());
 
+  /* Use the precomputed boundary graph, which avoids walking the topology refiner and
+   * de-duplicating indices through hash sets. */
   face_mask.foreach_index([&](const int face_index) {
-    const int num_face_grids = subdiv_ccg.faces[face_index].size();
-    face_vertices.reinitialize(num_face_grids);
-    topology_refiner->getFaceVertices(face_index, face_vertices.data());
-    adjacent_verts.add_multiple(face_vertices);
-
-    face_edges.reinitialize(num_face_grids);
-    topology_refiner->getFaceEdges(face_index, face_edges.data());
-    adjacent_edges.add_multiple(face_edges);
+    for (const int grid_index : subdiv_ccg.faces[face_index]) {
+      if (!subdiv_ccg.grid_adjacent_vert.is_empty()) {
+        adjacent_verts[subdiv_ccg.grid_adjacent_vert[grid_index]].set();
+      }
+      if (!subdiv_ccg.grid_adjacent_edge.is_empty()) {
+        adjacent_edges[subdiv_ccg.grid_adjacent_edge[grid_index]].set();
+      }
+    }
   });
 }
 
@@ -959,22 +962,14 @@ void subdiv_ccg_average_faces_boundaries_and_corners(SubdivCCG &subdiv_ccg,
                                                      const CCGKey &key,
                                                      const IndexMask &face_mask)
 {
-  blender::Set<int> adjacent_vert_set;
-  blender::Set<int> adjacent_edge_set;
-  subdiv_ccg_affected_face_adjacency(subdiv_ccg, face_mask, adjacent_vert_set, adjacent_edge_set);
-
-  Vector<int> adjacent_verts(adjacent_vert_set.begin(), adjacent_vert_set.end());
-  Vector<int> adjacent_edges(adjacent_edge_set.begin(), adjacent_edge_set.end());
-
-  std::sort(adjacent_verts.begin(), adjacent_verts.end());
-  std::sort(adjacent_edges.begin(), adjacent_edges.end());
+  blender::BitVector<> adjacent_verts;
+  blender::BitVector<> adjacent_edges;
+  subdiv_ccg_affected_face_adjacency(subdiv_ccg, face_mask, adjacent_verts, adjacent_edges);
 
   IndexMaskMemory memory;
-  subdiv_ccg_average_boundaries(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_edges.as_span(), memory));
+  subdiv_ccg_average_boundaries(subdiv_ccg, key, IndexMask::from_bits(adjacent_edges, memory));
 
-  subdiv_ccg_average_corners(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_verts.as_span(), memory));
+  subdiv_ccg_average_corners(subdiv_ccg, key, IndexMask::from_bits(adjacent_verts, memory));
 }
 
 #endif
@@ -987,10 +982,14 @@ void BKE_subdiv_ccg_average_stitch_faces(SubdivCCG &subdiv_ccg, const IndexMask
   face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
     subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
   });
-  /* TODO(sergey): Only average elements which are adjacent to modified
-   * faces. */
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  if (face_mask.size() == subdiv_ccg.faces.size()) {
+    subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
+    subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  }
+  else {
+    /* Only average boundary sets which are adjacent to the modified faces. */
+    subdiv_ccg_average_faces_boundaries_and_corners(subdiv_ccg, key, face_mask);
+  }
 #else
   UNUSED_VARS(subdiv_ccg, face_mask);
 #endif
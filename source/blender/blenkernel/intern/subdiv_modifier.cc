@@ -148,6 +148,41 @@ bool BKE_subsurf_modifier_can_do_gpu_subdiv(const Scene *scene,
   return is_subdivision_evaluation_possible_on_gpu();
 }
 
+bool BKE_multires_modifier_can_do_gpu_subdiv(const Scene *scene,
+                                             const Object *ob,
+                                             const Mesh *mesh,
+                                             const MultiresModifierData *mmd,
+                                             int required_mode)
+{
+  if ((U.gpu_flag & USER_GPU_FLAG_SUBDIVISION_EVALUATION) == 0) {
+    return false;
+  }
+
+  /* The draw code only runs the limit surface evaluation on the GPU, without a displacement
+   * stage, so delegating is only correct while no sculpted detail exists. */
+  if (CustomData_has_layer(&mesh->corner_data, CD_MDISPS)) {
+    return false;
+  }
+
+  /* Same restriction as for the Subsurf modifier: split normals are too complicated to support
+   * on the GPU. */
+  if (mmd->flags & eMultiresModifierFlag_UseCustomNormals &&
+      CustomData_has_layer(&mesh->corner_data, CD_CUSTOMLOOPNORMAL))
+  {
+    return false;
+  }
+  if (mesh->normals_domain() == MeshNormalDomain::Corner) {
+    return false;
+  }
+
+  ModifierData *md = modifier_get_last_enabled_for_mode(scene, ob, required_mode);
+  if (md != (const ModifierData *)mmd) {
+    return false;
+  }
+
+  return is_subdivision_evaluation_possible_on_gpu();
+}
+
 bool BKE_subsurf_modifier_has_gpu_subdiv(const Mesh *mesh)
 {
   SubsurfRuntimeData *runtime_data = mesh->runtime->subsurf_runtime_data;
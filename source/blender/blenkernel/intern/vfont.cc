@@ -504,28 +504,27 @@ static void build_underline(Curve *cu,
   mul_v2_fl(bp[3].vec, font_size);
 }
 
-void BKE_vfont_build_char(Curve *cu,
-                          ListBase *nubase,
-                          uint character,
-                          const CharInfo *info,
-                          float ofsx,
-                          float ofsy,
-                          float rot,
-                          int charidx,
-                          const float fsize)
+/**
+ * Add the glyph geometry for an already resolved character to \a nubase.
+ *
+ * Takes the #VChar directly so that layout code which already looked up the glyph
+ * (under #vfont_rwlock) doesn't have to repeat the hash lookup for every character.
+ */
+static void vfont_char_build(Curve *cu,
+                             ListBase *nubase,
+                             const VChar *che,
+                             const CharInfo *info,
+                             float ofsx,
+                             float ofsy,
+                             float rot,
+                             int charidx,
+                             const float fsize)
 {
-  VFontData *vfd = vfont_get_data(which_vfont(cu, info));
-  if (!vfd) {
-    return;
-  }
-
   /* make a copy at distance ofsx, ofsy with shear */
   float shear = cu->shear;
   float si = sinf(rot);
   float co = cosf(rot);
 
-  VChar *che = find_vfont_char(vfd, character);
-
   /* Select the glyph data */
   Nurb *nu1 = nullptr;
   if (che) {
@@ -627,6 +626,25 @@ void BKE_vfont_build_char(Curve *cu,
   }
 }
 
+void BKE_vfont_build_char(Curve *cu,
+                          ListBase *nubase,
+                          uint character,
+                          const CharInfo *info,
+                          float ofsx,
+                          float ofsy,
+                          float rot,
+                          int charidx,
+                          const float fsize)
+{
+  VFontData *vfd = vfont_get_data(which_vfont(cu, info));
+  if (!vfd) {
+    return;
+  }
+
+  vfont_char_build(
+      cu, nubase, find_vfont_char(vfd, character), info, ofsx, ofsy, rot, charidx, fsize);
+}
+
 int BKE_vfont_select_get(Object *ob, int *r_start, int *r_end)
 {
   Curve *cu = static_cast<Curve *>(ob->data);
@@ -938,6 +956,12 @@ static bool vfont_to_curve(Object *ob,
   ct = chartransdata = static_cast<CharTrans *>(
       MEM_calloc_arrayN((slen + 1), sizeof(CharTrans), "buildtext"));
 
+  /* Glyphs resolved during the layout pass (aligned with `mem`), so later passes
+   * (building curves, underline & cursor placement) don't have to re-do the
+   * lock-guarded hash lookup for every character. */
+  VChar **charcache = static_cast<VChar **>(
+      MEM_calloc_arrayN((slen + 1), sizeof(VChar *), "charcache"));
+
   /* We assume the worst case: 1 character per line (is freed at end anyway) */
   lineinfo = static_cast<TempLineInfo *>(
       MEM_malloc_arrayN((slen * 2 + 1), sizeof(*lineinfo), "lineinfo"));
@@ -1029,6 +1053,7 @@ static bool vfont_to_curve(Object *ob,
     else {
       che = nullptr;
     }
+    charcache[i] = che;
 
     twidth = char_width(cu, che, info);
 
@@ -1698,7 +1723,8 @@ static bool vfont_to_curve(Object *ob,
       }
       /* We don't want to see any character for '\n'. */
       if (cha != '\n') {
-        BKE_vfont_build_char(cu, r_nubase, cha, info, ct->xof, ct->yof, ct->rot, i, font_size);
+        vfont_char_build(
+            cu, r_nubase, charcache[i], info, ct->xof, ct->yof, ct->rot, i, font_size);
       }
 
       if ((info->flag & CU_CHINFO_UNDERLINE) && (cha != '\n')) {
@@ -1711,11 +1737,9 @@ static bool vfont_to_curve(Object *ob,
         {
           uloverlap = xtrax + 0.1f;
         }
-        /* Find the character, the characters has to be in the memory already
+        /* The character is in the cache already,
          * since character checking has been done earlier already. */
-        che = find_vfont_char(vfd, cha);
-
-        twidth = char_width(cu, che, info);
+        twidth = char_width(cu, charcache[i], info);
         ulwidth = (twidth * (1.0f + (info->kern / 40.0f))) + uloverlap;
 
         rect.xmin = ct->xof;
@@ -1910,9 +1934,7 @@ static bool vfont_to_curve(Object *ob,
        * (using the character midpoint on the x-axis as a reference). */
       for (; i <= char_end && char_yof == chartransdata[i].yof; i++) {
         info = &custrinfo[i];
-        ascii = info->flag & CU_CHINFO_SMALLCAPS_CHECK ? towupper(mem[i]) : mem[i];
-        che = find_vfont_char(vfd, ascii);
-        const float charwidth = char_width(cu, che, info);
+        const float charwidth = char_width(cu, charcache[i], info);
         const float charhalf = (charwidth / 2.0f);
         if (cursor_location[0] <= ((chartransdata[i].xof + charhalf) * font_size)) {
           break;
@@ -1941,6 +1963,7 @@ static bool vfont_to_curve(Object *ob,
     if (chartransdata != nullptr) {
       MEM_freeN(chartransdata);
     }
+    MEM_freeN(charcache);
 
     if (ef == nullptr) {
       MEM_freeN((void *)mem);
@@ -1950,6 +1973,7 @@ static bool vfont_to_curve(Object *ob,
 
   ok = true;
 finally:
+  MEM_freeN(charcache);
   if (r_text) {
     *r_text = mem;
     *r_text_len = slen;
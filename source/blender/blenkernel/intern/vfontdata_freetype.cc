@@ -22,6 +22,7 @@
 #include "BLI_string_utf8.h"
 
 #include "BKE_curve.hh"
+#include "BKE_packedFile.h"
 #include "BKE_vfont.hh"
 #include "BKE_vfontdata.hh"
 
@@ -33,7 +34,8 @@ extern int builtin_font_size;
 
 VFontData *BKE_vfontdata_from_freetypefont(PackedFile *pf)
 {
-  int fontid = BLF_load_mem("FTVFont", static_cast<const uchar *>(pf->data), pf->size);
+  int fontid = BLF_load_mem(
+      "FTVFont", static_cast<const uchar *>(BKE_packedfile_data_get(pf)), pf->size);
   if (fontid == -1) {
     return nullptr;
   }
@@ -88,8 +90,9 @@ VChar *BKE_vfontdata_char_from_freetypefont(VFont *vfont, ulong character)
         vfont->data->name, static_cast<const uchar *>(builtin_font_data), builtin_font_size);
   }
   else if (vfont->temp_pf) {
-    font_id = BLF_load_mem(
-        vfont->data->name, static_cast<const uchar *>(vfont->temp_pf->data), vfont->temp_pf->size);
+    font_id = BLF_load_mem(vfont->data->name,
+                           static_cast<const uchar *>(BKE_packedfile_data_get(vfont->temp_pf)),
+                           vfont->temp_pf->size);
   }
 
   if (font_id == -1) {
@@ -14,6 +14,7 @@
 #include "DNA_material_types.h"
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
 #include "DNA_volume_types.h"
 
 #include "BLI_bounds.hh"
@@ -134,6 +135,13 @@ void BKE_volumes_init()
 #endif
 }
 
+void BKE_volumes_exit()
+{
+#ifdef WITH_OPENVDB
+  blender::bke::volume_grid::file_cache::prefetch_exit();
+#endif
+}
+
 /* Volume datablock */
 
 static void volume_init_data(ID *id)
@@ -393,7 +401,10 @@ static int volume_sequence_frame(const Depsgraph *depsgraph, const Volume *volum
 }
 
 #ifdef WITH_OPENVDB
-static void volume_filepath_get(const Main *bmain, const Volume *volume, char r_filepath[FILE_MAX])
+static void volume_filepath_get_frame(const Main *bmain,
+                                      const Volume *volume,
+                                      const int frame,
+                                      char r_filepath[FILE_MAX])
 {
   BLI_strncpy(r_filepath, volume->filepath, FILE_MAX);
   BLI_path_abs(r_filepath, ID_BLEND_PATH(bmain, &volume->id));
@@ -402,10 +413,15 @@ static void volume_filepath_get(const Main *bmain, const Volume *volume, char r_
   if (volume->is_sequence && BLI_path_frame_get(r_filepath, &path_frame, &path_digits)) {
     char ext[32];
     BLI_path_frame_strip(r_filepath, ext, sizeof(ext));
-    BLI_path_frame(r_filepath, FILE_MAX, volume->runtime->frame, path_digits);
+    BLI_path_frame(r_filepath, FILE_MAX, frame, path_digits);
     BLI_path_extension_ensure(r_filepath, FILE_MAX, ext);
   }
 }
+
+static void volume_filepath_get(const Main *bmain, const Volume *volume, char r_filepath[FILE_MAX])
+{
+  volume_filepath_get_frame(bmain, volume, volume->runtime->frame, r_filepath);
+}
 #endif
 
 /* File Load */
@@ -530,6 +546,25 @@ bool BKE_volume_load(const Volume *volume, const Main *bmain)
 
   STRNCPY(grids.filepath, filepath);
 
+  /* Ask the file cache to load the upcoming frames of the sequence in the background, so that
+   * stepping to them during playback does not block on disk I/O. */
+  if (volume->is_sequence && grids.error_msg.empty()) {
+    const int num_prefetch_frames = 4;
+    blender::Vector<std::string> prefetch_paths;
+    for (int i = 1; i <= num_prefetch_frames; i++) {
+      char frame_filepath[FILE_MAX];
+      volume_filepath_get_frame(bmain, volume, volume->runtime->frame + i, frame_filepath);
+      if (!BLI_exists(frame_filepath)) {
+        continue;
+      }
+      prefetch_paths.append(frame_filepath);
+    }
+    if (!prefetch_paths.is_empty()) {
+      blender::bke::volume_grid::file_cache::prefetch_frames(
+          prefetch_paths, int64_t(U.memcachelimit) * 1024 * 1024);
+    }
+  }
+
   return grids.error_msg.empty();
 #else
   UNUSED_VARS(bmain, volume);
@@ -8,6 +8,7 @@
 #  include "BKE_volume_openvdb.hh"
 
 #  include "BLI_map.hh"
+#  include "BLI_task.h"
 
 #  include <openvdb/openvdb.h>
 
@@ -224,6 +225,134 @@ void unload_unused()
   }
 }
 
+/**
+ * A sequence frame that was loaded ahead of playback. Holding the grid references keeps the
+ * loaded trees alive in the cache; once a frame is dropped from the window, #unload_unused can
+ * reclaim the memory again.
+ */
+struct PrefetchedFrame {
+  std::string file_path;
+  Vector<GVolumeGrid> grids;
+  int64_t memory_bytes = 0;
+};
+
+/**
+ * State of the background frame prefetcher. Frames are loaded one by one on a low priority
+ * background thread, and kept resident in a sliding window that is trimmed to a memory budget.
+ */
+struct PrefetchState {
+  std::mutex mutex;
+  TaskPool *pool = nullptr;
+  int64_t memory_budget = 0;
+  /** Files that are queued for loading but not finished yet. */
+  Vector<std::string> pending;
+  /** Loaded frames, least recently requested first. */
+  Vector<PrefetchedFrame> resident;
+};
+
+static PrefetchState &get_prefetch_state()
+{
+  static PrefetchState state;
+  return state;
+}
+
+static void prefetch_task_run(TaskPool *__restrict /*pool*/, void *task_data)
+{
+  const std::string &file_path = *static_cast<std::string *>(task_data);
+
+  PrefetchedFrame frame;
+  frame.file_path = file_path;
+  /* Note that this is done without holding the prefetch mutex, so that residency queries and new
+   * prefetch requests are not blocked by disk I/O. */
+  GridsFromFile grids_from_file = get_all_grids_from_file(file_path);
+  for (GVolumeGrid &grid : grids_from_file.grids) {
+    /* Force the tree to be loaded; this is where the actual reading happens. */
+    VolumeTreeAccessToken tree_token;
+    frame.memory_bytes += int64_t(grid->grid(tree_token).memUsage());
+    frame.grids.append(std::move(grid));
+  }
+
+  PrefetchState &state = get_prefetch_state();
+  std::lock_guard lock{state.mutex};
+  const int64_t pending_index = state.pending.first_index_of_try(file_path);
+  if (pending_index != -1) {
+    state.pending.remove_and_reorder(pending_index);
+  }
+  if (!grids_from_file.error_message.empty()) {
+    return;
+  }
+  state.resident.append(std::move(frame));
+  /* Trim the oldest frames when over budget. The most recent frame is always kept, so that
+   * playback can make progress even when a single frame exceeds the budget. */
+  int64_t total_bytes = 0;
+  for (const PrefetchedFrame &resident_frame : state.resident) {
+    total_bytes += resident_frame.memory_bytes;
+  }
+  while (total_bytes > state.memory_budget && state.resident.size() > 1) {
+    total_bytes -= state.resident[0].memory_bytes;
+    state.resident.remove(0);
+  }
+}
+
+static void prefetch_task_free(TaskPool *__restrict /*pool*/, void *task_data)
+{
+  MEM_delete(static_cast<std::string *>(task_data));
+}
+
+void prefetch_frames(const Span<std::string> file_paths, const int64_t memory_budget)
+{
+  PrefetchState &state = get_prefetch_state();
+  std::lock_guard lock{state.mutex};
+  state.memory_budget = memory_budget;
+  if (state.pool == nullptr) {
+    state.pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  for (const std::string &file_path : file_paths) {
+    if (state.pending.contains(file_path)) {
+      continue;
+    }
+    bool is_resident = false;
+    for (const int64_t i : state.resident.index_range()) {
+      if (state.resident[i].file_path == file_path) {
+        /* Refresh recency, so that the sliding window follows playback. */
+        PrefetchedFrame frame = std::move(state.resident[i]);
+        state.resident.remove(i);
+        state.resident.append(std::move(frame));
+        is_resident = true;
+        break;
+      }
+    }
+    if (is_resident) {
+      continue;
+    }
+    state.pending.append(file_path);
+    BLI_task_pool_push(state.pool,
+                       prefetch_task_run,
+                       MEM_new<std::string>(__func__, file_path),
+                       true,
+                       prefetch_task_free);
+  }
+}
+
+void prefetch_exit()
+{
+  PrefetchState &state = get_prefetch_state();
+  TaskPool *pool;
+  {
+    std::lock_guard lock{state.mutex};
+    pool = state.pool;
+    state.pool = nullptr;
+    state.pending.clear();
+  }
+  if (pool != nullptr) {
+    /* Outside of the lock, because running tasks lock the mutex when they finish. */
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  }
+  std::lock_guard lock{state.mutex};
+  state.resident.clear();
+}
+
 }  // namespace blender::bke::volume_grid::file_cache
 
 #endif /* WITH_OPENVDB */
@@ -31,12 +31,17 @@ struct FileReader;
 
 typedef int64_t (*FileReaderReadFn)(struct FileReader *reader, void *buffer, size_t size);
 typedef off64_t (*FileReaderSeekFn)(struct FileReader *reader, off64_t offset, int whence);
+typedef const void *(*FileReaderDataPtrFn)(struct FileReader *reader, size_t offset, size_t size);
 typedef void (*FileReaderCloseFn)(struct FileReader *reader);
 
 /** General structure for all #FileReaders, implementations add custom fields at the end. */
 typedef struct FileReader {
   FileReaderReadFn read;
   FileReaderSeekFn seek;
+  /** Optional (may be NULL): returns a pointer to `size` bytes at `offset` of the backing
+   * storage without copying, for readers backed by memory or memory-mapped files.
+   * Returns NULL when the requested range is out of bounds. */
+  FileReaderDataPtrFn data_ptr;
   FileReaderCloseFn close;
 
   off64_t offset;
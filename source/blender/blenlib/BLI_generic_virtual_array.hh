@@ -204,6 +204,15 @@ class GVArray : public GVArrayCommon {
 
   GVArray slice(IndexRange slice) const;
 
+  /**
+   * Returns a virtual array with the same values that computes them in fixed-size chunks which
+   * are cached on first access. Pipelines that only sample parts of an expensive computed array
+   * then only pay for the chunks actually touched, while repeated access becomes a cheap copy.
+   * Chunk pointers are published atomically, so the result can be read from multiple threads.
+   * Spans and single values are returned as-is, they are already cheap to access.
+   */
+  GVArray with_chunked_cache() const;
+
   GVArray &operator=(const GVArray &other);
   GVArray &operator=(GVArray &&other) noexcept;
 
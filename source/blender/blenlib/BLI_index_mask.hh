@@ -249,6 +249,17 @@ class IndexMask : private IndexMaskData {
   static IndexMask from_intersection(const IndexMask &mask_a,
                                      const IndexMask &mask_b,
                                      IndexMaskMemory &memory);
+  /**
+   * Construct a mask from #mask with the indices in #added inserted and the indices in #removed
+   * removed (#removed is applied first, so indices in both end up in the result). Segments of
+   * #mask that don't overlap the delta are reused without copying their index arrays, so applying
+   * a small delta to a large mask is much cheaper than a full rebuild. The memory referenced by
+   * #mask must stay alive as long as the result is used.
+   */
+  static IndexMask from_delta(const IndexMask &mask,
+                              const IndexMask &added,
+                              const IndexMask &removed,
+                              IndexMaskMemory &memory);
   /** Construct a mask from all the indices for which the predicate is true. */
   template<typename Fn>
   static IndexMask from_predicate(const IndexMask &universe,
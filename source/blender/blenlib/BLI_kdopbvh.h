@@ -131,6 +131,18 @@ typedef void (*BVHTree_NearestProjectedCallback)(void *userdata,
  * \note many callers don't check for `NULL` return.
  */
 BVHTree *BLI_bvhtree_new(int maxsize, float epsilon, char tree_type, char axis);
+/**
+ * A version of #BLI_bvhtree_new that can enable a SIMD packed-node (QBVH
+ * style) layout, built as a side product of #BLI_bvhtree_balance. Ray-casts
+ * then test 4 child bounding boxes at once instead of one node at a time,
+ * which pays off for dense trees that are ray-cast many times.
+ *
+ * \param use_simd_packed: Request the packed layout. Only honored for 4-ary
+ * trees whose k-DOP type starts with the three axis-aligned axes
+ * (`axis` of 6, 8, 14 or 26), other trees keep the regular layout.
+ */
+BVHTree *BLI_bvhtree_new_ex(
+    int maxsize, float epsilon, char tree_type, char axis, bool use_simd_packed);
 void BLI_bvhtree_free(BVHTree *tree);
 
 /**
@@ -709,6 +709,21 @@ bool isect_ray_tri_v3(const float ray_origin[3],
                       const float v2[3],
                       float *r_lambda,
                       float r_uv[2]);
+/**
+ * Batch variant of #isect_ray_tri_v3 that intersects one ray with many triangles. Processes
+ * multiple triangles at once with SIMD when available. `r_hit[i]` is set for every triangle,
+ * while `r_lambda[i]` and `r_uv[i]` are only written when the triangle is hit (matching the
+ * single-triangle version, which leaves the outputs untouched on a miss). `r_uv` may be null.
+ */
+void isect_ray_tri_v3_batch(const float ray_origin[3],
+                            const float ray_direction[3],
+                            const float (*v0)[3],
+                            const float (*v1)[3],
+                            const float (*v2)[3],
+                            int len,
+                            bool *r_hit,
+                            float *r_lambda,
+                            float (*r_uv)[2]);
 bool isect_ray_tri_threshold_v3(const float ray_origin[3],
                                 const float ray_direction[3],
                                 const float v0[3],
@@ -926,6 +941,17 @@ bool point_in_slice_seg(float p[3], float l1[3], float l2[3]);
 
 void interp_weights_tri_v3(
     float w[3], const float v1[3], const float v2[3], const float v3[3], const float co[3]);
+/**
+ * Batch variant of #interp_weights_tri_v3 that computes the weights of `co[i]` in the triangle
+ * `(v1[i], v2[i], v3[i])` for every index. Processes multiple triangles at once with SIMD when
+ * available, which is significantly faster than calling the single-triangle version in a loop.
+ */
+void interp_weights_tri_v3_batch(float (*r_w)[3],
+                                 const float (*v1)[3],
+                                 const float (*v2)[3],
+                                 const float (*v3)[3],
+                                 const float (*co)[3],
+                                 int len);
 void interp_weights_quad_v3(float w[4],
                             const float v1[3],
                             const float v2[3],
@@ -0,0 +1,75 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * C++ utilities on top of #BLI_memarena.h.
+ */
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_memarena.h"
+#include "BLI_utility_mixins.hh"
+
+#include "MEM_guardedalloc.h"
+
+namespace blender {
+
+/**
+ * A pool of thread-local memory arenas for scratch allocations in parallel code. Each thread gets
+ * its own #MemArena on first use, so allocations don't contend with other threads. All arenas are
+ * freed together when the pool is destructed.
+ *
+ * This replaces the boilerplate of wrapping a lazily created #MemArena in a thread-local struct
+ * with a destructor at every call site.
+ */
+class MemArenaPool : NonCopyable, NonMovable {
+ private:
+  struct LocalArena {
+    MemArena *arena = nullptr;
+
+    ~LocalArena()
+    {
+      if (arena != nullptr) {
+        BLI_memarena_free(arena);
+      }
+    }
+  };
+
+  threading::EnumerableThreadSpecific<LocalArena> arenas_;
+  size_t bufsize_;
+
+ public:
+  MemArenaPool(const size_t bufsize = BLI_MEMARENA_STD_BUFSIZE) : bufsize_(bufsize) {}
+
+  /**
+   * Get the arena of the current thread. The arena is created on first use, so threads that never
+   * allocate don't pay for one.
+   */
+  MemArena *local()
+  {
+    MemArena *&arena = arenas_.local().arena;
+    if (arena == nullptr) {
+      arena = BLI_memarena_new(bufsize_, __func__);
+    }
+    return arena;
+  }
+
+  /**
+   * Clear all arenas for reuse, avoiding re-allocation when the pool is used for multiple
+   * passes. May only be called when no other thread is using the pool.
+   */
+  void clear_all()
+  {
+    for (LocalArena &local : arenas_) {
+      if (local.arena != nullptr) {
+        BLI_memarena_clear(local.arena);
+      }
+    }
+  }
+};
+
+}  // namespace blender
@@ -29,12 +29,60 @@ void *BLI_mempool_alloc(BLI_mempool *pool) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT A
     ATTR_NONNULL(1);
 void *BLI_mempool_calloc(BLI_mempool *pool)
     ATTR_MALLOC ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+/**
+ * Grow the pool so at least \a elem_num further elements can be allocated without any chunk
+ * allocation, adding all missing chunks at once. Useful before bulk element creation.
+ */
+void BLI_mempool_reserve(BLI_mempool *pool, unsigned int elem_num) ATTR_NONNULL(1);
 /**
  * Free an element from the mempool.
  *
  * \note doesn't protect against double frees, take care!
  */
 void BLI_mempool_free(BLI_mempool *pool, void *addr) ATTR_NONNULL(1, 2);
+
+/**
+ * Per-thread allocation magazine, for allocating from one pool on multiple
+ * threads concurrently. Each thread must use its own magazine, the pool
+ * itself may only be used through the magazines while they exist.
+ */
+typedef struct BLI_mempool_magazine BLI_mempool_magazine;
+
+/**
+ * Create \a magazines_num magazines for \a pool, typically one per worker
+ * thread. Must be called from a single thread.
+ */
+BLI_mempool_magazine *BLI_mempool_magazines_create(BLI_mempool *pool, unsigned int magazines_num)
+    ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+/**
+ * Get the magazine at \a index from an array created with
+ * #BLI_mempool_magazines_create. Needed because the struct is opaque,
+ * so the array cannot be indexed by callers directly.
+ */
+BLI_mempool_magazine *BLI_mempool_magazine_get(BLI_mempool_magazine *magazines,
+                                               unsigned int index) ATTR_WARN_UNUSED_RESULT
+    ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+/**
+ * Thread-safe counterpart of #BLI_mempool_alloc, only to be called by the
+ * thread owning \a magazine.
+ */
+void *BLI_mempool_magazine_alloc(BLI_mempool_magazine *magazine)
+    ATTR_MALLOC ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+void *BLI_mempool_magazine_calloc(BLI_mempool_magazine *magazine)
+    ATTR_MALLOC ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+/**
+ * Free an element into the magazine's private free list. It is only made
+ * available to other threads again once the magazines are destroyed.
+ */
+void BLI_mempool_magazine_free(BLI_mempool_magazine *magazine, void *addr) ATTR_NONNULL(1, 2);
+/**
+ * Return all left-over free elements to the pool and free the magazines.
+ * Must be called from a single thread after all workers finished.
+ */
+void BLI_mempool_magazines_destroy(BLI_mempool *pool,
+                                   BLI_mempool_magazine *magazines,
+                                   unsigned int magazines_num) ATTR_NONNULL(1, 2);
+
 /**
  * Empty the pool, as if it were just created.
  *
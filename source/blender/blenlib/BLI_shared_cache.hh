@@ -62,6 +62,21 @@ template<typename T> class SharedCache {
     cache_->mutex.ensure([&]() { compute_cache(this->cache_->data); });
   }
 
+  /**
+   * Tag the data for recomputation like #tag_dirty(), but keep the existing value available to
+   * the next computation (copying it from shared data if necessary). Useful when that computation
+   * may be able to reuse parts of the previous result instead of rebuilding it from scratch.
+   */
+  void tag_dirty_keep_data()
+  {
+    if (cache_.unique()) {
+      cache_->mutex.tag_dirty();
+    }
+    else {
+      cache_ = std::make_shared<CacheData>(cache_->data);
+    }
+  }
+
   /**
    * Represents a combination of "tag dirty" and "update cache for new data." Existing cached
    * values are kept available (copied from shared data if necessary). This can be helpful when
@@ -28,6 +28,12 @@ struct SearchItem {
   int main_group_id;
   int main_group_length;
   int total_length;
+  /**
+   * A bitmask with a bit set for every unicode code point in the normalized words (hashed into 64
+   * buckets). It is precomputed when the item is added so that queries can cheaply skip items that
+   * can't possibly match, without looking at the words themselves.
+   */
+  uint64_t char_mask;
   float weight;
   /**
    * This is a logical time stamp, i.e. the greater it is, the more recent the item was used. The
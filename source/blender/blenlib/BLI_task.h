@@ -92,6 +92,14 @@ TaskPool *BLI_task_pool_create_background_serial(void *userdata, eTaskPriority p
  */
 TaskPool *BLI_task_pool_create_suspended(void *userdata, eTaskPriority priority);
 
+/**
+ * Work stealing: distributes tasks over per-thread deques instead of the
+ * single shared queue, with LIFO execution of the local deque and FIFO
+ * stealing from other threads. Scales better than the regular pool when many
+ * fine-grained tasks are pushed, at the cost of dedicated worker threads.
+ */
+TaskPool *BLI_task_pool_create_work_stealing(void *userdata, eTaskPriority priority);
+
 /**
  * No threads: immediately executes tasks on the same thread. For debugging purposes.
  */
@@ -0,0 +1,70 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Lightweight frame-trace recorder.
+ *
+ * Scoped spans are recorded with begin/end timestamps and a thread id into a fixed size ring
+ * buffer, so the most recent few seconds of main-loop activity (depsgraph evaluation, draw
+ * submission, sequencer rendering, render engine sync) can be inspected as a timeline. The
+ * buffer is dumped as Chrome trace-event JSON (load in `chrome://tracing` or Perfetto), which
+ * makes it possible to profile hitches on artist machines without special builds.
+ *
+ * Recording is disabled by default; a disabled span is a single relaxed atomic load. Spans may
+ * be recorded from any thread.
+ */
+
+#include "BLI_string_ref.hh"
+#include "BLI_sys_types.h"
+
+namespace blender::trace {
+
+bool is_enabled();
+
+/** Start recording spans. Allocates the ring buffer on first use. */
+void enable();
+
+/** Stop recording spans. The already recorded events are kept for #dump_to_file. */
+void disable();
+
+/**
+ * Write the recorded events as Chrome trace-event JSON.
+ * \return true on success.
+ *
+ * \note Spans that wrapped out of the ring buffer may be missing their begin event,
+ * viewers tolerate this at the very start of the timeline.
+ */
+bool dump_to_file(StringRefNull filepath);
+
+/**
+ * Record the begin/end of a span on the current thread.
+ * \param name: must point to a statically allocated string, only the pointer is stored.
+ */
+void record_begin(const char *name);
+void record_end(const char *name);
+
+class ScopedSpan {
+ private:
+  const char *name_;
+
+ public:
+  ScopedSpan(const char *name) : name_(name)
+  {
+    record_begin(name);
+  }
+
+  ~ScopedSpan()
+  {
+    record_end(name_);
+  }
+};
+
+}  // namespace blender::trace
+
+/** Record a span covering the rest of the current scope. The name must be a static string. */
+#define BLI_TRACE_SCOPE(name) blender::trace::ScopedSpan trace_scoped_span(name)
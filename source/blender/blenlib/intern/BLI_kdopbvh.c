@@ -33,10 +33,9 @@
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
-#include "BLI_strict_flags.h" /* Keep last. */
+#include "kdopbvh_internal.h"
 
-/* used for iterative_raycast */
-// #define USE_SKIP_LINKS
+#include "BLI_strict_flags.h" /* Keep last. */
 
 /* Use to print balanced output. */
 // #define USE_PRINT_TREE
@@ -44,8 +43,6 @@
 /* Check tree is valid. */
 // #define USE_VERIFY_TREE
 
-#define MAX_TREETYPE 32
-
 /* Setting zero so we can catch bugs in BLI_task/KDOPBVH.
  * TODO(sergey): Deduplicate the limits with PBVH from BKE.
  */
@@ -59,38 +56,8 @@
 /** \name Struct Definitions
  * \{ */
 
-typedef uchar axis_t;
-
-typedef struct BVHNode {
-  struct BVHNode **children;
-  struct BVHNode *parent; /* some user defined traversed need that */
-#ifdef USE_SKIP_LINKS
-  struct BVHNode *skip[2];
-#endif
-  float *bv;      /* Bounding volume of all nodes, max 13 axis */
-  int index;      /* face, edge, vertex index */
-  char node_num;  /* how many nodes are used, used for speedup */
-  char main_axis; /* Axis used to split this node */
-} BVHNode;
-
-/* keep under 26 bytes for speed purposes */
-struct BVHTree {
-  BVHNode **nodes;
-  BVHNode *nodearray;  /* pre-alloc branch nodes */
-  BVHNode **nodechild; /* pre-alloc children for nodes */
-  float *nodebv;       /* pre-alloc bounding-volumes for nodes */
-  float epsilon;       /* Epsilon is used for inflation of the K-DOP. */
-  int leaf_num;        /* leafs */
-  int branch_num;
-  axis_t start_axis, stop_axis; /* bvhtree_kdop_axes array indices according to axis */
-  axis_t axis;                  /* KDOP type (6 => OBB, 7 => AABB, ...) */
-  char tree_type;               /* type of tree (4 => quad-tree). */
-};
-
-/* optimization, ensure we stay small */
-BLI_STATIC_ASSERT((sizeof(void *) == 8 && sizeof(BVHTree) <= 48) ||
-                      (sizeof(void *) == 4 && sizeof(BVHTree) <= 32),
-                  "over sized")
+/* NOTE: #BVHNode and #BVHTree are defined in `kdopbvh_internal.h`, shared
+ * with the SIMD packed-node layout in `kdopbvh_packed.cc`. */
 
 /* avoid duplicating vars in BVHOverlapData_Thread */
 typedef struct BVHOverlapData_Shared {
@@ -932,9 +899,22 @@ fail:
   return NULL;
 }
 
+BVHTree *BLI_bvhtree_new_ex(
+    int maxsize, float epsilon, char tree_type, char axis, bool use_simd_packed)
+{
+  BVHTree *tree = BLI_bvhtree_new(maxsize, epsilon, tree_type, axis);
+  if (tree && use_simd_packed) {
+    /* Packing needs 4 children per branch and the axis-aligned k-DOP axes
+     * first (all types except 18-DOP), otherwise keep the regular layout. */
+    tree->use_packed = (tree_type == 4) && (tree->start_axis == 0);
+  }
+  return tree;
+}
+
 void BLI_bvhtree_free(BVHTree *tree)
 {
   if (tree) {
+    bvhtree_packed4_free(tree->packed);
     MEM_SAFE_FREE(tree->nodes);
     MEM_SAFE_FREE(tree->nodearray);
     MEM_SAFE_FREE(tree->nodebv);
@@ -966,6 +946,10 @@ void BLI_bvhtree_balance(BVHTree *tree)
   build_skip_links(tree, tree->nodes[tree->leaf_num], NULL, NULL);
 #endif
 
+  if (tree->use_packed) {
+    tree->packed = bvhtree_packed4_build(tree);
+  }
+
 #ifdef USE_VERIFY_TREE
   bvhtree_verify(tree);
 #endif
@@ -1039,6 +1023,12 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
   for (; index >= root; index--) {
     node_join(tree, *index);
   }
+
+  /* The packed layout stores copies of the bounds, rebuild it. */
+  if (tree->packed) {
+    bvhtree_packed4_free(tree->packed);
+    tree->packed = bvhtree_packed4_build(tree);
+  }
 }
 int BLI_bvhtree_get_len(const BVHTree *tree)
 {
@@ -2020,7 +2010,11 @@ int BLI_bvhtree_ray_cast_ex(const BVHTree *tree,
     data.hit.dist = BVH_RAYCAST_DIST_MAX;
   }
 
-  if (root) {
+  if (tree->packed && data.ray.radius == 0.0f) {
+    /* Packed traversal tests 4 child bounding boxes per step. */
+    bvhtree_packed4_ray_cast(tree->packed, &data.ray, &data.hit, callback, userdata);
+  }
+  else if (root) {
     dfs_raycast(&data, root);
     //      iterative_raycast(&data, root);
   }
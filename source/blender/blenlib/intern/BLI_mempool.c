@@ -24,10 +24,7 @@
 #include "BLI_asan.h"
 #include "BLI_mempool.h"         /* own include */
 #include "BLI_mempool_private.h" /* own include */
-
-#ifdef WITH_ASAN
-#  include "BLI_threads.h"
-#endif
+#include "BLI_threads.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -125,6 +122,8 @@ struct BLI_mempool {
   uint pchunk;
   uint flag;
 
+  /** Serialize growing the chunk list from threaded allocations. */
+  SpinLock chunks_lock;
   /** Free element list. Interleaved into chunk data. */
   BLI_freenode *free;
   /** Use to know how many chunks to keep for #BLI_mempool_clear. */
@@ -211,9 +210,10 @@ static BLI_mempool_chunk *mempool_chunk_alloc(const BLI_mempool *pool)
  * (used when building free chunks initially)
  * \return The last chunk,
  */
-static BLI_freenode *mempool_chunk_add(BLI_mempool *pool,
-                                       BLI_mempool_chunk *mpchunk,
-                                       BLI_freenode *last_tail)
+static BLI_freenode *mempool_chunk_add_ex(BLI_mempool *pool,
+                                          BLI_mempool_chunk *mpchunk,
+                                          BLI_freenode *last_tail,
+                                          const bool set_pool_free)
 {
   const uint esize = pool->esize;
   BLI_freenode *curnode = CHUNK_DATA(mpchunk);
@@ -231,7 +231,7 @@ static BLI_freenode *mempool_chunk_add(BLI_mempool *pool,
   mpchunk->next = NULL;
   pool->chunk_tail = mpchunk;
 
-  if (UNLIKELY(pool->free == NULL)) {
+  if (set_pool_free && UNLIKELY(pool->free == NULL)) {
     pool->free = curnode;
   }
 
@@ -318,6 +318,13 @@ static BLI_freenode *mempool_chunk_add(BLI_mempool *pool,
   return curnode;
 }
 
+static BLI_freenode *mempool_chunk_add(BLI_mempool *pool,
+                                       BLI_mempool_chunk *mpchunk,
+                                       BLI_freenode *last_tail)
+{
+  return mempool_chunk_add_ex(pool, mpchunk, last_tail, true);
+}
+
 static void mempool_chunk_free(BLI_mempool_chunk *mpchunk, BLI_mempool *pool)
 {
 #ifdef WITH_ASAN
@@ -353,6 +360,7 @@ BLI_mempool *BLI_mempool_create(uint esize, uint elem_num, uint pchunk, uint fla
 #ifdef WITH_ASAN
   BLI_mutex_init(&pool->mutex);
 #endif
+  BLI_spin_init(&pool->chunks_lock);
 
   /* set the elem size */
   if (esize < (int)MEMPOOL_ELEM_SIZE_MIN) {
@@ -463,6 +471,43 @@ void *BLI_mempool_calloc(BLI_mempool *pool)
   return retval;
 }
 
+void BLI_mempool_reserve(BLI_mempool *pool, const uint elem_num)
+{
+  uint chunks_num = 0;
+  for (BLI_mempool_chunk *mpchunk = pool->chunks; mpchunk; mpchunk = mpchunk->next) {
+    chunks_num++;
+  }
+
+  const uint elem_num_free = (chunks_num * pool->pchunk) - pool->totused;
+  if (elem_num <= elem_num_free) {
+    return;
+  }
+
+  uint chunks_missing_num = mempool_maxchunks(elem_num - elem_num_free, pool->pchunk);
+
+  /* Put the new chunks at the head of the free list so following allocations fill them in
+   * order, appending whatever free elements were left afterwards. */
+  BLI_freenode *free_prev = pool->free;
+  BLI_freenode *last_tail = NULL;
+  pool->free = NULL; /* #mempool_chunk_add assigns. */
+  while (chunks_missing_num--) {
+    BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
+    last_tail = mempool_chunk_add(pool, mpchunk, last_tail);
+  }
+
+  if (free_prev) {
+    BLI_asan_unpoison(last_tail, pool->esize - POISON_REDZONE_SIZE);
+#ifdef WITH_MEM_VALGRIND
+    VALGRIND_MAKE_MEM_DEFINED(last_tail, pool->esize - POISON_REDZONE_SIZE);
+#endif
+    last_tail->next = free_prev;
+    BLI_asan_poison(last_tail, pool->esize);
+#ifdef WITH_MEM_VALGRIND
+    VALGRIND_MAKE_MEM_UNDEFINED(last_tail, pool->esize);
+#endif
+  }
+}
+
 /**
  * Free an element from the mempool.
  *
@@ -847,6 +892,146 @@ void *mempool_iter_threadsafe_step(BLI_mempool_threadsafe_iter *ts_iter)
 
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Threaded Allocation (Magazines)
+ *
+ * Per-thread magazines for allocating from one pool on multiple threads
+ * concurrently. A magazine owns a private free list that only its thread
+ * touches. When it runs empty, the shared free list is stolen in a single
+ * atomic exchange (taking it as a whole side-steps the ABA problem of
+ * popping elements one by one), falling back to allocating a new chunk with
+ * only the chunk-list linkage behind a spin lock.
+ *
+ * While magazines exist, the pool may only be used through them (and the
+ * thread-safe iterators). Elements freed into a magazine are not returned to
+ * the shared list until the magazines are destroyed.
+ * \{ */
+
+struct BLI_mempool_magazine {
+  BLI_mempool *pool;
+  /** Private free list, only touched by the owning thread. */
+  BLI_freenode *free;
+};
+
+BLI_mempool_magazine *BLI_mempool_magazines_create(BLI_mempool *pool, const uint magazines_num)
+{
+  BLI_mempool_magazine *magazines = MEM_callocN(sizeof(*magazines) * (size_t)magazines_num,
+                                                "mempool magazines");
+  for (uint i = 0; i < magazines_num; i++) {
+    magazines[i].pool = pool;
+  }
+  return magazines;
+}
+
+BLI_mempool_magazine *BLI_mempool_magazine_get(BLI_mempool_magazine *magazines, const uint index)
+{
+  return &magazines[index];
+}
+
+void *BLI_mempool_magazine_alloc(BLI_mempool_magazine *magazine)
+{
+  BLI_mempool *pool = magazine->pool;
+
+  if (UNLIKELY(magazine->free == NULL)) {
+    /* Steal the entire shared free list in one exchange. */
+    BLI_freenode *shared;
+    do {
+      shared = atomic_load_ptr((void *const *)&pool->free);
+    } while (shared && (atomic_cas_ptr((void **)&pool->free, shared, NULL) != shared));
+
+    if (shared) {
+      magazine->free = shared;
+    }
+    else {
+      /* Refill from a new chunk. Only its linkage into the chunk list needs
+       * to be serialized, the free list it contains stays private. */
+      BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
+      BLI_spin_lock(&pool->chunks_lock);
+      mempool_chunk_add_ex(pool, mpchunk, NULL, false);
+      BLI_spin_unlock(&pool->chunks_lock);
+      magazine->free = CHUNK_DATA(mpchunk);
+    }
+  }
+
+  BLI_freenode *free_pop = magazine->free;
+
+  BLI_asan_unpoison(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_ALLOC(pool, free_pop, pool->esize - POISON_REDZONE_SIZE);
+  VALGRIND_MAKE_MEM_DEFINED(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#endif
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+    free_pop->freeword = USEDWORD;
+  }
+
+  magazine->free = free_pop->next;
+  atomic_add_and_fetch_u(&pool->totused, 1);
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MAKE_MEM_UNDEFINED(free_pop, pool->esize - POISON_REDZONE_SIZE);
+#endif
+
+  return (void *)free_pop;
+}
+
+void *BLI_mempool_magazine_calloc(BLI_mempool_magazine *magazine)
+{
+  void *retval = BLI_mempool_magazine_alloc(magazine);
+
+  memset(retval, 0, (size_t)magazine->pool->esize - POISON_REDZONE_SIZE);
+
+  return retval;
+}
+
+void BLI_mempool_magazine_free(BLI_mempool_magazine *magazine, void *addr)
+{
+  BLI_mempool *pool = magazine->pool;
+  BLI_freenode *newhead = addr;
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+#ifndef NDEBUG
+    /* This will detect double free's. */
+    BLI_assert(newhead->freeword != FREEWORD);
+#endif
+    newhead->freeword = FREEWORD;
+  }
+
+  newhead->next = magazine->free;
+  magazine->free = newhead;
+
+  BLI_asan_poison(newhead, pool->esize);
+
+  atomic_sub_and_fetch_u(&pool->totused, 1);
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_FREE(pool, addr);
+#endif
+}
+
+void BLI_mempool_magazines_destroy(BLI_mempool *pool,
+                                   BLI_mempool_magazine *magazines,
+                                   const uint magazines_num)
+{
+  /* All threads using the magazines must have finished, the left-over free
+   * elements are returned to the shared list without synchronization. */
+  for (uint i = 0; i < magazines_num; i++) {
+    BLI_mempool_magazine *magazine = &magazines[i];
+    BLI_assert(magazine->pool == pool);
+    while (magazine->free) {
+      BLI_freenode *node = magazine->free;
+      BLI_asan_unpoison(node, pool->esize - POISON_REDZONE_SIZE);
+      magazine->free = node->next;
+      node->next = pool->free;
+      pool->free = node;
+      BLI_asan_poison(node, pool->esize);
+    }
+  }
+  MEM_freeN(magazines);
+}
+
+/** \} */
+
 void BLI_mempool_clear_ex(BLI_mempool *pool, const int elem_num_reserve)
 {
   BLI_mempool_chunk *mpchunk;
@@ -908,6 +1093,8 @@ void BLI_mempool_destroy(BLI_mempool *pool)
 {
   mempool_chunk_free_all(pool->chunks, pool);
 
+  BLI_spin_end(&pool->chunks_lock);
+
 #ifdef WITH_MEM_VALGRIND
   VALGRIND_DESTROY_MEMPOOL(pool);
 #endif
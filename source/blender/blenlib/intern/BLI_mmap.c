@@ -148,6 +148,14 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   if (memory == MAP_FAILED) {
     return NULL;
   }
+
+  /* Mapped files are consumed in roughly ascending offset order (blend file
+   * and image reading). Telling the kernel this makes it read ahead of the
+   * consuming thread aggressively, overlapping disk IO with parsing instead
+   * of taking a page fault pause on every first access. Errors are ignored,
+   * this is only a hint. */
+  madvise(memory, length, MADV_SEQUENTIAL);
+  madvise(memory, length, MADV_WILLNEED);
 #else
   /* Convert the POSIX-style file descriptor to a Windows handle. */
   void *file_handle = (void *)_get_osfhandle(fd);
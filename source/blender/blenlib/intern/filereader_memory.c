@@ -62,6 +62,17 @@ static off64_t memory_seek(FileReader *reader, off64_t offset, int whence)
   return mem->reader.offset;
 }
 
+static const void *memory_data_ptr(FileReader *reader, size_t offset, size_t size)
+{
+  MemoryReader *mem = (MemoryReader *)reader;
+
+  if (offset + size > mem->length) {
+    return NULL;
+  }
+
+  return mem->data + offset;
+}
+
 static void memory_close_raw(FileReader *reader)
 {
   MEM_freeN(reader);
@@ -76,6 +87,7 @@ FileReader *BLI_filereader_new_memory(const void *data, size_t len)
 
   mem->reader.read = memory_read_raw;
   mem->reader.seek = memory_seek;
+  mem->reader.data_ptr = memory_data_ptr;
   mem->reader.close = memory_close_raw;
 
   return (FileReader *)mem;
@@ -120,10 +132,12 @@ FileReader *BLI_filereader_new_mmap(int filedes)
   MemoryReader *mem = MEM_callocN(sizeof(MemoryReader), __func__);
 
   mem->mmap = mmap;
+  mem->data = BLI_mmap_get_pointer(mmap);
   mem->length = BLI_mmap_get_length(mmap);
 
   mem->reader.read = memory_read_mmap;
   mem->reader.seek = memory_seek;
+  mem->reader.data_ptr = memory_data_ptr;
   mem->reader.close = memory_close_mmap;
 
   return (FileReader *)mem;
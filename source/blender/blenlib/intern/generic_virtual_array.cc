@@ -2,7 +2,9 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
 
 #include "BLI_generic_virtual_array.hh"
 
@@ -539,6 +541,140 @@ class GVArrayImpl_For_SlicedGVArray : public GVArrayImpl {
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name #GVArrayImpl_For_ChunkedCache
+ * \{ */
+
+/**
+ * Evaluates the referenced virtual array in fixed-size chunks which are computed on first access
+ * and cached for later lookups. Computing a chunk is serialized with a mutex, reading an already
+ * published chunk is lock-free.
+ */
+class GVArrayImpl_For_ChunkedCache : public GVArrayImpl {
+ private:
+  static constexpr int64_t chunk_size_shift = 12;
+  /** Number of elements that are materialized at once. */
+  static constexpr int64_t chunk_size = int64_t(1) << chunk_size_shift;
+
+  GVArray varray_;
+  /** Lazily computed buffers of #chunk_size elements each (fewer for the last chunk). */
+  mutable Array<std::atomic<void *>> chunks_;
+  /** Serializes computing new chunks. */
+  mutable std::mutex mutex_;
+
+ public:
+  GVArrayImpl_For_ChunkedCache(GVArray varray)
+      : GVArrayImpl(varray.type(), varray.size()),
+        varray_(std::move(varray)),
+        chunks_((size_ + chunk_size - 1) >> chunk_size_shift)
+  {
+    for (std::atomic<void *> &chunk : chunks_) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~GVArrayImpl_For_ChunkedCache() override
+  {
+    for (const int64_t chunk_i : chunks_.index_range()) {
+      void *chunk = chunks_[chunk_i].load(std::memory_order_relaxed);
+      if (chunk != nullptr) {
+        type_->destruct_n(chunk, this->chunk_range(chunk_i).size());
+        MEM_freeN(chunk);
+      }
+    }
+  }
+
+ private:
+  IndexRange chunk_range(const int64_t chunk_i) const
+  {
+    return IndexRange::from_begin_end(chunk_i << chunk_size_shift,
+                                      std::min(size_, (chunk_i + 1) << chunk_size_shift));
+  }
+
+  const void *get_chunk(const int64_t chunk_i) const
+  {
+    std::atomic<void *> &slot = chunks_[chunk_i];
+    void *chunk = slot.load(std::memory_order_acquire);
+    if (chunk != nullptr) {
+      return chunk;
+    }
+    std::lock_guard lock{mutex_};
+    chunk = slot.load(std::memory_order_relaxed);
+    if (chunk != nullptr) {
+      return chunk;
+    }
+    const IndexRange range = this->chunk_range(chunk_i);
+    void *buffer = MEM_mallocN_aligned(
+        size_t(type_->size() * range.size()), size_t(type_->alignment()), __func__);
+    varray_.materialize_compressed_to_uninitialized(IndexMask(range), buffer);
+    /* Publish the chunk only after it is fully computed. */
+    slot.store(buffer, std::memory_order_release);
+    return buffer;
+  }
+
+  const void *get_element(const int64_t index) const
+  {
+    const void *chunk = this->get_chunk(index >> chunk_size_shift);
+    return POINTER_OFFSET(chunk, type_->size() * (index & (chunk_size - 1)));
+  }
+
+ public:
+  void get(const int64_t index, void *r_value) const override
+  {
+    type_->copy_assign(this->get_element(index), r_value);
+  }
+
+  void get_to_uninitialized(const int64_t index, void *r_value) const override
+  {
+    type_->copy_construct(this->get_element(index), r_value);
+  }
+
+  void materialize(const IndexMask &mask, void *dst) const override
+  {
+    if (mask.is_empty()) {
+      return;
+    }
+    /* Handle the mask chunk-wise, so every cached buffer is only looked up once. */
+    const int64_t first_chunk = mask.first() >> chunk_size_shift;
+    const int64_t last_chunk = mask.last() >> chunk_size_shift;
+    for (int64_t chunk_i = first_chunk; chunk_i <= last_chunk; chunk_i++) {
+      const IndexRange range = this->chunk_range(chunk_i);
+      const IndexMask sliced_mask = mask.slice_content(range);
+      if (sliced_mask.is_empty()) {
+        continue;
+      }
+      const void *chunk = this->get_chunk(chunk_i);
+      sliced_mask.foreach_index_optimized<int64_t>([&](const int64_t i) {
+        type_->copy_assign(POINTER_OFFSET(chunk, type_->size() * (i - range.start())),
+                           POINTER_OFFSET(dst, type_->size() * i));
+      });
+    }
+  }
+
+  void materialize_to_uninitialized(const IndexMask &mask, void *dst) const override
+  {
+    if (mask.is_empty()) {
+      return;
+    }
+    const int64_t first_chunk = mask.first() >> chunk_size_shift;
+    const int64_t last_chunk = mask.last() >> chunk_size_shift;
+    for (int64_t chunk_i = first_chunk; chunk_i <= last_chunk; chunk_i++) {
+      const IndexRange range = this->chunk_range(chunk_i);
+      const IndexMask sliced_mask = mask.slice_content(range);
+      if (sliced_mask.is_empty()) {
+        continue;
+      }
+      const void *chunk = this->get_chunk(chunk_i);
+      sliced_mask.foreach_index_optimized<int64_t>([&](const int64_t i) {
+        type_->copy_construct(POINTER_OFFSET(chunk, type_->size() * (i - range.start())),
+                              POINTER_OFFSET(dst, type_->size() * i));
+      });
+    }
+  }
+};
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name #GVArrayCommon
  * \{ */
@@ -744,6 +880,19 @@ GVArray GVArray::slice(IndexRange slice) const
   return GVArray::For<GVArrayImpl_For_SlicedGVArray>(*this, slice);
 }
 
+GVArray GVArray::with_chunked_cache() const
+{
+  const CommonVArrayInfo info = this->common_info();
+  if (info.type != CommonVArrayInfo::Type::Any) {
+    /* Spans and single values are already cheap to access, caching them would only copy. */
+    return *this;
+  }
+  if (this->is_empty()) {
+    return *this;
+  }
+  return GVArray::For<GVArrayImpl_For_ChunkedCache>(*this);
+}
+
 GVArray &GVArray::operator=(const GVArray &other)
 {
   this->copy_from(other);
@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 #include <iostream>
+#include <limits>
 #include <mutex>
 
 #include "BLI_array.hh"
@@ -394,6 +395,40 @@ struct ParallelSegmentsCollector {
 
 IndexMask IndexMask::complement(const IndexRange universe, IndexMaskMemory &memory) const
 {
+  if (universe.is_empty()) {
+    return {};
+  }
+  if (this->is_empty()) {
+    return universe;
+  }
+  if (const std::optional<IndexRange> range = this->to_range()) {
+    /* Fast path: the complement of a range is at most two ranges, which can be built without the
+     * expression evaluator (ranges only reference the static indices array). */
+    const IndexRange range_in_universe = range->intersect(universe);
+    if (range_in_universe.is_empty()) {
+      return universe;
+    }
+    const IndexRange front = IndexRange::from_begin_end(universe.start(),
+                                                        range_in_universe.start());
+    const IndexRange back = IndexRange::from_begin_end(range_in_universe.one_after_last(),
+                                                       universe.one_after_last());
+    if (front.is_empty()) {
+      return back;
+    }
+    if (back.is_empty()) {
+      return front;
+    }
+    const IndexMask front_mask(front);
+    const IndexMask back_mask(back);
+    Vector<IndexMaskSegment, 16> segments;
+    for (const int64_t i : IndexRange(front_mask.segments_num())) {
+      segments.append(front_mask.segment(i));
+    }
+    for (const int64_t i : IndexRange(back_mask.segments_num())) {
+      segments.append(back_mask.segment(i));
+    }
+    return IndexMask::from_segments(segments, memory);
+  }
   ExprBuilder builder;
   const IndexMask universe_mask{universe};
   const Expr &expr = builder.subtract(&universe_mask, {this});
@@ -521,6 +556,72 @@ IndexMask IndexMask::from_intersection(const IndexMask &mask_a,
   return evaluate_expression(expr, memory);
 }
 
+IndexMask IndexMask::from_delta(const IndexMask &mask,
+                                const IndexMask &added,
+                                const IndexMask &removed,
+                                IndexMaskMemory &memory)
+{
+  if (added.is_empty() && removed.is_empty()) {
+    return mask;
+  }
+  if (mask.is_empty()) {
+    return added;
+  }
+
+  /* Bounds of the indices actually affected by the delta. */
+  int64_t delta_first = std::numeric_limits<int64_t>::max();
+  int64_t delta_last = std::numeric_limits<int64_t>::min();
+  if (!added.is_empty()) {
+    delta_first = added.first();
+    delta_last = added.last();
+  }
+  if (!removed.is_empty()) {
+    delta_first = std::min(delta_first, removed.first());
+    delta_last = std::max(delta_last, removed.last());
+  }
+
+  /* Segments fully in front of or behind the delta are reused as-is, only their descriptors are
+   * copied. Only the overlapping segments are rebuilt. */
+  const int64_t segments_num = mask.segments_num();
+  int64_t prefix_num = 0;
+  while (prefix_num < segments_num && mask.segment(prefix_num).last() < delta_first) {
+    prefix_num++;
+  }
+  int64_t suffix_num = 0;
+  while (suffix_num < segments_num - prefix_num &&
+         mask.segment(segments_num - 1 - suffix_num)[0] > delta_last)
+  {
+    suffix_num++;
+  }
+
+  Vector<IndexMaskSegment, 16> segments;
+  for (const int64_t i : IndexRange(prefix_num)) {
+    segments.append(mask.segment(i));
+  }
+
+  /* Rebuild the part of the mask that overlaps the delta. */
+  Vector<IndexMaskSegment, 16> middle_segments;
+  for (const int64_t i : IndexRange::from_begin_end(prefix_num, segments_num - suffix_num)) {
+    middle_segments.append(mask.segment(i));
+  }
+  const IndexMask middle_mask = IndexMask::from_segments(middle_segments, memory);
+  ExprBuilder builder;
+  const Expr &removed_expr = builder.subtract({&middle_mask}, {&removed});
+  const Expr &expr = builder.merge({&removed_expr, &added});
+  const IndexMask middle_result = evaluate_expression(expr, memory);
+  for (const int64_t i : IndexRange(middle_result.segments_num())) {
+    segments.append(middle_result.segment(i));
+  }
+
+  for (const int64_t i : IndexRange(suffix_num)) {
+    segments.append(mask.segment(segments_num - suffix_num + i));
+  }
+
+  const int64_t consolidated_segments_num = consolidate_index_mask_segments(segments, memory);
+  segments.resize(consolidated_segments_num);
+  return IndexMask::from_segments(segments, memory);
+}
+
 IndexMask IndexMask::from_initializers(const Span<Initializer> initializers,
                                        IndexMaskMemory &memory)
 {
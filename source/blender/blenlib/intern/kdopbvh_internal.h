@@ -0,0 +1,113 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Shared internals of the k-DOP BVH-tree. Split from `BLI_kdopbvh.c` so the
+ * SIMD packed-node layout in `kdopbvh_packed.cc` can access the tree
+ * structure from C++ (SIMD support headers require C++).
+ */
+
+#include "BLI_kdopbvh.h"
+#include "BLI_sys_types.h"
+#include "BLI_utildefines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_TREETYPE 32
+
+/* used for iterative_raycast */
+// #define USE_SKIP_LINKS
+
+typedef uchar axis_t;
+
+typedef struct BVHNode {
+  struct BVHNode **children;
+  struct BVHNode *parent; /* some user defined traversed need that */
+#ifdef USE_SKIP_LINKS
+  struct BVHNode *skip[2];
+#endif
+  float *bv;      /* Bounding volume of all nodes, max 13 axis */
+  int index;      /* face, edge, vertex index */
+  char node_num;  /* how many nodes are used, used for speedup */
+  char main_axis; /* Axis used to split this node */
+} BVHNode;
+
+/* keep under 26 bytes for speed purposes */
+struct BVHTree {
+  BVHNode **nodes;
+  BVHNode *nodearray;  /* pre-alloc branch nodes */
+  BVHNode **nodechild; /* pre-alloc children for nodes */
+  float *nodebv;       /* pre-alloc bounding-volumes for nodes */
+  /* Packed 4-wide node layout, only built when enabled, see #BLI_bvhtree_new_ex. */
+  struct BVHTreePacked4 *packed;
+  float epsilon;                /* Epsilon is used for inflation of the K-DOP. */
+  int leaf_num;                 /* leafs */
+  int branch_num;
+  axis_t start_axis, stop_axis; /* bvhtree_kdop_axes array indices according to axis */
+  axis_t axis;                  /* KDOP type (6 => OBB, 7 => AABB, ...) */
+  char tree_type;               /* type of tree (4 => quad-tree). */
+  char use_packed;              /* Build the packed layout when balancing. */
+};
+
+/* optimization, ensure we stay small */
+BLI_STATIC_ASSERT((sizeof(void *) == 8 && sizeof(struct BVHTree) <= 64) ||
+                      (sizeof(void *) == 4 && sizeof(struct BVHTree) <= 40),
+                  "over sized")
+
+/* -------------------------------------------------------------------- */
+/** \name Packed 4-Wide Node Layout (`kdopbvh_packed.cc`)
+ *
+ * QBVH-style alternative layout of a balanced 4-ary tree. The axis-aligned
+ * bounds of all children of a branch are stored structure-of-arrays, so ray
+ * traversal performs one vectorized slab test against 4 child boxes instead
+ * of visiting nodes one at a time.
+ * \{ */
+
+typedef struct BVHTreePacked4Node {
+  /** Per-axis minimum/maximum of every child, `FLT_MAX`/`-FLT_MAX` for unused slots. */
+  float bv_min[3][4];
+  float bv_max[3][4];
+  /**
+   * Child references: values >= 0 index another packed node,
+   * negative values encode a leaf primitive index as `~index`.
+   */
+  int child[4];
+  int child_num;
+  int _pad[3]; /* Keep sizeof() a multiple of 16 for aligned SIMD loads. */
+} BVHTreePacked4Node;
+
+typedef struct BVHTreePacked4 {
+  BVHTreePacked4Node *nodes;
+  int node_num;
+} BVHTreePacked4;
+
+/**
+ * Build the packed layout from a balanced tree.
+ * Returns null for trees that can't be packed (not 4-ary, or the first k-DOP
+ * axes are not the three axis-aligned ones).
+ */
+BVHTreePacked4 *bvhtree_packed4_build(const struct BVHTree *tree);
+void bvhtree_packed4_free(BVHTreePacked4 *packed);
+
+/**
+ * Equivalent of the scalar raycast DFS over the packed layout. The ray
+ * `radius` is not supported, callers must use the scalar path for it.
+ */
+void bvhtree_packed4_ray_cast(const BVHTreePacked4 *packed,
+                              const BVHTreeRay *ray,
+                              BVHTreeRayHit *hit,
+                              BVHTree_RayCastCallback callback,
+                              void *userdata);
+
+/** \} */
+
+#ifdef __cplusplus
+}
+#endif
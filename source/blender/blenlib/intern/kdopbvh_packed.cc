@@ -0,0 +1,235 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ * \brief SIMD packed-node (QBVH style) layout for the k-DOP BVH-tree.
+ *
+ * Converts a balanced 4-ary #BVHTree into an array of #BVHTreePacked4Node,
+ * storing the axis-aligned bounds of all children of a branch
+ * structure-of-arrays. Ray traversal then performs the slab test against 4
+ * child boxes at once with SSE (or NEON through sse2neon) instead of
+ * visiting one node at a time. Without SIMD support a scalar loop over the
+ * packed bounds is used, which still benefits from the linear node layout.
+ */
+
+#include <cfloat>
+#include <cmath>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_math_base.h"
+#include "BLI_math_vector.h"
+#include "BLI_simd.hh"
+#include "BLI_utildefines.h"
+
+#include "kdopbvh_internal.h"
+
+/* -------------------------------------------------------------------- */
+/** \name Building
+ * \{ */
+
+static int packed4_build_recursive(BVHTreePacked4 *packed, int *node_count, const BVHNode *node)
+{
+  const int packed_index = (*node_count)++;
+  BVHTreePacked4Node *pnode = &packed->nodes[packed_index];
+
+  pnode->child_num = node->node_num;
+
+  for (int i = 0; i < 4; i++) {
+    if (i >= node->node_num) {
+      /* Unused slot, bounds that can never be hit. */
+      for (int axis = 0; axis < 3; axis++) {
+        pnode->bv_min[axis][i] = FLT_MAX;
+        pnode->bv_max[axis][i] = -FLT_MAX;
+      }
+      pnode->child[i] = 0;
+      continue;
+    }
+
+    const BVHNode *child = node->children[i];
+    for (int axis = 0; axis < 3; axis++) {
+      pnode->bv_min[axis][i] = child->bv[2 * axis];
+      pnode->bv_max[axis][i] = child->bv[2 * axis + 1];
+    }
+    if (child->node_num == 0) {
+      pnode->child[i] = ~child->index;
+    }
+    else {
+      /* NOTE: `pnode` may be invalidated here if nodes were reallocated,
+       * they are not: the array is allocated up-front from `branch_num`. */
+      pnode->child[i] = packed4_build_recursive(packed, node_count, child);
+    }
+  }
+
+  return packed_index;
+}
+
+BVHTreePacked4 *bvhtree_packed4_build(const BVHTree *tree)
+{
+  if (tree->tree_type != 4 || tree->start_axis != 0 || tree->branch_num == 0) {
+    return nullptr;
+  }
+  const BVHNode *root = tree->nodes[tree->leaf_num];
+  if (root == nullptr || root->node_num == 0) {
+    return nullptr;
+  }
+
+  BVHTreePacked4 *packed = MEM_cnew<BVHTreePacked4>(__func__);
+  packed->nodes = static_cast<BVHTreePacked4Node *>(MEM_mallocN_aligned(
+      sizeof(BVHTreePacked4Node) * size_t(tree->branch_num), 16, "BVHTreePacked4Node"));
+
+  int node_count = 0;
+  packed4_build_recursive(packed, &node_count, root);
+  BLI_assert(node_count <= tree->branch_num);
+  packed->node_num = node_count;
+
+  return packed;
+}
+
+void bvhtree_packed4_free(BVHTreePacked4 *packed)
+{
+  if (packed) {
+    MEM_freeN(packed->nodes);
+    MEM_freeN(packed);
+  }
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Ray Casting
+ * \{ */
+
+struct Packed4RayCastData {
+  const BVHTreePacked4 *packed;
+  BVHTree_RayCastCallback callback;
+  void *userdata;
+  const BVHTreeRay *ray;
+  BVHTreeRayHit *hit;
+
+  float idir[3];
+  /** True when the near plane of an axis is the maximum bound. */
+  int sign[3];
+};
+
+/**
+ * Slab test of the ray against the 4 child boxes of a packed node at once.
+ * Entry distances are written to \a tnear, the return value has \a tnear set
+ * to `FLT_MAX` for missed children (same convention as the scalar
+ * `fast_ray_nearest_hit`).
+ */
+static void packed4_ray_hit_dist(const Packed4RayCastData *data,
+                                 const BVHTreePacked4Node *node,
+                                 float tnear[4])
+{
+#if BLI_HAVE_SSE2
+  __m128 tmin = _mm_setzero_ps();
+  __m128 tmax = _mm_set1_ps(data->hit->dist);
+
+  for (int axis = 0; axis < 3; axis++) {
+    const __m128 bv_near = _mm_load_ps(data->sign[axis] ? node->bv_max[axis] :
+                                                          node->bv_min[axis]);
+    const __m128 bv_far = _mm_load_ps(data->sign[axis] ? node->bv_min[axis] :
+                                                         node->bv_max[axis]);
+    const __m128 origin = _mm_set1_ps(data->ray->origin[axis]);
+    const __m128 idir = _mm_set1_ps(data->idir[axis]);
+
+    tmin = _mm_max_ps(tmin, _mm_mul_ps(_mm_sub_ps(bv_near, origin), idir));
+    tmax = _mm_min_ps(tmax, _mm_mul_ps(_mm_sub_ps(bv_far, origin), idir));
+  }
+
+  const __m128 miss = _mm_cmpgt_ps(tmin, tmax);
+  /* Missed children get FLT_MAX, hit children keep their entry distance. */
+  const __m128 result = _mm_or_ps(_mm_and_ps(miss, _mm_set1_ps(FLT_MAX)),
+                                  _mm_andnot_ps(miss, tmin));
+  _mm_storeu_ps(tnear, result);
+#else
+  for (int i = 0; i < 4; i++) {
+    float tmin = 0.0f;
+    float tmax = data->hit->dist;
+    for (int axis = 0; axis < 3; axis++) {
+      const float bv_near = data->sign[axis] ? node->bv_max[axis][i] : node->bv_min[axis][i];
+      const float bv_far = data->sign[axis] ? node->bv_min[axis][i] : node->bv_max[axis][i];
+      tmin = max_ff(tmin, (bv_near - data->ray->origin[axis]) * data->idir[axis]);
+      tmax = min_ff(tmax, (bv_far - data->ray->origin[axis]) * data->idir[axis]);
+    }
+    tnear[i] = (tmin > tmax) ? FLT_MAX : tmin;
+  }
+#endif
+}
+
+static void packed4_dfs_raycast(Packed4RayCastData *data, const int node_index)
+{
+  const BVHTreePacked4Node *node = &data->packed->nodes[node_index];
+
+  float tnear[4];
+  packed4_ray_hit_dist(data, node, tnear);
+
+  /* Visit children nearest first, so close hits shrink the search distance
+   * before the farther boxes are entered. */
+  int order[4] = {0, 1, 2, 3};
+  for (int i = 1; i < node->child_num; i++) {
+    for (int j = i; j > 0 && tnear[order[j]] < tnear[order[j - 1]]; j--) {
+      SWAP(int, order[j], order[j - 1]);
+    }
+  }
+
+  for (int i = 0; i < node->child_num; i++) {
+    const int slot = order[i];
+    /* Re-check: the hit distance may have been shrunk by a previous child. */
+    if (tnear[slot] >= data->hit->dist) {
+      return;
+    }
+    const int child = node->child[slot];
+    if (child < 0) {
+      /* Leaf. */
+      if (data->callback) {
+        data->callback(data->userdata, ~child, data->ray, data->hit);
+      }
+      else {
+        data->hit->index = ~child;
+        data->hit->dist = tnear[slot];
+        madd_v3_v3v3fl(data->hit->co, data->ray->origin, data->ray->direction, tnear[slot]);
+      }
+    }
+    else {
+      packed4_dfs_raycast(data, child);
+    }
+  }
+}
+
+void bvhtree_packed4_ray_cast(const BVHTreePacked4 *packed,
+                              const BVHTreeRay *ray,
+                              BVHTreeRayHit *hit,
+                              BVHTree_RayCastCallback callback,
+                              void *userdata)
+{
+  BLI_assert(ray->radius == 0.0f);
+
+  Packed4RayCastData data;
+  data.packed = packed;
+  data.callback = callback;
+  data.userdata = userdata;
+  data.ray = ray;
+  data.hit = hit;
+
+  for (int axis = 0; axis < 3; axis++) {
+    const float dot = ray->direction[axis];
+    if (fabsf(dot) < FLT_EPSILON) {
+      /* Matches the scalar pre-calculation: huge finite value instead of
+       * infinity, so `0.0 * idir` stays finite. Sign is not important. */
+      data.idir[axis] = FLT_MAX;
+      data.sign[axis] = 0;
+    }
+    else {
+      data.idir[axis] = 1.0f / dot;
+      data.sign[axis] = (dot < 0.0f) ? 1 : 0;
+    }
+  }
+
+  packed4_dfs_raycast(&data, 0);
+}
+
+/** \} */
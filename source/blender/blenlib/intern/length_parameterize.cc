@@ -7,6 +7,45 @@
 
 namespace blender::length_parameterize {
 
+/**
+ * Find the segment indices and factors for a range of sorted sample lengths. Because the samples
+ * increase monotonically, every sample can continue scanning forward from the segment found for
+ * the previous one instead of running a binary search. A single binary search positions the scan
+ * at the start of the range. This makes sampling many short curves (e.g. resampling hair strands)
+ * linear in the number of segments and samples.
+ *
+ * \param sample_length_fn: Returns the sorted sample length for an index in \a range.
+ */
+template<typename SampleLengthFn>
+inline void sample_sorted_lengths(const Span<float> lengths,
+                                  const IndexRange range,
+                                  const SampleLengthFn sample_length_fn,
+                                  MutableSpan<int> r_segment_indices,
+                                  MutableSpan<float> r_factors)
+{
+  const float total_length = lengths.last();
+  const float first_sample_length = sample_length_fn(int(range.first()));
+  int segment_index = int(std::upper_bound(lengths.begin(), lengths.end(), first_sample_length) -
+                          lengths.begin());
+  for (const int i : range) {
+    const float sample_length = sample_length_fn(i);
+    if (sample_length >= total_length) {
+      /* Return the last position on the last segment. */
+      r_segment_indices[i] = int(lengths.size()) - 1;
+      r_factors[i] = 1.0f;
+      continue;
+    }
+    while (lengths[segment_index] <= sample_length) {
+      segment_index++;
+    }
+    const float segment_start = segment_index == 0 ? 0.0f : lengths[segment_index - 1];
+    const float segment_length = lengths[segment_index] - segment_start;
+    const float segment_length_inv = math::safe_divide(1.0f, segment_length);
+    r_segment_indices[i] = segment_index;
+    r_factors[i] = (sample_length - segment_start) * segment_length_inv;
+  }
+}
+
 void sample_uniform(const Span<float> accumulated_segment_lengths,
                     const bool include_last_point,
                     MutableSpan<int> r_segment_indices,
@@ -26,13 +65,13 @@ void sample_uniform(const Span<float> accumulated_segment_lengths,
   const float total_length = accumulated_segment_lengths.last();
   const float step_length = total_length / (count - include_last_point);
   threading::parallel_for(IndexRange(count), 512, [&](const IndexRange range) {
-    SampleSegmentHint hint;
-    for (const int i : range) {
-      /* Use minimum to avoid issues with floating point accuracy. */
-      const float sample_length = std::min(total_length, i * step_length);
-      sample_at_length(
-          accumulated_segment_lengths, sample_length, r_segment_indices[i], r_factors[i], &hint);
-    }
+    sample_sorted_lengths(
+        accumulated_segment_lengths,
+        range,
+        /* Use minimum to avoid issues with floating point accuracy. */
+        [&](const int i) { return std::min(total_length, i * step_length); },
+        r_segment_indices,
+        r_factors);
   });
 }
 
@@ -50,12 +89,12 @@ void sample_at_lengths(const Span<float> accumulated_segment_lengths,
   BLI_assert(count == r_factors.size());
 
   threading::parallel_for(IndexRange(count), 512, [&](const IndexRange range) {
-    SampleSegmentHint hint;
-    for (const int i : range) {
-      const float sample_length = sample_lengths[i];
-      sample_at_length(
-          accumulated_segment_lengths, sample_length, r_segment_indices[i], r_factors[i], &hint);
-    }
+    sample_sorted_lengths(
+        accumulated_segment_lengths,
+        range,
+        [&](const int i) { return sample_lengths[i]; },
+        r_segment_indices,
+        r_factors);
   });
 }
 
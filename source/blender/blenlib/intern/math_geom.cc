@@ -15,6 +15,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_simd.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_strict_flags.h" /* Keep last. */
@@ -1697,6 +1698,119 @@ bool isect_ray_tri_v3(const float ray_origin[3],
   return true;
 }
 
+#if BLI_HAVE_SSE2
+
+/** Gather one component of 4 consecutive 3D vectors into a SIMD register. */
+BLI_INLINE __m128 math_geom_gather4_ps(const float (*v)[3], const int i, const int c)
+{
+  return _mm_set_ps(v[i + 3][c], v[i + 2][c], v[i + 1][c], v[i + 0][c]);
+}
+
+BLI_INLINE __m128 math_geom_dot3_ps(const __m128 a[3], const __m128 b[3])
+{
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])),
+                    _mm_mul_ps(a[2], b[2]));
+}
+
+BLI_INLINE void math_geom_cross3_ps(__m128 r[3], const __m128 a[3], const __m128 b[3])
+{
+  r[0] = _mm_sub_ps(_mm_mul_ps(a[1], b[2]), _mm_mul_ps(a[2], b[1]));
+  r[1] = _mm_sub_ps(_mm_mul_ps(a[2], b[0]), _mm_mul_ps(a[0], b[2]));
+  r[2] = _mm_sub_ps(_mm_mul_ps(a[0], b[1]), _mm_mul_ps(a[1], b[0]));
+}
+
+/** Per-lane `mask ? a : b`. */
+BLI_INLINE __m128 math_geom_select_ps(const __m128 mask, const __m128 a, const __m128 b)
+{
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+#endif /* BLI_HAVE_SSE2 */
+
+void isect_ray_tri_v3_batch(const float ray_origin[3],
+                            const float ray_direction[3],
+                            const float (*v0)[3],
+                            const float (*v1)[3],
+                            const float (*v2)[3],
+                            const int len,
+                            bool *r_hit,
+                            float *r_lambda,
+                            float (*r_uv)[2])
+{
+  int i = 0;
+#if BLI_HAVE_SSE2
+  /* The same arithmetic as #isect_ray_tri_v3, evaluated for 4 triangles per iteration with the
+   * early-exit conditions turned into lane masks. Keep in sync with the scalar version. */
+  const float epsilon = 0.00000001f;
+  const __m128 epsilon4 = _mm_set1_ps(epsilon);
+  const __m128 neg_epsilon4 = _mm_set1_ps(-epsilon);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  __m128 origin[3], dir[3];
+  for (int c = 0; c < 3; c++) {
+    origin[c] = _mm_set1_ps(ray_origin[c]);
+    dir[c] = _mm_set1_ps(ray_direction[c]);
+  }
+
+  for (; i + 4 <= len; i += 4) {
+    __m128 e1[3], e2[3], s[3];
+    for (int c = 0; c < 3; c++) {
+      const __m128 a = math_geom_gather4_ps(v0, i, c);
+      e1[c] = _mm_sub_ps(math_geom_gather4_ps(v1, i, c), a);
+      e2[c] = _mm_sub_ps(math_geom_gather4_ps(v2, i, c), a);
+      s[c] = _mm_sub_ps(origin[c], a);
+    }
+
+    __m128 p[3], q[3];
+    math_geom_cross3_ps(p, dir, e2);
+    const __m128 a = math_geom_dot3_ps(e1, p);
+    /* Lanes with `-epsilon < a < epsilon` miss. */
+    __m128 valid = _mm_or_ps(_mm_cmple_ps(a, neg_epsilon4), _mm_cmpge_ps(a, epsilon4));
+
+    const __m128 f = _mm_div_ps(one, a);
+    const __m128 u = _mm_mul_ps(f, math_geom_dot3_ps(s, p));
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+    math_geom_cross3_ps(q, s, e1);
+    const __m128 v = _mm_mul_ps(f, math_geom_dot3_ps(dir, q));
+    valid = _mm_and_ps(
+        valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+    const __m128 lambda = _mm_mul_ps(f, math_geom_dot3_ps(e2, q));
+    valid = _mm_and_ps(valid, _mm_cmpge_ps(lambda, zero));
+
+    float lambda_lanes[4], u_lanes[4], v_lanes[4];
+    _mm_storeu_ps(lambda_lanes, lambda);
+    _mm_storeu_ps(u_lanes, u);
+    _mm_storeu_ps(v_lanes, v);
+    const int hit_mask = _mm_movemask_ps(valid);
+    for (int lane = 0; lane < 4; lane++) {
+      const bool hit = (hit_mask & (1 << lane)) != 0;
+      r_hit[i + lane] = hit;
+      if (hit) {
+        r_lambda[i + lane] = lambda_lanes[lane];
+        if (r_uv) {
+          r_uv[i + lane][0] = u_lanes[lane];
+          r_uv[i + lane][1] = v_lanes[lane];
+        }
+      }
+    }
+  }
+#endif /* BLI_HAVE_SSE2 */
+  for (; i < len; i++) {
+    float lambda;
+    float uv[2];
+    const bool hit = isect_ray_tri_v3(ray_origin, ray_direction, v0[i], v1[i], v2[i], &lambda, uv);
+    r_hit[i] = hit;
+    if (hit) {
+      r_lambda[i] = lambda;
+      if (r_uv) {
+        copy_v2_v2(r_uv[i], uv);
+      }
+    }
+  }
+}
+
 bool isect_ray_plane_v3_factor(const float ray_origin[3],
                                const float ray_direction[3],
                                const float plane_co[3],
@@ -3608,6 +3722,108 @@ void interp_weights_tri_v3(
   barycentric_weights(v1, v2, v3, co, n, w);
 }
 
+void interp_weights_tri_v3_batch(float (*r_w)[3],
+                                 const float (*v1)[3],
+                                 const float (*v2)[3],
+                                 const float (*v3)[3],
+                                 const float (*co)[3],
+                                 const int len)
+{
+  int i = 0;
+#if BLI_HAVE_SSE2
+  /* The same arithmetic as #barycentric_weights, evaluated for 4 triangles per iteration. The
+   * per-triangle dominant axis selection is done with lane masks. Keep in sync with the scalar
+   * version. */
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 half = _mm_set1_ps(0.5f);
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 third = _mm_set1_ps(1.0f / 3.0f);
+  const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+  for (; i + 4 <= len; i += 4) {
+    __m128 a[3], b[3], c[3], p[3];
+    for (int k = 0; k < 3; k++) {
+      a[k] = math_geom_gather4_ps(v1, i, k);
+      b[k] = math_geom_gather4_ps(v2, i, k);
+      c[k] = math_geom_gather4_ps(v3, i, k);
+      p[k] = math_geom_gather4_ps(co, i, k);
+    }
+
+    /* Unnormalized triangle normal (see #normal_tri_v3). The normalization is skipped because it
+     * does not change which axis dominates. */
+    __m128 n1[3], n2[3], n[3];
+    for (int k = 0; k < 3; k++) {
+      n1[k] = _mm_sub_ps(a[k], b[k]);
+      n2[k] = _mm_sub_ps(b[k], c[k]);
+    }
+    math_geom_cross3_ps(n, n1, n2);
+
+    /* Per-lane #axis_dominant_v3. */
+    const __m128 xn = _mm_and_ps(n[0], abs_mask);
+    const __m128 yn = _mm_and_ps(n[1], abs_mask);
+    const __m128 zn = _mm_and_ps(n[2], abs_mask);
+    const __m128 use_xy = _mm_and_ps(_mm_cmpge_ps(zn, xn), _mm_cmpge_ps(zn, yn));
+    const __m128 use_yz = _mm_andnot_ps(
+        use_xy, _mm_andnot_ps(_mm_and_ps(_mm_cmpge_ps(yn, xn), _mm_cmpge_ps(yn, zn)),
+                              _mm_castsi128_ps(_mm_set1_epi32(-1))));
+
+    /* Select the two dominant-plane components of every point per lane. */
+    __m128 ai, aj, bi, bj, ci, cj, pi, pj;
+    ai = math_geom_select_ps(use_yz, a[1], a[0]);
+    bi = math_geom_select_ps(use_yz, b[1], b[0]);
+    ci = math_geom_select_ps(use_yz, c[1], c[0]);
+    pi = math_geom_select_ps(use_yz, p[1], p[0]);
+    aj = math_geom_select_ps(use_xy, a[1], a[2]);
+    bj = math_geom_select_ps(use_xy, b[1], b[2]);
+    cj = math_geom_select_ps(use_xy, c[1], c[2]);
+    pj = math_geom_select_ps(use_xy, p[1], p[2]);
+
+    /* Per-lane #tri_signed_area for the three sub-triangles. */
+    auto signed_area = [&](const __m128 v1i,
+                           const __m128 v1j,
+                           const __m128 v2i,
+                           const __m128 v2j,
+                           const __m128 v3i,
+                           const __m128 v3j) {
+      return _mm_mul_ps(half,
+                        _mm_add_ps(_mm_mul_ps(_mm_sub_ps(v1i, v2i), _mm_sub_ps(v2j, v3j)),
+                                   _mm_mul_ps(_mm_sub_ps(v1j, v2j), _mm_sub_ps(v3i, v2i))));
+    };
+    __m128 w0 = signed_area(bi, bj, ci, cj, pi, pj);
+    __m128 w1 = signed_area(ci, cj, ai, aj, pi, pj);
+    __m128 w2 = signed_area(ai, aj, bi, bj, pi, pj);
+
+    const __m128 wtot = _mm_add_ps(_mm_add_ps(w0, w1), w2);
+    const __m128 inv_wtot = _mm_div_ps(one, wtot);
+    w0 = _mm_mul_ps(w0, inv_wtot);
+    w1 = _mm_mul_ps(w1, inv_wtot);
+    w2 = _mm_mul_ps(w2, inv_wtot);
+
+    /* Zero area triangles produce non-finite weights, fall back to 1/3 (see
+     * #barycentric_weights). A float is finite exactly when `x - x == 0`. */
+    __m128 finite = _mm_cmpeq_ps(_mm_sub_ps(w0, w0), zero);
+    finite = _mm_and_ps(finite, _mm_cmpeq_ps(_mm_sub_ps(w1, w1), zero));
+    finite = _mm_and_ps(finite, _mm_cmpeq_ps(_mm_sub_ps(w2, w2), zero));
+    w0 = math_geom_select_ps(finite, w0, third);
+    w1 = math_geom_select_ps(finite, w1, third);
+    w2 = math_geom_select_ps(finite, w2, third);
+
+    float w0_lanes[4], w1_lanes[4], w2_lanes[4];
+    _mm_storeu_ps(w0_lanes, w0);
+    _mm_storeu_ps(w1_lanes, w1);
+    _mm_storeu_ps(w2_lanes, w2);
+    for (int lane = 0; lane < 4; lane++) {
+      r_w[i + lane][0] = w0_lanes[lane];
+      r_w[i + lane][1] = w1_lanes[lane];
+      r_w[i + lane][2] = w2_lanes[lane];
+    }
+  }
+#endif /* BLI_HAVE_SSE2 */
+  for (; i < len; i++) {
+    interp_weights_tri_v3(r_w[i], v1[i], v2[i], v3[i], co[i]);
+  }
+}
+
 void interp_weights_quad_v3(float w[4],
                             const float v1[3],
                             const float v2[3],
@@ -4,6 +4,7 @@
 
 #include "BLI_array.hh"
 #include "BLI_linear_allocator.hh"
+#include "BLI_math_bits.h"
 #include "BLI_multi_value_map.hh"
 #include "BLI_span.hh"
 #include "BLI_string.h"
@@ -479,6 +480,26 @@ void extract_normalized_words(StringRef str,
   }
 }
 
+/**
+ * Hashes every unicode code point in the string into one of 64 buckets. The resulting masks are
+ * used to reject items that can't match a query word before the more expensive matching runs.
+ */
+static uint64_t compute_char_mask(const StringRef str)
+{
+  uint64_t mask = 0;
+  size_t offset = 0;
+  while (offset < size_t(str.size())) {
+    const uint32_t unicode = BLI_str_utf8_as_unicode_step_safe(str.data(), str.size(), &offset);
+    mask |= uint64_t(1) << (unicode & 63);
+  }
+  return mask;
+}
+
+static int count_bits_u64(const uint64_t x)
+{
+  return count_bits_i(uint32_t(x)) + count_bits_i(uint32_t(x >> 32));
+}
+
 void StringSearchBase::add_impl(const StringRef str, void *user_data, const float weight)
 {
   Vector<StringRef, 64> words;
@@ -516,12 +537,18 @@ void StringSearchBase::add_impl(const StringRef str, void *user_data, const floa
   /* Not checking for the "D" to avoid problems with upper/lower-case. */
   const bool is_deprecated = str.find("eprecated") != StringRef::not_found;
 
+  uint64_t char_mask = 0;
+  for (const StringRef word : words) {
+    char_mask |= compute_char_mask(word);
+  }
+
   items_.append({user_data,
                  allocator_.construct_array_copy(words.as_span()),
                  allocator_.construct_array_copy(word_group_ids.as_span()),
                  main_group_id,
                  main_group_length,
                  int(str.size()),
+                 char_mask,
                  weight,
                  recent_time,
                  is_deprecated});
@@ -535,11 +562,38 @@ Vector<void *> StringSearchBase::query_impl(const StringRef query) const
   Vector<int, 64> word_group_ids;
   string_search::extract_normalized_words(query, allocator, query_words, word_group_ids);
 
+  /* Precompute a character mask and error allowance per query word. An item can only match if,
+   * for every query word, at most a few of its characters are missing from the item (the fuzzy
+   * matching tolerates a limited number of errors). Comparing the masks rejects most items with a
+   * few bit operations before the expensive per-word matching runs. */
+  Array<uint64_t, 16> query_word_masks(query_words.size());
+  Array<int, 16> query_word_max_missing(query_words.size());
+  for (const int i : query_words.index_range()) {
+    query_word_masks[i] = compute_char_mask(query_words[i]);
+    /* Keep in sync with the max error count in #get_fuzzy_match_errors. Every tolerated error can
+     * account for at most one missing character, both in the query and in the matched window. */
+    const int max_errors = int(count_utf8_code_points(query_words[i])) / 8 + 1;
+    query_word_max_missing[i] = 2 * max_errors;
+  }
+
   /* Compute score of every result. */
   Array<std::optional<float>> all_scores(items_.size());
   threading::parallel_for(items_.index_range(), 256, [&](const IndexRange range) {
     for (const int i : range) {
       const SearchItem &item = items_[i];
+      bool can_match = true;
+      for (const int word_i : query_words.index_range()) {
+        const uint64_t missing_mask = query_word_masks[word_i] & ~item.char_mask;
+        /* Every missing bucket corresponds to at least one missing character. */
+        if (count_bits_u64(missing_mask) > query_word_max_missing[word_i]) {
+          can_match = false;
+          break;
+        }
+      }
+      if (!can_match) {
+        all_scores[i] = std::nullopt;
+        continue;
+      }
       const std::optional<float> score = string_search::score_query_against_words(query_words,
                                                                                   item);
       all_scores[i] = score;
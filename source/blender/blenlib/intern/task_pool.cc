@@ -9,6 +9,7 @@
  */
 
 #include <cstdlib>
+#include <deque>
 #include <memory>
 #include <utility>
 
@@ -143,6 +144,27 @@ enum TaskPoolType {
   TASK_POOL_NO_THREADS,
   TASK_POOL_BACKGROUND,
   TASK_POOL_BACKGROUND_SERIAL,
+  TASK_POOL_WORK_STEALING,
+};
+
+/* Work-stealing task pool.
+ *
+ * Per-thread deque of tasks, protected by its own spin lock. Workers pop from
+ * the back of their own deque (LIFO, for cache locality of recently spawned
+ * tasks) and steal from the front of other deques (FIFO, to take the oldest
+ * and typically largest remaining work). One extra deque is reserved for
+ * threads that push tasks without being workers themselves, like the main
+ * thread. */
+
+struct WorkStealingDeque {
+  SpinLock lock;
+  std::deque<Task *> *tasks;
+};
+
+struct WorkStealingThread {
+  TaskPool *pool;
+  /* Index of this worker's own deque in TaskPool.ws_deques. */
+  int index;
 };
 
 struct TaskPool {
@@ -163,6 +185,18 @@ struct TaskPool {
   ListBase background_threads;
   ThreadQueue *background_queue;
   volatile bool background_is_canceling;
+
+  /* Work-stealing task pool. */
+  WorkStealingDeque *ws_deques;
+  WorkStealingThread *ws_thread_data;
+  int ws_threads_num;
+  ListBase ws_threads;
+  ThreadMutex ws_mutex;
+  ThreadCondition ws_condition;
+  /* Number of pushed tasks that did not finish execution yet, protected by ws_mutex. */
+  int ws_pending_num;
+  volatile bool ws_exit;
+  volatile bool ws_is_canceling;
 };
 
 /* Execute task. */
@@ -354,6 +388,244 @@ static void background_task_pool_free(TaskPool *pool)
   BLI_thread_queue_free(pool->background_queue);
 }
 
+/* Work-Stealing Task Pool.
+ *
+ * Native work-stealing scheduler for fine-grained tasks. Instead of a single
+ * shared queue, every worker thread owns a deque and only synchronizes with
+ * other threads when its own deque runs empty, avoiding contention on one
+ * lock when thousands of small tasks are pushed. */
+
+/* Deque that the current thread pushes to and pops from, when it is a worker
+ * thread of a work-stealing pool. */
+static thread_local TaskPool *ws_current_pool = nullptr;
+static thread_local int ws_current_index = 0;
+
+/* Index of the deque that the current thread owns, the shared external deque
+ * is used for threads that are not workers of this pool. */
+static int ws_task_pool_thread_index(const TaskPool *pool)
+{
+  return (ws_current_pool == pool) ? ws_current_index : pool->ws_threads_num;
+}
+
+static Task *ws_task_pool_pop_or_steal(TaskPool *pool, const int index)
+{
+  /* LIFO pop from this thread's own deque. */
+  WorkStealingDeque &own_deque = pool->ws_deques[index];
+  BLI_spin_lock(&own_deque.lock);
+  if (!own_deque.tasks->empty()) {
+    Task *task = own_deque.tasks->back();
+    own_deque.tasks->pop_back();
+    BLI_spin_unlock(&own_deque.lock);
+    return task;
+  }
+  BLI_spin_unlock(&own_deque.lock);
+
+  /* FIFO steal from the other deques, including the external one. */
+  const int deques_num = pool->ws_threads_num + 1;
+  for (int i = 1; i < deques_num; i++) {
+    WorkStealingDeque &victim_deque = pool->ws_deques[(index + i) % deques_num];
+    BLI_spin_lock(&victim_deque.lock);
+    if (!victim_deque.tasks->empty()) {
+      Task *task = victim_deque.tasks->front();
+      victim_deque.tasks->pop_front();
+      BLI_spin_unlock(&victim_deque.lock);
+      return task;
+    }
+    BLI_spin_unlock(&victim_deque.lock);
+  }
+
+  return nullptr;
+}
+
+static void ws_task_pool_execute(TaskPool *pool, Task *task)
+{
+  (*task)();
+  task->~Task();
+  MEM_freeN(task);
+
+  BLI_mutex_lock(&pool->ws_mutex);
+  pool->ws_pending_num--;
+  if (pool->ws_pending_num == 0) {
+    BLI_condition_notify_all(&pool->ws_condition);
+  }
+  BLI_mutex_unlock(&pool->ws_mutex);
+}
+
+static void *ws_task_run(void *userdata)
+{
+  WorkStealingThread *thread = (WorkStealingThread *)userdata;
+  TaskPool *pool = thread->pool;
+
+  ws_current_pool = pool;
+  ws_current_index = thread->index;
+
+  while (true) {
+    if (Task *task = ws_task_pool_pop_or_steal(pool, thread->index)) {
+      ws_task_pool_execute(pool, task);
+      continue;
+    }
+
+    BLI_mutex_lock(&pool->ws_mutex);
+    if (pool->ws_exit) {
+      BLI_mutex_unlock(&pool->ws_mutex);
+      break;
+    }
+    BLI_condition_wait(&pool->ws_condition, &pool->ws_mutex);
+    BLI_mutex_unlock(&pool->ws_mutex);
+  }
+
+  ws_current_pool = nullptr;
+  ws_current_index = 0;
+
+  return nullptr;
+}
+
+static void ws_task_pool_create(TaskPool *pool, eTaskPriority /*priority*/)
+{
+  if (!pool->use_threads) {
+    return;
+  }
+
+  pool->ws_threads_num = BLI_task_scheduler_num_threads();
+
+  const int deques_num = pool->ws_threads_num + 1;
+  pool->ws_deques = MEM_cnew_array<WorkStealingDeque>(deques_num, __func__);
+  for (int i = 0; i < deques_num; i++) {
+    BLI_spin_init(&pool->ws_deques[i].lock);
+    pool->ws_deques[i].tasks = MEM_new<std::deque<Task *>>(__func__);
+  }
+
+  BLI_mutex_init(&pool->ws_mutex);
+  BLI_condition_init(&pool->ws_condition);
+
+  pool->ws_thread_data = MEM_cnew_array<WorkStealingThread>(pool->ws_threads_num, __func__);
+  BLI_threadpool_init(&pool->ws_threads, ws_task_run, pool->ws_threads_num);
+  for (int i = 0; i < pool->ws_threads_num; i++) {
+    pool->ws_thread_data[i].pool = pool;
+    pool->ws_thread_data[i].index = i;
+    BLI_threadpool_insert(&pool->ws_threads, &pool->ws_thread_data[i]);
+  }
+}
+
+static void ws_task_pool_run(TaskPool *pool, Task &&task)
+{
+  if (!pool->use_threads) {
+    /* Execute immediately. */
+    task();
+    return;
+  }
+
+  Task *task_mem = (Task *)MEM_mallocN(sizeof(Task), __func__);
+  new (task_mem) Task(std::move(task));
+
+  /* Count the task as pending before it becomes visible to other threads, so
+   * that work_and_wait() can not miss it. */
+  BLI_mutex_lock(&pool->ws_mutex);
+  pool->ws_pending_num++;
+  BLI_mutex_unlock(&pool->ws_mutex);
+
+  WorkStealingDeque &deque = pool->ws_deques[ws_task_pool_thread_index(pool)];
+  BLI_spin_lock(&deque.lock);
+  deque.tasks->push_back(task_mem);
+  BLI_spin_unlock(&deque.lock);
+
+  BLI_condition_notify_one(&pool->ws_condition);
+}
+
+static void ws_task_pool_work_and_wait(TaskPool *pool)
+{
+  if (!pool->use_threads) {
+    return;
+  }
+
+  /* The calling thread participates in execution instead of blocking, so
+   * recursive usage of pools does not run out of threads and get stuck. */
+  const int index = ws_task_pool_thread_index(pool);
+
+  while (true) {
+    if (Task *task = ws_task_pool_pop_or_steal(pool, index)) {
+      ws_task_pool_execute(pool, task);
+      continue;
+    }
+
+    BLI_mutex_lock(&pool->ws_mutex);
+    if (pool->ws_pending_num == 0) {
+      BLI_mutex_unlock(&pool->ws_mutex);
+      break;
+    }
+    /* Tasks are still running on worker threads and may spawn new ones, wait
+     * until either happens. */
+    BLI_condition_wait(&pool->ws_condition, &pool->ws_mutex);
+    BLI_mutex_unlock(&pool->ws_mutex);
+  }
+}
+
+static void ws_task_pool_cancel(TaskPool *pool)
+{
+  if (!pool->use_threads) {
+    return;
+  }
+
+  pool->ws_is_canceling = true;
+
+  /* Remove tasks not yet picked up by any thread. */
+  const int deques_num = pool->ws_threads_num + 1;
+  int removed_num = 0;
+  for (int i = 0; i < deques_num; i++) {
+    WorkStealingDeque &deque = pool->ws_deques[i];
+    BLI_spin_lock(&deque.lock);
+    for (Task *task : *deque.tasks) {
+      task->~Task();
+      MEM_freeN(task);
+      removed_num++;
+    }
+    deque.tasks->clear();
+    BLI_spin_unlock(&deque.lock);
+  }
+
+  BLI_mutex_lock(&pool->ws_mutex);
+  pool->ws_pending_num -= removed_num;
+  /* Wait for tasks that already started to finish or cancel themselves. */
+  while (pool->ws_pending_num != 0) {
+    BLI_condition_wait(&pool->ws_condition, &pool->ws_mutex);
+  }
+  BLI_mutex_unlock(&pool->ws_mutex);
+
+  pool->ws_is_canceling = false;
+}
+
+static bool ws_task_pool_canceled(TaskPool *pool)
+{
+  return pool->ws_is_canceling;
+}
+
+static void ws_task_pool_free(TaskPool *pool)
+{
+  if (!pool->use_threads) {
+    return;
+  }
+
+  ws_task_pool_work_and_wait(pool);
+
+  BLI_mutex_lock(&pool->ws_mutex);
+  pool->ws_exit = true;
+  BLI_condition_notify_all(&pool->ws_condition);
+  BLI_mutex_unlock(&pool->ws_mutex);
+
+  BLI_threadpool_end(&pool->ws_threads);
+
+  const int deques_num = pool->ws_threads_num + 1;
+  for (int i = 0; i < deques_num; i++) {
+    BLI_spin_end(&pool->ws_deques[i].lock);
+    MEM_delete(pool->ws_deques[i].tasks);
+  }
+  MEM_freeN(pool->ws_deques);
+  MEM_freeN(pool->ws_thread_data);
+
+  BLI_condition_end(&pool->ws_condition);
+  BLI_mutex_end(&pool->ws_mutex);
+}
+
 /* Task Pool */
 
 static TaskPool *task_pool_create_ex(void *userdata, TaskPoolType type, eTaskPriority priority)
@@ -386,6 +658,9 @@ static TaskPool *task_pool_create_ex(void *userdata, TaskPoolType type, eTaskPri
     case TASK_POOL_BACKGROUND_SERIAL:
       background_task_pool_create(pool);
       break;
+    case TASK_POOL_WORK_STEALING:
+      ws_task_pool_create(pool, priority);
+      break;
   }
 
   return pool;
@@ -418,6 +693,14 @@ TaskPool *BLI_task_pool_create_suspended(void *userdata, eTaskPriority priority)
   return task_pool_create_ex(userdata, TASK_POOL_TBB_SUSPENDED, priority);
 }
 
+TaskPool *BLI_task_pool_create_work_stealing(void *userdata, eTaskPriority priority)
+{
+  /* NOTE: Unlike #BLI_task_pool_create() this does not share worker threads
+   * with the TBB scheduler, so it should only be used for pools that push
+   * many fine-grained tasks and become bottle-necked on the shared queue. */
+  return task_pool_create_ex(userdata, TASK_POOL_WORK_STEALING, priority);
+}
+
 TaskPool *BLI_task_pool_create_no_threads(void *userdata)
 {
   return task_pool_create_ex(userdata, TASK_POOL_NO_THREADS, TASK_PRIORITY_HIGH);
@@ -440,6 +723,9 @@ void BLI_task_pool_free(TaskPool *pool)
     case TASK_POOL_BACKGROUND_SERIAL:
       background_task_pool_free(pool);
       break;
+    case TASK_POOL_WORK_STEALING:
+      ws_task_pool_free(pool);
+      break;
   }
 
   BLI_mutex_end(&pool->user_mutex);
@@ -465,6 +751,9 @@ void BLI_task_pool_push(TaskPool *pool,
     case TASK_POOL_BACKGROUND_SERIAL:
       background_task_pool_run(pool, std::move(task));
       break;
+    case TASK_POOL_WORK_STEALING:
+      ws_task_pool_run(pool, std::move(task));
+      break;
   }
 }
 
@@ -480,6 +769,9 @@ void BLI_task_pool_work_and_wait(TaskPool *pool)
     case TASK_POOL_BACKGROUND_SERIAL:
       background_task_pool_work_and_wait(pool);
       break;
+    case TASK_POOL_WORK_STEALING:
+      ws_task_pool_work_and_wait(pool);
+      break;
   }
 }
 
@@ -495,6 +787,9 @@ void BLI_task_pool_cancel(TaskPool *pool)
     case TASK_POOL_BACKGROUND_SERIAL:
       background_task_pool_cancel(pool);
       break;
+    case TASK_POOL_WORK_STEALING:
+      ws_task_pool_cancel(pool);
+      break;
   }
 }
 
@@ -508,6 +803,8 @@ bool BLI_task_pool_current_canceled(TaskPool *pool)
     case TASK_POOL_BACKGROUND:
     case TASK_POOL_BACKGROUND_SERIAL:
       return background_task_pool_canceled(pool);
+    case TASK_POOL_WORK_STEALING:
+      return ws_task_pool_canceled(pool);
   }
   BLI_assert_msg(0, "BLI_task_pool_canceled: Control flow should not come here!");
   return false;
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_fileops.h"
+#include "BLI_trace.hh"
+
+namespace blender::trace {
+
+enum class Phase : char {
+  Begin = 'B',
+  End = 'E',
+};
+
+struct TraceEvent {
+  /** Statically allocated string, null while the slot has not been written yet. */
+  const char *name;
+  uint64_t time_us;
+  uint32_t thread_id;
+  Phase phase;
+};
+
+/* Must be a power of two. 64k events cover several seconds of typical main-loop spans. */
+static constexpr uint64_t events_capacity = 1 << 16;
+
+static std::atomic<bool> trace_enabled = false;
+/** Total number of recorded events, the slot is `index & (events_capacity - 1)`. */
+static std::atomic<uint64_t> write_index = 0;
+static TraceEvent *events = nullptr;
+
+static uint64_t time_now_us()
+{
+  using namespace std::chrono;
+  return uint64_t(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t thread_id_get()
+{
+  static std::atomic<uint32_t> next_thread_id = 1;
+  static thread_local uint32_t thread_id = next_thread_id.fetch_add(1);
+  return thread_id;
+}
+
+static void record_event(const char *name, const Phase phase)
+{
+  const uint64_t index = write_index.fetch_add(1, std::memory_order_relaxed);
+  TraceEvent &event = events[index & (events_capacity - 1)];
+  event.name = name;
+  event.time_us = time_now_us();
+  event.thread_id = thread_id_get();
+  event.phase = phase;
+}
+
+bool is_enabled()
+{
+  return trace_enabled.load(std::memory_order_relaxed);
+}
+
+void enable()
+{
+  if (events == nullptr) {
+    /* Kept allocated until exit, re-enabling continues into the same buffer. */
+    events = MEM_cnew_array<TraceEvent>(events_capacity, __func__);
+  }
+  trace_enabled.store(true, std::memory_order_release);
+}
+
+void disable()
+{
+  trace_enabled.store(false, std::memory_order_relaxed);
+}
+
+void record_begin(const char *name)
+{
+  if (LIKELY(!is_enabled())) {
+    return;
+  }
+  record_event(name, Phase::Begin);
+}
+
+void record_end(const char *name)
+{
+  if (LIKELY(!is_enabled())) {
+    return;
+  }
+  record_event(name, Phase::End);
+}
+
+bool dump_to_file(const StringRefNull filepath)
+{
+  if (events == nullptr) {
+    return false;
+  }
+
+  /* Pause recording while walking the buffer. Events recorded by threads that already passed the
+   * enabled check may still trickle in, the ring is large enough that they only touch slots far
+   * from the ones being read. */
+  const bool was_enabled = is_enabled();
+  disable();
+
+  FILE *file = BLI_fopen(filepath.c_str(), "wb");
+  if (file == nullptr) {
+    if (was_enabled) {
+      enable();
+    }
+    return false;
+  }
+
+  const uint64_t total = write_index.load(std::memory_order_acquire);
+  const uint64_t first = (total > events_capacity) ? total - events_capacity : 0;
+
+  fprintf(file, "{\"traceEvents\":[\n");
+  bool is_first_row = true;
+  for (uint64_t index = first; index < total; index++) {
+    const TraceEvent &event = events[index & (events_capacity - 1)];
+    if (event.name == nullptr) {
+      continue;
+    }
+    fprintf(file,
+            "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%u}",
+            is_first_row ? "" : ",\n",
+            event.name,
+            char(event.phase),
+            (unsigned long long)event.time_us,
+            event.thread_id);
+    is_first_row = false;
+  }
+  fprintf(file, "\n]}\n");
+  fclose(file);
+
+  if (was_enabled) {
+    enable();
+  }
+  return true;
+}
+
+}  // namespace blender::trace
@@ -160,6 +160,82 @@ TEST(index_mask, FromIntersection)
   }
 }
 
+TEST(index_mask, FromDelta)
+{
+  {
+    IndexMaskMemory memory;
+    const IndexMask mask(IndexRange(100000));
+    Array<int> added_data = {100100, 100101};
+    const IndexMask added = IndexMask::from_indices<int>(added_data, memory);
+    Array<int> removed_data = {50000};
+    const IndexMask removed = IndexMask::from_indices<int>(removed_data, memory);
+
+    const IndexMask result = IndexMask::from_delta(mask, added, removed, memory);
+
+    EXPECT_EQ(result.size(), 100001);
+    EXPECT_FALSE(result.contains(50000));
+    EXPECT_TRUE(result.contains(49999));
+    EXPECT_TRUE(result.contains(50001));
+    EXPECT_TRUE(result.contains(100100));
+    EXPECT_TRUE(result.contains(100101));
+    EXPECT_FALSE(result.contains(100000));
+  }
+  {
+    /* Empty delta returns the mask unchanged. */
+    IndexMaskMemory memory;
+    const IndexMask mask(IndexRange(10, 90));
+    const IndexMask result = IndexMask::from_delta(mask, {}, {}, memory);
+    EXPECT_TRUE(result == mask);
+  }
+  {
+    /* An index in both #added and #removed ends up in the result. */
+    IndexMaskMemory memory;
+    Array<int> data = {5, 10, 15};
+    const IndexMask mask = IndexMask::from_indices<int>(data, memory);
+    Array<int> delta_data = {10};
+    const IndexMask delta = IndexMask::from_indices<int>(delta_data, memory);
+    const IndexMask result = IndexMask::from_delta(mask, delta, delta, memory);
+    EXPECT_EQ(result.size(), 3);
+    EXPECT_TRUE(result.contains(10));
+  }
+}
+
+TEST(index_mask, FromDeltaFuzzy)
+{
+  RandomNumberGenerator rng;
+  IndexMaskMemory memory;
+  for (const int64_t iteration : IndexRange(10)) {
+    UNUSED_VARS(iteration);
+    const int64_t universe_size = 10000;
+    Set<int64_t> indices;
+    for ([[maybe_unused]] const int64_t i : IndexRange(rng.get_int32(1000))) {
+      indices.add(rng.get_int32(universe_size));
+    }
+    Vector<int64_t> indices_vec;
+    indices_vec.extend(indices.begin(), indices.end());
+    std::sort(indices_vec.begin(), indices_vec.end());
+    const IndexMask mask = IndexMask::from_indices<int64_t>(indices_vec, memory);
+
+    Vector<int64_t> added_vec;
+    Vector<int64_t> removed_vec;
+    for ([[maybe_unused]] const int64_t i : IndexRange(rng.get_int32(100))) {
+      added_vec.append_non_duplicates(rng.get_int32(universe_size));
+    }
+    for ([[maybe_unused]] const int64_t i : IndexRange(rng.get_int32(100))) {
+      removed_vec.append_non_duplicates(rng.get_int32(universe_size));
+    }
+    std::sort(added_vec.begin(), added_vec.end());
+    std::sort(removed_vec.begin(), removed_vec.end());
+    const IndexMask added = IndexMask::from_indices<int64_t>(added_vec, memory);
+    const IndexMask removed = IndexMask::from_indices<int64_t>(removed_vec, memory);
+
+    const IndexMask result = IndexMask::from_delta(mask, added, removed, memory);
+    const IndexMask expected = IndexMask::from_union(
+        IndexMask::from_difference(mask, removed, memory), added, memory);
+    EXPECT_TRUE(result == expected);
+  }
+}
+
 TEST(index_mask, DefaultConstructor)
 {
   IndexMask mask;
@@ -134,3 +134,65 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+/**
+ * Ray-cast random points with the regular and the SIMD packed layout,
+ * both must find the same points at the same distances.
+ */
+static void ray_cast_packed_test(int points_len, float scale, int round, int random_seed)
+{
+  RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 4, 6);
+  BVHTree *tree_packed = BLI_bvhtree_new_ex(points_len, 0.0, 4, 6, true);
+
+  void *mem = MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*points)[3] = (float(*)[3])mem;
+
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, round, scale);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+    BLI_bvhtree_insert(tree_packed, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+  BLI_bvhtree_balance(tree_packed);
+
+  for (int i = 0; i < points_len; i++) {
+    /* Cast a ray at every point from outside the cloud along the X axis. */
+    const float co[3] = {-2.0f * scale, points[i][1], points[i][2]};
+    const float dir[3] = {1.0f, 0.0f, 0.0f};
+
+    BVHTreeRayHit hit, hit_packed;
+    hit.index = -1;
+    hit.dist = BVH_RAYCAST_DIST_MAX;
+    hit_packed = hit;
+
+    BLI_bvhtree_ray_cast(tree, co, dir, 0.0f, &hit, nullptr, nullptr);
+    BLI_bvhtree_ray_cast(tree_packed, co, dir, 0.0f, &hit_packed, nullptr, nullptr);
+
+    EXPECT_FLOAT_EQ(hit_packed.dist, hit.dist);
+    if (hit_packed.index != hit.index) {
+      /* Coincident points can be found in a different order, that's fine. */
+      EXPECT_GE(hit_packed.index, 0);
+      EXPECT_LT(hit_packed.index, points_len);
+      EXPECT_EQ_ARRAY(points[hit.index], points[hit_packed.index], 3);
+    }
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_bvhtree_free(tree_packed);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
+
+TEST(kdopbvh, RayCastPacked_1)
+{
+  ray_cast_packed_test(1, 1.0, 1000, 1234);
+}
+TEST(kdopbvh, RayCastPacked_2)
+{
+  ray_cast_packed_test(2, 1.0, 1000, 123);
+}
+TEST(kdopbvh, RayCastPacked_500)
+{
+  ray_cast_packed_test(500, 1.0, 1000, 12);
+}
@@ -5,6 +5,7 @@
 #include "testing/testing.h"
 
 #include "BLI_math_geom.h"
+#include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
 
 using namespace blender;
@@ -115,6 +116,80 @@ TEST(math_geom, IsectPointQuad2D)
   EXPECT_EQ(+1, isect_point_quad_v2(corner2, quad_ccw[0], quad_ccw[1], quad_ccw[2], quad_ccw[3]));
 }
 
+TEST(math_geom, InterpWeightsTriV3Batch)
+{
+  /* A mix of generic, degenerate and differently oriented triangles, more than one SIMD batch. */
+  const int len = 11;
+  float v1[len][3], v2[len][3], v3[len][3], co[len][3];
+  for (int i = 0; i < len; i++) {
+    const float f = float(i);
+    copy_v3_fl3(v1[i], f, 0.0f, 0.0f);
+    copy_v3_fl3(v2[i], f + 2.0f, 0.0f, f * 0.25f);
+    copy_v3_fl3(v3[i], f + 1.0f, 3.0f, -f * 0.5f);
+    copy_v3_fl3(co[i], f + 1.0f, 1.0f, 0.1f * f);
+  }
+  /* Zero area triangle has to fall back to 1/3 weights. */
+  copy_v3_v3(v2[4], v1[4]);
+  copy_v3_v3(v3[4], v1[4]);
+  /* Triangles dominant in other axis planes. */
+  copy_v3_fl3(v1[5], 0.0f, 1.0f, 2.0f);
+  copy_v3_fl3(v2[5], 0.0f, 4.0f, 2.5f);
+  copy_v3_fl3(v3[5], 0.2f, 2.0f, 6.0f);
+  copy_v3_fl3(co[5], 0.1f, 2.0f, 3.0f);
+  copy_v3_fl3(v1[6], 1.0f, 0.1f, 2.0f);
+  copy_v3_fl3(v2[6], 4.0f, 0.1f, 2.5f);
+  copy_v3_fl3(v3[6], 2.0f, 0.3f, 6.0f);
+  copy_v3_fl3(co[6], 2.0f, 0.2f, 3.0f);
+
+  float w_batch[len][3];
+  interp_weights_tri_v3_batch(w_batch, v1, v2, v3, co, len);
+  for (int i = 0; i < len; i++) {
+    float w_single[3];
+    interp_weights_tri_v3(w_single, v1[i], v2[i], v3[i], co[i]);
+    EXPECT_NEAR(w_single[0], w_batch[i][0], 1e-6f) << "index " << i;
+    EXPECT_NEAR(w_single[1], w_batch[i][1], 1e-6f) << "index " << i;
+    EXPECT_NEAR(w_single[2], w_batch[i][2], 1e-6f) << "index " << i;
+  }
+}
+
+TEST(math_geom, IsectRayTriV3Batch)
+{
+  const float ray_origin[3] = {0.5f, 0.5f, 5.0f};
+  const float ray_direction[3] = {0.0f, 0.0f, -1.0f};
+
+  const int len = 7;
+  float v0[len][3], v1[len][3], v2[len][3];
+  for (int i = 0; i < len; i++) {
+    /* Shift every second triangle away from the ray so that it misses. */
+    const float x = (i % 2 == 0) ? 0.0f : 10.0f;
+    const float z = float(i);
+    copy_v3_fl3(v0[i], x, 0.0f, z);
+    copy_v3_fl3(v1[i], x + 2.0f, 0.0f, z);
+    copy_v3_fl3(v2[i], x, 2.0f, z);
+  }
+  /* Degenerate triangle. */
+  copy_v3_v3(v1[6], v0[6]);
+
+  bool hit_batch[len];
+  float lambda_batch[len];
+  float uv_batch[len][2];
+  isect_ray_tri_v3_batch(
+      ray_origin, ray_direction, v0, v1, v2, len, hit_batch, lambda_batch, uv_batch);
+
+  for (int i = 0; i < len; i++) {
+    float lambda_single;
+    float uv_single[2];
+    const bool hit_single = isect_ray_tri_v3(
+        ray_origin, ray_direction, v0[i], v1[i], v2[i], &lambda_single, uv_single);
+    EXPECT_EQ(hit_single, hit_batch[i]) << "index " << i;
+    if (hit_single) {
+      EXPECT_FLOAT_EQ(lambda_single, lambda_batch[i]) << "index " << i;
+      EXPECT_FLOAT_EQ(uv_single[0], uv_batch[i][0]) << "index " << i;
+      EXPECT_FLOAT_EQ(uv_single[1], uv_batch[i][1]) << "index " << i;
+    }
+  }
+}
+
 TEST(math_geom, CrossPoly)
 {
   const float tri_cw_2d[3][2] = {{-1, 0}, {0, 1}, {1, 0}};
@@ -63,4 +63,24 @@ TEST(string_search, extract_normalized_words)
   EXPECT_EQ(word_group_ids[5], 2);
 }
 
+TEST(string_search, query)
+{
+  int dummy_data[4];
+  StringSearch<int> search{nullptr, MainWordsHeuristic::All};
+  search.add("Mark Sharp from Vertices", &dummy_data[0]);
+  search.add("Select Boundary Loop", &dummy_data[1]);
+  search.add("Rotate Edge CCW", &dummy_data[2]);
+  search.add("Transform", &dummy_data[3]);
+
+  /* Prefix, initials and fuzzy matches have to get through the precomputed mask filter. */
+  EXPECT_EQ(search.query("boundary").size(), 1);
+  EXPECT_EQ(search.query("msfv").size(), 1);
+  EXPECT_EQ(search.query("transfrom").size(), 1);
+  EXPECT_EQ(search.query("trensform").size(), 1);
+  /* Non-matching queries are filtered out. */
+  EXPECT_EQ(search.query("xyzxyzxyz").size(), 0);
+  /* An empty query returns all items. */
+  EXPECT_EQ(search.query("").size(), 4);
+}
+
 }  // namespace blender::string_search::tests
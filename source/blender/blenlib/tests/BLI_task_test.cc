@@ -69,6 +69,43 @@ TEST(task, RangeIter)
   BLI_threadapi_exit();
 }
 
+/* *** Work-stealing task pool. *** */
+
+static void task_work_stealing_func(TaskPool *__restrict pool, void *taskdata)
+{
+  int *data = (int *)BLI_task_pool_user_data(pool);
+  const int index = POINTER_AS_INT(taskdata);
+  atomic_add_and_fetch_int32(&data[index], index);
+}
+
+TEST(task, WorkStealingPool)
+{
+  int data[ITEMS_NUM] = {0};
+
+  BLI_threadapi_init();
+  BLI_task_scheduler_init();
+
+  TaskPool *pool = BLI_task_pool_create_work_stealing(data, TASK_PRIORITY_HIGH);
+  for (int i = 0; i < ITEMS_NUM; i++) {
+    BLI_task_pool_push(pool, task_work_stealing_func, POINTER_FROM_INT(i), false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(pool);
+
+  /* Pools can be reused for another batch of tasks after waiting. */
+  for (int i = 0; i < ITEMS_NUM; i++) {
+    BLI_task_pool_push(pool, task_work_stealing_func, POINTER_FROM_INT(i), false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(pool);
+  BLI_task_pool_free(pool);
+
+  for (int i = 0; i < ITEMS_NUM; i++) {
+    EXPECT_EQ(data[i], 2 * i);
+  }
+
+  BLI_task_scheduler_exit();
+  BLI_threadapi_exit();
+}
+
 /* *** Parallel iterations over mempool items. *** */
 
 static void task_mempool_iter_func(void *userdata,
@@ -233,6 +233,46 @@ TEST(virtual_array, MaterializeCompressed)
   }
 }
 
+TEST(virtual_array, ChunkedCache)
+{
+  IndexMaskMemory memory;
+  {
+    /* Computed arrays get wrapped in a caching virtual array. */
+    VArray<int> varray = VArray<int>::ForFunc(10000, [](const int64_t i) { return int(i * 2); });
+    GVArray cached = GVArray(varray).with_chunked_cache();
+    EXPECT_FALSE(cached.is_span());
+    EXPECT_FALSE(cached.is_single());
+    int value;
+    cached.get(0, &value);
+    EXPECT_EQ(value, 0);
+    cached.get(9999, &value);
+    EXPECT_EQ(value, 19998);
+    cached.get(5000, &value);
+    EXPECT_EQ(value, 10000);
+
+    Array<int> values(10000);
+    cached.materialize(IndexMask(10000), values.data());
+    for (const int64_t i : IndexRange(10000)) {
+      EXPECT_EQ(values[i], int(i * 2));
+    }
+
+    Array<int> sparse_values(10000, 0);
+    const IndexMask sparse_mask = IndexMask::from_indices<int>({3, 4000, 9500}, memory);
+    cached.materialize(sparse_mask, sparse_values.data());
+    EXPECT_EQ(sparse_values[3], 6);
+    EXPECT_EQ(sparse_values[4000], 8000);
+    EXPECT_EQ(sparse_values[9500], 19000);
+  }
+  {
+    /* Spans and single values are returned unchanged. */
+    std::array<int, 3> data = {1, 2, 3};
+    GVArray span_varray = GVArray::ForSpan(GSpan(Span(data)));
+    EXPECT_TRUE(span_varray.with_chunked_cache().is_span());
+    GVArray single_varray = GVArray::ForSingleRef(CPPType::get<int>(), 10, &data[0]);
+    EXPECT_TRUE(single_varray.with_chunked_cache().is_single());
+  }
+}
+
 TEST(virtual_array, EmptySpanWrapper)
 {
   {
@@ -0,0 +1,435 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+/** \file
+ * \ingroup bli
+ *
+ * Timed fixtures for hot blenlib kernels, to track throughput regressions. Unlike the regular
+ * unit tests, the binary is not run by ctest; run it manually or from a benchmark script.
+ *
+ * Every fixture reports the minimum and average runtime over a few iterations. When the
+ * `BLENLIB_PERFORMANCE_JSON` environment variable is set to a file path, a machine-readable
+ * summary of all results is written there as well, so builds can be gated on the numbers.
+ */
+
+#include <fstream>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_array.hh"
+#include "BLI_array_utils.hh"
+#include "BLI_generic_virtual_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_kdopbvh.h"
+#include "BLI_map.hh"
+#include "BLI_math_geom.h"
+#include "BLI_math_vector.h"
+#include "BLI_memarena.hh"
+#include "BLI_mempool.h"
+#include "BLI_rand.h"
+#include "BLI_string_search.hh"
+#include "BLI_task.h"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+#include "BLI_virtual_array.hh"
+
+namespace blender::tests {
+
+/* -------------------------------------------------------------------- */
+/** \name Benchmark Harness
+ * \{ */
+
+struct BenchmarkResult {
+  std::string name;
+  int64_t iterations;
+  timeit::Nanoseconds min_time;
+  timeit::Nanoseconds avg_time;
+};
+
+/** Collects results of all fixtures and writes the JSON summary at process exit. */
+class BenchmarkRecorder {
+ private:
+  Vector<BenchmarkResult> results_;
+
+ public:
+  static BenchmarkRecorder &get()
+  {
+    static BenchmarkRecorder recorder;
+    return recorder;
+  }
+
+  void add(BenchmarkResult result)
+  {
+    results_.append(std::move(result));
+  }
+
+  ~BenchmarkRecorder()
+  {
+    const char *json_path = std::getenv("BLENLIB_PERFORMANCE_JSON");
+    if (json_path == nullptr || results_.is_empty()) {
+      return;
+    }
+    std::ofstream file{json_path};
+    file << "{\n  \"benchmarks\": [\n";
+    for (const int i : results_.index_range()) {
+      const BenchmarkResult &result = results_[i];
+      file << "    {\"name\": \"" << result.name << "\", ";
+      file << "\"iterations\": " << result.iterations << ", ";
+      file << "\"min_ns\": " << result.min_time.count() << ", ";
+      file << "\"avg_ns\": " << result.avg_time.count() << "}";
+      file << (i == results_.size() - 1 ? "\n" : ",\n");
+    }
+    file << "  ]\n}\n";
+  }
+};
+
+/**
+ * Run \a fn \a iterations times after a warm-up run, print the timings and record them for the
+ * JSON summary.
+ */
+static void run_benchmark(const StringRef name,
+                          const int64_t iterations,
+                          const FunctionRef<void()> fn)
+{
+  /* Warm-up run, so that lazily initialized state and cold caches don't skew the first sample. */
+  fn();
+
+  timeit::Nanoseconds min_time = timeit::Nanoseconds::max();
+  timeit::Nanoseconds total_time{0};
+  for (int64_t i = 0; i < iterations; i++) {
+    const timeit::TimePoint start = timeit::Clock::now();
+    fn();
+    const timeit::Nanoseconds duration = timeit::Clock::now() - start;
+    min_time = std::min(min_time, duration);
+    total_time += duration;
+  }
+  const timeit::Nanoseconds avg_time = total_time / iterations;
+
+  std::cout << "Timer '" << name << "' (" << iterations << " runs) min: ";
+  timeit::print_duration(min_time);
+  std::cout << ", avg: ";
+  timeit::print_duration(avg_time);
+  std::cout << '\n';
+
+  BenchmarkRecorder::get().add({name, iterations, min_time, avg_time});
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Fixtures
+ * \{ */
+
+TEST(blenlib_performance, math_geom_triangles)
+{
+  constexpr int len = 1 << 20;
+  RNG *rng = BLI_rng_new(42);
+  Array<float[3]> v0(len), v1(len), v2(len), co(len);
+  for (const int i : IndexRange(len)) {
+    for (int c = 0; c < 3; c++) {
+      v0[i][c] = BLI_rng_get_float(rng) * 4.0f - 2.0f;
+      v1[i][c] = BLI_rng_get_float(rng) * 4.0f - 2.0f;
+      v2[i][c] = BLI_rng_get_float(rng) * 4.0f - 2.0f;
+      co[i][c] = BLI_rng_get_float(rng) * 4.0f - 2.0f;
+    }
+  }
+  BLI_rng_free(rng);
+
+  Array<float[3]> weights(len);
+  run_benchmark("interp_weights_tri_v3", 5, [&]() {
+    for (const int i : IndexRange(len)) {
+      interp_weights_tri_v3(weights[i], v0[i], v1[i], v2[i], co[i]);
+    }
+  });
+  run_benchmark("interp_weights_tri_v3_batch", 5, [&]() {
+    interp_weights_tri_v3_batch(weights.data(), v0.data(), v1.data(), v2.data(), co.data(), len);
+  });
+
+  const float ray_origin[3] = {0.0f, 0.0f, 10.0f};
+  const float ray_direction[3] = {0.0f, 0.0f, -1.0f};
+  Array<bool> hits(len);
+  Array<float> lambdas(len);
+  run_benchmark("isect_ray_tri_v3", 5, [&]() {
+    for (const int i : IndexRange(len)) {
+      hits[i] = isect_ray_tri_v3(
+          ray_origin, ray_direction, v0[i], v1[i], v2[i], &lambdas[i], nullptr);
+    }
+  });
+  run_benchmark("isect_ray_tri_v3_batch", 5, [&]() {
+    isect_ray_tri_v3_batch(ray_origin,
+                           ray_direction,
+                           v0.data(),
+                           v1.data(),
+                           v2.data(),
+                           len,
+                           hits.data(),
+                           lambdas.data(),
+                           nullptr);
+  });
+}
+
+TEST(blenlib_performance, index_mask)
+{
+  constexpr int64_t size = 8 << 20;
+  RNG *rng = BLI_rng_new(42);
+  Array<bool> bools(size);
+  for (const int64_t i : IndexRange(size)) {
+    bools[i] = BLI_rng_get_float(rng) < 0.5f;
+  }
+  BLI_rng_free(rng);
+
+  run_benchmark("index_mask_from_bools", 10, [&]() {
+    IndexMaskMemory memory;
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    EXPECT_GT(mask.size(), 0);
+  });
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_bools(bools, memory);
+  const IndexMask mask_shifted = IndexMask::from_predicate(
+      IndexRange(size), GrainSize(4096), memory, [&](const int64_t i) {
+        return i > 0 && bools[i - 1];
+      });
+  run_benchmark("index_mask_complement", 10, [&]() {
+    IndexMaskMemory local_memory;
+    const IndexMask complement = mask.complement(IndexRange(size), local_memory);
+    EXPECT_EQ(complement.size(), size - mask.size());
+  });
+  run_benchmark("index_mask_union", 10, [&]() {
+    IndexMaskMemory local_memory;
+    const IndexMask union_mask = IndexMask::from_union(mask, mask_shifted, local_memory);
+    EXPECT_GE(union_mask.size(), mask.size());
+  });
+}
+
+TEST(blenlib_performance, task_scheduling)
+{
+  BLI_threadapi_init();
+  BLI_task_scheduler_init();
+
+  constexpr int64_t size = 8 << 20;
+  Array<float> values(size, 1.0f);
+  run_benchmark("parallel_for", 10, [&]() {
+    threading::parallel_for(values.index_range(), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i] = values[i] * 0.5f + 1.0f;
+      }
+    });
+  });
+
+  constexpr int tasks_num = 10000;
+  std::atomic<int> counter = 0;
+  auto count_fn = [](TaskPool *pool, void * /*taskdata*/) {
+    std::atomic<int> *counter = static_cast<std::atomic<int> *>(BLI_task_pool_user_data(pool));
+    counter->fetch_add(1, std::memory_order_relaxed);
+  };
+  run_benchmark("task_pool", 10, [&]() {
+    TaskPool *pool = BLI_task_pool_create(&counter, TASK_PRIORITY_HIGH);
+    for (int i = 0; i < tasks_num; i++) {
+      BLI_task_pool_push(pool, count_fn, nullptr, false, nullptr);
+    }
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  });
+  run_benchmark("task_pool_work_stealing", 10, [&]() {
+    TaskPool *pool = BLI_task_pool_create_work_stealing(&counter, TASK_PRIORITY_HIGH);
+    for (int i = 0; i < tasks_num; i++) {
+      BLI_task_pool_push(pool, count_fn, nullptr, false, nullptr);
+    }
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  });
+}
+
+TEST(blenlib_performance, virtual_arrays)
+{
+  constexpr int64_t size = 8 << 20;
+  const VArray<int> varray = VArray<int>::ForFunc(size,
+                                                  [](const int64_t i) { return int(i) * 7; });
+  Array<int> dst(size);
+  run_benchmark("varray_materialize", 10,
+                [&]() { varray.materialize(dst.as_mutable_span()); });
+
+  const GVArray cached = GVArray(varray).with_chunked_cache();
+  run_benchmark("gvarray_chunked_cache_materialize", 10, [&]() {
+    cached.materialize(IndexMask(size), dst.data());
+  });
+}
+
+TEST(blenlib_performance, map)
+{
+  constexpr int size = 1 << 20;
+  run_benchmark("map_add_int", 5, [&]() {
+    Map<int, int> map;
+    for (int i = 0; i < size; i++) {
+      map.add(i * 2, i);
+    }
+    EXPECT_EQ(map.size(), size);
+  });
+
+  Map<int, int> map;
+  for (int i = 0; i < size; i++) {
+    map.add(i * 2, i);
+  }
+  run_benchmark("map_lookup_int", 5, [&]() {
+    int sum = 0;
+    for (int i = 0; i < size; i++) {
+      sum += map.lookup_default(i, 0);
+    }
+    EXPECT_GT(sum, 0);
+  });
+
+  Map<std::string, int> string_map;
+  Vector<std::string> keys;
+  for (const int i : IndexRange(10000)) {
+    keys.append("some_fairly_long_attribute_name_" + std::to_string(i));
+    string_map.add(keys.last(), i);
+  }
+  run_benchmark("map_lookup_string", 10, [&]() {
+    int sum = 0;
+    for (const std::string &key : keys) {
+      sum += string_map.lookup(key);
+    }
+    EXPECT_GT(sum, 0);
+  });
+}
+
+TEST(blenlib_performance, mempool)
+{
+  constexpr uint size = 1 << 20;
+  Array<void *> pointers(size);
+  run_benchmark("mempool_alloc_free", 5, [&]() {
+    BLI_mempool *pool = BLI_mempool_create(64, 0, 1024, BLI_MEMPOOL_NOP);
+    for (const uint i : IndexRange(size)) {
+      pointers[i] = BLI_mempool_alloc(pool);
+    }
+    for (const uint i : IndexRange(size)) {
+      BLI_mempool_free(pool, pointers[i]);
+    }
+    BLI_mempool_destroy(pool);
+  });
+  run_benchmark("mempool_magazine_alloc_parallel", 5, [&]() {
+    BLI_mempool *pool = BLI_mempool_create(64, 0, 1024, BLI_MEMPOOL_NOP);
+    constexpr uint threads_num = 4;
+    BLI_mempool_magazine *magazines = BLI_mempool_magazines_create(pool, threads_num);
+    threading::parallel_for(IndexRange(threads_num), 1, [&](const IndexRange range) {
+      for (const int64_t thread : range) {
+        BLI_mempool_magazine *magazine = BLI_mempool_magazine_get(magazines, uint(thread));
+        for (uint i = 0; i < size / threads_num; i++) {
+          void *elem = BLI_mempool_magazine_alloc(magazine);
+          BLI_mempool_magazine_free(magazine, elem);
+        }
+      }
+    });
+    BLI_mempool_magazines_destroy(pool, magazines, threads_num);
+    BLI_mempool_destroy(pool);
+  });
+}
+
+TEST(blenlib_performance, memarena)
+{
+  constexpr int size = 1 << 20;
+  run_benchmark("memarena_alloc", 5, [&]() {
+    MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
+    for (int i = 0; i < size; i++) {
+      void *buffer = BLI_memarena_alloc(arena, 48);
+      *static_cast<int *>(buffer) = i;
+    }
+    BLI_memarena_free(arena);
+  });
+  run_benchmark("memarena_pool_alloc_parallel", 5, [&]() {
+    MemArenaPool pool;
+    threading::parallel_for(IndexRange(size), 4096, [&](const IndexRange range) {
+      MemArena *arena = pool.local();
+      for (const int64_t i : range) {
+        void *buffer = BLI_memarena_alloc(arena, 48);
+        *static_cast<int64_t *>(buffer) = i;
+      }
+    });
+  });
+}
+
+TEST(blenlib_performance, bvh_ray_cast)
+{
+  constexpr int points_num = 100000;
+  constexpr int rays_num = 100000;
+  RNG *rng = BLI_rng_new(42);
+  Array<float[3]> points(points_num);
+  for (const int i : IndexRange(points_num)) {
+    for (int c = 0; c < 3; c++) {
+      points[i][c] = BLI_rng_get_float(rng) * 2.0f - 1.0f;
+    }
+  }
+  BLI_rng_free(rng);
+
+  run_benchmark("bvhtree_build", 5, [&]() {
+    BVHTree *tree = BLI_bvhtree_new(points_num, 0.0f, 4, 6);
+    for (const int i : IndexRange(points_num)) {
+      BLI_bvhtree_insert(tree, i, points[i], 1);
+    }
+    BLI_bvhtree_balance(tree);
+    BLI_bvhtree_free(tree);
+  });
+
+  auto build_and_cast = [&](const bool use_packed, const StringRef name) {
+    BVHTree *tree = BLI_bvhtree_new_ex(points_num, 0.0f, 4, 6, use_packed);
+    for (const int i : IndexRange(points_num)) {
+      BLI_bvhtree_insert(tree, i, points[i], 1);
+    }
+    BLI_bvhtree_balance(tree);
+    run_benchmark(name, 5, [&]() {
+      const float dir[3] = {0.0f, 0.0f, -1.0f};
+      int hits_num = 0;
+      for (const int i : IndexRange(rays_num)) {
+        const float co[3] = {points[i][0], points[i][1], 2.0f};
+        BVHTreeRayHit hit;
+        hit.index = -1;
+        hit.dist = FLT_MAX;
+        if (BLI_bvhtree_ray_cast(tree, co, dir, 0.0f, &hit, nullptr, nullptr) != -1) {
+          hits_num++;
+        }
+      }
+      EXPECT_GT(hits_num, 0);
+    });
+    BLI_bvhtree_free(tree);
+  };
+  build_and_cast(false, "bvhtree_ray_cast");
+  build_and_cast(true, "bvhtree_ray_cast_packed");
+}
+
+TEST(blenlib_performance, string_search)
+{
+  int dummy_data[1];
+  string_search::StringSearch<int> search{nullptr, string_search::MainWordsHeuristic::All};
+  for (const int i : IndexRange(20000)) {
+    search.add("Node Asset Item Number " + std::to_string(i), dummy_data);
+  }
+  run_benchmark("string_search_query", 10, [&]() {
+    const Vector<int *> results = search.query("item 1999");
+    EXPECT_GT(results.size(), 0);
+  });
+}
+
+TEST(blenlib_performance, array_utils_gather)
+{
+  constexpr int64_t size = 8 << 20;
+  Array<int> values(size);
+  Array<int> indices(size);
+  Array<int> dst(size);
+  for (const int64_t i : IndexRange(size)) {
+    values[i] = int(i);
+    indices[i] = int((i * 7919) % size);
+  }
+  run_benchmark("array_utils_gather", 10, [&]() {
+    array_utils::gather(values.as_span(), indices.as_span(), dst.as_mutable_span());
+  });
+}
+
+/** \} */
+
+}  // namespace blender::tests
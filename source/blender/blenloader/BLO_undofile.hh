@@ -12,6 +12,7 @@
 #include "BLI_filereader.h"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
+#include "BLI_vector.hh"
 
 namespace blender {
 class ImplicitSharingInfo;
@@ -32,8 +33,10 @@ struct MemFileSharedStorage {
 struct MemFileChunk {
   void *next, *prev;
   const char *buf;
-  /** Size in bytes. */
+  /** Size in bytes (of the uncompressed data). */
   size_t size;
+  /** Size of the buffer when it is stored zstd-compressed, zero when it is stored raw. */
+  size_t size_compressed;
   /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
@@ -64,6 +67,11 @@ struct MemFileWriteData {
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
+
+  /** Scratch buffers reused while comparing against compressed reference chunks and while
+   * compressing new ones, to avoid an allocation per chunk. */
+  blender::Vector<char> decompress_buffer;
+  blender::Vector<char> compress_buffer;
 };
 
 struct MemFileUndoData {
@@ -80,6 +88,10 @@ struct UndoReader {
   int undo_direction;
 
   bool memchunk_identical;
+
+  /** Cache holding the decompressed contents of the compressed chunk that was read last. */
+  const MemFileChunk *decompressed_chunk;
+  char *decompressed_buf;
 };
 
 /* Actually only used `writefile.cc`. */
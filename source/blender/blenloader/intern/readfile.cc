@@ -894,6 +894,19 @@ static bool blo_bhead_read_data(FileData *fd, BHead *thisblock, void *buf)
   return success;
 }
 
+/* Direct pointer to the block data in the underlying storage, for readers backed by memory or
+ * memory-mapped files. Returns null when the reader has to go through copying reads. */
+static const void *blo_bhead_data_ptr(FileData *fd, BHead *thisblock)
+{
+  BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (fd->file->data_ptr == nullptr) {
+    return nullptr;
+  }
+  return fd->file->data_ptr(
+      fd->file, size_t(new_bhead->file_offset), size_t(new_bhead->bhead.len));
+}
+
 static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 {
   BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
@@ -1808,6 +1821,12 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
+          /* When the storage is backed by memory-mapped IO, reconstruct the structs straight
+           * from the mapped pages instead of materializing a full copy of the block first. */
+          const void *direct_data = blo_bhead_data_ptr(fd, bh);
+          if (direct_data != nullptr) {
+            return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, direct_data);
+          }
           bh = blo_bhead_read_full(fd, bh);
           if (UNLIKELY(bh == nullptr)) {
             fd->flags &= ~FD_FLAGS_FILE_OK;
@@ -4621,14 +4640,14 @@ static FileData *read_library_file_data(FileData *basefd,
 
   if (mainptr->curlib->packedfile) {
     /* Read packed file. */
-    const PackedFile *pf = mainptr->curlib->packedfile;
+    PackedFile *pf = mainptr->curlib->packedfile;
 
     BLO_reportf_wrap(basefd->reports,
                      RPT_INFO,
                      RPT_("Read packed library: '%s', parent '%s'"),
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_memory(pf->data, pf->size, basefd->reports);
+    fd = blo_filedata_from_memory(BKE_packedfile_data_get(pf), pf->size, basefd->reports);
 
     /* Needed for library_append and read_libraries. */
     STRNCPY(fd->relabase, mainptr->curlib->runtime.filepath_abs);
@@ -20,6 +20,8 @@
 #  include <io.h>
 #endif
 
+#include <zstd.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_listBase.h"
@@ -38,6 +40,13 @@
 
 /* **************** support for memory-write, for undo buffers *************** */
 
+/* Chunk buffers that differ from the reference undo step are stored zstd-compressed, so that a
+ * given undo memory budget holds more steps. A low level keeps the overhead of the undo push
+ * small, while still typically shrinking DNA data considerably. */
+#define MEMFILE_COMPRESSION_LEVEL 1
+/* Don't bother compressing tiny chunks, the frame overhead outweighs the gain. */
+#define MEMFILE_COMPRESSION_MIN_SIZE 256
+
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
@@ -126,6 +135,8 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
 {
   mem_data->id_session_uid_mapping.clear_and_shrink();
+  mem_data->decompress_buffer.clear_and_shrink();
+  mem_data->compress_buffer.clear_and_shrink();
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -136,6 +147,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   MemFileChunk *curchunk = static_cast<MemFileChunk *>(
       MEM_mallocN(sizeof(MemFileChunk), "MemFileChunk"));
   curchunk->size = size;
+  curchunk->size_compressed = 0;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
   /* This is unsafe in the sense that an app handler or other code that does not
@@ -149,8 +161,24 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   if (*compchunk_step != nullptr) {
     MemFileChunk *compchunk = *compchunk_step;
     if (compchunk->size == curchunk->size) {
-      if (memcmp(compchunk->buf, buf, size) == 0) {
+      const char *compchunk_data = compchunk->buf;
+      if (compchunk->size_compressed != 0) {
+        /* The reference buffer is stored compressed, decompress it into the reused scratch
+         * buffer for the comparison. */
+        mem_data->decompress_buffer.resize(int64_t(compchunk->size));
+        compchunk_data = mem_data->decompress_buffer.data();
+        if (ZSTD_decompress(mem_data->decompress_buffer.data(),
+                            compchunk->size,
+                            compchunk->buf,
+                            compchunk->size_compressed) != compchunk->size)
+        {
+          BLI_assert_unreachable();
+          compchunk_data = nullptr;
+        }
+      }
+      if (compchunk_data && memcmp(compchunk_data, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
+        curchunk->size_compressed = compchunk->size_compressed;
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
       }
@@ -160,10 +188,29 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 
   /* not equal... */
   if (curchunk->buf == nullptr) {
-    char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+    /* Try to store the chunk compressed. When compression fails to reduce the size (e.g. for
+     * already compressed image data), the chunk is stored raw instead. */
+    if (size >= MEMFILE_COMPRESSION_MIN_SIZE) {
+      mem_data->compress_buffer.resize(int64_t(ZSTD_compressBound(size)));
+      const size_t size_compressed = ZSTD_compress(mem_data->compress_buffer.data(),
+                                                   size_t(mem_data->compress_buffer.size()),
+                                                   buf,
+                                                   size,
+                                                   MEMFILE_COMPRESSION_LEVEL);
+      if (!ZSTD_isError(size_compressed) && size_compressed < size) {
+        char *buf_new = static_cast<char *>(MEM_mallocN(size_compressed, "Chunk buffer"));
+        memcpy(buf_new, mem_data->compress_buffer.data(), size_compressed);
+        curchunk->buf = buf_new;
+        curchunk->size_compressed = size_compressed;
+        memfile->size += size_compressed;
+      }
+    }
+    if (curchunk->buf == nullptr) {
+      char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
+      memcpy(buf_new, buf, size);
+      curchunk->buf = buf_new;
+      memfile->size += size;
+    }
   }
 }
 
@@ -242,7 +289,26 @@ static int64_t undo_read(FileReader *reader, void *buffer, size_t size)
         readsize = chunk->size - chunkoffset;
       }
 
-      memcpy(POINTER_OFFSET(buffer, totread), chunk->buf + chunkoffset, readsize);
+      const char *chunk_data = chunk->buf;
+      if (chunk->size_compressed != 0) {
+        /* Compressed chunks are decompressed as a whole and cached, since reads typically cross
+         * a chunk in several consecutive calls. */
+        if (undo->decompressed_chunk != chunk) {
+          undo->decompressed_buf = static_cast<char *>(
+              MEM_reallocN(undo->decompressed_buf, chunk->size));
+          if (ZSTD_decompress(
+                  undo->decompressed_buf, chunk->size, chunk->buf, chunk->size_compressed) !=
+              chunk->size)
+          {
+            printf("illegal read, chunk decompression failed\n");
+            return 0;
+          }
+          undo->decompressed_chunk = chunk;
+        }
+        chunk_data = undo->decompressed_buf;
+      }
+
+      memcpy(POINTER_OFFSET(buffer, totread), chunk_data + chunkoffset, readsize);
       totread += readsize;
       undo->reader.offset += (off64_t)readsize;
       seek += readsize;
@@ -263,7 +329,11 @@ static int64_t undo_read(FileReader *reader, void *buffer, size_t size)
 
 static void undo_close(FileReader *reader)
 {
-  MEM_freeN(reader);
+  UndoReader *undo = (UndoReader *)reader;
+  if (undo->decompressed_buf) {
+    MEM_freeN(undo->decompressed_buf);
+  }
+  MEM_freeN(undo);
 }
 
 FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction)
@@ -201,6 +201,114 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/**
+ * Hands the actual file writes off to a background thread, so the caller can
+ * keep serializing data while the previous buffer is being written to disk.
+ * With a single worker thread the writes happen in submission order.
+ */
+class BackgroundWriteWrap : public WriteWrap {
+  WriteWrap &base_wrap;
+
+  ListBase threadpool = {};
+  ListBase tasks = {};
+  ThreadMutex mutex = {};
+
+  bool write_error = false;
+
+ public:
+  BackgroundWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  struct BackgroundWriteTask;
+  void write_task(BackgroundWriteTask *task);
+};
+
+struct BackgroundWriteWrap::BackgroundWriteTask {
+  BackgroundWriteTask *next, *prev;
+  void *data;
+  size_t size;
+  BackgroundWriteWrap *ww;
+
+  static void *write_task(void *userdata)
+  {
+    auto *task = static_cast<BackgroundWriteTask *>(userdata);
+    task->ww->write_task(task);
+    return nullptr;
+  }
+};
+
+void BackgroundWriteWrap::write_task(BackgroundWriteTask *task)
+{
+  BLI_mutex_lock(&mutex);
+  if (!write_error && !base_wrap.write(task->data, task->size)) {
+    write_error = true;
+  }
+  BLI_mutex_unlock(&mutex);
+
+  MEM_freeN(task->data);
+}
+
+bool BackgroundWriteWrap::open(const char *filepath)
+{
+  if (!base_wrap.open(filepath)) {
+    return false;
+  }
+
+  BLI_threadpool_init(&threadpool, BackgroundWriteTask::write_task, 1);
+  BLI_mutex_init(&mutex);
+
+  return true;
+}
+
+bool BackgroundWriteWrap::close()
+{
+  BLI_threadpool_end(&threadpool);
+  BLI_freelistN(&tasks);
+
+  BLI_mutex_end(&mutex);
+
+  return base_wrap.close() && !write_error;
+}
+
+bool BackgroundWriteWrap::write(const void *buf, size_t buf_len)
+{
+  BLI_mutex_lock(&mutex);
+  const bool had_error = write_error;
+  BLI_mutex_unlock(&mutex);
+  if (had_error) {
+    return false;
+  }
+
+  BackgroundWriteTask *task = static_cast<BackgroundWriteTask *>(
+      MEM_mallocN(sizeof(BackgroundWriteTask), __func__));
+  task->data = MEM_mallocN(buf_len, __func__);
+  memcpy(task->data, buf, buf_len);
+  task->size = buf_len;
+  task->ww = this;
+
+  BLI_addtail(&tasks, task);
+
+  /* If the worker thread is still busy, wait for the oldest task first, so
+   * that at most two buffers are in flight at any time. */
+  BackgroundWriteTask *first_task = static_cast<BackgroundWriteTask *>(tasks.first);
+  if (!BLI_available_threads(&threadpool)) {
+    BLI_threadpool_remove(&threadpool, first_task);
+
+    /* If the task list was empty before we pushed our task, there should
+     * always be a free thread. */
+    BLI_assert(first_task != task);
+    BLI_remlink(&tasks, first_task);
+    MEM_freeN(first_task);
+  }
+  BLI_threadpool_insert(&threadpool, task);
+
+  return true;
+}
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
@@ -1675,7 +1783,12 @@ bool BLO_write_file(Main *mainvar,
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
-  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
+  /* For uncompressed writes, hand the disk IO off to a background thread so
+   * that serialization of the next buffer overlaps with writing the current
+   * one. The compressed path gets the same overlap from the Zstd worker
+   * threads already. */
+  BackgroundWriteWrap bg_wrap(raw_wrap);
+  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, bg_wrap);
 }
 
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, int write_flags)
@@ -188,6 +188,7 @@
 #include "intern/bmesh_error.hh"
 #include "intern/bmesh_operator_api.hh"
 
+#include "intern/bmesh_adjacency.hh"
 #include "intern/bmesh_callback_generic.hh"
 #include "intern/bmesh_construct.hh"
 #include "intern/bmesh_core.hh"
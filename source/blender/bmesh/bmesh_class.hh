@@ -312,6 +312,14 @@ typedef struct BMesh {
    */
   char elem_table_dirty;
 
+  /**
+   * Incremented whenever dirty indices are recalculated, both by #BM_mesh_elem_index_ensure
+   * and by code that writes canonical indices itself and clears the dirty flags through
+   * #BM_mesh_elem_index_dirty_clear. Since topology changes mark indices dirty, this can be
+   * used as a cheap generation counter to detect them, see #BKE_editmesh_bvh_cache_get.
+   */
+  uint elem_index_gen;
+
   /* element pools */
   struct BLI_mempool *vpool, *epool, *lpool, *fpool;
 
@@ -329,6 +337,12 @@ typedef struct BMesh {
   int etable_tot;
   int ftable_tot;
 
+  /**
+   * Optional CSR vert/edge adjacency snapshot for query-heavy operators,
+   * see #BM_mesh_vert_adjacency_ensure. Never access directly.
+   */
+  struct BMVertAdjacency *vert_adjacency;
+
   /* Operator API stuff (must be all null or all allocated). */
   struct BLI_mempool *vtoolflagpool, *etoolflagpool, *ftoolflagpool;
 
@@ -0,0 +1,63 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bmesh
+ *
+ * Compact adjacency snapshots for query-heavy operators.
+ */
+
+#include "MEM_guardedalloc.h"
+
+#include "bmesh.hh"
+
+using blender::Array;
+using blender::MutableSpan;
+using blender::offset_indices::accumulate_counts_to_offsets;
+
+const BMVertAdjacency *BM_mesh_vert_adjacency_ensure(BMesh *bm)
+{
+  /* Bumps #BMesh.elem_index_gen when any indices were dirty, so the comparison
+   * below reliably detects topology changes (they always dirty the indices). */
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE);
+
+  BMVertAdjacency *adj = bm->vert_adjacency;
+  if (adj && adj->elem_index_gen == bm->elem_index_gen) {
+    return adj;
+  }
+  if (adj == nullptr) {
+    adj = bm->vert_adjacency = MEM_new<BMVertAdjacency>(__func__);
+  }
+
+  adj->elem_index_gen = bm->elem_index_gen;
+  adj->edge_offsets.reinitialize(bm->totvert + 1);
+  adj->edges.reinitialize(size_t(bm->totedge) * 2);
+
+  MutableSpan<int> offsets = adj->edge_offsets;
+  offsets.fill(0);
+
+  BMIter iter;
+  BMEdge *e;
+  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
+    offsets[BM_elem_index_get(e->v1)]++;
+    offsets[BM_elem_index_get(e->v2)]++;
+  }
+  accumulate_counts_to_offsets(offsets);
+
+  Array<int> cursor(blender::Span<int>(offsets.drop_back(1)));
+  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
+    adj->edges[cursor[BM_elem_index_get(e->v1)]++] = e;
+    adj->edges[cursor[BM_elem_index_get(e->v2)]++] = e;
+  }
+
+  return adj;
+}
+
+void BM_mesh_vert_adjacency_free(BMesh *bm)
+{
+  if (bm->vert_adjacency) {
+    MEM_delete(bm->vert_adjacency);
+    bm->vert_adjacency = nullptr;
+  }
+}
@@ -0,0 +1,52 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bmesh
+ *
+ * Compact adjacency snapshots for query-heavy operators.
+ *
+ * Walking the per-element linked lists (disk cycles) has poor cache locality when many
+ * adjacency queries run in a row. This provides an optional CSR (offsets + array) snapshot
+ * of the vert/edge adjacency, stored in contiguous memory, that is rebuilt lazily when the
+ * topology changed.
+ */
+
+#include "BLI_array.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_span.hh"
+
+#include "bmesh_class.hh"
+
+/**
+ * CSR vert/edge adjacency, valid as long as the topology doesn't change.
+ */
+struct BMVertAdjacency {
+  /** Offsets into #edges, one range per vertex index, sized `totvert + 1`. */
+  blender::Array<int> edge_offsets;
+  /** The edges of each vertex in edge-index order, sized `totedge * 2`. */
+  blender::Array<BMEdge *> edges;
+  /** The #BMesh.elem_index_gen value the snapshot was built for. */
+  uint elem_index_gen;
+
+  /** All edges connected to the vertex with the given index. */
+  blender::Span<BMEdge *> vert_edges(const int vert_index) const
+  {
+    const blender::OffsetIndices<int> offsets(this->edge_offsets);
+    return this->edges.as_span().slice(offsets[vert_index]);
+  }
+};
+
+/**
+ * Return the vert/edge adjacency snapshot for \a bm, building it when it doesn't exist or the
+ * topology changed since it was last built (ensures vert & edge indices as a side effect).
+ * The snapshot is owned by \a bm and stays valid until the next topology change, don't free it.
+ */
+const BMVertAdjacency *BM_mesh_vert_adjacency_ensure(BMesh *bm);
+/**
+ * Free the adjacency snapshot (if it exists), called when the mesh data is freed.
+ */
+void BM_mesh_vert_adjacency_free(BMesh *bm);
@@ -581,8 +581,8 @@ BMesh *BM_mesh_copy(BMesh *bm_old)
     BM_elem_index_set(v, i);     /* set_inline */
     BM_elem_index_set(v_new, i); /* set_inline */
   }
-  bm_old->elem_index_dirty &= ~BM_VERT;
-  bm_new->elem_index_dirty &= ~BM_VERT;
+  BM_mesh_elem_index_dirty_clear(bm_old, BM_VERT);
+  BM_mesh_elem_index_dirty_clear(bm_new, BM_VERT);
 
   /* safety check */
   BLI_assert(i == bm_old->totvert);
@@ -600,8 +600,8 @@ BMesh *BM_mesh_copy(BMesh *bm_old)
     BM_elem_index_set(e, i);     /* set_inline */
     BM_elem_index_set(e_new, i); /* set_inline */
   }
-  bm_old->elem_index_dirty &= ~BM_EDGE;
-  bm_new->elem_index_dirty &= ~BM_EDGE;
+  BM_mesh_elem_index_dirty_clear(bm_old, BM_EDGE);
+  BM_mesh_elem_index_dirty_clear(bm_new, BM_EDGE);
 
   /* safety check */
   BLI_assert(i == bm_old->totedge);
@@ -617,8 +617,8 @@ BMesh *BM_mesh_copy(BMesh *bm_old)
       bm_new->act_face = f_new;
     }
   }
-  bm_old->elem_index_dirty &= ~BM_FACE;
-  bm_new->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm_old, BM_FACE);
+  BM_mesh_elem_index_dirty_clear(bm_new, BM_FACE);
 
   /* low level! don't do this for normal api use */
   bm_new->totvertsel = bm_old->totvertsel;
@@ -112,6 +112,34 @@ void BM_mesh_elem_toolflags_ensure(BMesh *bm)
   bm->totflags = 1;
 }
 
+void BM_mesh_elem_reserve(BMesh *bm, const char htype, const int elem_num)
+{
+  if (elem_num <= 0) {
+    return;
+  }
+  if (htype & BM_VERT) {
+    BLI_mempool_reserve(bm->vpool, uint(elem_num));
+    if (bm->vtoolflagpool) {
+      BLI_mempool_reserve(bm->vtoolflagpool, uint(elem_num));
+    }
+  }
+  if (htype & BM_EDGE) {
+    BLI_mempool_reserve(bm->epool, uint(elem_num));
+    if (bm->etoolflagpool) {
+      BLI_mempool_reserve(bm->etoolflagpool, uint(elem_num));
+    }
+  }
+  if (htype & BM_LOOP) {
+    BLI_mempool_reserve(bm->lpool, uint(elem_num));
+  }
+  if (htype & BM_FACE) {
+    BLI_mempool_reserve(bm->fpool, uint(elem_num));
+    if (bm->ftoolflagpool) {
+      BLI_mempool_reserve(bm->ftoolflagpool, uint(elem_num));
+    }
+  }
+}
+
 void BM_mesh_elem_toolflags_clear(BMesh *bm)
 {
   if (bm->vtoolflagpool) {
@@ -223,6 +251,8 @@ void BM_mesh_data_free(BMesh *bm)
     MEM_freeN(bm->ftable);
   }
 
+  BM_mesh_vert_adjacency_free(bm);
+
   /* destroy flag pool */
   BM_mesh_elem_toolflags_clear(bm);
 
@@ -342,6 +372,10 @@ void BM_mesh_elem_index_ensure_ex(BMesh *bm, const char htype, int elem_offset[4
   BM_ELEM_INDEX_VALIDATE(bm, "Should Never Fail!", __func__);
 #endif
 
+  if (bm->elem_index_dirty & htype) {
+    bm->elem_index_gen++;
+  }
+
   if (elem_offset == nullptr) {
     /* Simple case. */
     const char htype_needed = bm->elem_index_dirty & htype;
@@ -17,6 +17,12 @@
 struct BMAllocTemplate;
 
 void BM_mesh_elem_toolflags_ensure(BMesh *bm);
+/**
+ * Pre-size the element pools (and tool-flag pools when they exist) of the given
+ * \a htype element types so \a elem_num further elements can be created without
+ * any chunk allocation. Useful for operators that create many elements at once.
+ */
+void BM_mesh_elem_reserve(BMesh *bm, char htype, int elem_num);
 void BM_mesh_elem_toolflags_clear(BMesh *bm);
 
 struct BMeshCreateParams {
@@ -70,6 +76,20 @@ void bmesh_edit_end(BMesh *bm, BMOpTypeFlag type_flag);
 
 void BM_mesh_elem_index_ensure_ex(BMesh *bm, char htype, int elem_offset[4]);
 void BM_mesh_elem_index_ensure(BMesh *bm, char htype);
+/**
+ * Clear dirty index flags after code wrote canonical indices itself instead of going through
+ * #BM_mesh_elem_index_ensure. Bumps #BMesh.elem_index_gen just like the ensure function does,
+ * so caches keyed on the generation (see #BKE_editmesh_bvh_cache_get and
+ * #BM_mesh_vert_adjacency_ensure) can't mistake the rewritten indices for the ones they were
+ * built from. Use this instead of clearing bits from `bm->elem_index_dirty` directly.
+ */
+BLI_INLINE void BM_mesh_elem_index_dirty_clear(BMesh *bm, const char htype)
+{
+  if (bm->elem_index_dirty & htype) {
+    bm->elem_index_gen++;
+  }
+  bm->elem_index_dirty &= char(~htype);
+}
 /**
  * Array checking/setting macros.
  *
@@ -133,7 +133,7 @@ void BM_mesh_copy_arrays(BMesh *bm_src,
     verts_dst[i] = v_dst;
   }
   bm_src->elem_index_dirty |= BM_VERT;
-  bm_dst->elem_index_dirty &= ~BM_VERT;
+  BM_mesh_elem_index_dirty_clear(bm_dst, BM_VERT);
 
   /* Edges. */
   BMEdge **edges_dst = static_cast<BMEdge **>(
@@ -147,7 +147,7 @@ void BM_mesh_copy_arrays(BMesh *bm_src,
     edges_dst[i] = e_dst;
   }
   bm_src->elem_index_dirty |= BM_EDGE;
-  bm_dst->elem_index_dirty &= ~BM_EDGE;
+  BM_mesh_elem_index_dirty_clear(bm_dst, BM_EDGE);
 
   /* Faces. */
   for (uint i = 0; i < faces_src_len; i++) {
@@ -156,7 +156,7 @@ void BM_mesh_copy_arrays(BMesh *bm_src,
         bm_dst, cd_face_map, cd_loop_map, f_src, verts_dst, edges_dst);
     BM_elem_index_set(f_dst, i);
   }
-  bm_dst->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm_dst, BM_FACE);
 
   /* Cleanup. */
   MEM_freeN(verts_dst);
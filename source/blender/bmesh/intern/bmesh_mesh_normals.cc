@@ -359,7 +359,7 @@ void BM_normals_loops_edges_tag(BMesh *bm, const bool do_edges)
         }
       }
     }
-    bm->elem_index_dirty &= ~BM_EDGE;
+    BM_mesh_elem_index_dirty_clear(bm, BM_EDGE);
   }
 
   int index_face, index_loop = 0;
@@ -371,7 +371,7 @@ void BM_normals_loops_edges_tag(BMesh *bm, const bool do_edges)
       BM_elem_flag_disable(l_curr, BM_ELEM_TAG);
     } while ((l_curr = l_curr->next) != l_first);
   }
-  bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP);
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE | BM_LOOP);
 }
 
 /**
@@ -407,7 +407,7 @@ static void bm_mesh_edges_sharp_tag(BMesh *bm,
     }
   }
 
-  bm->elem_index_dirty &= ~BM_EDGE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_EDGE);
 }
 
 void BM_edges_sharp_from_angle_set(BMesh *bm, const float split_angle)
@@ -1129,7 +1129,7 @@ static void bm_mesh_loops_calc_normals__single_threaded(BMesh *bm,
       BM_elem_flag_disable(l_curr, BM_ELEM_TAG);
     } while ((l_curr = l_curr->next) != l_first);
   }
-  bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP);
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE | BM_LOOP);
 
   /* Always tag edges based on winding & sharp edge flag
    * (even when the auto-smooth angle doesn't need to be calculated). */
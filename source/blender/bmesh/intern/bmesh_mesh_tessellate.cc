@@ -534,7 +534,8 @@ static int bmesh_calc_tessellation_for_face_beauty(std::array<BMLoop *, 3> *loop
   }
 }
 
-void BM_mesh_calc_tessellation_beauty(BMesh *bm, MutableSpan<std::array<BMLoop *, 3>> looptris)
+static void bm_mesh_calc_tessellation_beauty__single_threaded(
+    BMesh *bm, MutableSpan<std::array<BMLoop *, 3>> looptris)
 {
 #ifndef NDEBUG
   const int looptris_tot = poly_to_tri_count(bm->totface, bm->totloop);
@@ -563,4 +564,60 @@ void BM_mesh_calc_tessellation_beauty(BMesh *bm, MutableSpan<std::array<BMLoop *
   BLI_assert(i <= looptris_tot);
 }
 
+struct BeautyTessellationUserTLS {
+  MemArena *pf_arena;
+  Heap *pf_heap;
+};
+
+static void bmesh_calc_tessellation_for_face_beauty_fn(void *__restrict userdata,
+                                                       MempoolIterData *mp_f,
+                                                       const TaskParallelTLS *__restrict tls)
+{
+  BeautyTessellationUserTLS *tls_data = static_cast<BeautyTessellationUserTLS *>(
+      tls->userdata_chunk);
+  std::array<BMLoop *, 3> *looptris = static_cast<std::array<BMLoop *, 3> *>(userdata);
+  BMFace *f = (BMFace *)mp_f;
+  BMLoop *l = BM_FACE_FIRST_LOOP(f);
+  /* Every face writes exactly `f->len - 2` triangles in face order,
+   * so the write position only depends on the loop & face indices. */
+  const int offset = BM_elem_index_get(l) - (BM_elem_index_get(f) * 2);
+  bmesh_calc_tessellation_for_face_beauty(
+      looptris + offset, f, &tls_data->pf_arena, &tls_data->pf_heap);
+}
+
+static void bmesh_calc_tessellation_for_face_beauty_free_fn(const void *__restrict /*userdata*/,
+                                                            void *__restrict tls_v)
+{
+  BeautyTessellationUserTLS *tls_data = static_cast<BeautyTessellationUserTLS *>(tls_v);
+  if (tls_data->pf_arena) {
+    BLI_memarena_free(tls_data->pf_arena);
+    BLI_heap_free(tls_data->pf_heap, nullptr);
+  }
+}
+
+static void bm_mesh_calc_tessellation_beauty__multi_threaded(
+    BMesh *bm, MutableSpan<std::array<BMLoop *, 3>> looptris)
+{
+  BM_mesh_elem_index_ensure(bm, BM_LOOP | BM_FACE);
+
+  TaskParallelSettings settings;
+  BeautyTessellationUserTLS tls_dummy = {nullptr, nullptr};
+  BLI_parallel_mempool_settings_defaults(&settings);
+  settings.userdata_chunk = &tls_dummy;
+  settings.userdata_chunk_size = sizeof(tls_dummy);
+  settings.func_free = bmesh_calc_tessellation_for_face_beauty_free_fn;
+  BM_iter_parallel(
+      bm, BM_FACES_OF_MESH, bmesh_calc_tessellation_for_face_beauty_fn, looptris.data(), &settings);
+}
+
+void BM_mesh_calc_tessellation_beauty(BMesh *bm, MutableSpan<std::array<BMLoop *, 3>> looptris)
+{
+  if (bm->totface < BM_FACE_TESSELLATE_THREADED_LIMIT) {
+    bm_mesh_calc_tessellation_beauty__single_threaded(bm, looptris);
+  }
+  else {
+    bm_mesh_calc_tessellation_beauty__multi_threaded(bm, looptris);
+  }
+}
+
 /** \} */
@@ -1233,7 +1233,7 @@ static void bmo_flag_layer_alloc(BMesh *bm)
   BLI_mempool_destroy(eoldpool);
   BLI_mempool_destroy(foldpool);
 
-  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT | BM_EDGE | BM_FACE);
 }
 
 static void bmo_flag_layer_free(BMesh *bm)
@@ -1293,7 +1293,7 @@ static void bmo_flag_layer_free(BMesh *bm)
   BLI_mempool_destroy(eoldpool);
   BLI_mempool_destroy(foldpool);
 
-  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT | BM_EDGE | BM_FACE);
 }
 
 static void bmo_flag_layer_clear(BMesh *bm)
@@ -1333,7 +1333,7 @@ static void bmo_flag_layer_clear(BMesh *bm)
     }
   }
 
-  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT | BM_EDGE | BM_FACE);
 }
 
 void *BMO_slot_buffer_get_first(BMOpSlot slot_args[BMO_OP_MAX_SLOTS], const char *slot_name)
@@ -2154,7 +2154,7 @@ int BM_mesh_calc_face_groups(BMesh *bm,
 
     BM_elem_index_set(f, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
 
   /* detect groups */
   stack = static_cast<BMFace **>(MEM_mallocN(sizeof(*stack) * tot_faces, __func__));
@@ -2306,7 +2306,7 @@ int BM_mesh_calc_edge_groups(BMesh *bm,
 
     BM_elem_index_set(e, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_EDGE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_EDGE);
 
   /* detect groups */
   stack = static_cast<BMEdge **>(MEM_mallocN(sizeof(*stack) * tot_edges, __func__));
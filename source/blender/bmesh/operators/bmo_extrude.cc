@@ -244,6 +244,10 @@ void bmo_extrude_vert_indiv_exec(BMesh *bm, BMOperator *op)
     select_history_map = BM_select_history_map_create(bm);
   }
 
+  /* Every input vertex gets one duplicate and one connecting edge. */
+  const int verts_num = BMO_slot_buffer_len(op->slots_in, "verts");
+  BM_mesh_elem_reserve(bm, BM_VERT | BM_EDGE, verts_num);
+
   for (v = static_cast<BMVert *>(BMO_iter_new(&siter, op->slots_in, "verts", BM_VERT)); v;
        v = static_cast<BMVert *>(BMO_iter_step(&siter)))
   {
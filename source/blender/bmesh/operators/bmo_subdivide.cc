@@ -1140,6 +1140,12 @@ void bmo_subdivide_edges_exec(BMesh *bm, BMOperator *op)
 
   einput = BMO_slot_get(op->slots_in, "edges");
 
+  /* Each cut adds one vertex and splits one edge in two, so pre-size the pools
+   * for the bulk creation below (faces are filled in later and are harder to
+   * predict, leave them to grow on demand). */
+  BM_mesh_elem_reserve(bm, BM_VERT, numcuts * einput->len);
+  BM_mesh_elem_reserve(bm, BM_EDGE, 2 * numcuts * einput->len);
+
   /* go through and split edges */
   for (i = 0; i < einput->len; i++) {
     edge = static_cast<BMEdge *>(einput->data.buf[i]);
@@ -138,7 +138,7 @@ LinkNode *BM_mesh_calc_path_vert(BMesh *bm,
     BM_elem_flag_set(v, BM_ELEM_TAG, !filter_fn(v, user_data));
     BM_elem_index_set(v, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_VERT;
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT);
 
   /* Allocate. */
   totvert = bm->totvert;
@@ -318,7 +318,7 @@ LinkNode *BM_mesh_calc_path_edge(BMesh *bm,
     BM_elem_flag_set(e, BM_ELEM_TAG, !filter_fn(e, user_data));
     BM_elem_index_set(e, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_EDGE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_EDGE);
 
   /* Allocate. */
   totedge = bm->totedge;
@@ -519,7 +519,7 @@ LinkNode *BM_mesh_calc_path_face(BMesh *bm,
     BM_elem_flag_set(f, BM_ELEM_TAG, !filter_fn(f, user_data));
     BM_elem_index_set(f, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
 
   /* Allocate. */
   totface = bm->totface;
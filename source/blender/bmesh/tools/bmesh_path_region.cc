@@ -397,7 +397,7 @@ LinkNode *BM_mesh_calc_path_region_vert(BMesh *bm,
     BM_elem_flag_set(v, BM_ELEM_TAG, !filter_fn(v, user_data));
     BM_elem_index_set(v, i); /* set_inline */
   }
-  bm->elem_index_dirty &= ~BM_VERT;
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT);
 
   path = mesh_calc_path_region_elem(bm, ele_src, ele_dst, BM_VERT);
 
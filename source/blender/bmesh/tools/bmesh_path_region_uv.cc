@@ -422,7 +422,7 @@ LinkNode *BM_mesh_calc_path_uv_region_vert(BMesh *bm,
       i += 1;
     }
   }
-  bm->elem_index_dirty &= ~BM_LOOP;
+  BM_mesh_elem_index_dirty_clear(bm, BM_LOOP);
 
   path = mesh_calc_path_region_elem(bm, ele_src, ele_dst, cd_loop_uv_offset, BM_VERT);
 
@@ -451,7 +451,7 @@ LinkNode *BM_mesh_calc_path_uv_region_edge(BMesh *bm,
       i += 1;
     }
   }
-  bm->elem_index_dirty &= ~BM_LOOP;
+  BM_mesh_elem_index_dirty_clear(bm, BM_LOOP);
 
   path = mesh_calc_path_region_elem(bm, ele_src, ele_dst, cd_loop_uv_offset, BM_EDGE);
 
@@ -136,7 +136,7 @@ LinkNode *BM_mesh_calc_path_uv_vert(BMesh *bm,
       i += 1;
     } while ((l_iter = l_iter->next) != l_first);
   }
-  bm->elem_index_dirty &= ~BM_LOOP;
+  BM_mesh_elem_index_dirty_clear(bm, BM_LOOP);
 
   /* Allocate. */
   totloop = bm->totloop;
@@ -338,7 +338,7 @@ LinkNode *BM_mesh_calc_path_uv_edge(BMesh *bm,
       i += 1;
     } while ((l_iter = l_iter->next) != l_first);
   }
-  bm->elem_index_dirty &= ~BM_LOOP;
+  BM_mesh_elem_index_dirty_clear(bm, BM_LOOP);
 
   totloop = bm->totloop;
   loops_prev = static_cast<BMLoop **>(MEM_callocN(sizeof(*loops_prev) * totloop, __func__));
@@ -564,7 +564,7 @@ LinkNode *BM_mesh_calc_path_uv_face(BMesh *bm,
       BM_elem_index_set(f, i); /* set_inline */
       i += 1;
     }
-    bm->elem_index_dirty &= ~BM_FACE;
+    BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
   }
 
   /* Allocate. */
@@ -217,7 +217,7 @@ void BM_mesh_wireframe(BMesh *bm,
     verts_src[i] = v_src;
     BM_elem_flag_disable(v_src, BM_ELEM_TAG);
   }
-  bm->elem_index_dirty &= ~BM_VERT;
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT);
 
   /* setup tags, all faces and verts will be tagged which will be duplicated */
 
@@ -241,7 +241,7 @@ void BM_mesh_wireframe(BMesh *bm,
       BM_elem_flag_set(l->e, BM_ELEM_TAG, bm_loop_is_radial_boundary(l));
     }
   }
-  bm->elem_index_dirty &= ~BM_FACE;
+  BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
 
   /* duplicate tagged verts */
   for (i = 0; i < totvert_orig; i++) {
@@ -43,6 +43,7 @@ void FullFrameExecutionModel::execute(ExecutionSystem &exec_system)
   DebugInfo::graphviz(&exec_system, "compositor_prior_rendering");
 
   determine_areas_to_render_and_reads();
+  determine_fused_chains();
   render_operations();
 }
 
@@ -64,6 +65,143 @@ void FullFrameExecutionModel::determine_areas_to_render_and_reads()
   }
 }
 
+/**
+ * Side length of the intermediate buffers used when rendering fused operation chains.
+ */
+constexpr int FUSED_TILE_SIZE = 512;
+
+/**
+ * Whether the operation reads the given input strictly per-pixel, i.e. its area of interest
+ * always matches the output area. Probed with two arbitrary areas so that operations that only
+ * map one specific area onto itself are not mistaken for per-pixel ones.
+ */
+static bool is_area_preserving_input(NodeOperation *op, const int input_index)
+{
+  rcti probes[2];
+  BLI_rcti_init(&probes[0], 0, 7, 0, 5);
+  BLI_rcti_init(&probes[1], 131, 419, 73, 257);
+
+  for (const rcti &probe : probes) {
+    rcti input_area;
+    op->get_area_of_interest(input_index, probe, input_area);
+    if (!BLI_rcti_compare(&probe, &input_area)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Whether the operation reads all of its inputs strictly per-pixel.
+ */
+static bool is_area_preserving_operation(NodeOperation *op)
+{
+  const int num_inputs = op->get_number_of_input_sockets();
+  for (int i = 0; i < num_inputs; i++) {
+    if (!is_area_preserving_input(op, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FullFrameExecutionModel::is_fusable_into(NodeOperation *op, NodeOperation *consumer)
+{
+  if (op->get_number_of_input_sockets() == 0 || op->get_number_of_output_sockets() != 1) {
+    return false;
+  }
+  if (op->get_width() == 0 || op->get_height() == 0 || consumer->get_width() == 0 ||
+      consumer->get_height() == 0)
+  {
+    return false;
+  }
+
+  const NodeOperationFlags flags = op->get_flags();
+  if (flags.is_constant_operation || flags.is_viewer_operation || flags.is_preview_operation) {
+    return false;
+  }
+  if (op->is_output_operation(context_.is_rendering())) {
+    return false;
+  }
+
+  /* Chained operations share tile rects, so canvases must match exactly. */
+  if (!BLI_rcti_compare(&op->get_canvas(), &consumer->get_canvas())) {
+    return false;
+  }
+
+  /* Operations with more than one read need their full buffer materialized. */
+  if (active_buffers_.get_registered_reads(op) != 1) {
+    return false;
+  }
+
+  /* The operation renders into tile sized buffers, so the consumer's reads of it must be
+   * per-pixel as well. Member consumers satisfy this by being area preserving themselves, but a
+   * chain tail can be any operation (e.g. a blur) whose expanded area of interest would read
+   * outside the tile buffer. */
+  const int num_consumer_inputs = consumer->get_number_of_input_sockets();
+  for (int i = 0; i < num_consumer_inputs; i++) {
+    if (consumer->get_input_operation(i) == op && !is_area_preserving_input(consumer, i)) {
+      return false;
+    }
+  }
+
+  return is_area_preserving_operation(op);
+}
+
+/**
+ * Appends chain members reading depth-first into given consumer, in inputs to consumer
+ * render order.
+ */
+static void collect_chain_members(NodeOperation *consumer,
+                                  const Set<NodeOperation *> &members,
+                                  Vector<NodeOperation *> &r_chain)
+{
+  const int num_inputs = consumer->get_number_of_input_sockets();
+  for (int i = 0; i < num_inputs; i++) {
+    NodeOperation *input = consumer->get_input_operation(i);
+    if (members.contains(input)) {
+      collect_chain_members(input, members, r_chain);
+      r_chain.append(input);
+    }
+  }
+}
+
+void FullFrameExecutionModel::determine_fused_chains()
+{
+  /* Map operations read by a single consumer to that consumer. */
+  Map<NodeOperation *, NodeOperation *> single_consumers;
+  for (NodeOperation *op : operations_) {
+    const int num_inputs = op->get_number_of_input_sockets();
+    for (int i = 0; i < num_inputs; i++) {
+      NodeOperation *input = op->get_input_operation(i);
+      if (active_buffers_.get_registered_reads(input) == 1) {
+        single_consumers.add(input, op);
+      }
+    }
+  }
+
+  /* Operations that render as part of their consumer's chain. Membership is transitive:
+   * a member's inputs may be members of the same chain through it. */
+  for (NodeOperation *op : operations_) {
+    NodeOperation *const *consumer = single_consumers.lookup_ptr(op);
+    if (consumer && is_fusable_into(op, *consumer)) {
+      fused_operations_.add(op);
+    }
+  }
+
+  /* Any non-member operation reading at least one member is a chain tail. */
+  for (NodeOperation *op : operations_) {
+    if (fused_operations_.contains(op)) {
+      continue;
+    }
+    Vector<NodeOperation *> chain;
+    collect_chain_members(op, fused_operations_, chain);
+    if (!chain.is_empty()) {
+      fused_chains_.add_new(op, std::move(chain));
+    }
+  }
+}
+
 Vector<MemoryBuffer *> FullFrameExecutionModel::get_input_buffers(NodeOperation *op,
                                                                   const int output_x,
                                                                   const int output_y)
@@ -99,6 +237,18 @@ MemoryBuffer *FullFrameExecutionModel::create_operation_buffer(NodeOperation *op
 
 void FullFrameExecutionModel::render_operation(NodeOperation *op)
 {
+  if (fused_operations_.contains(op)) {
+    /* Operation is rendered tile-by-tile along with the rest of its chain once the chain
+     * tail is rendered, see #render_fused_chain. Mark it as rendered (with no buffer) so
+     * that dependency walking skips it; its reads are reported when the tail finishes. */
+    active_buffers_.set_rendered_buffer(op, nullptr);
+    return;
+  }
+  if (const Vector<NodeOperation *> *chain = fused_chains_.lookup_ptr(op)) {
+    render_fused_chain(op, *chain);
+    return;
+  }
+
   /* Output has no offset for easier image algorithms implementation on operations. */
   constexpr int output_x = 0;
   constexpr int output_y = 0;
@@ -134,6 +284,107 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
   }
 }
 
+void FullFrameExecutionModel::render_fused_chain(NodeOperation *tail,
+                                                 const Span<NodeOperation *> members)
+{
+  /* Output has no offset for easier image algorithms implementation on operations. */
+  constexpr int output_x = 0;
+  constexpr int output_y = 0;
+
+  BLI_assert(tail->get_width() > 0 && tail->get_height() > 0);
+
+  const bool has_outputs = tail->get_number_of_output_sockets() > 0;
+  MemoryBuffer *tail_buf = has_outputs ? create_operation_buffer(tail, output_x, output_y) :
+                                         nullptr;
+  const int op_offset_x = output_x - tail->get_canvas().xmin;
+  const int op_offset_y = output_y - tail->get_canvas().ymin;
+  const Vector<rcti> areas = active_buffers_.get_areas_to_render(tail, op_offset_x, op_offset_y);
+
+  Vector<timeit::Nanoseconds> op_times(members.size() + 1, timeit::Nanoseconds::zero());
+
+  /* Tile sized buffers holding intermediate chain results. All operations in a chain share
+   * the same canvas, so a tile rect addresses the same pixels for every one of them. */
+  Map<NodeOperation *, std::unique_ptr<MemoryBuffer>> chain_bufs;
+
+  for (const rcti &area : areas) {
+    for (int tile_ymin = area.ymin; tile_ymin < area.ymax; tile_ymin += FUSED_TILE_SIZE) {
+      for (int tile_xmin = area.xmin; tile_xmin < area.xmax; tile_xmin += FUSED_TILE_SIZE) {
+        rcti tile;
+        BLI_rcti_init(&tile,
+                      tile_xmin,
+                      std::min(tile_xmin + FUSED_TILE_SIZE, int(area.xmax)),
+                      tile_ymin,
+                      std::min(tile_ymin + FUSED_TILE_SIZE, int(area.ymax)));
+
+        for (const int64_t op_index : IndexRange(members.size() + 1)) {
+          const bool is_tail = op_index == members.size();
+          NodeOperation *op = is_tail ? tail : members[op_index];
+
+          MemoryBuffer *out_buf;
+          if (is_tail) {
+            out_buf = tail_buf;
+          }
+          else {
+            const DataType data_type = op->get_output_socket(0)->get_data_type();
+            out_buf = new MemoryBuffer(data_type, tile, false);
+            chain_bufs.add_overwrite(op, std::unique_ptr<MemoryBuffer>(out_buf));
+          }
+
+          /* Chained inputs read the tile buffers, the rest view already rendered buffers
+           * just as #get_input_buffers does. */
+          const int num_inputs = op->get_number_of_input_sockets();
+          Vector<MemoryBuffer *> input_bufs(num_inputs);
+          Vector<MemoryBuffer *> input_views;
+          for (int i = 0; i < num_inputs; i++) {
+            NodeOperation *input = op->get_input_operation(i);
+            if (std::unique_ptr<MemoryBuffer> *chained_buf = chain_bufs.lookup_ptr(input)) {
+              input_bufs[i] = chained_buf->get();
+              continue;
+            }
+            const int offset_x = (input->get_canvas().xmin - op->get_canvas().xmin) + output_x;
+            const int offset_y = (input->get_canvas().ymin - op->get_canvas().ymin) + output_y;
+            MemoryBuffer *buf = active_buffers_.get_rendered_buffer(input);
+
+            rcti rect = buf->get_rect();
+            BLI_rcti_translate(&rect, offset_x, offset_y);
+            MemoryBuffer *view = new MemoryBuffer(
+                buf->get_buffer(), buf->get_num_channels(), rect, buf->is_a_single_elem());
+            input_views.append(view);
+            input_bufs[i] = view;
+          }
+
+          const timeit::TimePoint before_time = timeit::Clock::now();
+          op->render(out_buf, Span<rcti>(&tile, 1), input_bufs);
+          op_times[op_index] += timeit::Clock::now() - before_time;
+
+          for (MemoryBuffer *buf : input_views) {
+            delete buf;
+          }
+        }
+        chain_bufs.clear();
+      }
+    }
+  }
+  DebugInfo::operation_rendered(tail, tail_buf);
+
+  active_buffers_.set_rendered_buffer(tail, std::unique_ptr<MemoryBuffer>(tail_buf));
+
+  for (NodeOperation *op : members) {
+    operation_finished(op);
+  }
+  operation_finished(tail);
+
+  if (context_.get_profiler()) {
+    for (const int64_t op_index : IndexRange(members.size() + 1)) {
+      NodeOperation *op = op_index == members.size() ? tail : members[op_index];
+      const bNodeInstanceKey node_instance_key = op->get_node_instance_key();
+      if (node_instance_key != bke::NODE_INSTANCE_KEY_NONE) {
+        context_.get_profiler()->set_node_evaluation_time(node_instance_key, op_times[op_index]);
+      }
+    }
+  }
+}
+
 void FullFrameExecutionModel::render_operations()
 {
   const bool is_rendering = context_.is_rendering();
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "BLI_map.hh"
+#include "BLI_set.hh"
 #include "BLI_vector.hh"
 
 #include "COM_Enums.h"
@@ -43,6 +45,19 @@ class FullFrameExecutionModel : public ExecutionModel {
    */
   Vector<eCompositorPriority> priorities_;
 
+  /**
+   * Chains of per-pixel operations fused into their last operation (the chain tail), mapped
+   * by tail. The whole chain is rendered tile-by-tile when the tail is rendered, keeping the
+   * intermediate results in tile sized buffers instead of full frame ones.
+   */
+  Map<NodeOperation *, Vector<NodeOperation *>> fused_chains_;
+
+  /**
+   * Operations that are part of a fused chain (chain tails excluded). Their buffers are
+   * never materialized.
+   */
+  Set<NodeOperation *> fused_operations_;
+
  public:
   FullFrameExecutionModel(CompositorContext &context,
                           SharedOperationBuffers &shared_buffers,
@@ -52,6 +67,16 @@ class FullFrameExecutionModel : public ExecutionModel {
 
  private:
   void determine_areas_to_render_and_reads();
+  /**
+   * Determines chains of per-pixel operations that can be rendered tile-by-tile along with
+   * their single reader, avoiding full frame buffers for the intermediate results.
+   */
+  void determine_fused_chains();
+  /**
+   * Whether given operation can be fused into given consumer chain instead of rendering
+   * into its own full frame buffer.
+   */
+  bool is_fusable_into(NodeOperation *op, NodeOperation *consumer);
   /**
    * Render output operations in order of priority.
    */
@@ -64,6 +89,11 @@ class FullFrameExecutionModel : public ExecutionModel {
   Vector<MemoryBuffer *> get_input_buffers(NodeOperation *op, int output_x, int output_y);
   MemoryBuffer *create_operation_buffer(NodeOperation *op, int output_x, int output_y);
   void render_operation(NodeOperation *op);
+  /**
+   * Renders a fused chain tile-by-tile into the tail operation buffer. Only the tail buffer
+   * is full frame, chained operations render into tile sized buffers.
+   */
+  void render_fused_chain(NodeOperation *tail, Span<NodeOperation *> members);
 
   void operation_finished(NodeOperation *operation);
 
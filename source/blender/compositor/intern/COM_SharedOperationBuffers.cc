@@ -41,6 +41,11 @@ bool SharedOperationBuffers::has_registered_reads(NodeOperation *op)
   return get_buffer_data(op).registered_reads > 0;
 }
 
+int SharedOperationBuffers::get_registered_reads(NodeOperation *op)
+{
+  return get_buffer_data(op).registered_reads;
+}
+
 void SharedOperationBuffers::register_read(NodeOperation *read_op)
 {
   get_buffer_data(read_op).registered_reads++;
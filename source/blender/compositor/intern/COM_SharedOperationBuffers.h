@@ -50,6 +50,10 @@ class SharedOperationBuffers {
    * given operation).
    */
   bool has_registered_reads(NodeOperation *op);
+  /**
+   * Number of registered reads for given operation.
+   */
+  int get_registered_reads(NodeOperation *op);
   /**
    * Registers an operation read (other operation depends on given operation).
    */
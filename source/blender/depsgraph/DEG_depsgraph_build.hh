@@ -66,12 +66,23 @@ void DEG_graph_build_from_ids(Depsgraph *graph, blender::Span<ID *> ids);
 /** Tag relations from the given graph for update. */
 void DEG_graph_tag_relations_update(Depsgraph *graph);
 
+/**
+ * Tag relations involving the given ID for update.
+ *
+ * Use when it is known that only relations of this ID changed (constraint added to an object,
+ * for example). Graphs which do not contain the ID will skip the relations rebuild entirely.
+ */
+void DEG_graph_tag_relations_update_for_id(Depsgraph *graph, ID *id);
+
 /** Create or update relations in the specified graph. */
 void DEG_graph_relations_update(Depsgraph *graph);
 
 /** Tag all relations in the database for update. */
 void DEG_relations_tag_update(Main *bmain);
 
+/** Tag relations involving the given ID for update, in all registered dependency graphs. */
+void DEG_relations_tag_update_for_id(Main *bmain, ID *id);
+
 /* Add Dependencies  ----------------------------- */
 
 /**
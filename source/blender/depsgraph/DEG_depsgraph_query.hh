@@ -20,6 +20,7 @@
 /* Needed for the instance iterator. */
 #include "DNA_object_types.h"
 
+#include "BKE_duplilist.hh"
 #include "BKE_object_types.hh"
 
 struct BLI_Iterator;
@@ -192,8 +193,8 @@ struct DEGObjectIterData {
 
   /* Object which created the dupli-list. */
   Object *dupli_parent;
-  /* List of duplicated objects. */
-  ListBase *dupli_list;
+  /* List of duplicated objects, owned by the iterator. */
+  DupliList *dupli_list;
   /* Next duplicated object to step into. */
   DupliObject *dupli_object_next;
   /* Corresponds to current object: current iterator object is evaluated from
@@ -74,6 +74,7 @@ struct ComponentNode;
 struct DepsNodeHandle;
 struct Depsgraph;
 class DepsgraphBuilderCache;
+class DriverDescriptor;
 struct IDNode;
 struct Node;
 struct OperationNode;
@@ -280,6 +281,7 @@ class DepsgraphRelationBuilder : public DepsgraphBuilder {
   virtual void build_copy_on_write_relations(IDNode *id_node);
   virtual void build_driver_relations();
   virtual void build_driver_relations(IDNode *id_node);
+  void build_driver_group_relations(Span<DriverDescriptor> prefix_group);
 
   template<typename KeyType> OperationNode *find_operation_node(const KeyType &key);
 
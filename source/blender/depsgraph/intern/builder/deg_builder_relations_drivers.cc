@@ -12,7 +12,9 @@
 
 #include <cstring>
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
+#include "BLI_task.hh"
 
 #include "DNA_anim_types.h"
 
@@ -138,100 +140,134 @@ static bool is_reachable(const Node *const from, const Node *const to)
 
 /* **** DepsgraphRelationBuilder functions **** */
 
-void DepsgraphRelationBuilder::build_driver_relations()
-{
-  for (IDNode *id_node : graph_->id_nodes) {
-    build_driver_relations(id_node);
-  }
-}
+namespace {
 
-void DepsgraphRelationBuilder::build_driver_relations(IDNode *id_node)
+/**
+ * Driver groups of one ID, mapping RNA prefix -> set of driver descriptors.
+ * The descriptors reference #id_ptr, don't relocate this after building.
+ */
+struct IDDriverGroups {
+  PointerRNA id_ptr;
+  Map<string, Vector<DriverDescriptor>> groups;
+};
+
+}  // namespace
+
+static void build_id_driver_groups(IDNode *id_node, IDDriverGroups &r_driver_groups)
 {
-  /* Add relations between drivers that write to the same datablock.
-   *
-   * This prevents threading issues when two separate RNA properties write to
-   * the same memory address. For example:
-   * - Drivers on individual array elements, as the animation system will write
-   *   the whole array back to RNA even when changing individual array value.
-   * - Drivers on RNA properties that map to a single bit flag. Changing the RNA
-   *   value will write the entire int containing the bit, in a non-thread-safe
-   *   way.
-   */
   ID *id_orig = id_node->id_orig;
   AnimData *adt = BKE_animdata_from_id(id_orig);
   if (adt == nullptr) {
     return;
   }
 
-  /* Mapping from RNA prefix -> set of driver descriptors: */
-  Map<string, Vector<DriverDescriptor>> driver_groups;
-
-  PointerRNA id_ptr = RNA_id_pointer_create(id_orig);
+  r_driver_groups.id_ptr = RNA_id_pointer_create(id_orig);
 
   LISTBASE_FOREACH (FCurve *, fcu, &adt->drivers) {
     if (fcu->rna_path == nullptr) {
       continue;
     }
 
-    DriverDescriptor driver_desc(&id_ptr, fcu);
+    DriverDescriptor driver_desc(&r_driver_groups.id_ptr, fcu);
     if (!driver_desc.driver_relations_needed()) {
       continue;
     }
 
-    driver_groups.lookup_or_add_default_as(driver_desc.rna_prefix).append(driver_desc);
+    r_driver_groups.groups.lookup_or_add_default_as(driver_desc.rna_prefix).append(driver_desc);
   }
+}
 
-  for (Span<DriverDescriptor> prefix_group : driver_groups.values()) {
-    /* For each node in the driver group, try to connect it to another node
-     * in the same group without creating any cycles. */
-    int num_drivers = prefix_group.size();
-    if (num_drivers < 2) {
-      /* A relation requires two drivers. */
-      continue;
+void DepsgraphRelationBuilder::build_driver_relations()
+{
+  /* Describing the drivers resolves their RNA paths, which is the expensive part of this step
+   * and only reads original data: fan it out over all IDs into per-ID staging buffers. Adding
+   * the relations has to stay serial, it mutates shared graph state and checks reachability
+   * against the relations added for previous IDs. */
+  Array<IDDriverGroups> driver_groups(graph_->id_nodes.size());
+  threading::parallel_for(driver_groups.index_range(), 8, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      build_id_driver_groups(graph_->id_nodes[i], driver_groups[i]);
+    }
+  });
+
+  for (const IDDriverGroups &id_driver_groups : driver_groups) {
+    for (Span<DriverDescriptor> prefix_group : id_driver_groups.groups.values()) {
+      build_driver_group_relations(prefix_group);
     }
-    for (int from_index = 0; from_index < num_drivers; ++from_index) {
-      const DriverDescriptor &driver_from = prefix_group[from_index];
-      Node *op_from = get_node(driver_from.depsgraph_key());
-
-      /* Start by trying the next node in the group. */
-      for (int to_offset = 1; to_offset < num_drivers; ++to_offset) {
-        const int to_index = (from_index + to_offset) % num_drivers;
-        const DriverDescriptor &driver_to = prefix_group[to_index];
-        Node *op_to = get_node(driver_to.depsgraph_key());
-
-        /* Duplicate drivers can exist (see #78615), but cannot be distinguished by OperationKey
-         * and thus have the same depsgraph node. Relations between those drivers should not be
-         * created. This not something that is expected to happen (both the UI and the Python API
-         * prevent duplicate drivers), it did happen in a file and it is easy to deal with here. */
-        if (op_from == op_to) {
+  }
+}
+
+void DepsgraphRelationBuilder::build_driver_relations(IDNode *id_node)
+{
+  IDDriverGroups driver_groups;
+  build_id_driver_groups(id_node, driver_groups);
+  for (Span<DriverDescriptor> prefix_group : driver_groups.groups.values()) {
+    build_driver_group_relations(prefix_group);
+  }
+}
+
+void DepsgraphRelationBuilder::build_driver_group_relations(
+    const Span<DriverDescriptor> prefix_group)
+{
+  /* Add relations between drivers that write to the same datablock.
+   *
+   * This prevents threading issues when two separate RNA properties write to
+   * the same memory address. For example:
+   * - Drivers on individual array elements, as the animation system will write
+   *   the whole array back to RNA even when changing individual array value.
+   * - Drivers on RNA properties that map to a single bit flag. Changing the RNA
+   *   value will write the entire int containing the bit, in a non-thread-safe
+   *   way.
+   *
+   * For each node in the driver group, try to connect it to another node
+   * in the same group without creating any cycles. */
+  int num_drivers = prefix_group.size();
+  if (num_drivers < 2) {
+    /* A relation requires two drivers. */
+    return;
+  }
+  for (int from_index = 0; from_index < num_drivers; ++from_index) {
+    const DriverDescriptor &driver_from = prefix_group[from_index];
+    Node *op_from = get_node(driver_from.depsgraph_key());
+
+    /* Start by trying the next node in the group. */
+    for (int to_offset = 1; to_offset < num_drivers; ++to_offset) {
+      const int to_index = (from_index + to_offset) % num_drivers;
+      const DriverDescriptor &driver_to = prefix_group[to_index];
+      Node *op_to = get_node(driver_to.depsgraph_key());
+
+      /* Duplicate drivers can exist (see #78615), but cannot be distinguished by OperationKey
+       * and thus have the same depsgraph node. Relations between those drivers should not be
+       * created. This not something that is expected to happen (both the UI and the Python API
+       * prevent duplicate drivers), it did happen in a file and it is easy to deal with here. */
+      if (op_from == op_to) {
+        continue;
+      }
+
+      if (from_index < to_index && driver_from.is_same_array_as(driver_to)) {
+        /* This is for adding a relation like `color[0]` -> `color[1]`.
+         * When the search for another driver wraps around,
+         * we cannot blindly add relations any more. */
+      }
+      else {
+        /* Investigate whether this relation would create a dependency cycle.
+         * Example graph:
+         *     A -> B -> C
+         * and investigating a potential connection C->A. Because A->C is an
+         * existing transitive connection, adding C->A would create a cycle. */
+        if (is_reachable(op_to, op_from)) {
           continue;
         }
 
-        if (from_index < to_index && driver_from.is_same_array_as(driver_to)) {
-          /* This is for adding a relation like `color[0]` -> `color[1]`.
-           * When the search for another driver wraps around,
-           * we cannot blindly add relations any more. */
+        /* No need to directly connect this node if there is already a transitive connection. */
+        if (is_reachable(op_from, op_to)) {
+          break;
         }
-        else {
-          /* Investigate whether this relation would create a dependency cycle.
-           * Example graph:
-           *     A -> B -> C
-           * and investigating a potential connection C->A. Because A->C is an
-           * existing transitive connection, adding C->A would create a cycle. */
-          if (is_reachable(op_to, op_from)) {
-            continue;
-          }
-
-          /* No need to directly connect this node if there is already a transitive connection. */
-          if (is_reachable(op_from, op_to)) {
-            break;
-          }
-        }
-
-        add_operation_relation(
-            op_from->get_exit_operation(), op_to->get_entry_operation(), "Driver Serialization");
-        break;
       }
+
+      add_operation_relation(
+          op_from->get_exit_operation(), op_to->get_entry_operation(), "Driver Serialization");
+      break;
     }
   }
 }
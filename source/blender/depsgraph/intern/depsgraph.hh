@@ -98,6 +98,11 @@ struct Depsgraph {
   /* Indicates whether relations needs to be updated. */
   bool need_update_relations;
 
+  /* Session UIDs of IDs tagged via #DEG_graph_tag_relations_update_for_id. Allows the relations
+   * update to be skipped entirely when none of the tagged IDs are part of this graph.
+   * Only meaningful when need_update_relations is false. */
+  Set<uint> ids_tagged_for_relations_update;
+
   /* Indicates whether indirect effect of nodes on a directly visible ones needs to be updated. */
   bool need_update_nodes_visibility;
 
@@ -288,6 +288,8 @@ void DEG_graph_tag_relations_update(Depsgraph *graph)
   DEG_DEBUG_PRINTF(graph, TAG, "%s: Tagging relations for update.\n", __func__);
   deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
   deg_graph->need_update_relations = true;
+  /* The full tag subsumes any pending per-ID tags. */
+  deg_graph->ids_tagged_for_relations_update.clear();
 
   /* NOTE: When relations are updated, it's quite possible that we've got new bases in the scene.
    * This means, we need to re-create flat array of bases in view layer. */
@@ -304,12 +306,39 @@ void DEG_graph_tag_relations_update(Depsgraph *graph)
   }
 }
 
+void DEG_graph_tag_relations_update_for_id(Depsgraph *graph, ID *id)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
+  if (deg_graph->need_update_relations) {
+    /* A full relations update is already pending, it subsumes the per-ID tag. */
+    return;
+  }
+  DEG_DEBUG_PRINTF(graph, TAG, "%s: Tagging relations of %s for update.\n", __func__, id->name);
+  deg_graph->ids_tagged_for_relations_update.add(id->session_uid);
+}
+
 void DEG_graph_relations_update(Depsgraph *graph)
 {
   deg::Depsgraph *deg_graph = (deg::Depsgraph *)graph;
   if (!deg_graph->need_update_relations) {
-    /* Graph is up to date, nothing to do. */
-    return;
+    if (deg_graph->ids_tagged_for_relations_update.is_empty()) {
+      /* Graph is up to date, nothing to do. */
+      return;
+    }
+    /* Only per-ID tags are pending: a rebuild is only needed when one of the tagged IDs actually
+     * participates in this graph. Scheduled state of other IDs is preserved across the rebuild
+     * by the builder, so skipping here is purely an optimization. */
+    bool any_tagged_id_in_graph = false;
+    for (const deg::IDNode *id_node : deg_graph->id_nodes) {
+      if (deg_graph->ids_tagged_for_relations_update.contains(id_node->id_orig_session_uid)) {
+        any_tagged_id_in_graph = true;
+        break;
+      }
+    }
+    deg_graph->ids_tagged_for_relations_update.clear();
+    if (!any_tagged_id_in_graph) {
+      return;
+    }
   }
   DEG_graph_build_from_view_layer(graph);
 }
@@ -321,3 +350,11 @@ void DEG_relations_tag_update(Main *bmain)
     DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
   }
 }
+
+void DEG_relations_tag_update_for_id(Main *bmain, ID *id)
+{
+  DEG_GLOBAL_DEBUG_PRINTF(TAG, "%s: Tagging relations of %s for update.\n", __func__, id->name);
+  for (deg::Depsgraph *depsgraph : deg::get_all_registered_graphs(bmain)) {
+    DEG_graph_tag_relations_update_for_id(reinterpret_cast<Depsgraph *>(depsgraph), id);
+  }
+}
@@ -115,11 +115,11 @@ bool deg_object_hide_original(eEvaluationMode eval_mode, Object *ob, DupliObject
   return false;
 }
 
-void deg_iterator_duplis_init(DEGObjectIterData *data, Object *object, ListBase *duplis)
+void deg_iterator_duplis_init(DEGObjectIterData *data, Object *object, DupliList *duplis)
 {
   data->dupli_parent = object;
   data->dupli_list = duplis;
-  data->dupli_object_next = static_cast<DupliObject *>(duplis->first);
+  data->dupli_object_next = duplis->is_empty() ? nullptr : duplis->begin();
 }
 
 /* Returns false when iterator is exhausted. */
@@ -133,7 +133,7 @@ bool deg_iterator_duplis_step(DEGObjectIterData *data)
     DupliObject *dob = data->dupli_object_next;
     Object *obd = dob->ob;
 
-    data->dupli_object_next = data->dupli_object_next->next;
+    data->dupli_object_next = (dob + 1 != data->dupli_list->end()) ? dob + 1 : nullptr;
 
     if (dob->no_draw) {
       continue;
@@ -190,7 +190,7 @@ bool deg_iterator_duplis_step(DEGObjectIterData *data)
   }
 
   free_owned_memory(data);
-  free_object_duplilist(data->dupli_list);
+  MEM_delete(data->dupli_list);
   data->dupli_parent = nullptr;
   data->dupli_list = nullptr;
   data->dupli_object_next = nullptr;
@@ -252,8 +252,9 @@ bool deg_iterator_objects_step(DEGObjectIterData *data)
 
     const bool use_preview = object_orig == data->object_orig_with_preview;
     if (use_preview) {
-      ListBase *preview_duplis = object_duplilist_preview(
-          data->graph, data->scene, object, data->settings->viewer_path);
+      DupliList *preview_duplis = MEM_new<DupliList>(__func__);
+      object_duplilist_preview(
+          data->graph, data->scene, object, data->settings->viewer_path, *preview_duplis);
       deg_iterator_duplis_init(data, object, preview_duplis);
       data->id_node_index++;
       return true;
@@ -273,7 +274,8 @@ bool deg_iterator_objects_step(DEGObjectIterData *data)
           ((object->transflag & OB_DUPLI) || object->runtime->geometry_set_eval != nullptr))
       {
         BLI_assert(deg::deg_validate_eval_copy_datablock(&object->id));
-        ListBase *duplis = object_duplilist(data->graph, data->scene, object);
+        DupliList *duplis = MEM_new<DupliList>(__func__);
+        object_duplilist(data->graph, data->scene, object, *duplis);
         deg_iterator_duplis_init(data, object, duplis);
       }
     }
@@ -785,9 +785,12 @@ ID *deg_expand_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
   BLI_assert(check_datablock_expanded(id_cow) == false);
   BLI_assert(id_cow->py_instance == nullptr);
 
-  /* Copy data from original ID to a copied version. */
-  /* TODO(sergey): Avoid doing full ID copy somehow, make Mesh to reference
-   * original geometry arrays for until those are modified. */
+  /* Copy data from original ID to a copied version.
+   *
+   * NOTE: Geometry attribute payloads are not duplicated here: #CustomData_copy shares the layer
+   * arrays with the original data-block via #blender::ImplicitSharingInfo, so expansion of
+   * Mesh/Curves/PointCloud only copies metadata. The arrays are un-shared lazily when an
+   * evaluation function actually writes to them. */
   /* TODO(sergey): We do some trickery with temp bmain and extra ID pointer
    * just to be able to use existing API. Ideally we need to replace this with
    * in-place copy from existing datablock to a prepared memory.
@@ -810,11 +813,6 @@ ID *deg_expand_eval_copy_datablock(const Depsgraph *depsgraph, const IDNode *id_
       }
       break;
     }
-    case ID_ME: {
-      /* TODO(sergey): Ideally we want to handle meshes in a special
-       * manner here to avoid initial copy of all the geometry arrays. */
-      break;
-    }
     default:
       break;
   }
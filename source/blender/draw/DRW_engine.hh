@@ -184,6 +184,9 @@ void DRW_cache_free_old_subdiv();
 /* For the OpenGL evaluators and garbage collected subdivision data. */
 void DRW_subdiv_free();
 
+/* For the compute shader used by the mesh extraction GPU path. */
+void DRW_mesh_extract_pos_free();
+
 }  // namespace blender::draw
 
 /* Never use this. Only for closing blender. */
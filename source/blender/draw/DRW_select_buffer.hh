@@ -61,6 +61,11 @@ struct SELECTID_Context {
 
   short select_mode;
 
+  /** CPU side copy of the select ID buffer, filled from the asynchronous readback on the first
+   * query after drawing. Subsequent queries read from it directly instead of from the GPU. */
+  blender::Array<uint> pixel_buf;
+  int pixel_buf_size[2];
+
   /* To check for updates. */
   float persmat[4][4];
   bool is_dirty(RegionView3D *rv3d);
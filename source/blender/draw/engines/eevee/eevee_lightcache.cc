@@ -8,13 +8,18 @@
  * Eevee's indirect lighting cache.
  */
 
+#include <mutex>
+
 #include "DRW_render.hh"
 
 #include "BKE_global.hh"
 
 #include "BLI_endian_switch.h"
+#include "BLI_hash_mm2a.hh"
+#include "BLI_map.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
@@ -22,7 +27,9 @@
 #include "BKE_object.hh"
 
 #include "DNA_collection_types.h"
+#include "DNA_light_types.h"
 #include "DNA_lightprobe_types.h"
+#include "DNA_mesh_types.h"
 
 #include "eevee_lightcache.h"
 #include "eevee_private.hh"
@@ -155,12 +162,144 @@ struct EEVEE_LightBake {
   /** Scene frame to bake. */
   int frame;
 
+  /* Incremental baking */
+  /** Skip probes whose lighting inputs did not change since the last completed bake. */
+  bool incremental;
+  /** Signature of everything that is not a probe but can influence the bake result. */
+  uint64_t scene_hash;
+  /** Per probe signatures, in sorted cache order (index 0 is reserved for the world). */
+  uint64_t *grid_hash, *cube_hash;
+  /** True if every irradiance grid is unchanged and the whole grid pass can be skipped. */
+  bool skip_grids;
+  /** Reflection cubes that do not need to be re-rendered. */
+  bool *cube_skip;
+
   /** If running in parallel (in a separate thread), use this context. */
   void *system_gpu_context, *blender_gpu_context;
 
   ThreadMutex *mutex;
 };
 
+/* -------------------------------------------------------------------- */
+/** \name Incremental Baking
+ *
+ * Keep a signature of the inputs of the last completed bake so that auto-bakes triggered by
+ * probe edits do not re-render probes whose result cannot have changed. The signatures are
+ * runtime only data: #LightCache is written to files and cannot hold them.
+ * \{ */
+
+struct LightCacheBakeSignature {
+  uint64_t scene_hash;
+  blender::Vector<uint64_t> grid_hashes;
+  blender::Vector<uint64_t> cube_hashes;
+};
+
+/** Signatures of the last completed bake, keyed by the cache they describe.
+ * Accessed from both the baking job thread and the main thread, hence the mutex. */
+static blender::Map<const LightCache *, LightCacheBakeSignature> g_bake_signatures;
+static std::mutex g_bake_signatures_mutex;
+
+static uint64_t eevee_lightbake_hash_data(uint64_t hash, const void *data, size_t len)
+{
+  return hash * 65599 + BLI_hash_mm2(static_cast<const uchar *>(data), len, 0x6c8e9cf5);
+}
+
+static uint64_t eevee_lightbake_probe_hash(const LightProbe *prb,
+                                           const void *cache_data,
+                                           const size_t cache_data_len)
+{
+  /* The packed cache data covers transform, influence and resolution. Add the probe settings
+   * that only influence the capture itself. */
+  uint64_t hash = eevee_lightbake_hash_data(0, cache_data, cache_data_len);
+  const float params[6] = {
+      prb->clipsta, prb->clipend, prb->intensity, prb->vis_bias, prb->vis_bleedbias, prb->vis_blur};
+  return eevee_lightbake_hash_data(hash, params, sizeof(params));
+}
+
+static uint64_t eevee_lightbake_object_hash(Object *ob)
+{
+  uint64_t hash = eevee_lightbake_hash_data(0, ob->id.name, strlen(ob->id.name));
+  hash = eevee_lightbake_hash_data(hash, ob->object_to_world().base_ptr(), sizeof(float[4][4]));
+
+  if (ob->type == OB_LAMP) {
+    const Light *la = static_cast<const Light *>(ob->data);
+    hash = eevee_lightbake_hash_data(hash, &la->type, sizeof(la->type));
+    const float params[8] = {
+        la->r, la->g, la->b, la->energy, la->radius, la->spotsize, la->spotblend, float(la->mode)};
+    hash = eevee_lightbake_hash_data(hash, params, sizeof(params));
+  }
+  else if (const Mesh *mesh = BKE_object_get_evaluated_mesh(ob)) {
+    /* Object level granularity: element counts and bounds catch most edits without hashing the
+     * full geometry. Material edits are not detected, which is why skipping is restricted to
+     * auto-bakes and a manual bake always re-renders everything. */
+    const int counts[3] = {mesh->verts_num, mesh->edges_num, mesh->faces_num};
+    hash = eevee_lightbake_hash_data(hash, counts, sizeof(counts));
+    if (const std::optional<blender::Bounds<blender::float3>> bounds = mesh->bounds_min_max()) {
+      hash = eevee_lightbake_hash_data(hash, &bounds->min, sizeof(bounds->min));
+      hash = eevee_lightbake_hash_data(hash, &bounds->max, sizeof(bounds->max));
+    }
+  }
+  return hash;
+}
+
+static void eevee_lightbake_skip_unchanged_probes(EEVEE_LightBake *lbake)
+{
+  LightCache *lcache = lbake->lcache;
+
+  if (!lbake->incremental) {
+    return;
+  }
+  /* A freshly created cache holds no previous data to reuse. */
+  if (lbake->own_light_cache) {
+    return;
+  }
+  /* World lighting leaks into every probe. */
+  if (lcache->flag & LIGHTCACHE_UPDATE_WORLD) {
+    return;
+  }
+
+  std::lock_guard lock(g_bake_signatures_mutex);
+  const LightCacheBakeSignature *signature = g_bake_signatures.lookup_ptr(lcache);
+  if (signature == nullptr || signature->scene_hash != lbake->scene_hash ||
+      signature->grid_hashes.size() != lbake->grid_len ||
+      signature->cube_hashes.size() != lbake->cube_len)
+  {
+    return;
+  }
+
+  /* Grids light each other through the diffuse bounces, they can only be skipped together. */
+  lbake->skip_grids = true;
+  for (int i = 1; i < lbake->grid_len; i++) {
+    if (signature->grid_hashes[i] != lbake->grid_hash[i]) {
+      lbake->skip_grids = false;
+      return;
+    }
+  }
+
+  /* Cube captures sample the grid irradiance, so they are only reusable if the grids are. */
+  for (int i = 1; i < lbake->cube_len; i++) {
+    lbake->cube_skip[i] = (signature->cube_hashes[i] == lbake->cube_hash[i]);
+  }
+}
+
+static void eevee_lightbake_store_signature(EEVEE_LightBake *lbake, const bool aborted)
+{
+  std::lock_guard lock(g_bake_signatures_mutex);
+  if (aborted) {
+    /* Partial results: force a full bake next time. */
+    g_bake_signatures.remove(lbake->lcache);
+    return;
+  }
+  LightCacheBakeSignature &signature = g_bake_signatures.lookup_or_add_default(lbake->lcache);
+  signature.scene_hash = lbake->scene_hash;
+  signature.grid_hashes = blender::Vector<uint64_t>(
+      blender::Span(lbake->grid_hash, lbake->grid_len));
+  signature.cube_hashes = blender::Vector<uint64_t>(
+      blender::Span(lbake->cube_hash, lbake->cube_len));
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Light Cache
  * \{ */
@@ -505,6 +644,11 @@ static void eevee_lightbake_readback_reflections(LightCache *lcache)
 
 void EEVEE_lightcache_free(LightCache *lcache)
 {
+  {
+    std::lock_guard lock(g_bake_signatures_mutex);
+    g_bake_signatures.remove(lcache);
+  }
+
   DRW_TEXTURE_FREE_SAFE(lcache->cube_tx.tex);
   MEM_SAFE_FREE(lcache->cube_tx.data);
   DRW_TEXTURE_FREE_SAFE(lcache->grid_tx.tex);
@@ -732,6 +876,12 @@ static void eevee_lightbake_create_resources(EEVEE_LightBake *lbake)
       MEM_callocN(sizeof(LightProbe *) * lbake->cube_len, "EEVEE Cube visgroup ptr"));
   lbake->grid_prb = static_cast<LightProbe **>(
       MEM_callocN(sizeof(LightProbe *) * lbake->grid_len, "EEVEE Grid visgroup ptr"));
+  lbake->cube_hash = static_cast<uint64_t *>(
+      MEM_callocN(sizeof(uint64_t) * lbake->cube_len, "EEVEE Cube bake hash"));
+  lbake->grid_hash = static_cast<uint64_t *>(
+      MEM_callocN(sizeof(uint64_t) * lbake->grid_len, "EEVEE Grid bake hash"));
+  lbake->cube_skip = static_cast<bool *>(
+      MEM_callocN(sizeof(bool) * lbake->cube_len, "EEVEE Cube bake skip"));
 
   eGPUTextureUsage usage = GPU_TEXTURE_USAGE_SHADER_READ | GPU_TEXTURE_USAGE_ATTACHMENT |
                            GPU_TEXTURE_USAGE_HOST_READ;
@@ -777,7 +927,8 @@ wmJob *EEVEE_lightbake_job_create(wmWindowManager *wm,
                                   ViewLayer *view_layer,
                                   Scene *scene,
                                   int delay,
-                                  int frame)
+                                  int frame,
+                                  bool incremental)
 {
   EEVEE_LightBake *lbake = nullptr;
 
@@ -816,6 +967,7 @@ wmJob *EEVEE_lightbake_job_create(wmWindowManager *wm,
     lbake->own_resources = true;
     lbake->delay = delay;
     lbake->frame = frame;
+    lbake->incremental = incremental;
 
     if (lbake->system_gpu_context == nullptr && !GPU_use_main_context_workaround()) {
       lbake->system_gpu_context = WM_system_gpu_context_create();
@@ -831,6 +983,7 @@ wmJob *EEVEE_lightbake_job_create(wmWindowManager *wm,
     lbake = static_cast<EEVEE_LightBake *>(
         EEVEE_lightbake_job_data_alloc(bmain, view_layer, scene, true, frame));
     lbake->delay = delay;
+    lbake->incremental = incremental;
   }
 
   WM_jobs_customdata_set(wm_job, lbake, EEVEE_lightbake_job_data_free);
@@ -879,6 +1032,9 @@ void EEVEE_lightbake_job_data_free(void *custom_data)
 
   MEM_SAFE_FREE(lbake->cube_prb);
   MEM_SAFE_FREE(lbake->grid_prb);
+  MEM_SAFE_FREE(lbake->cube_hash);
+  MEM_SAFE_FREE(lbake->grid_hash);
+  MEM_SAFE_FREE(lbake->cube_skip);
 
   BLI_mutex_free(lbake->mutex);
 
@@ -1335,6 +1491,21 @@ static void eevee_lightbake_gather_probes(EEVEE_LightBake *lbake)
   int cube_len = 1;
   int total_irr_samples = 1;
 
+  uint64_t scene_hash = 0;
+  {
+    /* Bake quality settings invalidate every probe result. */
+    const SceneEEVEE *eevee = &scene_eval->eevee;
+    const int params[3] = {
+        eevee->gi_diffuse_bounces, eevee->gi_cubemap_resolution, eevee->gi_visibility_resolution};
+    scene_hash = eevee_lightbake_hash_data(scene_hash, params, sizeof(params));
+    const float fparams[2] = {eevee->gi_glossy_clamp, eevee->gi_filter_quality};
+    scene_hash = eevee_lightbake_hash_data(scene_hash, fparams, sizeof(fparams));
+    if (scene_eval->world) {
+      scene_hash = eevee_lightbake_hash_data(
+          scene_hash, scene_eval->world->id.name, strlen(scene_eval->world->id.name));
+    }
+  }
+
   /* Convert all lightprobes to tight UBO data from all lightprobes in the scene.
    * This allows a large number of probe to be precomputed (even dupli ones). */
   DEGObjectIterSettings deg_iter_settings = {nullptr};
@@ -1360,6 +1531,11 @@ static void eevee_lightbake_gather_probes(EEVEE_LightBake *lbake)
         EEVEE_lightprobes_cube_data_from_object(ob, eprobe);
       }
     }
+    else {
+      /* Everything else contributes to the signature used to detect unchanged probes. */
+      const uint64_t ob_hash = eevee_lightbake_object_hash(ob);
+      scene_hash = eevee_lightbake_hash_data(scene_hash, &ob_hash, sizeof(ob_hash));
+    }
   }
   DEG_OBJECT_ITER_END;
 
@@ -1374,6 +1550,18 @@ static void eevee_lightbake_gather_probes(EEVEE_LightBake *lbake)
              lbake->cube_len - 1,
              eevee_lightbake_cube_comp);
 
+  /* Per probe signatures have to be computed after sorting so that indices of the last and the
+   * current bake refer to the same layer in the cache textures. */
+  lbake->scene_hash = scene_hash;
+  for (int i = 1; i < lbake->grid_len; i++) {
+    lbake->grid_hash[i] = eevee_lightbake_probe_hash(
+        lbake->grid_prb[i], &lcache->grid_data[i], sizeof(EEVEE_LightGrid));
+  }
+  for (int i = 1; i < lbake->cube_len; i++) {
+    lbake->cube_hash[i] = eevee_lightbake_probe_hash(
+        lbake->cube_prb[i], &lcache->cube_data[i], sizeof(EEVEE_LightProbe));
+  }
+
   lbake->total = lbake->total_irr_samples * lbake->bounce_len + lbake->cube_len;
   lbake->done = 0;
 }
@@ -1459,6 +1647,7 @@ void EEVEE_lightbake_job(void *custom_data, wmJobWorkerStatus *worker_status)
 
   /* Gather all probes data */
   eevee_lightbake_gather_probes(lbake);
+  eevee_lightbake_skip_unchanged_probes(lbake);
 
   LightCache *lcache = lbake->lcache;
 
@@ -1478,20 +1667,29 @@ void EEVEE_lightbake_job(void *custom_data, wmJobWorkerStatus *worker_status)
 
   /* Render irradiance grids */
   if (lcache->flag & LIGHTCACHE_UPDATE_GRID) {
-    for (lbake->bounce_curr = 0; lbake->bounce_curr < lbake->bounce_len; lbake->bounce_curr++) {
-      /* Bypass world, start at 1. */
-      lbake->probe = lbake->grid_prb + 1;
-      lbake->grid = lcache->grid_data + 1;
-      for (lbake->grid_curr = 1; lbake->grid_curr < lbake->grid_len;
-           lbake->grid_curr++, lbake->probe++, lbake->grid++)
-      {
-        LightProbe *prb = *lbake->probe;
-        lbake->grid_sample_len = prb->grid_resolution_x * prb->grid_resolution_y *
-                                 prb->grid_resolution_z;
-        for (lbake->grid_sample = 0; lbake->grid_sample < lbake->grid_sample_len;
-             ++lbake->grid_sample)
+    if (lbake->skip_grids) {
+      /* All grids are unchanged since the last completed bake: keep the previous irradiance. */
+      lbake->done += lbake->total_irr_samples * lbake->bounce_len;
+      *lbake->progress = lbake->done / float(lbake->total);
+      *lbake->do_update = true;
+      lcache->flag &= ~LIGHTCACHE_UPDATE_GRID;
+    }
+    else {
+      for (lbake->bounce_curr = 0; lbake->bounce_curr < lbake->bounce_len; lbake->bounce_curr++) {
+        /* Bypass world, start at 1. */
+        lbake->probe = lbake->grid_prb + 1;
+        lbake->grid = lcache->grid_data + 1;
+        for (lbake->grid_curr = 1; lbake->grid_curr < lbake->grid_len;
+             lbake->grid_curr++, lbake->probe++, lbake->grid++)
         {
-          lightbake_do_sample(lbake, eevee_lightbake_render_grid_sample);
+          LightProbe *prb = *lbake->probe;
+          lbake->grid_sample_len = prb->grid_resolution_x * prb->grid_resolution_y *
+                                   prb->grid_resolution_z;
+          for (lbake->grid_sample = 0; lbake->grid_sample < lbake->grid_sample_len;
+               ++lbake->grid_sample)
+          {
+            lightbake_do_sample(lbake, eevee_lightbake_render_grid_sample);
+          }
         }
       }
     }
@@ -1505,10 +1703,24 @@ void EEVEE_lightbake_job(void *custom_data, wmJobWorkerStatus *worker_status)
     for (lbake->cube_offset = 1; lbake->cube_offset < lbake->cube_len;
          lbake->cube_offset++, lbake->probe++, lbake->cube++)
     {
+      if (lbake->cube_skip[lbake->cube_offset]) {
+        /* Unchanged since the last completed bake: keep the previous capture. The cache is
+         * displayed progressively, so the skipped cube still counts as rendered. */
+        lcache->cube_len += 1;
+        lbake->done += 1;
+        *lbake->progress = lbake->done / float(lbake->total);
+        *lbake->do_update = true;
+        if (lbake->cube_offset == lbake->cube_len - 1) {
+          lcache->flag &= ~LIGHTCACHE_UPDATE_CUBE;
+        }
+        continue;
+      }
       lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample);
     }
   }
 
+  eevee_lightbake_store_signature(lbake, G.is_break == true || *lbake->stop);
+
   /* Read the resulting lighting data to save it to file/disk. */
   eevee_lightbake_context_enable(lbake);
   eevee_lightbake_readback_irradiance(lcache);
@@ -33,7 +33,8 @@ struct wmJob *EEVEE_lightbake_job_create(struct wmWindowManager *wm,
                                          struct ViewLayer *view_layer,
                                          struct Scene *scene,
                                          int delay,
-                                         int frame);
+                                         int frame,
+                                         bool incremental);
 /**
  * MUST run on the main thread.
  */
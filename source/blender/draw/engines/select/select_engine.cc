@@ -19,6 +19,7 @@
 
 #include "draw_cache_impl.hh"
 #include "draw_manager_c.hh"
+#include "draw_readback.hh"
 
 #include "select_engine.hh"
 #include "select_private.hh"
@@ -30,6 +31,7 @@
 struct SelectEngineData {
   GPUFrameBuffer *framebuffer_select_id;
   GPUTexture *texture_u32;
+  blender::draw::TextureReadback readback;
 
   SELECTID_Shaders sh_data[GPU_SHADER_CFG_LEN];
   SELECTID_Context context;
@@ -277,6 +279,11 @@ static void select_draw_scene(void *vedata)
     SELECTID_ObjectData *sel_data = reinterpret_cast<SELECTID_ObjectData *>(data);
     sel_data->is_drawn = true;
   }
+
+  /* Start moving the select buffer to the CPU right away, so that the picking queries that
+   * follow do not stall on a synchronous readback (see #DRW_select_buffer_read). */
+  e_data.context.pixel_buf.reinitialize(0);
+  e_data.readback.schedule(e_data.texture_u32);
 }
 
 static void select_engine_free()
@@ -290,6 +297,7 @@ static void select_engine_free()
 
   DRW_TEXTURE_FREE_SAFE(e_data.texture_u32);
   GPU_FRAMEBUFFER_FREE_SAFE(e_data.framebuffer_select_id);
+  e_data.readback.free();
 }
 
 /** \} */
@@ -362,6 +370,12 @@ GPUFrameBuffer *DRW_engine_select_framebuffer_get()
   return e_data.framebuffer_select_id;
 }
 
+blender::draw::TextureReadback *DRW_engine_select_readback_get()
+{
+  SelectEngineData &e_data = get_engine_data();
+  return &e_data.readback;
+}
+
 GPUTexture *DRW_engine_select_texture_get()
 {
   SelectEngineData &e_data = get_engine_data();
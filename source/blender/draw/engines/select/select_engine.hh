@@ -19,9 +19,14 @@ extern RenderEngineType DRW_engine_viewport_select_type;
 extern DrawEngineType draw_engine_debug_select_type;
 #endif
 
+namespace blender::draw {
+class TextureReadback;
+}
+
 struct SELECTID_Context *DRW_select_engine_context_get();
 struct GPUFrameBuffer *DRW_engine_select_framebuffer_get();
 struct GPUTexture *DRW_engine_select_texture_get();
+blender::draw::TextureReadback *DRW_engine_select_readback_get();
 
 /* select_instance.cc */
 
@@ -3378,7 +3378,7 @@ void drw_batch_cache_validate(Object *ob)
       DRW_volume_batch_cache_validate((Volume *)ob->data);
       break;
     case OB_GREASE_PENCIL:
-      DRW_grease_pencil_batch_cache_validate((GreasePencil *)ob->data);
+      DRW_grease_pencil_batch_cache_validate(*ob, (GreasePencil *)ob->data);
     default:
       break;
   }
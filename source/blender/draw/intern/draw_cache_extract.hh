@@ -10,6 +10,7 @@
 
 #include "BLI_math_matrix_types.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "GPU_shader.hh"
 
@@ -19,6 +20,7 @@ namespace blender::gpu {
 class Batch;
 class IndexBuf;
 }  // namespace blender::gpu
+struct GPUMaterial;
 struct TaskGraph;
 
 namespace blender::draw {
@@ -280,6 +282,14 @@ struct MeshBatchCache {
 
   DRW_Attributes attr_used, attr_needed, attr_used_over_time;
 
+  /* Memoized result of scanning the GPU materials for the attributes they reference
+   * (see #DRW_mesh_batch_cache_get_surface_shaded). Instanced objects resolve their surface
+   * batches with the same material set every frame, in which case the per-material attribute
+   * list traversal and layer name lookups can be skipped. */
+  Vector<const GPUMaterial *> gpumat_attr_query;
+  DRW_MeshCDMask gpumat_attr_cd_needed;
+  DRW_Attributes gpumat_attr_needed;
+
   int lastmatch;
 
   /* Valid only if edge_detection is up to date. */
@@ -715,19 +715,27 @@ void mesh_buffer_cache_create_requested(TaskGraph &task_graph,
   const bool use_thread = (mr->corners_num + mr->loose_indices_num) > MIN_RANGE_LEN;
 
   if (DRW_vbo_requested(buffers.vbo.pos)) {
-    struct TaskData {
-      MeshRenderData &mr;
-      MeshBufferCache &mbc;
-    };
-    TaskNode *task_node = BLI_task_graph_node_create(
-        &task_graph,
-        [](void *__restrict task_data) {
-          const TaskData &data = *static_cast<TaskData *>(task_data);
-          extract_positions(data.mr, *data.mbc.buff.vbo.pos);
-        },
-        new TaskData{*mr, mbc},
-        [](void *task_data) { delete static_cast<TaskData *>(task_data); });
-    BLI_task_graph_edge_create(task_node_mesh_render_data, task_node);
+    if (extract_positions_use_gpu(*mr)) {
+      /* The compute shader dispatch has to happen on this thread, the task graph workers do not
+       * have an active GPU context. */
+      mesh_render_data_update_loose_geom(*mr, mbc);
+      extract_positions_gpu(*mr, *buffers.vbo.pos);
+    }
+    else {
+      struct TaskData {
+        MeshRenderData &mr;
+        MeshBufferCache &mbc;
+      };
+      TaskNode *task_node = BLI_task_graph_node_create(
+          &task_graph,
+          [](void *__restrict task_data) {
+            const TaskData &data = *static_cast<TaskData *>(task_data);
+            extract_positions(data.mr, *data.mbc.buff.vbo.pos);
+          },
+          new TaskData{*mr, mbc},
+          [](void *task_data) { delete static_cast<TaskData *>(task_data); });
+      BLI_task_graph_edge_create(task_node_mesh_render_data, task_node);
+    }
   }
   if (DRW_vbo_requested(buffers.vbo.nor)) {
     struct TaskData {
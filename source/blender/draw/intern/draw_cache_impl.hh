@@ -67,7 +67,7 @@ void DRW_volume_batch_cache_validate(Volume *volume);
 void DRW_volume_batch_cache_free(Volume *volume);
 
 void DRW_grease_pencil_batch_cache_dirty_tag(GreasePencil *grase_pencil, int mode);
-void DRW_grease_pencil_batch_cache_validate(GreasePencil *grase_pencil);
+void DRW_grease_pencil_batch_cache_validate(Object &object, GreasePencil *grase_pencil);
 void DRW_grease_pencil_batch_cache_free(GreasePencil *grase_pencil);
 
 /** \} */
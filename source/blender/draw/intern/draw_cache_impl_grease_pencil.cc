@@ -33,6 +33,20 @@
 
 namespace blender::draw {
 
+/** The state of one visible drawing that the cached batches depend on. */
+struct DrawingFingerprint {
+  const bke::greasepencil::Drawing *drawing;
+  int64_t geometry_version;
+  int layer_index;
+  float4x4 layer_to_object;
+
+  friend bool operator==(const DrawingFingerprint &a, const DrawingFingerprint &b)
+  {
+    return a.drawing == b.drawing && a.geometry_version == b.geometry_version &&
+           a.layer_index == b.layer_index && a.layer_to_object == b.layer_to_object;
+  }
+};
+
 struct GreasePencilBatchCache {
   /** Instancing Data */
   gpu::VertBuf *vbo;
@@ -57,6 +71,12 @@ struct GreasePencilBatchCache {
   bool is_dirty;
   /** Last cached frame. */
   int cache_frame;
+  /**
+   * Snapshot of the visible drawings the cache was built from. When the evaluated frame changes
+   * but the same unmodified drawings remain visible (playback over held keyframes), the cached
+   * batches are reused instead of being rebuilt.
+   */
+  Vector<DrawingFingerprint> drawing_fingerprints;
 };
 
 /* -------------------------------------------------------------------- */
@@ -106,16 +126,51 @@ static GPUVertFormat *grease_pencil_color_format()
 /** \name Internal Utilities
  * \{ */
 
-static bool grease_pencil_batch_cache_valid(const GreasePencil &grease_pencil)
+static Vector<DrawingFingerprint> grease_pencil_drawing_fingerprints(
+    const Object &object, const GreasePencil &grease_pencil, const Scene &scene)
+{
+  using namespace blender::bke::greasepencil;
+  const Span<const Layer *> layers = grease_pencil.layers();
+  const Vector<ed::greasepencil::DrawingInfo> drawings =
+      ed::greasepencil::retrieve_visible_drawings(scene, grease_pencil, true);
+  Vector<DrawingFingerprint> fingerprints;
+  fingerprints.reserve(drawings.size());
+  for (const ed::greasepencil::DrawingInfo &info : drawings) {
+    fingerprints.append({&info.drawing,
+                         info.drawing.runtime->geometry_version.load(),
+                         info.layer_index,
+                         layers[info.layer_index]->to_object_space(object)});
+  }
+  return fingerprints;
+}
+
+static bool grease_pencil_batch_cache_valid(const Object &object,
+                                            const GreasePencil &grease_pencil,
+                                            const Scene &scene)
 {
   BLI_assert(grease_pencil.runtime != nullptr);
-  const GreasePencilBatchCache *cache = static_cast<GreasePencilBatchCache *>(
+  GreasePencilBatchCache *cache = static_cast<GreasePencilBatchCache *>(
       grease_pencil.runtime->batch_cache);
-  return (cache && cache->is_dirty == false &&
-          cache->cache_frame == grease_pencil.runtime->eval_frame);
+  if (cache == nullptr || cache->is_dirty) {
+    return false;
+  }
+  if (cache->cache_frame == grease_pencil.runtime->eval_frame) {
+    return true;
+  }
+  /* The evaluated frame changed, but the batches can still be reused if exactly the same
+   * drawings are visible with the same transforms and none of them were modified. */
+  if (cache->drawing_fingerprints ==
+      grease_pencil_drawing_fingerprints(object, grease_pencil, scene))
+  {
+    cache->cache_frame = grease_pencil.runtime->eval_frame;
+    return true;
+  }
+  return false;
 }
 
-static GreasePencilBatchCache *grease_pencil_batch_cache_init(GreasePencil &grease_pencil)
+static GreasePencilBatchCache *grease_pencil_batch_cache_init(const Object &object,
+                                                              GreasePencil &grease_pencil,
+                                                              const Scene &scene)
 {
   BLI_assert(grease_pencil.runtime != nullptr);
   GreasePencilBatchCache *cache = static_cast<GreasePencilBatchCache *>(
@@ -130,6 +185,8 @@ static GreasePencilBatchCache *grease_pencil_batch_cache_init(GreasePencil &grea
 
   cache->is_dirty = false;
   cache->cache_frame = grease_pencil.runtime->eval_frame;
+  cache->drawing_fingerprints = grease_pencil_drawing_fingerprints(
+      object, grease_pencil, scene);
 
   return cache;
 }
@@ -158,14 +215,16 @@ static void grease_pencil_batch_cache_clear(GreasePencil &grease_pencil)
   cache->is_dirty = true;
 }
 
-static GreasePencilBatchCache *grease_pencil_batch_cache_get(GreasePencil &grease_pencil)
+static GreasePencilBatchCache *grease_pencil_batch_cache_get(const Object &object,
+                                                             GreasePencil &grease_pencil,
+                                                             const Scene &scene)
 {
   BLI_assert(grease_pencil.runtime != nullptr);
   GreasePencilBatchCache *cache = static_cast<GreasePencilBatchCache *>(
       grease_pencil.runtime->batch_cache);
-  if (!grease_pencil_batch_cache_valid(grease_pencil)) {
+  if (!grease_pencil_batch_cache_valid(object, grease_pencil, scene)) {
     grease_pencil_batch_cache_clear(grease_pencil);
-    return grease_pencil_batch_cache_init(grease_pencil);
+    return grease_pencil_batch_cache_init(object, grease_pencil, scene);
   }
 
   return cache;
@@ -878,12 +937,13 @@ void DRW_grease_pencil_batch_cache_dirty_tag(GreasePencil *grease_pencil, int mo
   }
 }
 
-void DRW_grease_pencil_batch_cache_validate(GreasePencil *grease_pencil)
+void DRW_grease_pencil_batch_cache_validate(Object &object, GreasePencil *grease_pencil)
 {
   BLI_assert(grease_pencil->runtime != nullptr);
-  if (!grease_pencil_batch_cache_valid(*grease_pencil)) {
+  const Scene *scene = DRW_context_state_get()->scene;
+  if (!grease_pencil_batch_cache_valid(object, *grease_pencil, *scene)) {
     grease_pencil_batch_cache_clear(*grease_pencil);
-    grease_pencil_batch_cache_init(*grease_pencil);
+    grease_pencil_batch_cache_init(object, *grease_pencil, *scene);
   }
 }
 
@@ -897,7 +957,7 @@ void DRW_grease_pencil_batch_cache_free(GreasePencil *grease_pencil)
 gpu::Batch *DRW_cache_grease_pencil_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_geom_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->geom_batch;
@@ -906,7 +966,7 @@ gpu::Batch *DRW_cache_grease_pencil_get(const Scene *scene, Object *ob)
 gpu::Batch *DRW_cache_grease_pencil_edit_points_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_edit_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->edit_points;
@@ -915,7 +975,7 @@ gpu::Batch *DRW_cache_grease_pencil_edit_points_get(const Scene *scene, Object *
 gpu::Batch *DRW_cache_grease_pencil_edit_lines_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_edit_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->edit_lines;
@@ -924,7 +984,7 @@ gpu::Batch *DRW_cache_grease_pencil_edit_lines_get(const Scene *scene, Object *o
 gpu::VertBuf *DRW_cache_grease_pencil_position_buffer_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_geom_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->vbo;
@@ -933,7 +993,7 @@ gpu::VertBuf *DRW_cache_grease_pencil_position_buffer_get(const Scene *scene, Ob
 gpu::VertBuf *DRW_cache_grease_pencil_color_buffer_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_geom_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->vbo_col;
@@ -942,7 +1002,7 @@ gpu::VertBuf *DRW_cache_grease_pencil_color_buffer_get(const Scene *scene, Objec
 gpu::Batch *DRW_cache_grease_pencil_weight_points_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_weight_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->edit_points;
@@ -951,7 +1011,7 @@ gpu::Batch *DRW_cache_grease_pencil_weight_points_get(const Scene *scene, Object
 gpu::Batch *DRW_cache_grease_pencil_weight_lines_get(const Scene *scene, Object *ob)
 {
   GreasePencil &grease_pencil = *static_cast<GreasePencil *>(ob->data);
-  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(grease_pencil);
+  GreasePencilBatchCache *cache = grease_pencil_batch_cache_get(*ob, grease_pencil, *scene);
   grease_pencil_weight_batch_ensure(*ob, grease_pencil, *scene);
 
   return cache->edit_lines;
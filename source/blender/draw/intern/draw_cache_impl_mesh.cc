@@ -668,6 +668,8 @@ static void mesh_batch_cache_discard_shaded_tri(MeshBatchCache &cache)
   DRWBatchFlag batch_map = BATCH_MAP(vbo.uv, vbo.tan, vbo.orco);
   mesh_batch_cache_discard_batch(cache, batch_map);
   mesh_cd_layers_type_clear(&cache.cd_used);
+  /* The materials changed, the memoized attribute scan is no longer valid. */
+  cache.gpumat_attr_query.clear();
 }
 
 static void mesh_batch_cache_discard_uvedit(MeshBatchCache &cache)
@@ -758,6 +760,31 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
     case BKE_MESH_BATCH_DIRTY_ALL:
       cache.is_dirty = true;
       break;
+    case BKE_MESH_BATCH_DIRTY_DEFORM:
+      /* Topology and attribute contents are unchanged, only discard buffers which depend on the
+       * vertex positions. Index buffers, UVs and generic attribute data stay valid. */
+      FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.pos);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.nor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.vnor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.skin_roots);
+      }
+      batch_map = BATCH_MAP(vbo.pos,
+                            vbo.nor,
+                            vbo.vnor,
+                            vbo.edge_fac,
+                            vbo.tan,
+                            vbo.mesh_analysis,
+                            vbo.fdots_pos,
+                            vbo.fdots_nor,
+                            vbo.skin_roots);
+      mesh_batch_cache_discard_batch(cache, batch_map);
+      break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
       mesh_batch_cache_discard_uvedit(cache);
@@ -978,15 +1005,22 @@ gpu::Batch **DRW_mesh_batch_cache_get_surface_shaded(Object &object,
                                                      uint gpumat_array_len)
 {
   MeshBatchCache &cache = *mesh_batch_cache_get(mesh);
-  DRW_Attributes attrs_needed;
-  drw_attributes_clear(&attrs_needed);
-  DRW_MeshCDMask cd_needed = mesh_cd_calc_used_gpu_layers(
-      object, mesh, gpumat_array, gpumat_array_len, &attrs_needed);
 
   BLI_assert(gpumat_array_len == cache.mat_len);
 
-  mesh_cd_layers_type_merge(&cache.cd_needed, cd_needed);
-  drw_attributes_merge(&cache.attr_needed, &attrs_needed, mesh.runtime->render_mutex);
+  /* Instanced objects resolve their batches with the same material set for every instance and
+   * every frame. Only scan the material attribute lists again when the set changed. The attribute
+   * lists of a #GPUMaterial are immutable, so pointer identity is enough. */
+  const Span<const GPUMaterial *> query(gpumat_array, gpumat_array_len);
+  if (cache.gpumat_attr_query.as_span() != query) {
+    drw_attributes_clear(&cache.gpumat_attr_needed);
+    cache.gpumat_attr_cd_needed = mesh_cd_calc_used_gpu_layers(
+        object, mesh, gpumat_array, gpumat_array_len, &cache.gpumat_attr_needed);
+    cache.gpumat_attr_query = query;
+  }
+
+  mesh_cd_layers_type_merge(&cache.cd_needed, cache.gpumat_attr_cd_needed);
+  drw_attributes_merge(&cache.attr_needed, &cache.gpumat_attr_needed, mesh.runtime->render_mutex);
   mesh_batch_cache_request_surface_batches(cache);
   return cache.surface_per_mat.data();
 }
@@ -22,6 +22,8 @@
 #include "draw_state.hh"
 #include "draw_view.hh"
 
+#include <mutex>
+
 /* Forward declarations. */
 namespace blender::draw::detail {
 template<typename T, int64_t block_size> class SubPassVector;
@@ -606,6 +608,9 @@ class DrawMultiBuf {
   uint prototype_count_ = 0;
   /** Used items in the resource_id_buf_. Not it's allocated length. */
   uint resource_id_count_ = 0;
+  /** Multi-draw groups and prototypes are shared between all sub-passes of a pass. Allows draw
+   * call recording from multiple threads as long as each thread records into its own sub-pass. */
+  std::mutex mutex_;
 
  public:
   void clear()
@@ -640,6 +645,13 @@ class DrawMultiBuf {
 
     instance_len = instance_len != -1 ? instance_len : 1;
 
+    /* The headers and commands are owned by the calling sub-pass, but the group and prototype
+     * heaps are shared by the whole pass. Serialize access to them so that sub-passes can be
+     * recorded in parallel. The draw order inside a group is not deterministic, but it already
+     * is not for single threaded recording (see #PassMain). The submission order of the groups
+     * themselves only depends on the sub-pass creation order. */
+    std::scoped_lock lock(mutex_);
+
     /* If there was some state changes since previous call, we have to create another command. */
     if (headers.is_empty() || headers.last().type != Type::DrawMulti) {
       uint index = commands.append_and_get_index({});
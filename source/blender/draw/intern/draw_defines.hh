@@ -37,6 +37,8 @@
 #define DRW_FINALIZE_GROUP_SIZE 64
 /* Must be multiple of 32. Set to 32 for shader simplicity. */
 #define DRW_VISIBILITY_GROUP_SIZE 32
+/* 2D group size of the readback staging copy. */
+#define DRW_READBACK_GROUP_SIZE 16
 
 /**
  * The maximum of indexable views is dictated by:
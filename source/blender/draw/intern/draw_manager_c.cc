@@ -15,6 +15,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_trace.hh"
 
 #include "BLF_api.hh"
 
@@ -1606,6 +1607,8 @@ DRWTextStore *DRW_text_cache_ensure()
 
 void DRW_draw_view(const bContext *C)
 {
+  BLI_TRACE_SCOPE("DRW_draw_view");
+
   View3D *v3d = CTX_wm_view3d(C);
   if (v3d) {
     Depsgraph *depsgraph = CTX_data_expect_evaluated_depsgraph(C);
@@ -32,6 +32,12 @@
  * contain draw command, everything needs to be inside sub-passes. Sub-passes are automatically
  * sorted before submission.
  *
+ * \note Recording can be done from multiple threads as long as each thread records into its own
+ * sub-pass. This includes creating nested sub-passes of it, but sibling sub-passes of a shared
+ * parent must be created by the thread owning that parent since they are inserted into its
+ * command stream. The merge is deterministic: sub-passes are submitted in creation order, at the
+ * point of the parent pass where they were created.
+ *
  * \note A pass can be recorded once and resubmitted any number of time. This can be a good
  * optimization for passes that are always the same for each frame. The only thing to be aware of
  * is the life time of external resources. If a pass contains draw-calls with non default
@@ -59,6 +65,7 @@
 
 #include "intern/gpu_codegen.hh"
 
+#include <mutex>
 #include <sstream>
 
 namespace blender::draw {
@@ -86,6 +93,9 @@ template<typename T,
 class SubPassVector {
  private:
   Vector<std::unique_ptr<Vector<T, block_size>>, 0> blocks_;
+  /** Guards `blocks_` so that sub-passes can be created from multiple threads. References to
+   * already created sub-passes stay valid as elements never move. */
+  std::mutex mutex_;
 
  public:
   void clear()
@@ -95,6 +105,7 @@ class SubPassVector {
 
   int64_t append_and_get_index(T &&elem)
   {
+    std::scoped_lock lock(mutex_);
     /* Do not go over the inline size so that existing members never move. */
     if (blocks_.is_empty() || blocks_.last()->size() == block_size) {
       blocks_.append(std::make_unique<Vector<T, block_size>>());
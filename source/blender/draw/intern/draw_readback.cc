@@ -0,0 +1,89 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup draw
+ */
+
+#include "draw_readback.hh"
+
+#include "BLI_math_vector.hh"
+
+#include "GPU_compute.hh"
+#include "GPU_index_buffer.hh"
+#include "GPU_shader.hh"
+#include "GPU_state.hh"
+#include "GPU_storage_buffer.hh"
+#include "GPU_texture.hh"
+
+#include "draw_defines.hh"
+#include "draw_shader.hh"
+
+namespace blender::draw {
+
+void TextureReadback::schedule(GPUTexture *tx)
+{
+  BLI_assert(GPU_texture_format(tx) == GPU_R32UI);
+  extent_ = int2(GPU_texture_width(tx), GPU_texture_height(tx));
+  const size_t size = sizeof(uint) * extent_.x * extent_.y;
+
+  current_ = (current_ + 1) % 2;
+  Slot &slot = slots_[current_];
+  if (slot.staging != nullptr && slot.size != size) {
+    GPU_storagebuf_free(slot.staging);
+    slot.staging = nullptr;
+  }
+  if (slot.staging == nullptr) {
+    slot.staging = GPU_storagebuf_create_ex(size, nullptr, GPU_USAGE_DYNAMIC, __func__);
+    slot.size = size;
+  }
+  if (slot.fence == nullptr) {
+    slot.fence = GPU_fence_create();
+  }
+
+  GPUShader *shader = DRW_shader_draw_readback_uint_get();
+  GPU_shader_bind(shader);
+  GPU_shader_uniform_2iv(shader, "extent", extent_);
+  GPU_texture_bind(tx, GPU_shader_get_sampler_binding(shader, "input_tx"));
+  GPU_storagebuf_bind(slot.staging, GPU_shader_get_ssbo_binding(shader, "out_buf"));
+
+  const int2 group_len = math::divide_ceil(extent_, int2(DRW_READBACK_GROUP_SIZE));
+  GPU_compute_dispatch(shader, group_len.x, group_len.y, 1);
+  GPU_memory_barrier(GPU_BARRIER_BUFFER_UPDATE);
+  GPU_fence_signal(slot.fence);
+
+  GPU_storagebuf_unbind(slot.staging);
+  GPU_texture_unbind(tx);
+  GPU_shader_unbind();
+
+  pending_ = true;
+}
+
+void TextureReadback::read(uint *r_data)
+{
+  BLI_assert(pending_);
+  Slot &slot = slots_[current_];
+  /* Only stalls when the transfer has not finished yet. */
+  GPU_fence_wait(slot.fence);
+  GPU_storagebuf_read(slot.staging, r_data);
+  pending_ = false;
+}
+
+void TextureReadback::free()
+{
+  for (Slot &slot : slots_) {
+    if (slot.staging != nullptr) {
+      GPU_storagebuf_free(slot.staging);
+      slot.staging = nullptr;
+    }
+    if (slot.fence != nullptr) {
+      GPU_fence_free(slot.fence);
+      slot.fence = nullptr;
+    }
+    slot.size = 0;
+  }
+  pending_ = false;
+}
+
+}  // namespace blender::draw
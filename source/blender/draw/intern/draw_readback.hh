@@ -0,0 +1,71 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup draw
+ *
+ * Asynchronous GPU to CPU transfers.
+ *
+ * The texture content is copied into a staging storage buffer on the GPU timeline and a fence is
+ * inserted after the copy, so scheduling a transfer does not stall the pipeline. The CPU only
+ * blocks when the result is requested before the copy has finished. Two staging buffers are used
+ * so that a new transfer can be scheduled while the previous one is still in flight.
+ */
+
+#pragma once
+
+#include "BLI_math_vector_types.hh"
+
+struct GPUFence;
+struct GPUStorageBuf;
+struct GPUTexture;
+
+namespace blender::draw {
+
+/** Asynchronous readback of a single channel 32bit unsigned integer texture. */
+class TextureReadback {
+ private:
+  struct Slot {
+    GPUStorageBuf *staging = nullptr;
+    GPUFence *fence = nullptr;
+    size_t size = 0;
+  };
+  /** Double-buffered staging so a new transfer can overlap the previous one. */
+  Slot slots_[2];
+  /** Slot holding the most recently scheduled transfer. */
+  int current_ = 0;
+  int2 extent_ = int2(0);
+  bool pending_ = false;
+
+ public:
+  /**
+   * Schedule the transfer of \a tx (must be a `GPU_R32UI` texture).
+   * Must be called with an active context.
+   */
+  void schedule(GPUTexture *tx);
+
+  /** True when a transfer has been scheduled and not read back yet. */
+  bool is_pending() const
+  {
+    return pending_;
+  }
+
+  /** Extent of the last scheduled transfer. */
+  int2 extent() const
+  {
+    return extent_;
+  }
+
+  /**
+   * Copy the result of the last scheduled transfer into \a r_data (`extent()` x * y values),
+   * waiting for the GPU if the transfer has not finished yet.
+   * Must be called with an active context.
+   */
+  void read(uint *r_data);
+
+  /** Free the GPU resources. Must be called with an active context. */
+  void free();
+};
+
+}  // namespace blender::draw
@@ -14,6 +14,9 @@
 #include "BLI_bitmap.h"
 #include "BLI_bitmap_draw_2d.h"
 #include "BLI_rect.h"
+#include "BLI_task.hh"
+
+#include "atomic_ops.h"
 
 #include "DNA_screen_types.h"
 
@@ -26,9 +29,11 @@
 #include "DRW_select_buffer.hh"
 
 #include "draw_manager_c.hh"
+#include "draw_readback.hh"
 
 #include "../engines/select/select_engine.hh"
 
+using blender::IndexRange;
 using blender::int2;
 using blender::Span;
 
@@ -91,17 +96,41 @@ uint *DRW_select_buffer_read(
       buf_len = BLI_rcti_size_x(rect) * BLI_rcti_size_y(rect);
       r_buf = static_cast<uint *>(MEM_mallocN(buf_len * sizeof(*r_buf), __func__));
 
-      GPUFrameBuffer *select_id_fb = DRW_engine_select_framebuffer_get();
-      GPU_framebuffer_bind(select_id_fb);
-      GPU_framebuffer_read_color(select_id_fb,
-                                 rect_clamp.xmin,
-                                 rect_clamp.ymin,
-                                 BLI_rcti_size_x(&rect_clamp),
-                                 BLI_rcti_size_y(&rect_clamp),
-                                 1,
-                                 0,
-                                 GPU_DATA_UINT,
-                                 r_buf);
+      blender::draw::TextureReadback &readback = *DRW_engine_select_readback_get();
+      if (readback.is_pending()) {
+        /* Finish the transfer scheduled at the end of the select ID drawing. Only stalls when
+         * the GPU has not caught up yet. */
+        const int2 extent = readback.extent();
+        select_ctx->pixel_buf.reinitialize(size_t(extent.x) * extent.y);
+        select_ctx->pixel_buf_size[0] = extent.x;
+        select_ctx->pixel_buf_size[1] = extent.y;
+        readback.read(select_ctx->pixel_buf.data());
+      }
+
+      if (!select_ctx->pixel_buf.is_empty() && select_ctx->pixel_buf_size[0] == region->winx &&
+          select_ctx->pixel_buf_size[1] == region->winy)
+      {
+        /* Extract the rect from the CPU side copy of the buffer. */
+        const uint *src = select_ctx->pixel_buf.data();
+        const int width = BLI_rcti_size_x(&rect_clamp);
+        uint *dst = r_buf;
+        for (int y = rect_clamp.ymin; y < rect_clamp.ymax; y++, dst += width) {
+          memcpy(dst, src + size_t(y) * region->winx + rect_clamp.xmin, width * sizeof(uint));
+        }
+      }
+      else {
+        GPUFrameBuffer *select_id_fb = DRW_engine_select_framebuffer_get();
+        GPU_framebuffer_bind(select_id_fb);
+        GPU_framebuffer_read_color(select_id_fb,
+                                   rect_clamp.xmin,
+                                   rect_clamp.ymin,
+                                   BLI_rcti_size_x(&rect_clamp),
+                                   BLI_rcti_size_y(&rect_clamp),
+                                   1,
+                                   0,
+                                   GPU_DATA_UINT,
+                                   r_buf);
+      }
 
       if (!BLI_rcti_compare(rect, &rect_clamp)) {
         /* The rect has been clamped so we need to realign the buffer and fill in the blanks */
@@ -149,14 +178,17 @@ uint *DRW_select_buffer_bitmap_from_rect(
   const uint bitmap_len = select_ctx->index_drawn_len - 1;
 
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
-  const uint *buf_iter = buf;
-  while (buf_len--) {
-    const uint index = *buf_iter - 1;
-    if (index < bitmap_len) {
-      BLI_BITMAP_ENABLE(bitmap_buf, index);
+  /* A border select can cover most of the region, so convert the pixels in parallel. Neighboring
+   * pixels usually repeat the same index, testing before the atomic bit set keeps contention low.
+   */
+  blender::threading::parallel_for(IndexRange(buf_len), 32768, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const uint index = buf[i] - 1;
+      if (index < bitmap_len && !BLI_BITMAP_TEST(bitmap_buf, index)) {
+        BLI_BITMAP_TEST_AND_SET_ATOMIC(bitmap_buf, index);
+      }
     }
-    buf_iter++;
-  }
+  });
   MEM_freeN((void *)buf);
 
   if (r_bitmap_len) {
@@ -191,19 +223,23 @@ uint *DRW_select_buffer_bitmap_from_circle(Depsgraph *depsgraph,
   const uint bitmap_len = select_ctx->index_drawn_len - 1;
 
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
-  const uint *buf_iter = buf;
+  const int diameter = radius * 2 + 1;
   const int radius_sq = radius * radius;
-  for (int yc = -radius; yc <= radius; yc++) {
-    for (int xc = -radius; xc <= radius; xc++, buf_iter++) {
-      if (xc * xc + yc * yc < radius_sq) {
-        /* Intentionally wrap to max value if this is zero. */
-        const uint index = *buf_iter - 1;
-        if (index < bitmap_len) {
-          BLI_BITMAP_ENABLE(bitmap_buf, index);
+  blender::threading::parallel_for(IndexRange(diameter), 16, [&](const IndexRange range) {
+    for (const int64_t row : range) {
+      const int yc = int(row) - radius;
+      const uint *buf_iter = buf + row * diameter;
+      for (int xc = -radius; xc <= radius; xc++, buf_iter++) {
+        if (xc * xc + yc * yc < radius_sq) {
+          /* Intentionally wrap to max value if this is zero. */
+          const uint index = *buf_iter - 1;
+          if (index < bitmap_len && !BLI_BITMAP_TEST(bitmap_buf, index)) {
+            BLI_BITMAP_TEST_AND_SET_ATOMIC(bitmap_buf, index);
+          }
         }
       }
     }
-  }
+  });
   MEM_freeN((void *)buf);
 
   if (r_bitmap_len) {
@@ -266,16 +302,21 @@ uint *DRW_select_buffer_bitmap_from_poly(Depsgraph *depsgraph,
   const uint bitmap_len = select_ctx->index_drawn_len - 1;
 
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
-  const uint *buf_iter = buf;
-  int i = 0;
-  while (buf_len--) {
-    const uint index = *buf_iter - 1;
-    if (index < bitmap_len && BLI_BITMAP_TEST(buf_mask, i)) {
-      BLI_BITMAP_ENABLE(bitmap_buf, index);
+  /* Lasso selections can cover most of the region, convert the masked pixels in parallel per
+   * scan-line (see #DRW_select_buffer_bitmap_from_rect). */
+  const int width = poly_mask_data.width;
+  blender::threading::parallel_for(IndexRange(buf_len / width), 16, [&](const IndexRange range) {
+    for (const int64_t row : range) {
+      for (int64_t i = row * width; i < (row + 1) * width; i++) {
+        const uint index = buf[i] - 1;
+        if (index < bitmap_len && BLI_BITMAP_TEST(buf_mask, i) &&
+            !BLI_BITMAP_TEST(bitmap_buf, index))
+        {
+          BLI_BITMAP_TEST_AND_SET_ATOMIC(bitmap_buf, index);
+        }
+      }
     }
-    buf_iter++;
-    i++;
-  }
+  });
   MEM_freeN((void *)buf);
   MEM_freeN(buf_mask);
 
@@ -22,6 +22,7 @@ GPUShader *DRW_shader_curves_refine_get(blender::draw::CurvesEvalShader type);
 GPUShader *DRW_shader_debug_print_display_get();
 GPUShader *DRW_shader_debug_draw_display_get();
 GPUShader *DRW_shader_draw_visibility_compute_get();
+GPUShader *DRW_shader_draw_readback_uint_get();
 GPUShader *DRW_shader_draw_view_finalize_get();
 GPUShader *DRW_shader_draw_resource_finalize_get();
 GPUShader *DRW_shader_draw_command_generate_get();
@@ -344,6 +344,13 @@ void extract_mesh_loose_edge_data(const Span<T> vert_data,
 }
 
 void extract_positions(const MeshRenderData &mr, gpu::VertBuf &vbo);
+/**
+ * Whether #extract_positions_gpu can be used for this mesh. The GPU path only pays off for large
+ * meshes. Unlike the other extract functions it has to be called from a thread with an active GPU
+ * context.
+ */
+bool extract_positions_use_gpu(const MeshRenderData &mr);
+void extract_positions_gpu(const MeshRenderData &mr, gpu::VertBuf &vbo);
 void extract_positions_subdiv(const DRWSubdivCache &subdiv_cache,
                               const MeshRenderData &mr,
                               gpu::VertBuf &vbo,
@@ -166,7 +166,7 @@ static void statvis_calc_thickness(const MeshRenderData &mr, float *r_thickness)
     BMesh *bm = em->bm;
     BM_mesh_elem_index_ensure(bm, BM_FACE);
 
-    BMBVHTree *bmtree = BKE_bmbvh_new_from_editmesh(em, 0, nullptr, false);
+    BMBVHTree *bmtree = BKE_editmesh_bvh_cache_get(em, 0);
     const Span<std::array<BMLoop *, 3>> looptris = em->looptris;
     for (int i = 0; i < mr.corner_tris_num; i++) {
       const BMLoop *const *ltri = looptris[i].data();
@@ -200,7 +200,6 @@ static void statvis_calc_thickness(const MeshRenderData &mr, float *r_thickness)
         }
       }
     }
-    BKE_bmbvh_free(bmtree);
 
     BMIter iter;
     BMFace *f;
@@ -317,7 +316,7 @@ static void statvis_calc_intersect(const MeshRenderData &mr, float *r_intersect)
 
     BM_mesh_elem_index_ensure(bm, BM_FACE);
 
-    BMBVHTree *bmtree = BKE_bmbvh_new_from_editmesh(em, 0, nullptr, false);
+    BMBVHTree *bmtree = BKE_editmesh_bvh_cache_get(em, 0);
     BVHTreeOverlap *overlap = BKE_bmbvh_overlap_self(bmtree, &overlap_len);
 
     if (overlap) {
@@ -337,8 +336,6 @@ static void statvis_calc_intersect(const MeshRenderData &mr, float *r_intersect)
       }
       MEM_freeN(overlap);
     }
-
-    BKE_bmbvh_free(bmtree);
   }
   else {
     uint overlap_len;
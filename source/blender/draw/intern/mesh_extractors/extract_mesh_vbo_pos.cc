@@ -8,12 +8,127 @@
 
 #include "BLI_array_utils.hh"
 
+#include "GPU_capabilities.hh"
+#include "GPU_compute.hh"
+#include "GPU_uniform_buffer.hh"
+
 #include "extract_mesh.hh"
 
 #include "draw_subdivision.hh"
 
+extern "C" char datatoc_common_mesh_extract_pos_comp_glsl[];
+
 namespace blender::draw {
 
+/* -------------------------------------------------------------------- */
+/** \name Extract Position on GPU
+ *
+ * Gathering per-corner positions is a pure memory bandwidth problem, so for large meshes it is
+ * faster to upload the vertex positions and gather indices (a third of the output size) and let
+ * a compute shader write the VBO, than to gather on the CPU and upload the result.
+ * \{ */
+
+/** Minimum number of corners before the compute path pays for the extra buffer setup. */
+#define EXTRACT_POS_GPU_CORNERS_MIN (1 << 16)
+
+static GPUShader *g_extract_pos_shader = nullptr;
+
+static GPUShader *get_extract_pos_shader()
+{
+  if (g_extract_pos_shader == nullptr) {
+    g_extract_pos_shader = GPU_shader_create_compute(
+        datatoc_common_mesh_extract_pos_comp_glsl, nullptr, nullptr, "draw_mesh_extract_pos");
+  }
+  return g_extract_pos_shader;
+}
+
+void DRW_mesh_extract_pos_free()
+{
+  if (g_extract_pos_shader) {
+    GPU_shader_free(g_extract_pos_shader);
+    g_extract_pos_shader = nullptr;
+  }
+}
+
+bool extract_positions_use_gpu(const MeshRenderData &mr)
+{
+  return mr.extract_type == MR_EXTRACT_MESH && mr.corners_num >= EXTRACT_POS_GPU_CORNERS_MIN;
+}
+
+void extract_positions_gpu(const MeshRenderData &mr, gpu::VertBuf &vbo)
+{
+  BLI_assert(extract_positions_use_gpu(mr));
+  static GPUVertFormat format = {0};
+  if (format.attr_len == 0) {
+    GPU_vertformat_attr_add(&format, "pos", GPU_COMP_F32, 3, GPU_FETCH_FLOAT);
+  }
+  const int total_count = mr.corners_num + mr.loose_indices_num;
+  GPU_vertbuf_init_build_on_device(&vbo, &format, total_count);
+
+  /* Source positions, uploaded as-is. */
+  gpu::VertBuf *src_positions = GPU_vertbuf_calloc();
+  GPU_vertbuf_init_with_format(src_positions, &format);
+  GPU_vertbuf_data_alloc(src_positions, mr.verts_num);
+  memcpy(GPU_vertbuf_get_data(src_positions),
+         mr.vert_positions.data(),
+         mr.vert_positions.size_in_bytes());
+  GPU_vertbuf_tag_dirty(src_positions);
+
+  /* Gather indices: corner vertices, then the vertex pairs of the loose edges, then the loose
+   * vertices, matching the layout of the position VBO. */
+  gpu::VertBuf *gather_indices = GPU_vertbuf_calloc();
+  static GPUVertFormat index_format = {0};
+  if (index_format.attr_len == 0) {
+    GPU_vertformat_attr_add(&index_format, "index", GPU_COMP_I32, 1, GPU_FETCH_INT);
+  }
+  GPU_vertbuf_init_with_format(gather_indices, &index_format);
+  GPU_vertbuf_data_alloc(gather_indices, total_count);
+  MutableSpan<int> indices_data(static_cast<int *>(GPU_vertbuf_get_data(gather_indices)),
+                                total_count);
+  array_utils::copy(mr.corner_verts, indices_data.take_front(mr.corners_num));
+  MutableSpan<int> loose_edge_data = indices_data.slice(mr.corners_num, mr.loose_edges.size() * 2);
+  for (const int i : mr.loose_edges.index_range()) {
+    const int2 edge = mr.edges[mr.loose_edges[i]];
+    loose_edge_data[i * 2 + 0] = edge[0];
+    loose_edge_data[i * 2 + 1] = edge[1];
+  }
+  array_utils::copy(mr.loose_verts, indices_data.take_back(mr.loose_verts.size()));
+  GPU_vertbuf_tag_dirty(gather_indices);
+
+  GPUShader *shader = get_extract_pos_shader();
+  GPU_shader_bind(shader);
+
+  struct {
+    int total_count;
+    int _pad0, _pad1, _pad2;
+  } storage = {total_count, 0, 0, 0};
+  GPUUniformBuf *ubo = GPU_uniformbuf_create_ex(sizeof(storage), &storage, __func__);
+  GPU_uniformbuf_bind(ubo, GPU_shader_get_ubo_binding(shader, "shader_data"));
+
+  int binding_point = 0;
+  GPU_vertbuf_bind_as_ssbo(src_positions, binding_point++);
+  GPU_vertbuf_bind_as_ssbo(gather_indices, binding_point++);
+  GPU_vertbuf_bind_as_ssbo(&vbo, binding_point++);
+
+  /* Split the dispatch along a second dimension when exceeding the work group count limit, the
+   * shader flattens the invocation index again (same scheme as the subdivision shaders). */
+  const uint dispatch_size = divide_ceil_u(uint(total_count), 64);
+  const uint max_res_x = uint(GPU_max_work_group_count(0));
+  const uint dispatch_rx = std::min(dispatch_size, max_res_x);
+  const uint dispatch_ry = divide_ceil_u(dispatch_size, max_res_x);
+  GPU_compute_dispatch(shader, dispatch_rx, dispatch_ry, 1);
+
+  /* The result is used as a vertex buffer by many batches. */
+  GPU_memory_barrier(GPU_BARRIER_VERTEX_ATTRIB_ARRAY);
+
+  GPU_shader_unbind();
+  GPU_uniformbuf_free(ubo);
+  GPU_vertbuf_discard(src_positions);
+  GPU_vertbuf_discard(gather_indices);
+}
+
+/** \} */
+
 static void extract_positions_mesh(const MeshRenderData &mr, MutableSpan<float3> vbo_data)
 {
   MutableSpan corners_data = vbo_data.take_front(mr.corners_num);
@@ -0,0 +1,44 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/* Gather per-corner vertex positions from the per-vertex positions of a mesh.
+ * Entries for loose edges and loose vertices at the end of the output buffer
+ * use the same gather indices, flattened by the CPU. */
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(std140) uniform shader_data
+{
+  /* Number of entries in the gather index buffer (corners + loose geometry). */
+  int total_count;
+};
+
+layout(std430, binding = 0) readonly buffer vertPositions
+{
+  float positions[];
+};
+
+layout(std430, binding = 1) readonly buffer gatherIndices
+{
+  int vert_indices[];
+};
+
+layout(std430, binding = 2) writeonly buffer dstPositions
+{
+  float dst_positions[];
+};
+
+void main()
+{
+  uint invocations_per_row = gl_WorkGroupSize.x * gl_NumWorkGroups.x;
+  uint index = gl_GlobalInvocationID.x + gl_GlobalInvocationID.y * invocations_per_row;
+  if (index >= uint(total_count)) {
+    return;
+  }
+
+  uint vert_index = uint(vert_indices[index]);
+  dst_positions[index * 3u + 0u] = positions[vert_index * 3u + 0u];
+  dst_positions[index * 3u + 1u] = positions[vert_index * 3u + 1u];
+  dst_positions[index * 3u + 2u] = positions[vert_index * 3u + 2u];
+}
@@ -0,0 +1,14 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "draw_defines.hh"
+#include "gpu_shader_create_info.hh"
+
+GPU_SHADER_CREATE_INFO(draw_readback_uint)
+    .do_static_compilation(true)
+    .local_group_size(DRW_READBACK_GROUP_SIZE, DRW_READBACK_GROUP_SIZE)
+    .sampler(0, ImageType::UINT_2D, "input_tx")
+    .storage_buf(0, Qualifier::WRITE, "uint", "out_buf[]")
+    .push_constant(Type::IVEC2, "extent")
+    .compute_source("draw_readback_uint_comp.glsl");
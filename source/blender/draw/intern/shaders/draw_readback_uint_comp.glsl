@@ -0,0 +1,17 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/**
+ * Copy a single channel unsigned integer texture into a staging storage buffer so that it can be
+ * read back asynchronously. See `draw_readback.hh`.
+ */
+
+void main()
+{
+  ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+  if (any(greaterThanEqual(texel, extent))) {
+    return;
+  }
+  out_buf[texel.y * extent.x + texel.x] = texelFetch(input_tx, texel, 0).r;
+}
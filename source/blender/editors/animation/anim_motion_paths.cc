@@ -31,6 +31,8 @@
 #include "GPU_batch.hh"
 #include "GPU_vertex_buffer.hh"
 
+#include "BLI_map.hh"
+
 #include "ED_anim_api.hh"
 #include "ED_keyframes_keylist.hh"
 
@@ -48,6 +50,10 @@ struct MPathTarget {
 
   AnimKeylist *keylist; /* temp, to know where the keyframes are */
 
+  /* Frame range this target actually needs to be re-baked for. Targets whose keys were not
+   * edited keep a much narrower range than the union that drives the scene evaluation. */
+  int bake_sfra, bake_efra;
+
   /* Original (Source Objects) */
   Object *ob;          /* source object */
   bPoseChannel *pchan; /* source posechannel (if applicable) */
@@ -144,6 +150,11 @@ static void motionpaths_calc_bake_targets(ListBase *targets,
       continue;
     }
 
+    /* only frames this target was invalidated for need to be written */
+    if ((cframe < mpt->bake_sfra) || (cframe > mpt->bake_efra)) {
+      continue;
+    }
+
     /* get the relevant cache vert to write to */
     bMotionPathVert *mpv = mpath->points + (cframe - mpath->start_frame);
 
@@ -481,9 +492,16 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
     }
     ED_keylist_prepare_for_direct_access(mpt->keylist);
 
+    mpt->bake_sfra = mpt->mpath->start_frame;
+    mpt->bake_efra = mpt->mpath->end_frame;
+
     if (range == ANIMVIZ_CALC_RANGE_CHANGED) {
       int mpt_sfra, mpt_efra;
       motionpath_calculate_update_range(mpt, adt, fcurve_list, cfra, &mpt_sfra, &mpt_efra);
+      /* Restrict the re-bake of this target to its own changed range: the frame loop covers the
+       * union of all targets, and targets with untouched keys should not be rewritten over it. */
+      mpt->bake_sfra = mpt_sfra;
+      mpt->bake_efra = mpt_efra;
       if (mpt_sfra <= mpt_efra) {
         sfra = min_ii(sfra, mpt_sfra);
         efra = max_ii(efra, mpt_efra);
@@ -491,6 +509,28 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
     }
   }
 
+  if (range == ANIMVIZ_CALC_RANGE_CHANGED) {
+    /* Bone targets of one armature influence each other through the hierarchy and constraints,
+     * so every target has to cover the union of the changed ranges found on its object. Targets
+     * on other objects keep their own (possibly empty) range. */
+    blender::Map<Object *, std::pair<int, int>> object_ranges;
+    LISTBASE_FOREACH (MPathTarget *, mpt, targets) {
+      if (mpt->bake_sfra > mpt->bake_efra) {
+        continue;
+      }
+      std::pair<int, int> &object_range = object_ranges.lookup_or_add(mpt->ob,
+                                                                      {INT_MAX, INT_MIN});
+      object_range.first = min_ii(object_range.first, mpt->bake_sfra);
+      object_range.second = max_ii(object_range.second, mpt->bake_efra);
+    }
+    LISTBASE_FOREACH (MPathTarget *, mpt, targets) {
+      if (const std::pair<int, int> *object_range = object_ranges.lookup_ptr(mpt->ob)) {
+        mpt->bake_sfra = object_range->first;
+        mpt->bake_efra = object_range->second;
+      }
+    }
+  }
+
   if (sfra > efra) {
     motionpath_free_free_tree_data(targets);
     return;
@@ -1080,27 +1080,43 @@ static int insert_key_to_keying_set_path(bContext *C,
   int keyed_channels = 0;
 
   CombinedKeyingResult combined_result;
-  for (; array_index < array_length; array_index++) {
-    if (mode == ModifyKeyMode::INSERT) {
-      CombinedKeyingResult result = insert_keyframe(bmain,
-                                                    *keyingset_path->id,
-                                                    groupname,
-                                                    keyingset_path->rna_path,
-                                                    array_index,
-                                                    &anim_eval_context,
-                                                    keytype,
-                                                    path_insert_key_flags);
-      keyed_channels += result.get_count(SingleKeyingResult::SUCCESS);
-      combined_result.merge(result);
-    }
-    else if (mode == ModifyKeyMode::DELETE) {
-      keyed_channels += delete_keyframe(bmain,
-                                        reports,
-                                        keyingset_path->id,
-                                        nullptr,
-                                        keyingset_path->rna_path,
-                                        array_index,
-                                        frame);
+  if (mode == ModifyKeyMode::INSERT && (keyingset_path->flag & KSP_FLAG_WHOLE_ARRAY)) {
+    /* Key the entire array with a single call: the RNA path is resolved and the NLA remapping
+     * context is built once, instead of once per array index. */
+    CombinedKeyingResult result = insert_keyframe(bmain,
+                                                  *keyingset_path->id,
+                                                  groupname,
+                                                  keyingset_path->rna_path,
+                                                  -1,
+                                                  &anim_eval_context,
+                                                  keytype,
+                                                  path_insert_key_flags);
+    keyed_channels += result.get_count(SingleKeyingResult::SUCCESS);
+    combined_result.merge(result);
+  }
+  else {
+    for (; array_index < array_length; array_index++) {
+      if (mode == ModifyKeyMode::INSERT) {
+        CombinedKeyingResult result = insert_keyframe(bmain,
+                                                      *keyingset_path->id,
+                                                      groupname,
+                                                      keyingset_path->rna_path,
+                                                      array_index,
+                                                      &anim_eval_context,
+                                                      keytype,
+                                                      path_insert_key_flags);
+        keyed_channels += result.get_count(SingleKeyingResult::SUCCESS);
+        combined_result.merge(result);
+      }
+      else if (mode == ModifyKeyMode::DELETE) {
+        keyed_channels += delete_keyframe(bmain,
+                                          reports,
+                                          keyingset_path->id,
+                                          nullptr,
+                                          keyingset_path->rna_path,
+                                          array_index,
+                                          frame);
+      }
     }
   }
 
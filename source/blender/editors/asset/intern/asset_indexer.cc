@@ -76,6 +76,28 @@ using namespace blender::bke::idprop;
  * NOTE: File browser uses name and idcode separate. Inside the index they are joined together like
  * #ID.name.
  * NOTE: File browser group name isn't stored in the index as it is a translatable name.
+ *
+ * Next to the per-file indices a single bundle file
+ * (#AssetLibraryIndex::bundle_file_path) is kept per asset library. It caches the contents of
+ * all per-file indices together with the modification time and size of the blend file each
+ * index was created from. Reading one bundle replaces opening and parsing thousands of small
+ * index files, so listing a large unchanged library only needs a single `stat` per blend file.
+ * The per-file indices stay the source of truth; the bundle is rebuilt from them whenever it is
+ * missing, outdated or corrupt.
+ *
+ * The structure of a bundle file is
+ * \code
+ * {
+ *   "version": <file version number>,
+ *   "files": {
+ *     "<blend file path>": {
+ *       "modification_time": <blend file mtime>,
+ *       "size": <blend file size>,
+ *       "index": <contents of the per-file index>
+ *     }
+ *   }
+ * }
+ * \endcode
  */
 constexpr StringRef ATTRIBUTE_VERSION("version");
 constexpr StringRef ATTRIBUTE_ENTRIES("entries");
@@ -88,6 +110,10 @@ constexpr StringRef ATTRIBUTE_ENTRIES_COPYRIGHT("copyright");
 constexpr StringRef ATTRIBUTE_ENTRIES_LICENSE("license");
 constexpr StringRef ATTRIBUTE_ENTRIES_TAGS("tags");
 constexpr StringRef ATTRIBUTE_ENTRIES_PROPERTIES("properties");
+constexpr StringRef ATTRIBUTE_FILES("files");
+constexpr StringRef ATTRIBUTE_FILES_MODIFICATION_TIME("modification_time");
+constexpr StringRef ATTRIBUTE_FILES_SIZE("size");
+constexpr StringRef ATTRIBUTE_FILES_INDEX("index");
 
 /** Abstract class for #BlendFile and #AssetIndexFile. */
 class AbstractFile {
@@ -290,6 +316,20 @@ struct AssetLibraryIndex {
     bool is_used = false;
   };
 
+  /**
+   * \brief Contents of a single per-file index as cached in the library bundle file.
+   */
+  struct BundledFileIndex {
+    /** Modification time of the blend file at the time its index was created. */
+    int64_t blend_file_mtime = 0;
+    /** Size of the blend file at the time its index was created. */
+    int64_t blend_file_size = 0;
+    /** Root value of the per-file index (same structure as a `.index.json` file). */
+    std::shared_ptr<Value> contents;
+    /** Bundled indices that aren't used when reading finishes are dropped from the bundle. */
+    bool is_used = false;
+  };
+
   /**
    * File indices that are existing already before reading/updating performs changes. The key is
    * the absolute path. The value can store information like if the index is known to be used.
@@ -299,6 +339,16 @@ struct AssetLibraryIndex {
    */
   Map<std::string /*path*/, PreexistingFileIndexInfo> preexisting_file_indices;
 
+  /**
+   * Per-file indices loaded from the bundle file, keyed by the absolute path of the blend file
+   * they were created from. Updated while reading so the bundle can be written back when reading
+   * finishes.
+   */
+  Map<std::string /*blend path*/, BundledFileIndex> bundled_file_indices;
+
+  /** True when #bundled_file_indices changed compared to the bundle file on disk. */
+  bool bundle_is_dirty = false;
+
   /**
    * \brief Absolute path where the indices of `library` are stored.
    *
@@ -356,6 +406,64 @@ struct AssetLibraryIndex {
     return ss.str();
   }
 
+  /**
+   * \return absolute path of the bundle file caching all per-file indices of this library.
+   *
+   * \note The name deliberately doesn't end with `.index.json` so the bundle isn't picked up as a
+   * pre-existing per-file index (see #collect_preexisting_file_indices).
+   */
+  std::string bundle_file_path() const
+  {
+    return this->indices_base_path + "library.bundle.json";
+  }
+
+  /**
+   * Load #bundled_file_indices from the bundle file. Missing, outdated or corrupt bundles are
+   * silently ignored; reading then falls back to the per-file indices and the bundle is rebuilt
+   * from them.
+   */
+  /* Implemented further below. */
+  void read_bundle();
+
+  /**
+   * \return the bundled index for the given blend file, or null when there is none or the blend
+   * file changed since the index was created. A returned index is marked as used, keeping it in
+   * the bundle when it is written back.
+   */
+  const DictionaryValue *lookup_bundled_index(const StringRef blend_file_path,
+                                              const int64_t blend_file_mtime,
+                                              const int64_t blend_file_size)
+  {
+    BundledFileIndex *bundled = this->bundled_file_indices.lookup_ptr_as(blend_file_path);
+    if (bundled == nullptr) {
+      return nullptr;
+    }
+    if (bundled->blend_file_mtime != blend_file_mtime ||
+        bundled->blend_file_size != blend_file_size)
+    {
+      return nullptr;
+    }
+    bundled->is_used = true;
+    return bundled->contents->as_dictionary_value();
+  }
+
+  void store_in_bundle(std::string blend_file_path,
+                       const int64_t blend_file_mtime,
+                       const int64_t blend_file_size,
+                       std::shared_ptr<Value> contents)
+  {
+    BundledFileIndex bundled{blend_file_mtime, blend_file_size, std::move(contents), true};
+    this->bundled_file_indices.add_overwrite(std::move(blend_file_path), std::move(bundled));
+    this->bundle_is_dirty = true;
+  }
+
+  /**
+   * Drop bundled indices that weren't used while reading (their blend file was removed or
+   * renamed) and write the bundle file when its contents changed.
+   */
+  /* Implemented further below. */
+  void write_bundle();
+
   /**
    * Check for pre-existing index files to be able to track what is still used and what can be
    * removed. See #AssetLibraryIndex::preexisting_file_indices.
@@ -592,6 +700,83 @@ class AssetIndexFile : public AbstractFile {
   }
 };
 
+void AssetLibraryIndex::read_bundle()
+{
+  const std::string bundle_path = this->bundle_file_path();
+  if (!BLI_exists(bundle_path.c_str())) {
+    return;
+  }
+
+  JsonFormatter formatter;
+  std::ifstream is;
+  is.open(bundle_path);
+  std::unique_ptr<Value> read_data = formatter.deserialize(is);
+  is.close();
+
+  const DictionaryValue *root = read_data ? read_data->as_dictionary_value() : nullptr;
+  if (root == nullptr) {
+    CLOG_INFO(&LOG, 2, "Ignoring corrupt asset index bundle [%s].", bundle_path.c_str());
+    return;
+  }
+  if (root->lookup_int(ATTRIBUTE_VERSION).value_or(-1) != AssetIndex::CURRENT_VERSION) {
+    CLOG_INFO(&LOG, 2, "Ignoring outdated asset index bundle [%s].", bundle_path.c_str());
+    return;
+  }
+  const DictionaryValue *files = root->lookup_dict(ATTRIBUTE_FILES);
+  if (files == nullptr) {
+    return;
+  }
+
+  for (const DictionaryValue::Item &item : files->elements()) {
+    const DictionaryValue *file = item.second->as_dictionary_value();
+    if (file == nullptr) {
+      continue;
+    }
+    const std::optional<int64_t> mtime = file->lookup_int(ATTRIBUTE_FILES_MODIFICATION_TIME);
+    const std::optional<int64_t> size = file->lookup_int(ATTRIBUTE_FILES_SIZE);
+    const std::shared_ptr<Value> *contents = file->lookup(ATTRIBUTE_FILES_INDEX);
+    if (!mtime || !size || contents == nullptr ||
+        (*contents)->as_dictionary_value() == nullptr) {
+      continue;
+    }
+    this->bundled_file_indices.add(item.first, BundledFileIndex{*mtime, *size, *contents});
+  }
+}
+
+void AssetLibraryIndex::write_bundle()
+{
+  const int64_t num_dropped = this->bundled_file_indices.remove_if(
+      [](auto item) { return !item.value.is_used; });
+  if (num_dropped > 0) {
+    this->bundle_is_dirty = true;
+  }
+  if (!this->bundle_is_dirty) {
+    return;
+  }
+
+  const std::string bundle_path = this->bundle_file_path();
+  if (!BLI_file_ensure_parent_dir_exists(bundle_path.c_str())) {
+    CLOG_ERROR(&LOG, "Bundle not created: couldn't create folder [%s].", bundle_path.c_str());
+    return;
+  }
+
+  DictionaryValue root;
+  root.append_int(ATTRIBUTE_VERSION, AssetIndex::CURRENT_VERSION);
+  std::shared_ptr<DictionaryValue> files = root.append_dict(ATTRIBUTE_FILES);
+  for (const auto &item : this->bundled_file_indices.items()) {
+    std::shared_ptr<DictionaryValue> file = files->append_dict(item.key);
+    file->append_int(ATTRIBUTE_FILES_MODIFICATION_TIME, item.value.blend_file_mtime);
+    file->append_int(ATTRIBUTE_FILES_SIZE, item.value.blend_file_size);
+    file->append(ATTRIBUTE_FILES_INDEX, item.value.contents);
+  }
+
+  JsonFormatter formatter;
+  std::ofstream os;
+  os.open(bundle_path, std::ios::out | std::ios::trunc);
+  formatter.serialize(os, root);
+  os.close();
+}
+
 /* TODO(Julian): remove this after a short while. Just necessary for people who've been using alpha
  * builds from a certain period. */
 int AssetLibraryIndex::remove_broken_index_files()
@@ -650,6 +835,31 @@ static eFileIndexerResult read_index(const char *filename,
   BlendFile asset_file(filename);
   AssetIndexFile asset_index_file(library_index, asset_file);
 
+  BLI_stat_t blend_stat = {};
+  const bool has_blend_stat = BLI_stat(filename, &blend_stat) != -1;
+
+  if (has_blend_stat) {
+    if (const DictionaryValue *bundled_contents = library_index.lookup_bundled_index(
+            filename, blend_stat.st_mtime, blend_stat.st_size))
+    {
+      /* Keep the per-file index around, it is the fallback when the bundle gets removed or
+       * corrupted. */
+      asset_index_file.mark_as_used();
+
+      int read_entries_len = 0;
+      if (bundled_contents->lookup_array(ATTRIBUTE_ENTRIES)) {
+        read_entries_len = init_indexer_entries_from_value(*entries, *bundled_contents);
+      }
+      CLOG_INFO(&LOG,
+                3,
+                "Read %d entries from bundled asset index for [%s].",
+                read_entries_len,
+                filename);
+      *r_read_entries_len = read_entries_len;
+      return FILE_INDEXER_ENTRIES_LOADED;
+    }
+  }
+
   if (!asset_index_file.exists()) {
     return FILE_INDEXER_NEEDS_UPDATE;
   }
@@ -675,6 +885,12 @@ static eFileIndexerResult read_index(const char *filename,
               3,
               "Asset file index is to small to contain any entries. [%s]",
               asset_index_file.filename.c_str());
+    if (has_blend_stat) {
+      std::shared_ptr<DictionaryValue> contents = std::make_shared<DictionaryValue>();
+      contents->append_int(ATTRIBUTE_VERSION, AssetIndex::CURRENT_VERSION);
+      library_index.store_in_bundle(
+          filename, blend_stat.st_mtime, blend_stat.st_size, std::move(contents));
+    }
     *r_read_entries_len = 0;
     return FILE_INDEXER_ENTRIES_LOADED;
   }
@@ -694,6 +910,13 @@ static eFileIndexerResult read_index(const char *filename,
   CLOG_INFO(&LOG, 1, "Read %d entries from asset index for [%s].", read_entries_len, filename);
   *r_read_entries_len = read_entries_len;
 
+  if (has_blend_stat) {
+    library_index.store_in_bundle(filename,
+                                  blend_stat.st_mtime,
+                                  blend_stat.st_size,
+                                  std::shared_ptr<Value>(std::move(contents->contents)));
+  }
+
   return FILE_INDEXER_ENTRIES_LOADED;
 }
 
@@ -710,6 +933,14 @@ static void update_index(const char *filename, FileIndexerEntries *entries, void
 
   AssetIndex content(*entries);
   asset_index_file.write_contents(content);
+
+  BLI_stat_t blend_stat = {};
+  if (BLI_stat(filename, &blend_stat) != -1) {
+    library_index.store_in_bundle(filename,
+                                  blend_stat.st_mtime,
+                                  blend_stat.st_size,
+                                  std::shared_ptr<Value>(std::move(content.contents)));
+  }
 }
 
 static void *init_user_data(const char *root_directory, size_t root_directory_maxncpy)
@@ -718,6 +949,7 @@ static void *init_user_data(const char *root_directory, size_t root_directory_ma
       __func__, StringRef(root_directory, BLI_strnlen(root_directory, root_directory_maxncpy)));
   library_index->collect_preexisting_file_indices();
   library_index->remove_broken_index_files();
+  library_index->read_bundle();
   return library_index;
 }
 
@@ -733,6 +965,7 @@ static void filelist_finished(void *user_data)
   if (num_indices_removed > 0) {
     CLOG_INFO(&LOG, 1, "Removed %d unused indices.", num_indices_removed);
   }
+  library_index.write_bundle();
 }
 
 constexpr FileIndexerType asset_indexer()
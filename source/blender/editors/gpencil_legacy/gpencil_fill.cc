@@ -14,6 +14,7 @@
 #include "BLI_ghash.h"
 #include "BLI_math_matrix.h"
 #include "BLI_stack.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -1513,6 +1514,23 @@ static bool gpencil_boundaryfill_area(tGPDfill *tgpf)
    * -----------
    * </pre>
    */
+  /* Check a neighbor pixel before pushing it: border (red) and already filled (green) pixels are
+   * never filled, so pushing them only grows the stack and forces a second read when they are
+   * popped again. Border contact is detected here as well since border pixels no longer enter the
+   * stack. */
+  const auto push_if_fillable = [&](const int index) {
+    get_pixel(ibuf, index, rgba);
+
+    /* Determine if the flood contacts with external borders. */
+    if (rgba[3] == 0.5f) {
+      border_contact = true;
+    }
+
+    if ((rgba[0] != 1.0f) && (rgba[1] != 1.0f)) {
+      BLI_stack_push(stack, &index);
+    }
+  };
+
   while (!BLI_stack_is_empty(stack)) {
     int v;
 
@@ -1533,30 +1551,26 @@ static bool gpencil_boundaryfill_area(tGPDfill *tgpf)
       /* add contact pixels */
       /* pixel left */
       if (v - 1 >= 0) {
-        index = v - 1;
         if (!is_leak_narrow(ibuf, maxpixel, tgpf->fill_leak, v, LEAK_HORZ)) {
-          BLI_stack_push(stack, &index);
+          push_if_fillable(v - 1);
         }
       }
       /* pixel right */
       if (v + 1 <= maxpixel) {
-        index = v + 1;
         if (!is_leak_narrow(ibuf, maxpixel, tgpf->fill_leak, v, LEAK_HORZ)) {
-          BLI_stack_push(stack, &index);
+          push_if_fillable(v + 1);
         }
       }
       /* pixel top */
       if (v + ibuf->x <= maxpixel) {
-        index = v + ibuf->x;
         if (!is_leak_narrow(ibuf, maxpixel, tgpf->fill_leak, v, LEAK_VERT)) {
-          BLI_stack_push(stack, &index);
+          push_if_fillable(v + ibuf->x);
         }
       }
       /* pixel bottom */
       if (v - ibuf->x >= 0) {
-        index = v - ibuf->x;
         if (!is_leak_narrow(ibuf, maxpixel, tgpf->fill_leak, v, LEAK_VERT)) {
-          BLI_stack_push(stack, &index);
+          push_if_fillable(v - ibuf->x);
         }
       }
     }
@@ -1617,22 +1631,27 @@ static void gpencil_invert_image(tGPDfill *tgpf)
 
   const int maxpixel = (ibuf->x * ibuf->y) - 1;
 
-  for (int v = maxpixel; v != 0; v--) {
-    float color[4];
-    get_pixel(ibuf, v, color);
-    /* Green->Red. */
-    if (color[1] == 1.0f) {
-      set_pixel(ibuf, v, fill_col[0]);
-    }
-    /* Red->Green */
-    else if (color[0] == 1.0f) {
-      set_pixel(ibuf, v, fill_col[1]);
-    }
-    else {
-      /* Set to Transparent. */
-      set_pixel(ibuf, v, fill_col[2]);
-    }
-  }
+  /* Every pixel is swapped independently, so process them in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(1, maxpixel), 32768, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          const int v = int(i);
+          float color[4];
+          get_pixel(ibuf, v, color);
+          /* Green->Red. */
+          if (color[1] == 1.0f) {
+            set_pixel(ibuf, v, fill_col[0]);
+          }
+          /* Red->Green */
+          else if (color[0] == 1.0f) {
+            set_pixel(ibuf, v, fill_col[1]);
+          }
+          else {
+            /* Set to Transparent. */
+            set_pixel(ibuf, v, fill_col[2]);
+          }
+        }
+      });
 
   /* release ibuf */
   BKE_image_release_ibuf(tgpf->ima, ibuf, lock);
@@ -1662,43 +1681,46 @@ static void gpencil_erase_processed_area(tGPDfill *tgpf)
     set_pixel(ibuf, image_idx, blue_col);
   }
 
-  /* Second, clean by lines any pixel between blue pixels. */
-  float rgba[4];
-
-  for (int idy = 0; idy < ibuf->y; idy++) {
-    int init = -1;
-    int end = -1;
-    for (int idx = 0; idx < ibuf->x; idx++) {
-      int image_idx = ibuf->x * idy + idx;
-      get_pixel(ibuf, image_idx, rgba);
-      /* Blue. */
-      if (rgba[2] == 1.0f) {
-        if (init < 0) {
-          init = image_idx;
-        }
-        else {
-          end = image_idx;
-        }
-      }
-      /* Red. */
-      else if (rgba[0] == 1.0f) {
-        if (init > -1) {
-          for (int i = init; i <= max_ii(init, end); i++) {
-            set_pixel(ibuf, i, clear_col);
+  /* Second, clean by lines any pixel between blue pixels. Rows are independent of each other, so
+   * scan them in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(ibuf->y), 8, [&](const blender::IndexRange range) {
+        float rgba[4];
+        for (const int64_t idy : range) {
+          int init = -1;
+          int end = -1;
+          for (int idx = 0; idx < ibuf->x; idx++) {
+            int image_idx = ibuf->x * int(idy) + idx;
+            get_pixel(ibuf, image_idx, rgba);
+            /* Blue. */
+            if (rgba[2] == 1.0f) {
+              if (init < 0) {
+                init = image_idx;
+              }
+              else {
+                end = image_idx;
+              }
+            }
+            /* Red. */
+            else if (rgba[0] == 1.0f) {
+              if (init > -1) {
+                for (int i = init; i <= max_ii(init, end); i++) {
+                  set_pixel(ibuf, i, clear_col);
+                }
+                init = -1;
+                end = -1;
+              }
+            }
+          }
+          /* Check last segment. */
+          if (init > -1) {
+            for (int i = init; i <= max_ii(init, end); i++) {
+              set_pixel(ibuf, i, clear_col);
+            }
+            set_pixel(ibuf, init, clear_col);
           }
-          init = -1;
-          end = -1;
         }
-      }
-    }
-    /* Check last segment. */
-    if (init > -1) {
-      for (int i = init; i <= max_ii(init, end); i++) {
-        set_pixel(ibuf, i, clear_col);
-      }
-      set_pixel(ibuf, init, clear_col);
-    }
-  }
+      });
 
   /* release ibuf */
   BKE_image_release_ibuf(tgpf->ima, ibuf, lock);
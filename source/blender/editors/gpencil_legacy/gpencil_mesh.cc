@@ -103,18 +103,16 @@ static void animdata_keyframe_list_get(ListBase *ob_list,
 static void gpencil_bake_duplilist(Depsgraph *depsgraph, Scene *scene, Object *ob, ListBase *list)
 {
   GpBakeOb *elem = nullptr;
-  ListBase *lb;
-  lb = object_duplilist(depsgraph, scene, ob);
-  LISTBASE_FOREACH (DupliObject *, dob, lb) {
-    if (dob->ob->type != OB_MESH) {
+  DupliList duplilist;
+  object_duplilist(depsgraph, scene, ob, duplilist);
+  for (const DupliObject &dob : duplilist) {
+    if (dob.ob->type != OB_MESH) {
       continue;
     }
     elem = MEM_cnew<GpBakeOb>(__func__);
-    elem->ob = dob->ob;
+    elem->ob = dob.ob;
     BLI_addtail(list, elem);
   }
-
-  free_object_duplilist(lb);
 }
 
 static bool gpencil_bake_ob_list(bContext *C, Depsgraph *depsgraph, Scene *scene, ListBase *list)
@@ -67,6 +67,9 @@ struct SnapObjectContext;
 SnapObjectContext *ED_transform_snap_object_context_create(Scene *scene, int flag);
 void ED_transform_snap_object_context_destroy(SnapObjectContext *sctx);
 
+/** Free the snap context kept alive between transform operations (see `transform_snap.cc`). */
+void ED_transform_snap_object_context_session_free();
+
 /** Callbacks to filter how snap works. */
 void ED_transform_snap_object_context_set_editmesh_callbacks(
     SnapObjectContext *sctx,
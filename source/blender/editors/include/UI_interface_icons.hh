@@ -132,6 +132,12 @@ ListBase *UI_iconfile_list();
 int UI_iconfile_get_index(const char *filename);
 
 PreviewImage *UI_icon_to_preview(int icon_id);
+/**
+ * Check if the preview pixels of a preview icon are available at the requested \a size, without
+ * triggering their creation. Can be used to decide if a placeholder has to be drawn while a
+ * preview job is still loading or rendering the image in the background.
+ */
+bool UI_icon_preview_available(int icon_id, enum eIconSizes size);
 
 int UI_icon_from_rnaptr(const bContext *C, PointerRNA *ptr, int rnaicon, bool big);
 int UI_icon_from_idcode(int idcode);
@@ -6590,6 +6590,7 @@ void UI_exit()
 {
   ui_resources_free();
   ui_but_clipboard_free();
+  ui_widgetbase_draw_cache_free();
 }
 
 void UI_interface_tag_script_reload()
@@ -113,6 +113,13 @@ struct DrawInfo {
     struct {
       IconImage *image;
     } buffer;
+    struct {
+      /**
+       * GPU texture lazily created from the icon's #ImBuf (which doesn't change once set), so the
+       * pixels don't have to be re-uploaded on every draw.
+       */
+      GPUTexture *texture;
+    } imbuf;
     struct {
       int x, y, w, h;
       int theme_color;
@@ -1301,6 +1308,11 @@ void UI_icons_free_drawinfo(void *drawinfo)
       IMB_freeImBuf(di->data.geom.image_cache);
     }
   }
+  else if (di->type == ICON_TYPE_IMBUF) {
+    if (di->data.imbuf.texture) {
+      GPU_texture_free(di->data.imbuf.texture);
+    }
+  }
 
   MEM_freeN(di);
 }
@@ -1646,6 +1658,33 @@ PreviewImage *UI_icon_to_preview(int icon_id)
   return nullptr;
 }
 
+bool UI_icon_preview_available(const int icon_id, const enum eIconSizes size)
+{
+  Icon *icon = BKE_icon_get(icon_id);
+
+  if (icon == nullptr) {
+    return false;
+  }
+
+  DrawInfo *di = icon_ensure_drawinfo(icon);
+
+  if (di == nullptr || di->type != ICON_TYPE_PREVIEW) {
+    return false;
+  }
+
+  const PreviewImage *prv = (icon->id_type != 0) ?
+                                BKE_previewimg_id_ensure((ID *)icon->obj) :
+                                static_cast<const PreviewImage *>(icon->obj);
+
+  return prv && prv->rect[size] && BKE_previewimg_is_finished(prv, size);
+}
+
+/**
+ * \param texture_cache_p: Optional pointer to a texture cache slot. When given, a GPU texture is
+ * created from \a rect on the first draw and stored there, and subsequent draws reuse it instead
+ * of re-uploading the pixels. The caller is responsible for freeing the texture when \a rect
+ * changes or is freed.
+ */
 static void icon_draw_rect(float x,
                            float y,
                            int w,
@@ -1654,7 +1693,8 @@ static void icon_draw_rect(float x,
                            int rh,
                            const uint8_t *rect,
                            float alpha,
-                           const float desaturate)
+                           const float desaturate,
+                           GPUTexture **texture_cache_p = nullptr)
 {
   int draw_w = w;
   int draw_h = h;
@@ -1705,6 +1745,49 @@ static void icon_draw_rect(float x,
     immUniform1f("factor", desaturate);
   }
 
+  if (texture_cache_p) {
+    GPUTexture *texture = *texture_cache_p;
+    /* Callers invalidate the cache when the pixel buffer changes, but still handle a stale
+     * texture of a different size gracefully. */
+    if (texture && (GPU_texture_width(texture) != rw || GPU_texture_height(texture) != rh)) {
+      GPU_texture_free(texture);
+      texture = nullptr;
+    }
+    if (texture == nullptr) {
+      /* Always create the full mipmap chain, previews are drawn at many different sizes and
+       * plain bi-linear down-scaling gives poor filtering results (see
+       * #immDrawPixelsTexScaledFullSize). */
+      texture = GPU_texture_create_2d(
+          "icon_rect", rw, rh, 9999, GPU_RGBA8, GPU_TEXTURE_USAGE_SHADER_READ, nullptr);
+      GPU_texture_update(texture, GPU_DATA_UBYTE, rect);
+      GPU_texture_filter_mode(texture, true);
+      GPU_texture_update_mipmap_chain(texture);
+      GPU_texture_mipmap_mode(texture, true, true);
+      GPU_texture_extend_mode(texture, GPU_SAMPLER_EXTEND_MODE_EXTEND);
+    }
+    *texture_cache_p = texture;
+
+    GPU_texture_bind(texture, 0);
+    immUniformColor4fv(col);
+
+    immBegin(GPU_PRIM_TRI_FAN, 4);
+    immAttr2f(state.texco, 0.0f, 0.0f);
+    immVertex2f(state.pos, draw_x, draw_y);
+    immAttr2f(state.texco, 1.0f, 0.0f);
+    immVertex2f(state.pos, draw_x + draw_w, draw_y);
+    immAttr2f(state.texco, 1.0f, 1.0f);
+    immVertex2f(state.pos, draw_x + draw_w, draw_y + draw_h);
+    immAttr2f(state.texco, 0.0f, 1.0f);
+    immVertex2f(state.pos, draw_x, draw_y + draw_h);
+    immEnd();
+
+    if (state.do_shader_unbind) {
+      immUnbindProgram();
+    }
+    GPU_texture_unbind(texture);
+    return;
+  }
+
   immDrawPixelsTexScaledFullSize(
       &state, draw_x, draw_y, rw, rh, GPU_RGBA8, true, rect, scale_x, scale_y, 1.0f, 1.0f, col);
 }
@@ -2014,7 +2097,16 @@ static void icon_draw_size(float x,
     const ImBuf *ibuf = static_cast<const ImBuf *>(icon->obj);
 
     GPU_blend(GPU_BLEND_ALPHA_PREMULT);
-    icon_draw_rect(x, y, w, h, ibuf->x, ibuf->y, ibuf->byte_buffer.data, alpha, desaturate);
+    icon_draw_rect(x,
+                   y,
+                   w,
+                   h,
+                   ibuf->x,
+                   ibuf->y,
+                   ibuf->byte_buffer.data,
+                   alpha,
+                   desaturate,
+                   &di->data.imbuf.texture);
     GPU_blend(GPU_BLEND_ALPHA);
   }
   else if (di->type == ICON_TYPE_VECTOR) {
@@ -2137,6 +2229,13 @@ static void icon_draw_size(float x,
         return;
       }
 
+      /* Only cache the texture while the preview isn't being written to by a render or loading
+       * job, the cached texture wouldn't be updated along with the pixel buffer. */
+      GPUTexture **texture_cache_p = (BKE_previewimg_is_finished(pi, size) &&
+                                      (pi->flag[size] & PRV_CHANGED) == 0) ?
+                                         &pi->runtime->gputexture[size] :
+                                         nullptr;
+
       /* Preview images use premultiplied alpha. */
       GPU_blend(GPU_BLEND_ALPHA_PREMULT);
       icon_draw_rect(x,
@@ -2147,7 +2246,8 @@ static void icon_draw_size(float x,
                      pi->h[size],
                      reinterpret_cast<const uint8_t *>(pi->rect[size]),
                      alpha,
-                     desaturate);
+                     desaturate,
+                     texture_cache_p);
       GPU_blend(GPU_BLEND_ALPHA);
     }
   }
@@ -2166,6 +2266,13 @@ static void ui_id_preview_image_render_size(
 {
   /* changed only ever set by dynamic icons */
   if ((pi->flag[size] & PRV_CHANGED) || !pi->rect[size]) {
+    /* The pixel buffer is about to be re-rendered in place, the cached texture would keep
+     * showing the old content. */
+    if (pi->runtime->gputexture[size]) {
+      GPU_texture_free(pi->runtime->gputexture[size]);
+      pi->runtime->gputexture[size] = nullptr;
+    }
+
     /* create the rect if necessary */
     icon_set_image(C, scene, id, pi, eIconSizes(size), use_job);
 
@@ -21,6 +21,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_context.hh"
 
@@ -43,6 +44,7 @@
 #include "GPU_matrix.hh"
 #include "GPU_platform.hh"
 #include "GPU_state.hh"
+#include "GPU_storage_buffer.hh"
 
 #ifdef WITH_INPUT_IME
 #  include "WM_types.hh"
@@ -1052,39 +1054,63 @@ static void widgetbase_set_uniform_colors_ubv(uiWidgetBase *wtb,
 #define MAX_WIDGET_PARAMETERS 12
 
 static struct {
-  uiWidgetBaseParameters params[MAX_WIDGET_BASE_BATCH];
-  int count;
+  /** Grows as needed, all accumulated widgets are flushed in a single draw. */
+  blender::Vector<uiWidgetBaseParameters> params;
   bool enabled;
-} g_widget_base_batch = {{{{0}}}};
+} g_widget_base_batch;
+
+void ui_widgetbase_draw_cache_free()
+{
+  g_widget_base_batch.params.clear_and_shrink();
+}
 
 void UI_widgetbase_draw_cache_flush()
 {
   const float checker_params[3] = {
       UI_ALPHA_CHECKER_DARK / 255.0f, UI_ALPHA_CHECKER_LIGHT / 255.0f, 8.0f};
 
-  if (g_widget_base_batch.count == 0) {
+  const int count = g_widget_base_batch.params.size();
+  if (count == 0) {
     return;
   }
 
   blender::gpu::Batch *batch = ui_batch_roundbox_widget_get();
-  if (g_widget_base_batch.count == 1) {
+  if (count == 1) {
     /* draw single */
     GPU_batch_program_set_builtin(batch, GPU_SHADER_2D_WIDGET_BASE);
-    GPU_batch_uniform_4fv_array(
-        batch, "parameters", MAX_WIDGET_PARAMETERS, (const float(*)[4])g_widget_base_batch.params);
+    GPU_batch_uniform_4fv_array(batch,
+                                "parameters",
+                                MAX_WIDGET_PARAMETERS,
+                                (const float(*)[4])g_widget_base_batch.params.data());
     GPU_batch_uniform_3fv(batch, "checkerColorAndSize", checker_params);
     GPU_batch_draw(batch);
   }
-  else {
+  else if (count <= MAX_WIDGET_BASE_BATCH) {
+    /* Small batches fit in the push constant block. */
     GPU_batch_program_set_builtin(batch, GPU_SHADER_2D_WIDGET_BASE_INST);
     GPU_batch_uniform_4fv_array(batch,
                                 "parameters",
-                                MAX_WIDGET_PARAMETERS * MAX_WIDGET_BASE_BATCH,
-                                (float(*)[4])g_widget_base_batch.params);
+                                MAX_WIDGET_PARAMETERS * count,
+                                (float(*)[4])g_widget_base_batch.params.data());
     GPU_batch_uniform_3fv(batch, "checkerColorAndSize", checker_params);
-    GPU_batch_draw_instance_range(batch, 0, g_widget_base_batch.count);
+    GPU_batch_draw_instance_range(batch, 0, count);
   }
-  g_widget_base_batch.count = 0;
+  else {
+    /* Large batches stream the parameters through a storage buffer, so a full region worth of
+     * widgets still renders with a single draw call. */
+    GPUStorageBuf *params_buf = GPU_storagebuf_create_ex(sizeof(uiWidgetBaseParameters) * count,
+                                                         g_widget_base_batch.params.data(),
+                                                         GPU_USAGE_STREAM,
+                                                         __func__);
+    GPU_batch_program_set_builtin(batch, GPU_SHADER_2D_WIDGET_BASE_BATCH);
+    GPU_storagebuf_bind(params_buf, GPU_shader_get_ssbo_binding(batch->shader, "parameters_buf"));
+    GPU_batch_uniform_3fv(batch, "checkerColorAndSize", checker_params);
+    GPU_batch_draw_instance_range(batch, 0, count);
+    GPU_storagebuf_unbind(params_buf);
+    /* Deletion is deferred by the GPU backend until the draw is done. */
+    GPU_storagebuf_free(params_buf);
+  }
+  g_widget_base_batch.params.clear();
 }
 
 void UI_widgetbase_draw_cache_begin()
@@ -1114,12 +1140,7 @@ static void draw_widgetbase_batch(uiWidgetBase *wtb)
   copy_v2_v2(wtb->uniform_params.tria2_center, wtb->tria2.center);
 
   if (g_widget_base_batch.enabled) {
-    g_widget_base_batch.params[g_widget_base_batch.count] = wtb->uniform_params;
-    g_widget_base_batch.count++;
-
-    if (g_widget_base_batch.count == MAX_WIDGET_BASE_BATCH) {
-      UI_widgetbase_draw_cache_flush();
-    }
+    g_widget_base_batch.params.append(wtb->uniform_params);
   }
   else {
     const float checker_params[3] = {
@@ -857,7 +857,7 @@ static int edbm_face_split_by_edges_exec(bContext *C, wmOperator * /*op*/)
         BM_elem_index_set(f, i); /* set_ok */
       }
     }
-    bm->elem_index_dirty &= ~BM_FACE;
+    BM_mesh_elem_index_dirty_clear(bm, BM_FACE);
 
     BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
       if (BM_elem_flag_test(e, hflag)) {
@@ -2873,7 +2873,7 @@ bool EDBM_select_interior_faces(BMEditMesh *em)
 
       BM_elem_index_set(e, i); /* set_inline */
     }
-    bm->elem_index_dirty &= ~BM_EDGE;
+    BM_mesh_elem_index_dirty_clear(bm, BM_EDGE);
 
     if (has_nonmanifold == false) {
       MEM_freeN(edge_lengths);
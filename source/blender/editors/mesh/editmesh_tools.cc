@@ -4273,7 +4273,7 @@ static int edbm_knife_cut_exec(bContext *C, wmOperator *op)
     BM_elem_index_set(bv, i); /* set_inline */
     sco++;
   }
-  bm->elem_index_dirty &= ~BM_VERT; /* clear dirty flag */
+  BM_mesh_elem_index_dirty_clear(bm, BM_VERT); /* clear dirty flag */
 
   if (!EDBM_op_init(em, &bmop, op, "subdivide_edges")) {
     MEM_freeN(mouse_path);
@@ -5773,7 +5773,7 @@ static int edbm_decimate_exec(bContext *C, wmOperator *op)
         vweights[i] = weight;
         BM_elem_index_set(v, i); /* set_inline */
       }
-      bm->elem_index_dirty &= ~BM_VERT;
+      BM_mesh_elem_index_dirty_clear(bm, BM_VERT);
     }
 
     float ratio_adjust;
@@ -10,6 +10,7 @@
 #include "BLI_path_util.h"
 #include "BLI_serialize.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -292,19 +293,22 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
     const std::string frame_file_name = bake::frame_to_file_name(frame);
 
-    for (NodeBakeRequest &request : job.bake_requests) {
+    /* Serializing the new frame of each request is independent work: every request writes into
+     * its own bake directory with its own blob sharing state. Spread the encoding and disk IO
+     * over threads, which speeds up "bake all" style jobs with many baked nodes. */
+    threading::parallel_for_each(job.bake_requests, [&](NodeBakeRequest &request) {
       NodesModifierData &nmd = *request.nmd;
       bake::ModifierCache &modifier_cache = *nmd.runtime->cache;
       const bake::NodeBakeCache *bake_cache = modifier_cache.get_node_bake_cache(request.bake_id);
       if (bake_cache == nullptr) {
-        continue;
+        return;
       }
       if (bake_cache->frames.is_empty()) {
-        continue;
+        return;
       }
       const bake::FrameCache &frame_cache = *bake_cache->frames.last();
       if (frame_cache.frame != frame) {
-        continue;
+        return;
       }
 
       const bake::BakePath path = request.path;
@@ -318,7 +322,7 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
       bake::DiskBlobWriter blob_writer{path.blobs_dir, frame_file_name};
       fstream meta_file{meta_path, std::ios::out};
       bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
-    }
+    });
 
     worker_status->progress += progress_per_frame;
     worker_status->do_update = true;
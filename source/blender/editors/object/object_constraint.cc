@@ -1339,7 +1339,8 @@ void constraint_dependency_update(Main *bmain, Object *ob)
   if (ob->pose) {
     object_pose_tag_update(bmain, ob);
   }
-  DEG_relations_tag_update(bmain);
+  /* Only relations of this object changed, graphs not containing it can skip the rebuild. */
+  DEG_relations_tag_update_for_id(bmain, &ob->id);
 }
 
 void constraint_tag_update(Main *bmain, Object *ob, bConstraint *con)
@@ -1372,7 +1373,8 @@ void constraint_dependency_tag_update(Main *bmain, Object *ob, bConstraint *con)
   if (ob->pose) {
     object_pose_tag_update(bmain, ob);
   }
-  DEG_relations_tag_update(bmain);
+  /* Only relations of this object changed, graphs not containing it can skip the rebuild. */
+  DEG_relations_tag_update_for_id(bmain, &ob->id);
 }
 
 bool constraint_move_to_index(Object *ob, bConstraint *con, const int index)
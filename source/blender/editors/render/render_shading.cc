@@ -1447,9 +1447,12 @@ static int light_cache_bake_invoke(bContext *C, wmOperator *op, const wmEvent *
   Main *bmain = CTX_data_main(C);
   Scene *scene = CTX_data_scene(C);
   int delay = RNA_int_get(op->ptr, "delay");
+  /* Only auto-bakes (dirty subset) may reuse unchanged probe results,
+   * a manual bake always re-renders everything. */
+  const bool incremental = (RNA_enum_get(op->ptr, "subset") == LIGHTCACHE_SUBSET_DIRTY);
 
   wmJob *wm_job = EEVEE_lightbake_job_create(
-      wm, win, bmain, view_layer, scene, delay, scene->r.cfra);
+      wm, win, bmain, view_layer, scene, delay, scene->r.cfra, incremental);
 
   if (!wm_job) {
     return OPERATOR_CANCELLED;
@@ -25,6 +25,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_context.hh"
@@ -92,7 +93,10 @@ void ED_render_view3d_update(Depsgraph *depsgraph,
       /* NOTE: Important to pass non-updated depsgraph, This is because this function is called
        * from inside dependency graph evaluation. Additionally, if we pass fully evaluated one
        * we will lose updates stored in the graph. */
-      engine->type->view_update(engine, C, CTX_data_depsgraph_pointer(C));
+      {
+        BLI_TRACE_SCOPE("render_engine_view_update");
+        engine->type->view_update(engine, C, CTX_data_depsgraph_pointer(C));
+      }
 
       CTX_free(C);
     }
@@ -142,7 +142,10 @@ void ED_region_do_listen(wmRegionListenerParams *params)
   }
 
   if (region->type && region->type->listener) {
-    region->type->listener(params);
+    const int category_mask = region->type->listener_category_mask;
+    if ((category_mask == 0) || (category_mask & NOTE_CATEGORY_MASK(notifier->category))) {
+      region->type->listener(params);
+    }
   }
 
   LISTBASE_FOREACH (uiBlock *, block, &region->uiblocks) {
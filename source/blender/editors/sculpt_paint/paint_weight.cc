@@ -13,6 +13,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.h"
 #include "BLI_color.hh"
 #include "BLI_color_mix.hh"
@@ -1048,16 +1049,53 @@ static void precompute_weight_values(
 /** \name Weight paint brushes.
  * \{ */
 
-static void parallel_nodes_loop_with_mirror_check(const Mesh &mesh,
-                                                  const Span<PBVHNode *> nodes,
-                                                  FunctionRef<void(IndexRange)> fn)
+/* Brush influence for a single vertex, computed in parallel and applied to the vertex groups
+ * through #do_weight_paint_vertex. */
+struct WeightPaintSample {
+  int vert;
+  float alpha;
+  float weight;
+};
+
+/**
+ * Run the per-node brush evaluation \a fn for all nodes, applying the resulting weight samples
+ * with #do_weight_paint_vertex.
+ *
+ * Without X-mirror, samples are applied directly from the worker threads: every vertex belongs
+ * to exactly one node. With X-mirror the weight writes also touch the mirrored vertex, which may
+ * be handled by another node, so the brush evaluation (brush tests, falloff, neighbor averaging)
+ * still runs in parallel but stages its samples per node, and the vertex group writes are applied
+ * afterwards on a single thread in node order, matching the previous fully serial result.
+ */
+static void parallel_nodes_loop_with_mirror_check(
+    const VPaint &vp,
+    Object &ob,
+    const WeightPaintInfo &wpi,
+    const Mesh &mesh,
+    const Span<PBVHNode *> nodes,
+    FunctionRef<void(int node_index, FunctionRef<void(WeightPaintSample)> apply)> fn)
 {
-  /* NOTE: current mirroring code cannot be run in parallel */
   if (ME_USING_MIRROR_X_VERTEX_GROUPS(&mesh)) {
-    fn(nodes.index_range());
+    Array<Vector<WeightPaintSample>> samples(nodes.size());
+    threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+      for (const int i : range) {
+        fn(i, [&](const WeightPaintSample sample) { samples[i].append(sample); });
+      }
+    });
+    for (const int i : nodes.index_range()) {
+      for (const WeightPaintSample &sample : samples[i]) {
+        do_weight_paint_vertex(vp, ob, wpi, sample.vert, sample.alpha, sample.weight);
+      }
+    }
   }
   else {
-    threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) { fn(range); });
+    threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+      for (const int i : range) {
+        fn(i, [&](const WeightPaintSample sample) {
+          do_weight_paint_vertex(vp, ob, wpi, sample.vert, sample.alpha, sample.weight);
+        });
+      }
+    });
   }
 }
 
@@ -1100,61 +1138,66 @@ static void do_wpaint_brush_blur(const Scene &scene,
     select_vert = *attributes.lookup<bool>(".select_vert", bke::AttrDomain::Point);
   }
 
-  parallel_nodes_loop_with_mirror_check(mesh, nodes, [&](const IndexRange range) {
-    SculptBrushTest test = test_init;
-    for (const int i : range) {
-      for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
-        if (!hide_vert.is_empty() && hide_vert[vert]) {
-          continue;
-        }
-        if (!select_vert.is_empty() && !select_vert[vert]) {
-          continue;
-        }
-        if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
-          continue;
-        }
+  parallel_nodes_loop_with_mirror_check(
+      vp,
+      ob,
+      wpi,
+      mesh,
+      nodes,
+      [&](const int i, const FunctionRef<void(WeightPaintSample)> apply) {
+        SculptBrushTest test = test_init;
+        for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
+          if (!hide_vert.is_empty() && hide_vert[vert]) {
+            continue;
+          }
+          if (!select_vert.is_empty() && !select_vert[vert]) {
+            continue;
+          }
+          if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
+            continue;
+          }
 
-        /* Get the average face weight */
-        int total_hit_loops = 0;
-        float weight_final = 0.0f;
-        for (const int face : vert_to_face[vert]) {
-          total_hit_loops += faces[face].size();
-          for (const int vert : corner_verts.slice(faces[face])) {
-            weight_final += wpd.precomputed_weight[vert];
+          /* Get the average face weight */
+          int total_hit_loops = 0;
+          float weight_final = 0.0f;
+          for (const int face : vert_to_face[vert]) {
+            total_hit_loops += faces[face].size();
+            for (const int vert : corner_verts.slice(faces[face])) {
+              weight_final += wpd.precomputed_weight[vert];
+            }
           }
-        }
 
-        if (total_hit_loops == 0) {
-          continue;
-        }
+          if (total_hit_loops == 0) {
+            continue;
+          }
 
-        float brush_strength = cache->bstrength;
-        const float angle_cos = use_normal ?
-                                    dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
-                                    1.0f;
-        if (!vwpaint::test_brush_angle_falloff(
-                brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
-        {
-          continue;
-        }
+          float brush_strength = cache->bstrength;
+          const float angle_cos = use_normal ?
+                                      dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
+                                      1.0f;
+          if (!vwpaint::test_brush_angle_falloff(
+                  brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
+          {
+            continue;
+          }
 
-        const float brush_fade = BKE_brush_curve_strength(&brush, sqrtf(test.dist), cache->radius);
-        const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
+          const float brush_fade = BKE_brush_curve_strength(
+              &brush, sqrtf(test.dist), cache->radius);
+          const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
 
-        if ((brush.flag & BRUSH_ACCUMULATE) == 0) {
-          if (ss.mode.wpaint.alpha_weight[vert] < final_alpha) {
-            ss.mode.wpaint.alpha_weight[vert] = final_alpha;
-          }
-          else {
-            continue;
+          if ((brush.flag & BRUSH_ACCUMULATE) == 0) {
+            if (ss.mode.wpaint.alpha_weight[vert] < final_alpha) {
+              ss.mode.wpaint.alpha_weight[vert] = final_alpha;
+            }
+            else {
+              continue;
+            }
           }
-        }
 
-        weight_final /= total_hit_loops;
-        do_weight_paint_vertex(vp, ob, wpi, vert, final_alpha, weight_final);
-      }
-    }
-  });
+          weight_final /= total_hit_loops;
+          apply({vert, final_alpha, weight_final});
+        }
+      });
 }
 
 static void do_wpaint_brush_smear(const Scene &scene,
@@ -1205,75 +1248,79 @@ static void do_wpaint_brush_smear(const Scene &scene,
   const float *sculpt_normal_frontface = SCULPT_brush_frontface_normal_from_falloff_shape(
       ss, brush.falloff_shape);
 
-  parallel_nodes_loop_with_mirror_check(mesh, nodes, [&](const IndexRange range) {
-    SculptBrushTest test = test_init;
-    for (const int i : range) {
-      for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
-        if (!hide_vert.is_empty() && hide_vert[vert]) {
-          continue;
-        }
-        if (!select_vert.is_empty() && !select_vert[vert]) {
-          continue;
-        }
-        if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
-          continue;
-        }
+  parallel_nodes_loop_with_mirror_check(
+      vp,
+      ob,
+      wpi,
+      mesh,
+      nodes,
+      [&](const int i, const FunctionRef<void(WeightPaintSample)> apply) {
+        SculptBrushTest test = test_init;
+        for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
+          if (!hide_vert.is_empty() && hide_vert[vert]) {
+            continue;
+          }
+          if (!select_vert.is_empty() && !select_vert[vert]) {
+            continue;
+          }
+          if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
+            continue;
+          }
 
-        float brush_strength = cache->bstrength;
-        const float angle_cos = use_normal ?
-                                    dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
-                                    1.0f;
-        if (!vwpaint::test_brush_angle_falloff(
-                brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
-        {
-          continue;
-        }
+          float brush_strength = cache->bstrength;
+          const float angle_cos = use_normal ?
+                                      dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
+                                      1.0f;
+          if (!vwpaint::test_brush_angle_falloff(
+                  brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
+          {
+            continue;
+          }
 
-        bool do_color = false;
-        /* Minimum dot product between brush direction and current
-         * to neighbor direction is 0.0, meaning orthogonal. */
-        float stroke_dot_max = 0.0f;
-
-        /* Get the color of the loop in the opposite direction of the brush movement
-         * (this callback is specifically for smear.) */
-        float weight_final = 0.0;
-        for (const int face : vert_to_face[vert]) {
-          for (const int vert_other : corner_verts.slice(faces[face])) {
-            if (vert_other == vert) {
+          bool do_color = false;
+          /* Minimum dot product between brush direction and current
+           * to neighbor direction is 0.0, meaning orthogonal. */
+          float stroke_dot_max = 0.0f;
+
+          /* Get the color of the loop in the opposite direction of the brush movement
+           * (this callback is specifically for smear.) */
+          float weight_final = 0.0;
+          for (const int face : vert_to_face[vert]) {
+            for (const int vert_other : corner_verts.slice(faces[face])) {
+              if (vert_other == vert) {
+                continue;
+              }
+
+              /* Get the direction from the selected vert to the neighbor. */
+              float other_dir[3];
+              sub_v3_v3v3(other_dir, vert_positions[vert], vert_positions[vert_other]);
+              project_plane_v3_v3v3(other_dir, other_dir, cache->view_normal);
+
+              normalize_v3(other_dir);
+
+              const float stroke_dot = dot_v3v3(other_dir, brush_dir);
+
+              if (stroke_dot > stroke_dot_max) {
+                stroke_dot_max = stroke_dot;
+                weight_final = wpd.precomputed_weight[vert_other];
+                do_color = true;
+              }
+            }
+            if (!do_color) {
               continue;
             }
+            const float brush_fade = BKE_brush_curve_strength(
+                &brush, sqrtf(test.dist), cache->radius);
+            const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
 
-            /* Get the direction from the selected vert to the neighbor. */
-            float other_dir[3];
-            sub_v3_v3v3(other_dir, vert_positions[vert], vert_positions[vert_other]);
-            project_plane_v3_v3v3(other_dir, other_dir, cache->view_normal);
-
-            normalize_v3(other_dir);
-
-            const float stroke_dot = dot_v3v3(other_dir, brush_dir);
-
-            if (stroke_dot > stroke_dot_max) {
-              stroke_dot_max = stroke_dot;
-              weight_final = wpd.precomputed_weight[vert_other];
-              do_color = true;
+            if (final_alpha <= 0.0f) {
+              continue;
             }
-          }
-          if (!do_color) {
-            continue;
-          }
-          const float brush_fade = BKE_brush_curve_strength(
-              &brush, sqrtf(test.dist), cache->radius);
-          const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
 
-          if (final_alpha <= 0.0f) {
-            continue;
+            apply({vert, final_alpha, float(weight_final)});
           }
-
-          do_weight_paint_vertex(vp, ob, wpi, vert, final_alpha, float(weight_final));
         }
-      }
-    }
-  });
+      });
 }
 
 static void do_wpaint_brush_draw(const Scene &scene,
@@ -1315,44 +1362,49 @@ static void do_wpaint_brush_draw(const Scene &scene,
     select_vert = *attributes.lookup<bool>(".select_vert", bke::AttrDomain::Point);
   }
 
-  parallel_nodes_loop_with_mirror_check(mesh, nodes, [&](const IndexRange range) {
-    SculptBrushTest test = test_init;
-    for (const int i : range) {
-      for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
-        if (!hide_vert.is_empty() && hide_vert[vert]) {
-          continue;
-        }
-        if (!select_vert.is_empty() && !select_vert[vert]) {
-          continue;
-        }
-        if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
-          continue;
-        }
-        float brush_strength = cache->bstrength;
-        const float angle_cos = use_normal ?
-                                    dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
-                                    1.0f;
-        if (!vwpaint::test_brush_angle_falloff(
-                brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
-        {
-          continue;
-        }
-        const float brush_fade = BKE_brush_curve_strength(&brush, sqrtf(test.dist), cache->radius);
-        const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
-
-        if ((brush.flag & BRUSH_ACCUMULATE) == 0) {
-          if (ss.mode.wpaint.alpha_weight[vert] < final_alpha) {
-            ss.mode.wpaint.alpha_weight[vert] = final_alpha;
+  parallel_nodes_loop_with_mirror_check(
+      vp,
+      ob,
+      wpi,
+      mesh,
+      nodes,
+      [&](const int i, const FunctionRef<void(WeightPaintSample)> apply) {
+        SculptBrushTest test = test_init;
+        for (const int vert : bke::pbvh::node_unique_verts(*nodes[i])) {
+          if (!hide_vert.is_empty() && hide_vert[vert]) {
+            continue;
           }
-          else {
+          if (!select_vert.is_empty() && !select_vert[vert]) {
             continue;
           }
-        }
+          if (!sculpt_brush_test_sq_fn(test, vert_positions[vert])) {
+            continue;
+          }
+          float brush_strength = cache->bstrength;
+          const float angle_cos = use_normal ?
+                                      dot_v3v3(sculpt_normal_frontface, vert_normals[vert]) :
+                                      1.0f;
+          if (!vwpaint::test_brush_angle_falloff(
+                  brush, wpd.normal_angle_precalc, angle_cos, &brush_strength))
+          {
+            continue;
+          }
+          const float brush_fade = BKE_brush_curve_strength(
+              &brush, sqrtf(test.dist), cache->radius);
+          const float final_alpha = brush_fade * brush_strength * brush_alpha_pressure;
 
-        do_weight_paint_vertex(vp, ob, wpi, vert, final_alpha, paintweight);
-      }
-    }
-  });
+          if ((brush.flag & BRUSH_ACCUMULATE) == 0) {
+            if (ss.mode.wpaint.alpha_weight[vert] < final_alpha) {
+              ss.mode.wpaint.alpha_weight[vert] = final_alpha;
+            }
+            else {
+              continue;
+            }
+          }
+
+          apply({vert, final_alpha, paintweight});
+        }
+      });
 }
 
 static float calculate_average_weight(Object &ob,
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
 #include <queue>
 
@@ -225,6 +226,13 @@ struct Node {
   Vector<int> face_indices;
 
   size_t undo_size;
+
+  /**
+   * Held by the allocating thread while the node's data is copied, so that #push_node can
+   * release the global node-list lock before the (comparatively expensive) snapshot copy.
+   * Threads that find an existing node must wait on this lock before using its arrays.
+   */
+  std::mutex mutex;
 };
 
 }
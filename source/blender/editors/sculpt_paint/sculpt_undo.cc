@@ -1575,15 +1575,22 @@ Node *push_node(const Object &object, const PBVHNode *node, Type type)
     }
     if ((unode = get_node(node, type))) {
       BLI_thread_unlock(LOCK_CUSTOM1);
+      /* The node may have been allocated by another thread that is still copying its data.
+       * Wait for that copy to finish before handing the node to the caller. */
+      unode->mutex.lock();
+      unode->mutex.unlock();
       // return unode;
       return;
     }
 
     unode = alloc_node(object, node, type);
 
-    /* NOTE: If this ever becomes a bottleneck, make a lock inside of the node.
-     * so we release global lock sooner, but keep data locked for until it is
-     * fully initialized. */
+    /* Keep the node's own lock for the duration of the data copy, but release the global list
+     * lock already: the copies are the expensive part of an undo push and only touch this node's
+     * arrays, so multiple threads can snapshot different nodes concurrently. */
+    std::lock_guard lock(unode->mutex);
+    BLI_thread_unlock(LOCK_CUSTOM1);
+
     switch (type) {
       case Type::Position:
         store_coords(object, unode);
@@ -1610,8 +1617,6 @@ Node *push_node(const Object &object, const PBVHNode *node, Type type)
         store_face_sets(*static_cast<const Mesh *>(object.data), *unode);
         break;
     }
-
-    BLI_thread_unlock(LOCK_CUSTOM1);
   });
 
   /* Store sculpt pivot. */
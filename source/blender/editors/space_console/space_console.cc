@@ -371,6 +371,7 @@ void ED_spacetype_console()
   art->cursor = console_cursor;
   art->event_cursor = true;
   art->listener = console_main_region_listener;
+  art->listener_category_mask = NOTE_CATEGORY_MASK(NC_SPACE);
 
   BLI_addhead(&st->regiontypes, art);
 
@@ -276,6 +276,7 @@ void ED_spacetype_info()
   art->init = info_main_region_init;
   art->draw = info_main_region_draw;
   art->listener = info_main_region_listener;
+  art->listener_category_mask = NOTE_CATEGORY_MASK(NC_SPACE);
 
   BLI_addhead(&st->regiontypes, art);
 
@@ -286,6 +287,9 @@ void ED_spacetype_info()
 
   art->keymapflag = ED_KEYMAP_UI | ED_KEYMAP_VIEW2D | ED_KEYMAP_FRAMES | ED_KEYMAP_HEADER;
   art->listener = info_header_listener;
+  art->listener_category_mask = NOTE_CATEGORY_MASK(NC_SCREEN) | NOTE_CATEGORY_MASK(NC_WM) |
+                                NOTE_CATEGORY_MASK(NC_SCENE) | NOTE_CATEGORY_MASK(NC_SPACE) |
+                                NOTE_CATEGORY_MASK(NC_ID);
   art->message_subscribe = info_header_region_message_subscribe;
   art->init = info_header_region_init;
   art->draw = info_header_region_draw;
@@ -1137,7 +1137,7 @@ static int collection_isolate_exec(bContext *C, wmOperator *op)
   }
   BLI_gset_free(data.collections_to_edit, nullptr);
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, nullptr);
@@ -1221,7 +1221,7 @@ static int collection_visibility_exec(bContext *C, wmOperator *op)
   }
   BLI_gset_free(data.collections_to_edit, nullptr);
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, nullptr);
@@ -1411,7 +1411,7 @@ static int collection_flag_exec(bContext *C, wmOperator *op)
     BLI_gset_free(data.collections_to_edit, nullptr);
   }
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   if (!is_render) {
@@ -1562,7 +1562,7 @@ static int outliner_hide_exec(bContext *C, wmOperator * /*op*/)
   }
   BLI_gset_free(data.bases_to_edit, nullptr);
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, nullptr);
@@ -1601,7 +1601,7 @@ static int outliner_unhide_all_exec(bContext *C, wmOperator * /*op*/)
     base->flag &= ~BASE_HIDDEN;
   }
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, nullptr);
@@ -186,6 +186,14 @@ bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *s
   return exclude_flags & (SO_FILTER_OB_STATE_SELECTED | SO_FILTER_OB_STATE_ACTIVE);
 }
 
+bool outliner_requires_rebuild_on_visibility_change(const SpaceOutliner *space_outliner)
+{
+  int exclude_flags = outliner_exclude_filter_get(space_outliner);
+  /* Visibility changes are drawn from the current base/object flags, the tree structure only
+   * changes when elements are filtered based on their visibility/selectability state. */
+  return exclude_flags & (SO_FILTER_OB_STATE_VISIBLE | SO_FILTER_OB_STATE_SELECTABLE);
+}
+
 #ifdef WITH_FREESTYLE
 static void outliner_add_line_styles(SpaceOutliner *space_outliner,
                                      ListBase *lb,
@@ -127,6 +127,15 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
           break;
         case ND_OB_VISIBLE:
         case ND_OB_RENDER:
+          /* Rebuilding a large tree on every hide/unhide is expensive, only filters based on the
+           * visibility state actually change the tree. */
+          if (outliner_requires_rebuild_on_visibility_change(space_outliner)) {
+            ED_region_tag_redraw(region);
+          }
+          else {
+            ED_region_tag_redraw_no_rebuild(region);
+          }
+          break;
         case ND_MODE:
         case ND_KEYINGSET:
         case ND_RENDER_OPTIONS:
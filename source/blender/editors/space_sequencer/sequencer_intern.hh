@@ -23,6 +23,8 @@ class SeqQuadsBatch;
 struct ARegion;
 struct ARegionType;
 struct Depsgraph;
+struct GPUTexture;
+struct ImBuf;
 struct wmGizmoGroupType;
 struct wmGizmoType;
 struct Main;
@@ -45,6 +47,30 @@ struct ListBase;
 
 namespace blender::ed::seq {
 
+/* Cache of GPU textures of recently displayed preview frames, so that showing a frame which is
+ * still in the sequencer cache again skips the host-to-device pixel upload. Entries are keyed by
+ * the #ImBuf, on which they keep a reference so that the pointer uniquely identifies the pixels
+ * (same assumption as #SeqScopes::reference_ibuf). Least recently used entries are evicted once
+ * the combined size of the textures and the pinned image buffers exceeds a fixed budget. */
+struct SeqPreviewTextureCache {
+  struct Entry {
+    ImBuf *ibuf;
+    GPUTexture *texture;
+    size_t size;
+    uint64_t last_used;
+  };
+
+  blender::Vector<Entry> entries;
+  uint64_t access_counter = 0;
+  size_t size_total = 0;
+
+  /** Returns the texture of a previously displayed `ibuf`, or null. */
+  GPUTexture *lookup(const ImBuf *ibuf);
+  /** Takes ownership of `texture` and adds a reference to `ibuf`. */
+  void insert(ImBuf *ibuf, GPUTexture *texture);
+  void free_all();
+};
+
 struct SpaceSeq_Runtime : public NonCopyable {
   /** Required for Thumbnail job start condition. */
   rctf last_thumbnail_area = {0, 0, 0, 0};
@@ -54,6 +80,7 @@ struct SpaceSeq_Runtime : public NonCopyable {
   float timeline_clamp_custom_range = 0;
 
   blender::ed::seq::SeqScopes scopes;
+  blender::ed::seq::SeqPreviewTextureCache preview_textures;
 
   SpaceSeq_Runtime() = default;
   ~SpaceSeq_Runtime();
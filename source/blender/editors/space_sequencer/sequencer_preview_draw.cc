@@ -422,6 +422,76 @@ static void sequencer_preview_get_rect(rctf *preview,
   }
 }
 
+/* Combined budget for cached preview textures and the image buffers they pin in memory. */
+constexpr size_t PREVIEW_TEXTURE_CACHE_LIMIT = size_t(256) * 1024 * 1024;
+
+static size_t preview_texture_size_get(GPUTexture *texture)
+{
+  size_t bytes_per_pixel;
+  switch (GPU_texture_format(texture)) {
+    case GPU_RGBA16F:
+      bytes_per_pixel = 8;
+      break;
+    case GPU_RGB16F:
+      bytes_per_pixel = 6;
+      break;
+    default:
+      bytes_per_pixel = 4;
+      break;
+  }
+
+  return size_t(GPU_texture_width(texture)) * GPU_texture_height(texture) * bytes_per_pixel;
+}
+
+namespace blender::ed::seq {
+
+GPUTexture *SeqPreviewTextureCache::lookup(const ImBuf *ibuf)
+{
+  for (Entry &entry : entries) {
+    if (entry.ibuf == ibuf) {
+      entry.last_used = ++access_counter;
+      return entry.texture;
+    }
+  }
+
+  return nullptr;
+}
+
+void SeqPreviewTextureCache::insert(ImBuf *ibuf, GPUTexture *texture)
+{
+  const size_t size = preview_texture_size_get(texture) + IMB_get_size_in_memory(ibuf);
+
+  while (size_total + size > PREVIEW_TEXTURE_CACHE_LIMIT && !entries.is_empty()) {
+    int64_t lru_index = 0;
+    for (const int64_t i : entries.index_range()) {
+      if (entries[i].last_used < entries[lru_index].last_used) {
+        lru_index = i;
+      }
+    }
+    Entry &lru_entry = entries[lru_index];
+    size_total -= lru_entry.size;
+    GPU_texture_free(lru_entry.texture);
+    IMB_freeImBuf(lru_entry.ibuf);
+    entries.remove_and_reorder(lru_index);
+  }
+
+  IMB_refImBuf(ibuf);
+  entries.append({ibuf, texture, size, ++access_counter});
+  size_total += size;
+}
+
+void SeqPreviewTextureCache::free_all()
+{
+  for (Entry &entry : entries) {
+    GPU_texture_free(entry.texture);
+    IMB_freeImBuf(entry.ibuf);
+  }
+  entries.clear();
+  size_total = 0;
+}
+
+}  // namespace blender::ed::seq
+
 static void sequencer_draw_display_buffer(const bContext *C,
                                           Scene *scene,
                                           ARegion *region,
@@ -455,11 +525,26 @@ static void sequencer_draw_display_buffer(const bContext *C,
     GPU_matrix_push_projection();
     GPU_matrix_identity_projection_set();
   }
-  eGPUTextureUsage usage = GPU_TEXTURE_USAGE_SHADER_READ | GPU_TEXTURE_USAGE_ATTACHMENT;
-  GPUTexture *texture = GPU_texture_create_2d(
-      "seq_display_buf", ibuf->x, ibuf->y, 1, format, usage, nullptr);
-  GPU_texture_update(texture, data, display_buffer);
-  GPU_texture_filter_mode(texture, false);
+
+  /* Textures are only reused when the color transform runs on the GPU: then their content is a
+   * pure function of the image buffer, while with the CPU fallback it depends on the current
+   * display settings. */
+  blender::ed::seq::SeqPreviewTextureCache &texture_cache = sseq->runtime->preview_textures;
+  GPUTexture *texture = glsl_used ? texture_cache.lookup(ibuf) : nullptr;
+  bool texture_owned_by_cache = (texture != nullptr);
+
+  if (texture == nullptr) {
+    eGPUTextureUsage usage = GPU_TEXTURE_USAGE_SHADER_READ | GPU_TEXTURE_USAGE_ATTACHMENT;
+    texture = GPU_texture_create_2d(
+        "seq_display_buf", ibuf->x, ibuf->y, 1, format, usage, nullptr);
+    GPU_texture_update(texture, data, display_buffer);
+    GPU_texture_filter_mode(texture, false);
+
+    if (glsl_used) {
+      texture_cache.insert(ibuf, texture);
+      texture_owned_by_cache = true;
+    }
+  }
 
   GPU_texture_bind(texture, 0);
 
@@ -496,7 +581,9 @@ static void sequencer_draw_display_buffer(const bContext *C,
   immEnd();
 
   GPU_texture_unbind(texture);
-  GPU_texture_free(texture);
+  if (!texture_owned_by_cache) {
+    GPU_texture_free(texture);
+  }
 
   if (!glsl_used) {
     immUnbindProgram();
@@ -8,6 +8,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_task.h"
 
 #include "BKE_context.hh"
 #include "BKE_global.hh"
@@ -134,47 +135,98 @@ static void seq_get_thumb_image_dimensions(Sequence *seq,
   }
 }
 
-static void thumbnail_start_job(void *data, wmJobWorkerStatus *worker_status)
+struct ThumbnailRenderTask {
+  ThumbnailDrawJob *tj;
+  Sequence *seq_orig;
+  ThumbDataItem *val;
+  wmJobWorkerStatus *worker_status;
+  /* Render the "guaranteed" base set instead of the visible set. */
+  bool base_set;
+};
+
+static void thumbnail_render_strip_task(TaskPool *__restrict task_pool, void *task_data)
 {
-  ThumbnailDrawJob *tj = static_cast<ThumbnailDrawJob *>(data);
+  ThumbnailRenderTask *task = static_cast<ThumbnailRenderTask *>(task_data);
+  ThumbnailDrawJob *tj = task->tj;
   const Scene *scene = tj->scene;
+
+  if (BLI_task_pool_current_canceled(task_pool) || task->worker_status->stop) {
+    return;
+  }
+
+  if (!check_seq_need_thumbnails(scene, task->seq_orig, tj->view_area)) {
+    return;
+  }
+
   float frame_step;
+  seq_get_thumb_image_dimensions(task->val->seq_dupli,
+                                 tj->pixelx,
+                                 tj->pixely,
+                                 &frame_step,
+                                 tj->thumb_height,
+                                 nullptr,
+                                 nullptr);
+  if (task->base_set) {
+    SEQ_render_thumbnails_base_set(&tj->context,
+                                   task->val->seq_dupli,
+                                   task->seq_orig,
+                                   tj->view_area,
+                                   &task->worker_status->stop);
+  }
+  else {
+    SEQ_render_thumbnails(&tj->context,
+                          task->val->seq_dupli,
+                          task->seq_orig,
+                          frame_step,
+                          tj->view_area,
+                          &task->worker_status->stop);
+  }
+  SEQ_relations_sequence_free_anim(task->val->seq_dupli);
+}
 
+static void thumbnail_push_render_tasks(TaskPool *task_pool,
+                                        ThumbnailDrawJob *tj,
+                                        wmJobWorkerStatus *worker_status,
+                                        const bool base_set)
+{
   GHashIterator gh_iter;
 
-  /* First pass: render visible images. */
   BLI_ghashIterator_init(&gh_iter, tj->sequences_ghash);
-  while (!BLI_ghashIterator_done(&gh_iter) && !worker_status->stop) {
+  while (!BLI_ghashIterator_done(&gh_iter)) {
     Sequence *seq_orig = static_cast<Sequence *>(BLI_ghashIterator_getKey(&gh_iter));
     ThumbDataItem *val = static_cast<ThumbDataItem *>(
         BLI_ghash_lookup(tj->sequences_ghash, seq_orig));
 
-    if (check_seq_need_thumbnails(scene, seq_orig, tj->view_area)) {
-      seq_get_thumb_image_dimensions(
-          val->seq_dupli, tj->pixelx, tj->pixely, &frame_step, tj->thumb_height, nullptr, nullptr);
-      SEQ_render_thumbnails(
-          &tj->context, val->seq_dupli, seq_orig, frame_step, tj->view_area, &worker_status->stop);
-      SEQ_relations_sequence_free_anim(val->seq_dupli);
-    }
+    ThumbnailRenderTask *task = MEM_cnew<ThumbnailRenderTask>("Thumbnail render task");
+    task->tj = tj;
+    task->seq_orig = seq_orig;
+    task->val = val;
+    task->worker_status = worker_status;
+    task->base_set = base_set;
+    BLI_task_pool_push(task_pool, thumbnail_render_strip_task, task, true, nullptr);
+
     BLI_ghashIterator_step(&gh_iter);
   }
+}
+
+static void thumbnail_start_job(void *data, wmJobWorkerStatus *worker_status)
+{
+  ThumbnailDrawJob *tj = static_cast<ThumbnailDrawJob *>(data);
+
+  /* Each strip duplicate owns its decoder, so strips can render in parallel.
+   * Within a strip #SEQ_render_thumbnails requests frames in source order,
+   * so a single decoder pass yields all thumbnails for that strip. */
+  TaskPool *task_pool = BLI_task_pool_create(nullptr, TASK_PRIORITY_LOW);
+
+  /* First pass: render visible images. */
+  thumbnail_push_render_tasks(task_pool, tj, worker_status, false);
+  BLI_task_pool_work_and_wait(task_pool);
 
   /* Second pass: render "guaranteed" set of images. */
-  BLI_ghashIterator_init(&gh_iter, tj->sequences_ghash);
-  while (!BLI_ghashIterator_done(&gh_iter) && !worker_status->stop) {
-    Sequence *seq_orig = static_cast<Sequence *>(BLI_ghashIterator_getKey(&gh_iter));
-    ThumbDataItem *val = static_cast<ThumbDataItem *>(
-        BLI_ghash_lookup(tj->sequences_ghash, seq_orig));
+  thumbnail_push_render_tasks(task_pool, tj, worker_status, true);
+  BLI_task_pool_work_and_wait(task_pool);
 
-    if (check_seq_need_thumbnails(scene, seq_orig, tj->view_area)) {
-      seq_get_thumb_image_dimensions(
-          val->seq_dupli, tj->pixelx, tj->pixely, &frame_step, tj->thumb_height, nullptr, nullptr);
-      SEQ_render_thumbnails_base_set(
-          &tj->context, val->seq_dupli, seq_orig, tj->view_area, &worker_status->stop);
-      SEQ_relations_sequence_free_anim(val->seq_dupli);
-    }
-    BLI_ghashIterator_step(&gh_iter);
-  }
+  BLI_task_pool_free(task_pool);
 }
 
 static SeqRenderData sequencer_thumbnail_context_init(const bContext *C)
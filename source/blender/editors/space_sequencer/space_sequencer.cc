@@ -69,6 +69,8 @@ blender::ed::seq::SpaceSeq_Runtime::~SpaceSeq_Runtime()
     BLI_ghash_free(last_displayed_thumbnails, nullptr, last_displayed_thumbnails_list_free);
     last_displayed_thumbnails = nullptr;
   }
+
+  preview_textures.free_all();
 }
 
 /* ******************** manage regions ********************* */
@@ -153,6 +153,9 @@ void ED_spacetype_statusbar()
   art->layout = ED_region_header_layout;
   art->draw = ED_region_header_draw;
   art->listener = statusbar_header_region_listener;
+  art->listener_category_mask = NOTE_CATEGORY_MASK(NC_SCREEN) | NOTE_CATEGORY_MASK(NC_WM) |
+                                NOTE_CATEGORY_MASK(NC_SCENE) | NOTE_CATEGORY_MASK(NC_SPACE) |
+                                NOTE_CATEGORY_MASK(NC_ID);
   art->message_subscribe = statusbar_header_region_message_subscribe;
   BLI_addhead(&st->regiontypes, art);
 
@@ -654,22 +654,36 @@ static void space_text_update_drawcache(SpaceText *st, const ARegion *region)
     if (drawcache->update) {
       TextLine *line = static_cast<TextLine *>(st->text->lines.first);
       int lineno = 0, size, lines_count;
-      int *fp = drawcache->line_height, *new_tail, *old_tail;
+      int *fp = drawcache->line_height, *new_tail;
 
       nlines = BLI_listbase_count(&txt->lines);
       size = sizeof(int) * nlines;
 
       if (fp) {
-        fp = static_cast<int *>(MEM_reallocN(fp, size));
+        /* Keep the heights of the still valid head and tail lines from before the edit, so only
+         * the changed lines in between have to be recalculated. Move the tail entries into their
+         * new position before shrinking the array (and after growing it), so the copy always
+         * stays within bounds. */
+        const int valid_tail = drawcache->valid_tail;
+        if (nlines <= drawcache->nlines) {
+          memmove(fp + nlines - valid_tail,
+                  fp + drawcache->nlines - valid_tail,
+                  sizeof(int) * valid_tail);
+          fp = static_cast<int *>(MEM_reallocN(fp, size));
+        }
+        else {
+          fp = static_cast<int *>(MEM_reallocN(fp, size));
+          memmove(fp + nlines - valid_tail,
+                  fp + drawcache->nlines - valid_tail,
+                  sizeof(int) * valid_tail);
+        }
       }
       else {
         fp = static_cast<int *>(MEM_callocN(size, "text drawcache line_height"));
+        drawcache->valid_tail = drawcache->valid_head = 0;
       }
 
-      drawcache->valid_tail = drawcache->valid_head = 0;
-      old_tail = fp + drawcache->nlines - drawcache->valid_tail;
       new_tail = fp + nlines - drawcache->valid_tail;
-      memmove(new_tail, old_tail, drawcache->valid_tail);
 
       drawcache->total_lines = 0;
 
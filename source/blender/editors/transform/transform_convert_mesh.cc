@@ -1062,7 +1062,7 @@ void transform_convert_mesh_connectivity_distance(BMesh *bm,
 
       dists[i] = dist;
     }
-    bm->elem_index_dirty &= ~BM_VERT;
+    BM_mesh_elem_index_dirty_clear(bm, BM_VERT);
   }
 
   {
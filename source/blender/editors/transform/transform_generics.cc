@@ -16,6 +16,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 
 #include "BLT_translation.hh"
@@ -1272,78 +1273,97 @@ void tranformViewUpdate(TransInfo *t)
 
 void calculatePropRatio(TransInfo *t)
 {
-  int i;
-  float dist;
   const bool connected = (t->flag & T_PROP_CONNECTED) != 0;
 
   t->proptext[0] = '\0';
 
   if (t->flag & T_PROP_EDIT) {
     const char *pet_id = nullptr;
-    FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-      TransData *td = tc->data;
-      for (i = 0; i < tc->data_len; i++, td++) {
-        if (td->flag & TD_SELECTED) {
-          td->factor = 1.0f;
-        }
-        else if ((connected ? td->dist : td->rdist) > t->prop_size) {
-          td->factor = 0.0f;
-          restoreElement(td);
-        }
-        else {
-          /* Use `rdist` for falloff calculations, it is the real distance. */
-          if (connected) {
-            dist = (t->prop_size - td->dist) / t->prop_size;
-          }
-          else {
-            dist = (t->prop_size - td->rdist) / t->prop_size;
-          }
 
-          /*
-           * Clamp to positive numbers.
-           * Certain corner cases with connectivity and individual centers
-           * can give values of rdist larger than propsize.
-           */
-          if (dist < 0.0f) {
-            dist = 0.0f;
-          }
+    if (t->prop_mode == PROP_RANDOM && t->rng == nullptr) {
+      /* Lazy initialization. */
+      uint rng_seed = uint(BLI_time_now_seconds_i() & UINT_MAX);
+      t->rng = BLI_rng_new(rng_seed);
+    }
 
-          switch (t->prop_mode) {
-            case PROP_SHARP:
-              td->factor = dist * dist;
-              break;
-            case PROP_SMOOTH:
-              td->factor = 3.0f * dist * dist - 2.0f * dist * dist * dist;
-              break;
-            case PROP_ROOT:
-              td->factor = sqrtf(dist);
-              break;
-            case PROP_LIN:
-              td->factor = dist;
-              break;
-            case PROP_CONST:
-              td->factor = 1.0f;
-              break;
-            case PROP_SPHERE:
-              td->factor = sqrtf(2 * dist - dist * dist);
-              break;
-            case PROP_RANDOM:
-              if (t->rng == nullptr) {
-                /* Lazy initialization. */
-                uint rng_seed = uint(BLI_time_now_seconds_i() & UINT_MAX);
-                t->rng = BLI_rng_new(rng_seed);
-              }
-              td->factor = BLI_rng_get_float(t->rng) * dist;
-              break;
-            case PROP_INVSQUARE:
-              td->factor = dist * (2.0f - dist);
-              break;
-            default:
-              td->factor = 1;
-              break;
-          }
+    const auto calculate_factor = [&](TransData *td) {
+      if (td->flag & TD_SELECTED) {
+        td->factor = 1.0f;
+        return;
+      }
+      if ((connected ? td->dist : td->rdist) > t->prop_size) {
+        td->factor = 0.0f;
+        restoreElement(td);
+        return;
+      }
+
+      /* Use `rdist` for falloff calculations, it is the real distance. */
+      float dist;
+      if (connected) {
+        dist = (t->prop_size - td->dist) / t->prop_size;
+      }
+      else {
+        dist = (t->prop_size - td->rdist) / t->prop_size;
+      }
+
+      /*
+       * Clamp to positive numbers.
+       * Certain corner cases with connectivity and individual centers
+       * can give values of rdist larger than propsize.
+       */
+      if (dist < 0.0f) {
+        dist = 0.0f;
+      }
+
+      switch (t->prop_mode) {
+        case PROP_SHARP:
+          td->factor = dist * dist;
+          break;
+        case PROP_SMOOTH:
+          td->factor = 3.0f * dist * dist - 2.0f * dist * dist * dist;
+          break;
+        case PROP_ROOT:
+          td->factor = sqrtf(dist);
+          break;
+        case PROP_LIN:
+          td->factor = dist;
+          break;
+        case PROP_CONST:
+          td->factor = 1.0f;
+          break;
+        case PROP_SPHERE:
+          td->factor = sqrtf(2 * dist - dist * dist);
+          break;
+        case PROP_RANDOM:
+          td->factor = BLI_rng_get_float(t->rng) * dist;
+          break;
+        case PROP_INVSQUARE:
+          td->factor = dist * (2.0f - dist);
+          break;
+        default:
+          td->factor = 1;
+          break;
+      }
+    };
+
+    FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+      if (t->prop_mode == PROP_RANDOM) {
+        /* The random falloff draws from the shared RNG, keep the iteration order stable by
+         * evaluating it on a single thread. */
+        TransData *td = tc->data;
+        for (int i = 0; i < tc->data_len; i++, td++) {
+          calculate_factor(td);
         }
       }
+      else {
+        /* Every element only reads shared transform state and writes its own factor (or restores
+         * its own original values), so the falloff can be evaluated in parallel. */
+        threading::parallel_for(IndexRange(tc->data_len), 1024, [&](const IndexRange range) {
+          for (const int i : range) {
+            calculate_factor(&tc->data[i]);
+          }
+        });
+      }
     }
 
     switch (t->prop_mode) {
@@ -1382,7 +1402,7 @@ void calculatePropRatio(TransInfo *t)
   else {
     FOREACH_TRANS_DATA_CONTAINER (t, tc) {
       TransData *td = tc->data;
-      for (i = 0; i < tc->data_len; i++, td++) {
+      for (int i = 0; i < tc->data_len; i++, td++) {
         td->factor = 1.0;
       }
     }
@@ -47,6 +47,7 @@
 #include "transform_convert.hh"
 #include "transform_mode.hh"
 #include "transform_snap.hh"
+#include "transform_snap_object.hh"
 
 using namespace blender;
 
@@ -757,6 +758,58 @@ static eSnapTargetOP snap_target_select_from_spacetype(TransInfo *t)
   return ret;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Session Snap Object Context
+ *
+ * Keep the snap object context of the last transform alive, so its snap caches (most importantly
+ * the BVH trees built for edit-meshes) can be reused by the next transform instead of being
+ * rebuilt on the first snap movement of every operation. Each cache entry is validated against
+ * the evaluated meshes once per acquired context (and on every lookup outside of transform), so
+ * reuse stays correct across depsgraph updates; the context is dropped on scene change and freed
+ * through #ED_editors_exit.
+ * \{ */
+
+static SnapObjectContext *g_session_snap_context = nullptr;
+
+static SnapObjectContext *snap_object_context_acquire(Scene *scene)
+{
+  SnapObjectContext *sctx = g_session_snap_context;
+  g_session_snap_context = nullptr;
+
+  if (sctx && sctx->scene != scene) {
+    ED_transform_snap_object_context_destroy(sctx);
+    sctx = nullptr;
+  }
+  if (sctx == nullptr) {
+    sctx = ED_transform_snap_object_context_create(scene, 0);
+  }
+  else {
+    /* Snap target meshes may have been edited since the previous operation, and #G.moving
+     * suppresses the per-lookup cache checks during the transform itself. Tag the reuse so every
+     * cache entry is validated once before it is trusted again. */
+    sctx->session_generation++;
+  }
+  return sctx;
+}
+
+static void snap_object_context_release(SnapObjectContext *sctx)
+{
+  if (g_session_snap_context) {
+    ED_transform_snap_object_context_destroy(g_session_snap_context);
+  }
+  g_session_snap_context = sctx;
+}
+
+void ED_transform_snap_object_context_session_free()
+{
+  if (g_session_snap_context) {
+    ED_transform_snap_object_context_destroy(g_session_snap_context);
+    g_session_snap_context = nullptr;
+  }
+}
+
+/** \} */
+
 static void snap_object_context_init(TransInfo *t)
 {
   if (t->data_type == &TransConvertType_Mesh) {
@@ -804,7 +857,7 @@ static void initSnappingMode(TransInfo *t)
   if (t->spacetype == SPACE_VIEW3D) {
     if (t->tsnap.object_context == nullptr) {
       SET_FLAG_FROM_TEST(t->tsnap.flag, snap_use_backface_culling(t), SCE_SNAP_BACKFACE_CULLING);
-      t->tsnap.object_context = ED_transform_snap_object_context_create(t->scene, 0);
+      t->tsnap.object_context = snap_object_context_acquire(t->scene);
       snap_object_context_init(t);
     }
   }
@@ -943,7 +996,7 @@ void freeSnapping(TransInfo *t)
     t->tsnap.seq_context = nullptr;
   }
   else if (t->tsnap.object_context) {
-    ED_transform_snap_object_context_destroy(t->tsnap.object_context);
+    snap_object_context_release(t->tsnap.object_context);
     t->tsnap.object_context = nullptr;
 
     ED_transform_snap_object_time_average_print();
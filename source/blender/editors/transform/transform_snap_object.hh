@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "BLI_kdopbvh.h"
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
 
@@ -25,6 +26,11 @@ struct SnapObjectContext {
   };
   blender::Map<const ID *, std::unique_ptr<SnapCache>> editmesh_caches;
 
+  /* Incremented when the context is kept alive and reused by a later operation (see
+   * #snap_object_context_acquire), so cache entries can be validated once per operation even
+   * while #G.moving suppresses the per-lookup checks. */
+  int session_generation = 0;
+
   /* Filter data, returns true to check this value. */
   struct {
     struct {
@@ -48,6 +48,9 @@ struct SnapCache_EditMesh : public SnapObjectContext::SnapCache {
   bke::MeshRuntime *runtime_ref;
   bke::EditMeshData *edit_data_ref;
 
+  /* The #SnapObjectContext::session_generation this entry was last validated for. */
+  int session_generation = 0;
+
   bool has_mesh_updated(const Mesh *mesh)
   {
     if (mesh != this->mesh_ref || mesh->runtime != this->runtime_ref ||
@@ -165,15 +168,24 @@ static SnapCache_EditMesh *snap_object_data_editmesh_get(SnapObjectContext *sctx
   {
     em_cache = static_cast<SnapCache_EditMesh *>(em_cache_p->get());
 
+    if (mesh_ref == nullptr && em_cache->session_generation != sctx->session_generation) {
+      /* The context was kept alive from a previous operation, so this entry may predate mesh
+       * edits that happened in between. Validate it once per acquired context, even though
+       * #G.moving suppresses the check above for the rest of the transform. */
+      mesh_ref = get_mesh_ref(ob_eval);
+    }
+
     /* Check if the geometry has changed. */
     if (mesh_ref && em_cache->has_mesh_updated(mesh_ref)) {
       em_cache->clear();
       init = true;
     }
+    em_cache->session_generation = sctx->session_generation;
   }
   else if (create) {
     std::unique_ptr<SnapCache_EditMesh> em_cache_ptr = std::make_unique<SnapCache_EditMesh>();
     em_cache = em_cache_ptr.get();
+    em_cache->session_generation = sctx->session_generation;
     sctx->editmesh_caches.add_new(ob_eval->runtime->data_orig, std::move(em_cache_ptr));
     init = true;
   }
@@ -46,6 +46,7 @@
 #include "ED_screen.hh"
 #include "ED_sculpt.hh"
 #include "ED_space_api.hh"
+#include "ED_transform_snap_object_context.hh"
 #include "ED_util.hh"
 
 #include "GPU_immediate.hh"
@@ -253,6 +254,9 @@ void ED_editors_exit(Main *bmain, bool do_undo_system)
   /* global in meshtools... */
   ED_mesh_mirror_spatial_table_end(nullptr);
   ED_mesh_mirror_topo_table_end(nullptr);
+
+  /* Global in `transform_snap.cc`. */
+  ED_transform_snap_object_context_session_free();
 }
 
 bool ED_editors_flush_edits_for_object_ex(Main *bmain,
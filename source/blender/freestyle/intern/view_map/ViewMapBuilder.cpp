@@ -8,7 +8,9 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 
@@ -27,6 +29,7 @@
 #include "../winged_edge/WFillGrid.h"
 
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 
 #include "BKE_global.hh"
 
@@ -435,200 +438,220 @@ static void computeCumulativeVisibility(ViewMap *ioViewMap,
 {
   vector<ViewEdge *> &vedges = ioViewMap->ViewEdges();
 
-  FEdge *fe, *festart;
-  int nSamples = 0;
-  vector<WFace *> wFaces;
-  WFace *wFace = nullptr;
-  uint count = 0;
+  /* Upper bound on the number of processed view edges, only used for progress reports. */
+  std::atomic<uint> count = 0;
   uint count_step = uint(ceil(0.01f * vedges.size()));
-  uint tmpQI = 0;
-  uint qiClasses[256];
-  uint maxIndex, maxCard;
-  uint qiMajority;
-  for (vector<ViewEdge *>::iterator ve = vedges.begin(), veend = vedges.end(); ve != veend; ve++) {
-    if (iRenderMonitor) {
-      if (iRenderMonitor->testBreak()) {
-        break;
-      }
-      if (count % count_step == 0) {
-        stringstream ss;
-        ss << "Freestyle: Visibility computations " << (100 * count / vedges.size()) << "%";
-        iRenderMonitor->setInfo(ss.str());
-        iRenderMonitor->progress(float(count) / vedges.size());
-      }
-      count++;
-    }
+  std::atomic<bool> stop = false;
+  std::mutex monitor_mutex;
+
+  /* The ray casts for a view edge only write to that edge and its own FEdges, and the grid
+   * iterators keep all of their traversal state locally, so view edges can be processed in
+   * parallel. Only the render monitor is shared: #RenderMonitor::testBreak is safe to call from
+   * worker threads (render threads already do), status reports are serialized below. */
+  blender::threading::parallel_for(
+      blender::IndexRange(vedges.size()), 8, [&](const blender::IndexRange range) {
+        FEdge *fe, *festart;
+        int nSamples = 0;
+        vector<WFace *> wFaces;
+        WFace *wFace = nullptr;
+        uint tmpQI = 0;
+        uint qiClasses[256];
+        uint maxIndex, maxCard;
+        uint qiMajority;
+        for (const int64_t edge_index : range) {
+          if (stop) {
+            return;
+          }
+          ViewEdge *ve = vedges[edge_index];
+          if (iRenderMonitor) {
+            if (iRenderMonitor->testBreak()) {
+              stop = true;
+              return;
+            }
+            const uint processed = count.fetch_add(1);
+            if (processed % count_step == 0) {
+              std::lock_guard<std::mutex> lock(monitor_mutex);
+              stringstream ss;
+              ss << "Freestyle: Visibility computations " << (100 * processed / vedges.size())
+                 << "%";
+              iRenderMonitor->setInfo(ss.str());
+              iRenderMonitor->progress(float(processed) / vedges.size());
+            }
+          }
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "Processing ViewEdge " << (*ve)->getId() << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "Processing ViewEdge " << ve->getId() << endl;
+          }
 #endif
-    // Find an edge to test
-    if (!(*ve)->isInImage()) {
-      // This view edge has been proscenium culled
-      (*ve)->setQI(255);
-      (*ve)->setaShape(nullptr);
+          // Find an edge to test
+          if (!ve->isInImage()) {
+            // This view edge has been proscenium culled
+            ve->setQI(255);
+            ve->setaShape(nullptr);
 #if LOGGING
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "\tCulled." << endl;
-      }
+            if (_global.debug & G_DEBUG_FREESTYLE) {
+              cout << "\tCulled." << endl;
+            }
 #endif
-      continue;
-    }
-
-    // Test edge
-    festart = (*ve)->fedgeA();
-    fe = (*ve)->fedgeA();
-    qiMajority = 0;
-    do {
-      if (fe != nullptr && fe->isInImage()) {
-        qiMajority++;
-      }
-      fe = fe->nextEdge();
-    } while (fe && fe != festart);
+            continue;
+          }
 
-    if (qiMajority == 0) {
-      // There are no occludable FEdges on this ViewEdge
-      // This should be impossible.
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "View Edge in viewport without occludable FEdges: " << (*ve)->getId() << endl;
-      }
-      // We can recover from this error:
-      // Treat this edge as fully visible with no occludee
-      (*ve)->setQI(0);
-      (*ve)->setaShape(nullptr);
-      continue;
-    }
+          // Test edge
+          festart = ve->fedgeA();
+          fe = ve->fedgeA();
+          qiMajority = 0;
+          do {
+            if (fe != nullptr && fe->isInImage()) {
+              qiMajority++;
+            }
+            fe = fe->nextEdge();
+          } while (fe && fe != festart);
+
+          if (qiMajority == 0) {
+            // There are no occludable FEdges on this ViewEdge
+            // This should be impossible.
+            if (_global.debug & G_DEBUG_FREESTYLE) {
+              cout << "View Edge in viewport without occludable FEdges: " << ve->getId() << endl;
+            }
+            // We can recover from this error:
+            // Treat this edge as fully visible with no occludee
+            ve->setQI(0);
+            ve->setaShape(nullptr);
+            continue;
+          }
 
-    ++qiMajority;
-    qiMajority >>= 1;
+          ++qiMajority;
+          qiMajority >>= 1;
 
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tqiMajority: " << qiMajority << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tqiMajority: " << qiMajority << endl;
+          }
 #endif
 
-    tmpQI = 0;
-    maxIndex = 0;
-    maxCard = 0;
-    nSamples = 0;
-    memset(qiClasses, 0, 256 * sizeof(*qiClasses));
-    set<ViewShape *> foundOccluders;
-
-    fe = (*ve)->fedgeA();
-    do {
-      if (!fe || !fe->isInImage()) {
-        fe = fe->nextEdge();
-        continue;
-      }
-      if (maxCard < qiMajority) {
-        // ARB: change &wFace to wFace and use reference in called function
-        tmpQI = computeVisibility<G, I>(
-            ioViewMap, fe, grid, epsilon, *ve, &wFace, &foundOccluders);
+          tmpQI = 0;
+          maxIndex = 0;
+          maxCard = 0;
+          nSamples = 0;
+          memset(qiClasses, 0, 256 * sizeof(*qiClasses));
+          set<ViewShape *> foundOccluders;
+
+          fe = ve->fedgeA();
+          do {
+            if (!fe || !fe->isInImage()) {
+              fe = fe->nextEdge();
+              continue;
+            }
+            if (maxCard < qiMajority) {
+              // ARB: change &wFace to wFace and use reference in called function
+              tmpQI = computeVisibility<G, I>(
+                  ioViewMap, fe, grid, epsilon, ve, &wFace, &foundOccluders);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: visibility " << tmpQI << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFEdge: visibility " << tmpQI << endl;
+              }
 #endif
 
-        // ARB: This is an error condition, not an alert condition.
-        // Some sort of recovery or abort is necessary.
-        if (tmpQI >= 256) {
-          cerr << "Warning: too many occluding levels" << endl;
-          // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
-          tmpQI = 255;
-        }
+              // ARB: This is an error condition, not an alert condition.
+              // Some sort of recovery or abort is necessary.
+              if (tmpQI >= 256) {
+                cerr << "Warning: too many occluding levels" << endl;
+                // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
+                tmpQI = 255;
+              }
 
-        if (++qiClasses[tmpQI] > maxCard) {
-          maxCard = qiClasses[tmpQI];
-          maxIndex = tmpQI;
-        }
-      }
-      else {
-        // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
-        // ARB: change &wFace to wFace and use reference in called function
-        findOccludee<G, I>(fe, grid, epsilon, *ve, &wFace);
+              if (++qiClasses[tmpQI] > maxCard) {
+                maxCard = qiClasses[tmpQI];
+                maxIndex = tmpQI;
+              }
+            }
+            else {
+              // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
+              // ARB: change &wFace to wFace and use reference in called function
+              findOccludee<G, I>(fe, grid, epsilon, ve, &wFace);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found") << ")"
-               << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found")
+                     << ")" << endl;
+              }
 #endif
-      }
+            }
 
-      // Store test results
-      if (wFace) {
-        vector<Vec3r> vertices;
-        for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
-          vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
-        }
-        Polygon3r poly(vertices, wFace->GetNormal());
-        poly.userdata = (void *)wFace;
-        fe->setaFace(poly);
-        wFaces.push_back(wFace);
-        fe->setOccludeeEmpty(false);
+            // Store test results
+            if (wFace) {
+              vector<Vec3r> vertices;
+              for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
+                vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
+              }
+              Polygon3r poly(vertices, wFace->GetNormal());
+              poly.userdata = (void *)wFace;
+              fe->setaFace(poly);
+              wFaces.push_back(wFace);
+              fe->setOccludeeEmpty(false);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFound occludee" << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFound occludee" << endl;
+              }
 #endif
-      }
-      else {
-        fe->setOccludeeEmpty(true);
-      }
+            }
+            else {
+              fe->setOccludeeEmpty(true);
+            }
 
-      ++nSamples;
-      fe = fe->nextEdge();
-    } while ((maxCard < qiMajority) && (fe) && (fe != festart));
+            ++nSamples;
+            fe = fe->nextEdge();
+          } while ((maxCard < qiMajority) && (fe) && (fe != festart));
 
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
+          }
 #endif
 
-    // ViewEdge
-    // qi --
-    // Find the minimum value that is >= the majority of the QI
-    for (uint count = 0, i = 0; i < 256; ++i) {
-      count += qiClasses[i];
-      if (count >= qiMajority) {
-        (*ve)->setQI(i);
-        break;
-      }
-    }
-    // occluders --
-    // I would rather not have to go through the effort of creating this set and then copying out
-    // its contents. Is there a reason why ViewEdge::_Occluders cannot be converted to a set<>?
-    for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
-         o != oend;
-         ++o)
-    {
-      (*ve)->AddOccluder(*o);
-    }
+          // ViewEdge
+          // qi --
+          // Find the minimum value that is >= the majority of the QI
+          for (uint qi_count = 0, i = 0; i < 256; ++i) {
+            qi_count += qiClasses[i];
+            if (qi_count >= qiMajority) {
+              ve->setQI(i);
+              break;
+            }
+          }
+          // occluders --
+          // I would rather not have to go through the effort of creating this set and then copying
+          // out its contents. Is there a reason why ViewEdge::_Occluders cannot be converted to a
+          // set<>?
+          for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
+               o != oend;
+               ++o)
+          {
+            ve->AddOccluder(*o);
+          }
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tConclusion: QI = " << maxIndex << ", " << (*ve)->occluders_size() << " occluders."
-           << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tConclusion: QI = " << maxIndex << ", " << ve->occluders_size()
+                 << " occluders." << endl;
+          }
 #else
-    (void)maxIndex;
+          (void)maxIndex;
 #endif
-    // occludee --
-    if (!wFaces.empty()) {
-      if (wFaces.size() <= float(nSamples) / 2.0f) {
-        (*ve)->setaShape(nullptr);
-      }
-      else {
-        ViewShape *vshape = ioViewMap->viewShape(
-            (*wFaces.begin())->GetVertex(0)->shape()->GetId());
-        (*ve)->setaShape(vshape);
-      }
-    }
+          // occludee --
+          if (!wFaces.empty()) {
+            if (wFaces.size() <= float(nSamples) / 2.0f) {
+              ve->setaShape(nullptr);
+            }
+            else {
+              ViewShape *vshape = ioViewMap->viewShape(
+                  (*wFaces.begin())->GetVertex(0)->shape()->GetId());
+              ve->setaShape(vshape);
+            }
+          }
+
+          wFaces.clear();
+        }
+      });
 
-    wFaces.clear();
-  }
   if (iRenderMonitor && !vedges.empty()) {
     stringstream ss;
     ss << "Freestyle: Visibility computations " << (100 * count / vedges.size()) << "%";
@@ -645,180 +668,191 @@ static void computeDetailedVisibility(ViewMap *ioViewMap,
 {
   vector<ViewEdge *> &vedges = ioViewMap->ViewEdges();
 
-  FEdge *fe, *festart;
-  int nSamples = 0;
-  vector<WFace *> wFaces;
-  WFace *wFace = nullptr;
-  uint tmpQI = 0;
-  uint qiClasses[256];
-  uint maxIndex, maxCard;
-  uint qiMajority;
-  for (vector<ViewEdge *>::iterator ve = vedges.begin(), veend = vedges.end(); ve != veend; ve++) {
-    if (iRenderMonitor && iRenderMonitor->testBreak()) {
-      break;
-    }
+  std::atomic<bool> stop = false;
+
+  /* The ray casts for a view edge only write to that edge and its own FEdges, and the grid
+   * iterators keep all of their traversal state locally, so view edges can be processed in
+   * parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(vedges.size()), 8, [&](const blender::IndexRange range) {
+        FEdge *fe, *festart;
+        int nSamples = 0;
+        vector<WFace *> wFaces;
+        WFace *wFace = nullptr;
+        uint tmpQI = 0;
+        uint qiClasses[256];
+        uint maxIndex, maxCard;
+        uint qiMajority;
+        for (const int64_t edge_index : range) {
+          if (stop || (iRenderMonitor && iRenderMonitor->testBreak())) {
+            stop = true;
+            return;
+          }
+          ViewEdge *ve = vedges[edge_index];
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "Processing ViewEdge " << (*ve)->getId() << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "Processing ViewEdge " << ve->getId() << endl;
+          }
 #endif
-    // Find an edge to test
-    if (!(*ve)->isInImage()) {
-      // This view edge has been proscenium culled
-      (*ve)->setQI(255);
-      (*ve)->setaShape(nullptr);
+          // Find an edge to test
+          if (!ve->isInImage()) {
+            // This view edge has been proscenium culled
+            ve->setQI(255);
+            ve->setaShape(nullptr);
 #if LOGGING
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "\tCulled." << endl;
-      }
+            if (_global.debug & G_DEBUG_FREESTYLE) {
+              cout << "\tCulled." << endl;
+            }
 #endif
-      continue;
-    }
-
-    // Test edge
-    festart = (*ve)->fedgeA();
-    fe = (*ve)->fedgeA();
-    qiMajority = 0;
-    do {
-      if (fe != nullptr && fe->isInImage()) {
-        qiMajority++;
-      }
-      fe = fe->nextEdge();
-    } while (fe && fe != festart);
+            continue;
+          }
 
-    if (qiMajority == 0) {
-      // There are no occludable FEdges on this ViewEdge
-      // This should be impossible.
-      if (_global.debug & G_DEBUG_FREESTYLE) {
-        cout << "View Edge in viewport without occludable FEdges: " << (*ve)->getId() << endl;
-      }
-      // We can recover from this error:
-      // Treat this edge as fully visible with no occludee
-      (*ve)->setQI(0);
-      (*ve)->setaShape(nullptr);
-      continue;
-    }
+          // Test edge
+          festart = ve->fedgeA();
+          fe = ve->fedgeA();
+          qiMajority = 0;
+          do {
+            if (fe != nullptr && fe->isInImage()) {
+              qiMajority++;
+            }
+            fe = fe->nextEdge();
+          } while (fe && fe != festart);
+
+          if (qiMajority == 0) {
+            // There are no occludable FEdges on this ViewEdge
+            // This should be impossible.
+            if (_global.debug & G_DEBUG_FREESTYLE) {
+              cout << "View Edge in viewport without occludable FEdges: " << ve->getId() << endl;
+            }
+            // We can recover from this error:
+            // Treat this edge as fully visible with no occludee
+            ve->setQI(0);
+            ve->setaShape(nullptr);
+            continue;
+          }
 
-    ++qiMajority;
-    qiMajority >>= 1;
+          ++qiMajority;
+          qiMajority >>= 1;
 
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tqiMajority: " << qiMajority << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tqiMajority: " << qiMajority << endl;
+          }
 #endif
 
-    tmpQI = 0;
-    maxIndex = 0;
-    maxCard = 0;
-    nSamples = 0;
-    memset(qiClasses, 0, 256 * sizeof(*qiClasses));
-    set<ViewShape *> foundOccluders;
-
-    fe = (*ve)->fedgeA();
-    do {
-      if (fe == nullptr || !fe->isInImage()) {
-        fe = fe->nextEdge();
-        continue;
-      }
-      if (maxCard < qiMajority) {
-        // ARB: change &wFace to wFace and use reference in called function
-        tmpQI = computeVisibility<G, I>(
-            ioViewMap, fe, grid, epsilon, *ve, &wFace, &foundOccluders);
+          tmpQI = 0;
+          maxIndex = 0;
+          maxCard = 0;
+          nSamples = 0;
+          memset(qiClasses, 0, 256 * sizeof(*qiClasses));
+          set<ViewShape *> foundOccluders;
+
+          fe = ve->fedgeA();
+          do {
+            if (fe == nullptr || !fe->isInImage()) {
+              fe = fe->nextEdge();
+              continue;
+            }
+            if (maxCard < qiMajority) {
+              // ARB: change &wFace to wFace and use reference in called function
+              tmpQI = computeVisibility<G, I>(
+                  ioViewMap, fe, grid, epsilon, ve, &wFace, &foundOccluders);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: visibility " << tmpQI << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFEdge: visibility " << tmpQI << endl;
+              }
 #endif
 
-        // ARB: This is an error condition, not an alert condition.
-        // Some sort of recovery or abort is necessary.
-        if (tmpQI >= 256) {
-          cerr << "Warning: too many occluding levels" << endl;
-          // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
-          tmpQI = 255;
-        }
+              // ARB: This is an error condition, not an alert condition.
+              // Some sort of recovery or abort is necessary.
+              if (tmpQI >= 256) {
+                cerr << "Warning: too many occluding levels" << endl;
+                // ARB: Wild guess: instead of aborting or corrupting memory, treat as tmpQI == 255
+                tmpQI = 255;
+              }
 
-        if (++qiClasses[tmpQI] > maxCard) {
-          maxCard = qiClasses[tmpQI];
-          maxIndex = tmpQI;
-        }
-      }
-      else {
-        // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
-        // ARB: change &wFace to wFace and use reference in called function
-        findOccludee<G, I>(fe, grid, epsilon, *ve, &wFace);
+              if (++qiClasses[tmpQI] > maxCard) {
+                maxCard = qiClasses[tmpQI];
+                maxIndex = tmpQI;
+              }
+            }
+            else {
+              // ARB: FindOccludee is redundant if ComputeRayCastingVisibility has been called
+              // ARB: change &wFace to wFace and use reference in called function
+              findOccludee<G, I>(fe, grid, epsilon, ve, &wFace);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found") << ")"
-               << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFEdge: occludee only (" << (wFace != nullptr ? "found" : "not found")
+                     << ")" << endl;
+              }
 #endif
-      }
+            }
 
-      // Store test results
-      if (wFace) {
-        vector<Vec3r> vertices;
-        for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
-          vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
-        }
-        Polygon3r poly(vertices, wFace->GetNormal());
-        poly.userdata = (void *)wFace;
-        fe->setaFace(poly);
-        wFaces.push_back(wFace);
-        fe->setOccludeeEmpty(false);
+            // Store test results
+            if (wFace) {
+              vector<Vec3r> vertices;
+              for (int i = 0, numEdges = wFace->numberOfEdges(); i < numEdges; ++i) {
+                vertices.emplace_back(wFace->GetVertex(i)->GetVertex());
+              }
+              Polygon3r poly(vertices, wFace->GetNormal());
+              poly.userdata = (void *)wFace;
+              fe->setaFace(poly);
+              wFaces.push_back(wFace);
+              fe->setOccludeeEmpty(false);
 #if LOGGING
-        if (_global.debug & G_DEBUG_FREESTYLE) {
-          cout << "\tFound occludee" << endl;
-        }
+              if (_global.debug & G_DEBUG_FREESTYLE) {
+                cout << "\tFound occludee" << endl;
+              }
 #endif
-      }
-      else {
-        fe->setOccludeeEmpty(true);
-      }
+            }
+            else {
+              fe->setOccludeeEmpty(true);
+            }
 
-      ++nSamples;
-      fe = fe->nextEdge();
-    } while ((maxCard < qiMajority) && (fe) && (fe != festart));
+            ++nSamples;
+            fe = fe->nextEdge();
+          } while ((maxCard < qiMajority) && (fe) && (fe != festart));
 
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tFinished with " << nSamples << " samples, maxCard = " << maxCard << endl;
+          }
 #endif
 
-    // ViewEdge
-    // qi --
-    (*ve)->setQI(maxIndex);
-    // occluders --
-    // I would rather not have to go through the effort of creating this this set and then copying
-    // out its contents. Is there a reason why ViewEdge::_Occluders cannot be converted to a set<>?
-    for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
-         o != oend;
-         ++o)
-    {
-      (*ve)->AddOccluder(*o);
-    }
+          // ViewEdge
+          // qi --
+          ve->setQI(maxIndex);
+          // occluders --
+          // I would rather not have to go through the effort of creating this this set and then
+          // copying out its contents. Is there a reason why ViewEdge::_Occluders cannot be
+          // converted to a set<>?
+          for (set<ViewShape *>::iterator o = foundOccluders.begin(), oend = foundOccluders.end();
+               o != oend;
+               ++o)
+          {
+            ve->AddOccluder(*o);
+          }
 #if LOGGING
-    if (_global.debug & G_DEBUG_FREESTYLE) {
-      cout << "\tConclusion: QI = " << maxIndex << ", " << (*ve)->occluders_size() << " occluders."
-           << endl;
-    }
+          if (_global.debug & G_DEBUG_FREESTYLE) {
+            cout << "\tConclusion: QI = " << maxIndex << ", " << ve->occluders_size()
+                 << " occluders." << endl;
+          }
 #endif
-    // occludee --
-    if (!wFaces.empty()) {
-      if (wFaces.size() <= float(nSamples) / 2.0f) {
-        (*ve)->setaShape(nullptr);
-      }
-      else {
-        ViewShape *vshape = ioViewMap->viewShape(
-            (*wFaces.begin())->GetVertex(0)->shape()->GetId());
-        (*ve)->setaShape(vshape);
-      }
-    }
+          // occludee --
+          if (!wFaces.empty()) {
+            if (wFaces.size() <= float(nSamples) / 2.0f) {
+              ve->setaShape(nullptr);
+            }
+            else {
+              ViewShape *vshape = ioViewMap->viewShape(
+                  (*wFaces.begin())->GetVertex(0)->shape()->GetId());
+              ve->setaShape(vshape);
+            }
+          }
 
-    wFaces.clear();
-  }
+          wFaces.clear();
+        }
+      });
 }
 
 template<typename G, typename I>
@@ -201,8 +201,14 @@ inline void execute_materialized(TypeSequence<ParamTags...> /*param_tags*/,
   /* In theory, all elements could be processed in one chunk. However, that has the disadvantage
    * that large temporary arrays are needed. Using small chunks allows using small arrays, which
    * are reused multiple times, which improves cache efficiency. The chunk size also shouldn't be
-   * too small, because then overhead of the outer loop over chunks becomes significant again. */
-  static constexpr int64_t MaxChunkSize = 64;
+   * too small, because then overhead of the outer loop over chunks becomes significant again.
+   * Scale the chunk size with the element size, so that small types like `float` are processed in
+   * larger batches (which amortizes the per-chunk virtual calls better and gives the compiler
+   * longer loops to vectorize), while the stack-resident temporary buffers stay small for large
+   * types. */
+  static constexpr size_t max_param_size = std::max({sizeof(typename ParamTags::base_type)...});
+  static constexpr int64_t MaxChunkSize = std::clamp<int64_t>(
+      2048 / int64_t(max_param_size), 64, 512);
   const int64_t mask_size = mask.size();
   const int64_t tmp_buffer_size = std::min(mask_size, MaxChunkSize);
 
@@ -23,6 +23,13 @@ static void calculate_result_offsets(const bke::CurvesGeometry &src_curves,
   /* Fill the array with each curve's point count, then accumulate them to the offsets. */
   const OffsetIndices src_points_by_curve = src_curves.points_by_curve();
   offset_indices::copy_group_sizes(src_points_by_curve, unselected, dst_curve_offsets);
+  /* With a constant cut count (the common case when the input isn't a varying field), the count
+   * per segment is known up front and the virtual array doesn't have to be materialized. */
+  std::optional<int> single_count;
+  if (const std::optional<int> single_cuts = cuts.get_if_single()) {
+    /* Make sure there is at least one cut, and add one for the existing point. */
+    single_count = std::max(*single_cuts, 0) + 1;
+  }
   selection.foreach_index(GrainSize(1024), [&](const int curve_i) {
     const IndexRange src_points = src_points_by_curve[curve_i];
     const IndexRange src_segments = bke::curves::per_curve_point_offsets_range(src_points,
@@ -35,10 +42,15 @@ static void calculate_result_offsets(const bke::CurvesGeometry &src_curves,
       point_counts.first() = 1;
     }
     else {
-      cuts.materialize_compressed(src_points, point_counts);
-      for (int &count : point_counts) {
-        /* Make sure there at least one cut, and add one for the existing point. */
-        count = std::max(count, 0) + 1;
+      if (single_count) {
+        point_counts.fill(*single_count);
+      }
+      else {
+        cuts.materialize_compressed(src_points, point_counts);
+        for (int &count : point_counts) {
+          /* Make sure there at least one cut, and add one for the existing point. */
+          count = std::max(count, 0) + 1;
+        }
       }
       if (!cyclic[curve_i]) {
         /* The last point only has a segment to be subdivided if the curve isn't cyclic. */
@@ -149,6 +149,10 @@ struct PChart {
 
   bool has_pins;
   bool skip_flush;
+  /* The LSCM matrix has been handed to `context` and factorized. Re-solves (live unwrap) only
+   * need to update the pinned values, rebuilding the matrix would be wasted work since the
+   * solver keeps its factorization for repeated solves. */
+  bool lscm_matrix_constructed;
 };
 
 /* PHash
@@ -3069,6 +3073,27 @@ static bool p_chart_lscm_solve(ParamHandle *handle, PChart *chart)
     }
   }
 
+  if (chart->lscm_matrix_constructed) {
+    /* Re-solve for live unwrap: the matrix only depends on the mesh angles and the set of locked
+     * variables, both fixed between #p_chart_lscm_begin and #p_chart_lscm_end. The updated pin
+     * locations entered the solver through the variable values above, and the factorization is
+     * reused for the new right hand side. */
+    if (EIG_linear_solver_solve(context)) {
+      for (PVert *v = chart->verts; v; v = v->nextlink) {
+        v->uv[0] = EIG_linear_solver_variable_get(context, 0, 2 * v->u.id);
+        v->uv[1] = EIG_linear_solver_variable_get(context, 0, 2 * v->u.id + 1);
+      }
+      return true;
+    }
+
+    for (PVert *v = chart->verts; v; v = v->nextlink) {
+      v->uv[0] = 0.0f;
+      v->uv[1] = 0.0f;
+    }
+
+    return false;
+  }
+
   /* Detect "up" direction based on pinned vertices. */
   float area_pinned_up = 0.0f;
   float area_pinned_down = 0.0f;
@@ -3154,6 +3179,8 @@ static bool p_chart_lscm_solve(ParamHandle *handle, PChart *chart)
     row++;
   }
 
+  chart->lscm_matrix_constructed = true;
+
   if (EIG_linear_solver_solve(context)) {
     for (PVert *v = chart->verts; v; v = v->nextlink) {
       v->uv[0] = EIG_linear_solver_variable_get(context, 0, 2 * v->u.id);
@@ -3193,6 +3220,7 @@ static void p_chart_lscm_end(PChart *chart)
 {
   EIG_linear_solver_delete(chart->context);
   chart->context = nullptr;
+  chart->lscm_matrix_constructed = false;
 
   MEM_SAFE_FREE(chart->abf_alpha);
 
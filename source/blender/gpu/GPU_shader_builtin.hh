@@ -57,6 +57,7 @@ enum eGPUBuiltinShader {
   /** Multi usage widget shaders for drawing buttons and other UI elements. */
   GPU_SHADER_2D_WIDGET_BASE,
   GPU_SHADER_2D_WIDGET_BASE_INST,
+  GPU_SHADER_2D_WIDGET_BASE_BATCH,
   GPU_SHADER_2D_WIDGET_SHADOW,
   /** Draw a node link given an input quadratic Bezier curve. */
   GPU_SHADER_2D_NODELINK,
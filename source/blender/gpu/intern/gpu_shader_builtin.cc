@@ -79,6 +79,8 @@ static const char *builtin_shader_create_info_name(eGPUBuiltinShader shader)
       return "gpu_shader_2D_widget_base";
     case GPU_SHADER_2D_WIDGET_BASE_INST:
       return "gpu_shader_2D_widget_base_inst";
+    case GPU_SHADER_2D_WIDGET_BASE_BATCH:
+      return "gpu_shader_2D_widget_base_batch";
     case GPU_SHADER_2D_WIDGET_SHADOW:
       return "gpu_shader_2D_widget_shadow";
     case GPU_SHADER_2D_NODELINK:
@@ -97,6 +97,7 @@ GLContext::~GLContext()
     cache->clear();
   }
   glDeleteBuffers(1, &default_attr_vbo_);
+  staging_ring.free();
 }
 
 /** \} */
@@ -158,7 +159,7 @@ void GLContext::begin_frame()
 
 void GLContext::end_frame()
 {
-  /* No-op. */
+  staging_ring.frame_sync();
 }
 
 /** \} */
@@ -15,6 +15,7 @@
 #include "BLI_set.hh"
 #include "BLI_vector.hh"
 
+#include "gl_staging_ring.hh"
 #include "gl_state.hh"
 
 #include <mutex>
@@ -47,6 +48,7 @@ class GLContext : public Context {
 
   /** Extensions. */
 
+  static bool buffer_storage_support;
   static bool clear_texture_support;
   static bool debug_layer_support;
   static bool direct_state_access_support;
@@ -72,6 +74,9 @@ class GLContext : public Context {
   /** VBO for missing vertex attribute binding. Avoid undefined behavior on some implementation. */
   GLuint default_attr_vbo_;
 
+  /** Staging memory for vertex buffer uploads (see #GLStagingRing). */
+  GLStagingRing staging_ring;
+
   /** Used for debugging purpose. Bitflags of all bound slots. */
   uint16_t bound_ubo_slots;
   uint16_t bound_ssbo_slots;
@@ -6,10 +6,15 @@
  * \ingroup gpu
  */
 
+#include <cinttypes>
 #include <iomanip>
 
+#include "BKE_appdir.hh"
 #include "BKE_global.hh"
 
+#include "BLI_fileops.h"
+#include "BLI_hash.hh"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
@@ -31,6 +36,8 @@ using namespace blender::gpu::shader;
 
 extern "C" char datatoc_glsl_shader_defines_glsl[];
 
+static bool program_binary_cache_enabled();
+
 /* -------------------------------------------------------------------- */
 /** \name Creation / Destruction
  * \{ */
@@ -1104,13 +1111,12 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage,
   /* Patch the shader sources to include specialization constants. */
   std::string constants_source;
   Vector<const char *> recreated_sources;
-  const bool has_specialization_constants = !constants.types.is_empty();
-  if (has_specialization_constants) {
+  if (!constants.types.is_empty()) {
     constants_source = constants_declare();
-    if (sources.is_empty()) {
-      recreated_sources = gl_sources.sources_get();
-      sources = recreated_sources;
-    }
+  }
+  if (sources.is_empty()) {
+    recreated_sources = gl_sources.sources_get();
+    sources = recreated_sources;
   }
 
   /* Patch the shader code using the first source slot. */
@@ -1180,8 +1186,9 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage,
 void GLShader::update_program_and_sources(GLSources &stage_sources,
                                           MutableSpan<const char *> sources)
 {
-  const bool has_specialization_constants = !constants.types.is_empty();
-  if (has_specialization_constants && stage_sources.is_empty()) {
+  /* Compilation is deferred to #finalize. Only store the sources so that a program binary cache
+   * hit can skip it entirely. */
+  if (stage_sources.is_empty()) {
     stage_sources = sources;
   }
 
@@ -1191,29 +1198,21 @@ void GLShader::update_program_and_sources(GLSources &stage_sources,
 void GLShader::vertex_shader_from_glsl(MutableSpan<const char *> sources)
 {
   update_program_and_sources(vertex_sources_, sources);
-  program_active_->vert_shader = this->create_shader_stage(
-      GL_VERTEX_SHADER, sources, vertex_sources_);
 }
 
 void GLShader::geometry_shader_from_glsl(MutableSpan<const char *> sources)
 {
   update_program_and_sources(geometry_sources_, sources);
-  program_active_->geom_shader = this->create_shader_stage(
-      GL_GEOMETRY_SHADER, sources, geometry_sources_);
 }
 
 void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 {
   update_program_and_sources(fragment_sources_, sources);
-  program_active_->frag_shader = this->create_shader_stage(
-      GL_FRAGMENT_SHADER, sources, fragment_sources_);
 }
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
   update_program_and_sources(compute_sources_, sources);
-  program_active_->compute_shader = this->create_shader_stage(
-      GL_COMPUTE_SHADER, sources, compute_sources_);
 }
 
 bool GLShader::finalize(const shader::ShaderCreateInfo *info)
@@ -1231,11 +1230,55 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
     geometry_shader_from_glsl(sources);
   }
 
-  if (!program_link()) {
-    return false;
+  BLI_assert(program_active_ != nullptr);
+  GLuint program_id = program_active_->program_id;
+
+  /* Shaders using specialization constants create new programs on demand (see #program_get) and
+   * are left out of the binary cache to keep a one to one mapping between entries and programs. */
+  const bool use_binary_cache = constants.types.is_empty() && program_binary_cache_enabled();
+
+  bool is_linked = false;
+  if (use_binary_cache) {
+    program_cache_hash_ = program_cache_hash_calc();
+    is_linked = program_binary_load(program_id);
+  }
+
+  if (!is_linked) {
+    MutableSpan<const char *> no_sources;
+    if (!vertex_sources_.is_empty()) {
+      program_active_->vert_shader = create_shader_stage(
+          GL_VERTEX_SHADER, no_sources, vertex_sources_);
+    }
+    if (!geometry_sources_.is_empty()) {
+      program_active_->geom_shader = create_shader_stage(
+          GL_GEOMETRY_SHADER, no_sources, geometry_sources_);
+    }
+    if (!fragment_sources_.is_empty()) {
+      program_active_->frag_shader = create_shader_stage(
+          GL_FRAGMENT_SHADER, no_sources, fragment_sources_);
+    }
+    if (!compute_sources_.is_empty()) {
+      program_active_->compute_shader = create_shader_stage(
+          GL_COMPUTE_SHADER, no_sources, compute_sources_);
+    }
+
+    if (compilation_failed_) {
+      return false;
+    }
+
+    if (use_binary_cache) {
+      glProgramParameteri(program_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    if (!program_link()) {
+      return false;
+    }
+
+    if (use_binary_cache) {
+      program_binary_store(program_id);
+    }
   }
 
-  GLuint program_id = program_get();
   if (info != nullptr && info->legacy_resource_location_ == false) {
     interface = new GLShaderInterface(program_id, *info);
   }
@@ -1248,6 +1291,132 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary Cache
+ *
+ * Linked programs are stored on disk (using `GL_ARB_get_program_binary`) so that subsequent
+ * sessions can skip both compilation and linking. Binaries are opaque driver specific blobs, so
+ * entries are keyed by a hash of the stage sources together with the driver identification
+ * strings, and a binary rejected by the driver simply falls back to a regular compilation that
+ * overwrites the stale entry.
+ * \{ */
+
+static bool program_binary_cache_enabled()
+{
+  if (G.debug & G_DEBUG_GPU) {
+    /* Debug mode patches the sources with renamed resources. Always recompile so that shader
+     * logs point to the actual sources. */
+    return false;
+  }
+  static GLint format_len = -1;
+  if (format_len == -1) {
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_len);
+  }
+  return format_len > 0;
+}
+
+static bool program_binary_cache_path_get(uint64_t hash, char r_filepath[FILE_MAX])
+{
+  static char cache_dir[FILE_MAXDIR];
+  static bool cache_dir_valid = false;
+  static bool cache_dir_init = false;
+  if (!cache_dir_init) {
+    cache_dir_init = true;
+    char app_dir[FILE_MAXDIR];
+    if (BKE_appdir_folder_caches(app_dir, sizeof(app_dir))) {
+      BLI_path_join(cache_dir, sizeof(cache_dir), app_dir, "gpu-program-cache");
+      cache_dir_valid = BLI_dir_create_recursive(cache_dir);
+    }
+  }
+  if (!cache_dir_valid) {
+    return false;
+  }
+  char filename[FILE_MAXFILE];
+  SNPRINTF(filename, "%016" PRIx64 ".bin", hash);
+  BLI_path_join(r_filepath, FILE_MAX, cache_dir, filename);
+  return true;
+}
+
+uint64_t GLShader::program_cache_hash_calc() const
+{
+  /* The driver identification is part of the key since program binaries are opaque driver
+   * specific blobs that do not survive driver updates. */
+  uint64_t hash = get_default_hash(
+      StringRef(reinterpret_cast<const char *>(glGetString(GL_VENDOR))),
+      StringRef(reinterpret_cast<const char *>(glGetString(GL_RENDERER))));
+  hash = get_default_hash(hash,
+                          StringRef(reinterpret_cast<const char *>(glGetString(GL_VERSION))));
+
+  for (const GLSources *stage_sources :
+       {&vertex_sources_, &geometry_sources_, &fragment_sources_, &compute_sources_})
+  {
+    for (const GLSource &source : *stage_sources) {
+      const StringRef source_str = source.source_ref ? StringRef(source.source_ref) :
+                                                       StringRef(source.source);
+      hash = get_default_hash(hash, source_str);
+    }
+  }
+  return hash;
+}
+
+bool GLShader::program_binary_load(GLuint program_id)
+{
+  char filepath[FILE_MAX];
+  if (!program_binary_cache_path_get(program_cache_hash_, filepath)) {
+    return false;
+  }
+
+  size_t data_len = 0;
+  void *data = BLI_file_read_binary_as_mem(filepath, 0, &data_len);
+  if (data == nullptr) {
+    return false;
+  }
+  if (data_len <= sizeof(GLenum)) {
+    MEM_freeN(data);
+    return false;
+  }
+
+  GLenum binary_format;
+  memcpy(&binary_format, data, sizeof(GLenum));
+  const void *binary = POINTER_OFFSET(data, sizeof(GLenum));
+  glProgramBinary(program_id, binary_format, binary, data_len - sizeof(GLenum));
+  MEM_freeN(data);
+
+  /* The driver is free to reject the binary (e.g. after a driver update). Fall back to a regular
+   * compilation, which overwrites the stale cache entry. */
+  GLint status;
+  glGetProgramiv(program_id, GL_LINK_STATUS, &status);
+  return bool(status);
+}
+
+void GLShader::program_binary_store(GLuint program_id)
+{
+  char filepath[FILE_MAX];
+  if (!program_binary_cache_path_get(program_cache_hash_, filepath)) {
+    return;
+  }
+
+  GLint binary_len = 0;
+  glGetProgramiv(program_id, GL_PROGRAM_BINARY_LENGTH, &binary_len);
+  if (binary_len <= 0) {
+    return;
+  }
+
+  void *binary = MEM_mallocN(binary_len, __func__);
+  GLenum binary_format = 0;
+  glGetProgramBinary(program_id, binary_len, nullptr, &binary_format, binary);
+
+  FILE *file = BLI_fopen(filepath, "wb");
+  if (file) {
+    fwrite(&binary_format, sizeof(GLenum), 1, file);
+    fwrite(binary, binary_len, 1, file);
+    fclose(file);
+  }
+  MEM_freeN(binary);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Binding
  * \{ */
@@ -86,9 +86,9 @@ class GLShader : public Shader {
   GLProgram *program_active_ = nullptr;
 
   /**
-   * When the shader uses Specialization Constants these attribute contains the sources to
-   * rebuild shader stages. When Specialization Constants aren't used they are empty to
-   * reduce memory needs.
+   * Sources of each shader stage. Compilation is deferred to #finalize so that it can be
+   * skipped altogether when a matching program binary is found in the on-disk cache. When the
+   * shader uses Specialization Constants they are also used to rebuild shader stages.
    */
   GLSources vertex_sources_;
   GLSources geometry_sources_;
@@ -114,6 +114,14 @@ class GLShader : public Shader {
    */
   bool program_link();
 
+  /** Hash of all stage sources and driver identification, keying the on-disk binary cache. */
+  uint64_t program_cache_hash_ = 0;
+
+  uint64_t program_cache_hash_calc() const;
+  /** Try to load a previously stored program binary. Return true if the program is linked. */
+  bool program_binary_load(GLuint program_id);
+  void program_binary_store(GLuint program_id);
+
   /**
    * Return a GLProgram program id that reflects the current state of shader.constants.values.
    * The returned program_id is in linked state, or an error happened during linking.
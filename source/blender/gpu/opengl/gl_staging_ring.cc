@@ -0,0 +1,135 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup gpu
+ */
+
+#include "gl_staging_ring.hh"
+
+#include "gl_context.hh"
+
+namespace blender::gpu {
+
+void GLStagingRing::init()
+{
+  const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  glGenBuffers(1, &vbo_id_);
+  glBindBuffer(GL_COPY_READ_BUFFER, vbo_id_);
+  glBufferStorage(GL_COPY_READ_BUFFER, segment_len_ * segment_size_, nullptr, flags);
+  mapped_ = (uchar *)glMapBufferRange(GL_COPY_READ_BUFFER, 0, segment_len_ * segment_size_, flags);
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+}
+
+void *GLStagingRing::alloc(size_t size, size_t *r_offset)
+{
+  BLI_assert(GLContext::get() != nullptr);
+
+  if (!GLContext::buffer_storage_support || size > segment_size_) {
+    return nullptr;
+  }
+  if (vbo_id_ == 0) {
+    init();
+  }
+  if (mapped_ == nullptr) {
+    return nullptr;
+  }
+
+  head_ = (head_ + alignment_ - 1) & ~(alignment_ - 1);
+  if (head_ + size > segment_size_) {
+    if (!segment_advance()) {
+      return nullptr;
+    }
+  }
+
+  const size_t offset = segment_ * segment_size_ + head_;
+  head_ += size;
+  segment_used_ = true;
+  pending_[segment_]++;
+  *r_offset = offset;
+  return mapped_ + offset;
+}
+
+void GLStagingRing::consume(const size_t offset, const bool gpu_read)
+{
+  const size_t segment = offset / segment_size_;
+  BLI_assert(segment < segment_len_);
+  BLI_assert(pending_[segment] > 0);
+
+  if (gpu_read && segment != segment_ && fences_[segment]) {
+    /* The device side read was issued after this segment was fenced, so the existing fence does
+     * not cover it. Renew the fence so the memory is not handed out again before the read
+     * executed. */
+    BLI_assert(GLContext::get() != nullptr);
+    glDeleteSync(fences_[segment]);
+    fences_[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+
+  pending_[segment]--;
+}
+
+bool GLStagingRing::segment_advance()
+{
+  const size_t next = (segment_ + 1) % segment_len_;
+  if (pending_[next] != 0) {
+    /* The next segment still holds staged data that was not consumed yet (buffers filled but not
+     * uploaded), reusing it would overwrite that data. Stay on the current segment and let
+     * allocations fail until the ranges are consumed. */
+    return false;
+  }
+
+  /* Guard the allocations of the current segment against reuse. */
+  if (fences_[segment_]) {
+    glDeleteSync(fences_[segment_]);
+  }
+  fences_[segment_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  segment_ = next;
+  head_ = 0;
+  segment_used_ = false;
+
+  if (fences_[segment_]) {
+    /* Wait for the GPU to be done with the segment about to be reused. Only stalls when the CPU
+     * is more than `segment_len_ - 1` sync points ahead of the GPU. */
+    glClientWaitSync(fences_[segment_], GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(-1));
+    glDeleteSync(fences_[segment_]);
+    fences_[segment_] = nullptr;
+  }
+  return true;
+}
+
+void GLStagingRing::frame_sync()
+{
+  if (segment_used_) {
+    segment_advance();
+  }
+}
+
+void GLStagingRing::free()
+{
+  for (GLsync &fence : fences_) {
+    if (fence) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  if (vbo_id_ != 0) {
+    if (mapped_) {
+      glBindBuffer(GL_COPY_READ_BUFFER, vbo_id_);
+      glUnmapBuffer(GL_COPY_READ_BUFFER);
+      glBindBuffer(GL_COPY_READ_BUFFER, 0);
+      mapped_ = nullptr;
+    }
+    glDeleteBuffers(1, &vbo_id_);
+    vbo_id_ = 0;
+  }
+  segment_ = 0;
+  head_ = 0;
+  segment_used_ = false;
+  for (std::atomic<int> &pending : pending_) {
+    pending = 0;
+  }
+}
+
+}  // namespace blender::gpu
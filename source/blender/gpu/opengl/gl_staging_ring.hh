@@ -0,0 +1,96 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup gpu
+ *
+ * Persistently mapped ring buffer used to stage vertex buffer uploads. Data is written directly
+ * into the mapped memory and transferred to its destination buffer with a device side copy,
+ * removing the intermediate CPU side copy of regular `glBufferSubData` uploads.
+ *
+ * Memory is only reclaimed once an allocation was consumed (see #consume): a segment with
+ * unconsumed ranges is never handed out again and fences guard it against reuse while the
+ * device may still be reading from it.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <epoxy/gl.h>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_utildefines.h"
+
+namespace blender::gpu {
+
+class GLStagingRing {
+ private:
+  /** Number of segments the ring is divided into. Each segment is guarded by its own fence. */
+  static constexpr size_t segment_len_ = 4;
+  /** Size of one segment in bytes. Allocations bigger than this cannot use the ring. */
+  static constexpr size_t segment_size_ = 8 * 1024 * 1024;
+  /** Alignment of the returned offsets. */
+  static constexpr size_t alignment_ = 256;
+
+  /** OpenGL buffer handle. Created on first allocation. Immutable after that. */
+  GLuint vbo_id_ = 0;
+  /** Persistent coherent mapping of the whole buffer. */
+  uchar *mapped_ = nullptr;
+  /** Fences guarding reuse of each segment. */
+  GLsync fences_[segment_len_] = {};
+  /** Segment currently allocated from. */
+  size_t segment_ = 0;
+  /** Offset of the next free byte inside the current segment. */
+  size_t head_ = 0;
+  /** True if the current segment received allocations since the last fence. */
+  bool segment_used_ = false;
+  /** Number of allocations per segment that were handed out but not consumed yet. Such ranges
+   * still hold data whose device side copy was not issued, so their segment cannot be reused.
+   * Atomic because buffers may be freed (consuming their range) from other threads. */
+  std::atomic<int> pending_[segment_len_] = {};
+
+ public:
+  /**
+   * Allocate a range of \a size bytes and return a pointer to write into, or null when the ring
+   * cannot serve the allocation (no `GL_ARB_buffer_storage` support, or \a size exceeds a
+   * segment). The offset of the range inside the buffer is returned in \a r_offset.
+   * Must be called with an active context. The range stays valid until it is consumed: every
+   * successful allocation must be matched by exactly one #consume call.
+   */
+  void *alloc(size_t size, size_t *r_offset);
+
+  /**
+   * Mark the range starting at \a offset as consumed, allowing its memory to be reclaimed.
+   * Pass true for \a gpu_read when a device side read of the range was issued (the guarding
+   * fence is renewed to cover it, requires an active context), false when the range was
+   * abandoned or only read from the CPU (safe to call from any thread).
+   */
+  void consume(size_t offset, bool gpu_read);
+
+  /** Fence the allocations made since the last call so that their memory can be reclaimed. */
+  void frame_sync();
+
+  /** Free all resources. Must be called with an active context. */
+  void free();
+
+  GLuint gl_id() const
+  {
+    return vbo_id_;
+  }
+
+ private:
+  void init();
+  /**
+   * Fence the current segment and move to the next one, waiting on its fence if needed.
+   * Returns false (staying on the current segment) when the next segment still has
+   * unconsumed ranges that reusing it would overwrite.
+   */
+  bool segment_advance();
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("GLStagingRing")
+};
+
+}  // namespace blender::gpu
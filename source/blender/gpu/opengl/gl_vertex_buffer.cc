@@ -6,6 +6,8 @@
  * \ingroup gpu
  */
 
+#include <algorithm>
+
 #include "GPU_texture.hh"
 
 #include "gl_context.hh"
@@ -21,7 +23,29 @@ void GLVertBuf::acquire_data()
   }
 
   /* Discard previous data if any. */
-  MEM_SAFE_FREE(data);
+  if (staging_vbo_id_ != 0) {
+    staging_ring_->consume(staging_offset_, false);
+    data = nullptr;
+    staging_vbo_id_ = 0;
+    staging_ring_ = nullptr;
+  }
+  else {
+    MEM_SAFE_FREE(data);
+  }
+
+  /* Static buffers are discarded after upload, so they can be written directly inside the
+   * staging ring and transferred with a device side copy, skipping one CPU side copy of the
+   * data. This requires an active context: worker threads fall back to the heap. */
+  GLContext *ctx = GLContext::get();
+  if (usage_ == GPU_USAGE_STATIC && ctx != nullptr) {
+    data = (uchar *)ctx->staging_ring.alloc(this->size_alloc_get(), &staging_offset_);
+    if (data != nullptr) {
+      staging_vbo_id_ = ctx->staging_ring.gl_id();
+      staging_ring_ = &ctx->staging_ring;
+      staging_size_ = this->size_alloc_get();
+      return;
+    }
+  }
   data = (uchar *)MEM_mallocN(sizeof(uchar) * this->size_alloc_get(), __func__);
 }
 
@@ -31,6 +55,19 @@ void GLVertBuf::resize_data()
     return;
   }
 
+  if (staging_vbo_id_ != 0) {
+    /* Move the data to the heap instead of reallocating inside the ring, so that resizing also
+     * works without an active context. */
+    const size_t new_size = this->size_alloc_get();
+    uchar *heap_data = (uchar *)MEM_mallocN(sizeof(uchar) * new_size, __func__);
+    memcpy(heap_data, data, std::min(staging_size_, new_size));
+    staging_ring_->consume(staging_offset_, false);
+    data = heap_data;
+    staging_vbo_id_ = 0;
+    staging_ring_ = nullptr;
+    return;
+  }
+
   data = (uchar *)MEM_reallocN(data, sizeof(uchar) * this->size_alloc_get());
 }
 
@@ -47,6 +84,12 @@ void GLVertBuf::release_data()
     memory_usage -= vbo_size_;
   }
 
+  if (staging_vbo_id_ != 0) {
+    staging_ring_->consume(staging_offset_, false);
+    data = nullptr;
+    staging_vbo_id_ = 0;
+    staging_ring_ = nullptr;
+  }
   MEM_SAFE_FREE(data);
 }
 
@@ -72,7 +115,14 @@ void GLVertBuf::duplicate_data(VertBuf *dst_)
   }
 
   if (data != nullptr) {
-    dst->data = (uchar *)MEM_dupallocN(src->data);
+    if (staging_vbo_id_ != 0) {
+      /* Ring allocations are not guarded allocations; always duplicate to the heap. */
+      dst->data = (uchar *)MEM_mallocN(staging_size_, __func__);
+      memcpy(dst->data, src->data, staging_size_);
+    }
+    else {
+      dst->data = (uchar *)MEM_dupallocN(src->data);
+    }
   }
 }
 
@@ -97,7 +147,22 @@ void GLVertBuf::bind()
     glBufferData(GL_ARRAY_BUFFER, vbo_size_, nullptr, to_gl(usage_));
     /* Do not transfer data from host to device when buffer is device only. */
     if (usage_ != GPU_USAGE_DEVICE_ONLY) {
-      glBufferSubData(GL_ARRAY_BUFFER, 0, vbo_size_, data);
+      if (staging_vbo_id_ != 0) {
+        /* The data was written directly inside the staging ring. Transfer it with a device side
+         * copy instead of reading it back through the CPU. */
+        glBindBuffer(GL_COPY_READ_BUFFER, staging_vbo_id_);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ARRAY_BUFFER, staging_offset_, 0, vbo_size_);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        /* The copy is issued now, the ring can reclaim the range once it executed. Staging is
+         * only used for static buffers, which always discard `data` after the upload. */
+        staging_ring_->consume(staging_offset_, true);
+        data = nullptr;
+        staging_vbo_id_ = 0;
+        staging_ring_ = nullptr;
+      }
+      else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vbo_size_, data);
+      }
     }
     memory_usage += vbo_size_;
 
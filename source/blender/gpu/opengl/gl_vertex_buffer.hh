@@ -17,6 +17,8 @@
 namespace blender {
 namespace gpu {
 
+class GLStagingRing;
+
 class GLVertBuf : public VertBuf {
   friend class GLTexture;    /* For buffer texture. */
   friend class GLShader;     /* For transform feedback. */
@@ -32,6 +34,14 @@ class GLVertBuf : public VertBuf {
   bool is_wrapper_ = false;
   /** Size on the GPU. */
   size_t vbo_size_ = 0;
+  /** Handle, offset and size of the staging ring range holding `data` when it was allocated
+   * inside the ring, in which case the upload is a device side copy and `data` is not a heap
+   * allocation. 0 handle means heap allocation. Every staged range has to be consumed on the
+   * ring exactly once so its memory can be reclaimed. See #GLStagingRing. */
+  GLuint staging_vbo_id_ = 0;
+  GLStagingRing *staging_ring_ = nullptr;
+  size_t staging_offset_ = 0;
+  size_t staging_size_ = 0;
 
  public:
   void bind();
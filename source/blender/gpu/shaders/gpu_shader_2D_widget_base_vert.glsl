@@ -2,6 +2,10 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#ifdef WIDGET_PARAMETERS_SSBO
+#  define parameters parameters_buf
+#endif
+
 #define recti parameters[widgetID * MAX_PARAM + 0]
 #define rect parameters[widgetID * MAX_PARAM + 1]
 #define radsi parameters[widgetID * MAX_PARAM + 2].x
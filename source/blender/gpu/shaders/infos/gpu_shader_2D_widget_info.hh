@@ -49,6 +49,14 @@ GPU_SHADER_CREATE_INFO(gpu_shader_2D_widget_base_inst)
     .push_constant(Type::VEC4, "parameters", (MAX_PARAM * MAX_INSTANCE))
     .additional_info("gpu_shader_2D_widget_shared");
 
+GPU_SHADER_CREATE_INFO(gpu_shader_2D_widget_base_batch)
+    .do_static_compilation(true)
+    .define("widgetID", "gl_InstanceID")
+    /* Parameters are streamed through a storage buffer so the batch size is unbounded. */
+    .define("WIDGET_PARAMETERS_SSBO")
+    .storage_buf(0, Qualifier::READ, "vec4", "parameters_buf[]")
+    .additional_info("gpu_shader_2D_widget_shared");
+
 GPU_SHADER_INTERFACE_INFO(gpu_widget_shadow_iface, "")
     .smooth(Type::FLOAT, "shadowFalloff")
     .smooth(Type::FLOAT, "innerMask");
@@ -138,6 +138,19 @@ struct IK_Channel {
   }
 };
 
+/* Number of converged poses kept per scene for warm starting. */
+#define IK_WARM_START_CACHE_SIZE 8
+
+/* One converged solution of the scene, keyed by the quantized target poses in
+ * IK base space. Cyclic animation brings the same targets back every cycle, in
+ * which case the solver is seeded with the converged joints instead of the
+ * action pose and reaches the precision threshold in far fewer iterations.
+ * See execute_scene(). */
+struct IK_WarmStartEntry {
+  std::vector<int32_t> key;
+  KDL::JntArray joints;
+};
+
 struct IK_Scene {
   Depsgraph *bldepsgraph;
   Scene *blscene;
@@ -158,6 +171,9 @@ struct IK_Scene {
   float blInvScale; /* inverse of Armature object scale */
   bConstraint *polarConstraint;
   std::vector<IK_Target *> targets;
+  /* Warm start cache for animation mode, oldest entry is replaced first. */
+  std::vector<IK_WarmStartEntry> warmStartCache;
+  int warmStartNext;
 
   IK_Scene()
   {
@@ -175,6 +191,7 @@ struct IK_Scene {
     numchan = 0;
     numjoint = 0;
     polarConstraint = nullptr;
+    warmStartNext = 0;
   }
 
   ~IK_Scene()
@@ -1690,6 +1707,97 @@ static int init_scene(Object *ob)
   return 0;
 }
 
+/* Build the warm start key: all target poses relative to the IK base, so that
+ * object level motion doesn't invalidate the cache, quantized so that poses
+ * closer than the quantization step share a slot. Returns false when the scene
+ * can't be keyed reliably (polar targets rotate the base during solving). */
+static bool ik_scene_warm_start_key(IK_Scene *ikscene, std::vector<int32_t> &r_key)
+{
+  /* Quantization step, in object units for locations. */
+  const float step = 0.001f;
+
+  if (ikscene->polarConstraint) {
+    return false;
+  }
+
+  /* Pose of the IK base in world space, mirrors base_callback(). */
+  bPoseChannel *pchan = ikscene->channels[0].pchan;
+  float rootmat[4][4], imat[4][4];
+  if (pchan->parent) {
+    pchan = pchan->parent;
+    float chanmat[4][4];
+    copy_m4_m4(chanmat, pchan->pose_mat);
+    copy_v3_v3(chanmat[3], pchan->pose_tail);
+    mul_m4_m4m4(rootmat, ikscene->blArmature->object_to_world().ptr(), chanmat);
+  }
+  else {
+    copy_m4_m4(rootmat, ikscene->blArmature->object_to_world().ptr());
+  }
+  invert_m4_m4(imat, rootmat);
+
+  r_key.clear();
+  r_key.reserve(ikscene->targets.size() * 14);
+  for (IK_Target *iktarget : ikscene->targets) {
+    bConstraint *constraint = iktarget->blenderConstraint;
+    r_key.push_back((constraint->flag & CONSTRAINT_OFF) ? 1 : 0);
+    r_key.push_back(int32_t(std::round(constraint->enforce / step)));
+    if (constraint->flag & CONSTRAINT_OFF) {
+      continue;
+    }
+
+    float tarmat[4][4], basemat[4][4];
+    BKE_constraint_target_matrix_get(iktarget->bldepsgraph,
+                                     iktarget->blscene,
+                                     constraint,
+                                     0,
+                                     CONSTRAINT_OBTYPE_OBJECT,
+                                     iktarget->owner,
+                                     tarmat,
+                                     1.0);
+    mul_m4_m4m4(basemat, imat, tarmat);
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 3; j++) {
+        r_key.push_back(int32_t(std::round(basemat[i][j] / step)));
+      }
+    }
+  }
+  return !r_key.empty();
+}
+
+/* Seed the joint array from a cached converged solution, if there is one. */
+static void ik_scene_warm_start_seed(IK_Scene *ikscene, const std::vector<int32_t> &key)
+{
+  for (const IK_WarmStartEntry &entry : ikscene->warmStartCache) {
+    if (entry.key == key && entry.joints.rows() == ikscene->jointArray.rows()) {
+      ikscene->jointArray = entry.joints;
+      return;
+    }
+  }
+}
+
+/* Store the converged joints for later warm starts, replacing the oldest
+ * entry once the cache is full. */
+static void ik_scene_warm_start_store(IK_Scene *ikscene, std::vector<int32_t> key)
+{
+  const KDL::JntArray &joints = ikscene->armature->getJointArray();
+
+  for (IK_WarmStartEntry &entry : ikscene->warmStartCache) {
+    if (entry.key == key) {
+      entry.joints = joints;
+      return;
+    }
+  }
+  if (ikscene->warmStartCache.size() < IK_WARM_START_CACHE_SIZE) {
+    ikscene->warmStartCache.push_back({std::move(key), joints});
+  }
+  else {
+    IK_WarmStartEntry &entry = ikscene->warmStartCache[ikscene->warmStartNext];
+    entry.key = std::move(key);
+    entry.joints = joints;
+    ikscene->warmStartNext = (ikscene->warmStartNext + 1) % IK_WARM_START_CACHE_SIZE;
+  }
+}
+
 static void execute_scene(Depsgraph *depsgraph,
                           Scene *blscene,
                           IK_Scene *ikscene,
@@ -1740,12 +1848,20 @@ static void execute_scene(Depsgraph *depsgraph,
   int numstep = (ikparam->flag & ITASC_AUTO_STEP) ? 0 : ikparam->numstep;
   bool simulation = true;
 
+  std::vector<int32_t> warm_key;
+  bool use_warm_start = false;
+
   if (ikparam->flag & ITASC_SIMULATION) {
     ikscene->solver->setParam(iTaSC::Solver::DLS_QMAX, ikparam->maxvel);
   }
   else {
     /* in animation mode we start from the pose after action and constraint */
     convert_pose(ikscene);
+    /* unless the same targets were solved before, then start from that solution */
+    use_warm_start = ik_scene_warm_start_key(ikscene, warm_key);
+    if (use_warm_start) {
+      ik_scene_warm_start_seed(ikscene, warm_key);
+    }
     ikscene->armature->setJointArray(ikscene->jointArray);
     /* and we don't handle velocity */
     reiterate = true;
@@ -1788,6 +1904,9 @@ static void execute_scene(Depsgraph *depsgraph,
       /* one more fake iteration to cache */
       ikscene->scene->update(timestamp, 0.0, 1, true, true, true);
     }
+    else if (use_warm_start) {
+      ik_scene_warm_start_store(ikscene, std::move(warm_key));
+    }
   }
   /* compute constraint error */
   for (i = ikscene->targets.size(); i > 0; i--) {
@@ -563,6 +563,14 @@ static void ffmpeg_postprocess(ImBufAnim *anim, AVFrame *input, ImBuf *ibuf)
   const int ibuf_linesize = ibuf->x * 4;
   const int rgb_linesize = anim->pFrameRGB->linesize[0];
   bool scale_to_ibuf = (rgb_linesize == ibuf_linesize);
+  /* Older libswscale could crash on destination rows that are not SIMD aligned
+   * (FFmpeg ticket #8747), which is why the intermediate `pFrameRGB` buffer with
+   * a padded line size exists at all. FFmpeg 5.0 and newer handle arbitrary
+   * destination strides, so the extra copy through the intermediate buffer can
+   * be skipped for widths that are not a multiple of the alignment as well. */
+#  if LIBSWSCALE_VERSION_MAJOR >= 6
+  scale_to_ibuf = true;
+#  endif
   /* swscale on arm64 before ffmpeg 6.0 (libswscale major version 7)
    * could not handle negative line sizes. That has been fixed in all major
    * ffmpeg releases in early 2023, but easier to just check for "below 7". */
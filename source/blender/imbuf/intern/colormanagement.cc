@@ -29,6 +29,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_ghash.h"
 #include "BLI_math_color.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
@@ -93,8 +94,18 @@ float imbuf_aces_to_scene_linear[3][3] = {{0.0f}};
  */
 static pthread_mutex_t processor_lock = BLI_MUTEX_INITIALIZER;
 
+/* Lazily filled cache of CPU processors for arbitrary color space pairs,
+ * keyed by the (from, to) ColorSpace pointer pair. Getting a CPU processor
+ * from OCIO is expensive (it builds the optimized transform), while the
+ * same conversions are requested over and over during playback.
+ * Protected by processor_lock, freed together with the configuration. */
+static GHash *colorspace_pair_cpu_processors = nullptr;
+
 struct ColormanageProcessor {
   OCIO_ConstCPUProcessorRcPtr *cpu_processor;
+  /* Whether `cpu_processor` is owned by this processor, or borrowed from the
+   * global pair cache. */
+  bool owns_cpu_processor;
   CurveMapping *curve_mapping;
   bool is_data_result;
 };
@@ -600,6 +611,17 @@ static void colormanage_free_config()
   ColorSpace *colorspace;
   ColorManagedDisplay *display;
 
+  /* Free cached color space pair processors. */
+  if (colorspace_pair_cpu_processors != nullptr) {
+    GHashIterator gh_iter;
+    GHASH_ITER (gh_iter, colorspace_pair_cpu_processors) {
+      OCIO_cpuProcessorRelease(
+          static_cast<OCIO_ConstCPUProcessorRcPtr *>(BLI_ghashIterator_getValue(&gh_iter)));
+    }
+    BLI_ghash_free(colorspace_pair_cpu_processors, BLI_ghashutil_pairfree, nullptr);
+    colorspace_pair_cpu_processors = nullptr;
+  }
+
   /* free color spaces */
   colorspace = static_cast<ColorSpace *>(global_colorspaces.first);
   while (colorspace) {
@@ -917,6 +939,39 @@ static OCIO_ConstProcessorRcPtr *create_colorspace_transform_processor(const cha
   return processor;
 }
 
+static OCIO_ConstCPUProcessorRcPtr *colorspace_to_colorspace_cpu_processor(
+    ColorSpace *from_colorspace, ColorSpace *to_colorspace)
+{
+  BLI_mutex_lock(&processor_lock);
+
+  if (colorspace_pair_cpu_processors == nullptr) {
+    colorspace_pair_cpu_processors = BLI_ghash_new(
+        BLI_ghashutil_pairhash, BLI_ghashutil_paircmp, "colorspace pair cpu processors");
+  }
+
+  GHashPair pair_key = {from_colorspace, to_colorspace};
+  OCIO_ConstCPUProcessorRcPtr *cpu_processor = static_cast<OCIO_ConstCPUProcessorRcPtr *>(
+      BLI_ghash_lookup(colorspace_pair_cpu_processors, &pair_key));
+
+  if (cpu_processor == nullptr) {
+    OCIO_ConstProcessorRcPtr *processor = create_colorspace_transform_processor(
+        from_colorspace->name, to_colorspace->name);
+
+    if (processor != nullptr) {
+      cpu_processor = OCIO_processorGetCPUProcessor(processor);
+      OCIO_processorRelease(processor);
+
+      BLI_ghash_insert(colorspace_pair_cpu_processors,
+                       BLI_ghashutil_pairalloc(from_colorspace, to_colorspace),
+                       cpu_processor);
+    }
+  }
+
+  BLI_mutex_unlock(&processor_lock);
+
+  return cpu_processor;
+}
+
 static OCIO_ConstCPUProcessorRcPtr *colorspace_to_scene_linear_cpu_processor(
     ColorSpace *colorspace)
 {
@@ -2838,6 +2893,132 @@ uchar *IMB_display_buffer_acquire_ctx(const bContext *C, ImBuf *ibuf, void **cac
   return IMB_display_buffer_acquire(ibuf, view_settings, display_settings, cache_handle);
 }
 
+struct DisplayTransformApplyThread {
+  ColormanageProcessor *cm_processor;
+
+  uchar *display_buffer;
+  float *float_display_buffer;
+  const float *linear_buffer;
+
+  int width;
+  int tot_line;
+
+  int channels;
+  bool predivide;
+};
+
+struct DisplayTransformApplyInitData {
+  ColormanageProcessor *cm_processor;
+  uchar *display_buffer;
+  float *float_display_buffer;
+  const float *linear_buffer;
+  int width;
+  int channels;
+  bool predivide;
+};
+
+static void display_transform_apply_init_handle(void *handle_v,
+                                                int start_line,
+                                                int tot_line,
+                                                void *init_data_v)
+{
+  DisplayTransformApplyThread *handle = (DisplayTransformApplyThread *)handle_v;
+  DisplayTransformApplyInitData *init_data = (DisplayTransformApplyInitData *)init_data_v;
+
+  const int channels = init_data->channels;
+  const int width = init_data->width;
+
+  const size_t offset = size_t(channels) * start_line * width;
+
+  memset(handle, 0, sizeof(DisplayTransformApplyThread));
+
+  handle->cm_processor = init_data->cm_processor;
+
+  if (init_data->display_buffer != nullptr) {
+    handle->display_buffer = init_data->display_buffer + size_t(4) * start_line * width;
+  }
+  if (init_data->float_display_buffer != nullptr) {
+    handle->float_display_buffer = init_data->float_display_buffer + offset;
+  }
+  handle->linear_buffer = init_data->linear_buffer + offset;
+
+  handle->width = width;
+  handle->tot_line = tot_line;
+
+  handle->channels = channels;
+  handle->predivide = init_data->predivide;
+}
+
+static void *do_display_transform_apply_thread(void *handle_v)
+{
+  DisplayTransformApplyThread *handle = (DisplayTransformApplyThread *)handle_v;
+  const int channels = handle->channels;
+  const int width = handle->width;
+  const int height = handle->tot_line;
+
+  /* Copy the band into a temporary buffer so the linear buffer stays untouched, then apply
+   * the display processor and convert while the band is still cache hot. The processor is
+   * shared between all threads, processor application itself is thread-safe. */
+  const size_t band_size = size_t(channels) * width * height * sizeof(float);
+  float *buffer = static_cast<float *>(MEM_mallocN(band_size, "display transform temp buffer"));
+  memcpy(buffer, handle->linear_buffer, band_size);
+
+  IMB_colormanagement_processor_apply(
+      handle->cm_processor, buffer, width, height, channels, handle->predivide);
+
+  if (handle->display_buffer != nullptr) {
+    IMB_buffer_byte_from_float(handle->display_buffer,
+                               buffer,
+                               channels,
+                               0.0f,
+                               IB_PROFILE_SRGB,
+                               IB_PROFILE_SRGB,
+                               false,
+                               width,
+                               height,
+                               width,
+                               width);
+  }
+  if (handle->float_display_buffer != nullptr) {
+    memcpy(handle->float_display_buffer, buffer, band_size);
+  }
+
+  MEM_freeN(buffer);
+
+  return nullptr;
+}
+
+static void display_transform_apply_threaded(uchar *display_buffer,
+                                             float *float_display_buffer,
+                                             const float *linear_buffer,
+                                             const int width,
+                                             const int height,
+                                             const int channels,
+                                             const ColorManagedViewSettings *view_settings,
+                                             const ColorManagedDisplaySettings *display_settings,
+                                             const bool predivide)
+{
+  ColormanageProcessor *cm_processor = IMB_colormanagement_display_processor_new(view_settings,
+                                                                                 display_settings);
+
+  DisplayTransformApplyInitData init_data;
+  init_data.cm_processor = cm_processor;
+  init_data.display_buffer = display_buffer;
+  init_data.float_display_buffer = float_display_buffer;
+  init_data.linear_buffer = linear_buffer;
+  init_data.width = width;
+  init_data.channels = channels;
+  init_data.predivide = predivide;
+
+  IMB_processor_apply_threaded(height,
+                               sizeof(DisplayTransformApplyThread),
+                               &init_data,
+                               display_transform_apply_init_handle,
+                               do_display_transform_apply_thread);
+
+  IMB_colormanagement_processor_free(cm_processor);
+}
+
 void IMB_display_buffer_transform_apply(uchar *display_buffer,
                                         float *linear_buffer,
                                         int width,
@@ -2847,31 +3028,15 @@ void IMB_display_buffer_transform_apply(uchar *display_buffer,
                                         const ColorManagedDisplaySettings *display_settings,
                                         bool predivide)
 {
-  float *buffer;
-  ColormanageProcessor *cm_processor = IMB_colormanagement_display_processor_new(view_settings,
-                                                                                 display_settings);
-
-  buffer = static_cast<float *>(MEM_mallocN(size_t(channels) * width * height * sizeof(float),
-                                            "display transform temp buffer"));
-  memcpy(buffer, linear_buffer, size_t(channels) * width * height * sizeof(float));
-
-  IMB_colormanagement_processor_apply(cm_processor, buffer, width, height, channels, predivide);
-
-  IMB_colormanagement_processor_free(cm_processor);
-
-  IMB_buffer_byte_from_float(display_buffer,
-                             buffer,
-                             channels,
-                             0.0f,
-                             IB_PROFILE_SRGB,
-                             IB_PROFILE_SRGB,
-                             false,
-                             width,
-                             height,
-                             width,
-                             width);
-
-  MEM_freeN(buffer);
+  display_transform_apply_threaded(display_buffer,
+                                   nullptr,
+                                   linear_buffer,
+                                   width,
+                                   height,
+                                   channels,
+                                   view_settings,
+                                   display_settings,
+                                   predivide);
 }
 
 void IMB_display_buffer_transform_apply_float(float *float_display_buffer,
@@ -2883,20 +3048,15 @@ void IMB_display_buffer_transform_apply_float(float *float_display_buffer,
                                               const ColorManagedDisplaySettings *display_settings,
                                               bool predivide)
 {
-  float *buffer;
-  ColormanageProcessor *cm_processor = IMB_colormanagement_display_processor_new(view_settings,
-                                                                                 display_settings);
-
-  buffer = static_cast<float *>(MEM_mallocN(size_t(channels) * width * height * sizeof(float),
-                                            "display transform temp buffer"));
-  memcpy(buffer, linear_buffer, size_t(channels) * width * height * sizeof(float));
-
-  IMB_colormanagement_processor_apply(cm_processor, buffer, width, height, channels, predivide);
-
-  IMB_colormanagement_processor_free(cm_processor);
-
-  memcpy(float_display_buffer, buffer, size_t(channels) * width * height * sizeof(float));
-  MEM_freeN(buffer);
+  display_transform_apply_threaded(nullptr,
+                                   float_display_buffer,
+                                   linear_buffer,
+                                   width,
+                                   height,
+                                   channels,
+                                   view_settings,
+                                   display_settings,
+                                   predivide);
 }
 
 void IMB_display_buffer_release(void *cache_handle)
@@ -3934,6 +4094,7 @@ ColormanageProcessor *IMB_colormanagement_display_processor_new(
     cm_processor->is_data_result = display_space->is_data;
   }
 
+  cm_processor->owns_cpu_processor = true;
   cm_processor->cpu_processor = create_display_buffer_processor(
       applied_view_settings->look,
       applied_view_settings->view_transform,
@@ -3961,12 +4122,22 @@ ColormanageProcessor *IMB_colormanagement_colorspace_processor_new(const char *f
   color_space = colormanage_colorspace_get_named(to_colorspace);
   cm_processor->is_data_result = color_space->is_data;
 
-  OCIO_ConstProcessorRcPtr *processor = create_colorspace_transform_processor(from_colorspace,
-                                                                              to_colorspace);
-  if (processor != nullptr) {
-    cm_processor->cpu_processor = OCIO_processorGetCPUProcessor(processor);
+  ColorSpace *from_color_space = colormanage_colorspace_get_named(from_colorspace);
+  if (from_color_space != nullptr) {
+    /* The CPU processor is borrowed from the global pair cache, so repeated
+     * conversions between the same spaces don't rebuild it. */
+    cm_processor->cpu_processor = colorspace_to_colorspace_cpu_processor(from_color_space,
+                                                                         color_space);
+  }
+  else {
+    OCIO_ConstProcessorRcPtr *processor = create_colorspace_transform_processor(from_colorspace,
+                                                                                to_colorspace);
+    if (processor != nullptr) {
+      cm_processor->cpu_processor = OCIO_processorGetCPUProcessor(processor);
+      cm_processor->owns_cpu_processor = true;
+    }
+    OCIO_processorRelease(processor);
   }
-  OCIO_processorRelease(processor);
 
   return cm_processor;
 }
@@ -4117,7 +4288,7 @@ void IMB_colormanagement_processor_free(ColormanageProcessor *cm_processor)
   if (cm_processor->curve_mapping) {
     BKE_curvemapping_free(cm_processor->curve_mapping);
   }
-  if (cm_processor->cpu_processor) {
+  if (cm_processor->cpu_processor && cm_processor->owns_cpu_processor) {
     OCIO_cpuProcessorRelease(cm_processor->cpu_processor);
   }
 
@@ -19,6 +19,7 @@
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
@@ -965,9 +966,12 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *c
   uint64_t s_dts = context->seek_pos_dts;
   uint64_t pts = av_get_pts_from_frame(in_frame);
 
-  for (i = 0; i < context->num_proxy_sizes; i++) {
-    add_to_proxy_output_ffmpeg(context->proxy_ctx[i], in_frame);
-  }
+  /* The proxy outputs are fully independent of each other: each has its own
+   * scaling context, encoder and muxer. Scaling and encoding a frame is costly
+   * enough to be worth a task per proxy size. */
+  blender::threading::parallel_for_each(
+      blender::Span(context->proxy_ctx, context->num_proxy_sizes),
+      [&](proxy_output_ctx *proxy_ctx) { add_to_proxy_output_ffmpeg(proxy_ctx, in_frame); });
 
   if (!context->start_pts_set) {
     context->start_pts = pts;
@@ -79,7 +79,9 @@
 #include "BLI_fileops.h"
 #include "BLI_math_color.h"
 #include "BLI_mmap.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "BKE_idprop.hh"
 #include "BKE_image.h"
@@ -1270,6 +1272,15 @@ void IMB_exr_read_channels(void *handle)
       "name",
       "internal_name");
 
+  /* A part with its frame-buffer set, ready for reading its pixels. */
+  struct PartToRead {
+    InputPart input_part;
+    int min_y, max_y;
+  };
+  blender::Vector<PartToRead> parts_to_read;
+
+  /* Set up a frame-buffer for every part that has destination memory. Part setup has to
+   * happen from a single thread, only reading the pixels is thread-safe across parts. */
   for (int i = 0; i < numparts; i++) {
     /* Read part header. */
     InputPart in(*data->ifile, i);
@@ -1312,21 +1323,47 @@ void IMB_exr_read_channels(void *handle)
       }
     }
 
-    /* Read pixels. */
+    if (frameBuffer.begin() == frameBuffer.end()) {
+      /* No channel of this part has destination memory, don't decode it at all. */
+      continue;
+    }
+
     try {
       in.setFrameBuffer(frameBuffer);
-      exr_printf("readPixels:readPixels[%d]: min.y: %d, max.y: %d\n", i, dw.min.y, dw.max.y);
-      in.readPixels(dw.min.y, dw.max.y);
+      parts_to_read.append({in, dw.min.y, dw.max.y});
     }
     catch (const std::exception &exc) {
-      std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
+      std::cerr << "OpenEXR-setFrameBuffer: ERROR: " << exc.what() << std::endl;
       break;
     }
     catch (...) { /* Catch-all for edge cases or compiler bugs. */
-      std::cerr << "OpenEXR-readPixels: UNKNOWN ERROR: " << std::endl;
+      std::cerr << "OpenEXR-setFrameBuffer: UNKNOWN ERROR: " << std::endl;
       break;
     }
   }
+
+  /* Read pixels of all parts in parallel. The multi-part input file serializes the raw
+   * chunk reads internally while decompression runs concurrently, so multi-layer files
+   * with many parts decode on all cores instead of one part at a time. */
+  blender::threading::parallel_for(
+      parts_to_read.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          PartToRead &part = parts_to_read[i];
+          try {
+            exr_printf("readPixels:readPixels[%d]: min.y: %d, max.y: %d\n",
+                       int(i),
+                       part.min_y,
+                       part.max_y);
+            part.input_part.readPixels(part.min_y, part.max_y);
+          }
+          catch (const std::exception &exc) {
+            std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
+          }
+          catch (...) { /* Catch-all for edge cases or compiler bugs. */
+            std::cerr << "OpenEXR-readPixels: UNKNOWN ERROR: " << std::endl;
+          }
+        }
+      });
 }
 
 void IMB_exr_multilayer_convert(void *handle,
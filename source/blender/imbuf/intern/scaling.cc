@@ -8,6 +8,7 @@
 
 #include <cmath>
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -752,17 +753,9 @@ static ImBuf *scaledownx(ImBuf *ibuf, int newx)
 {
   const bool do_rect = (ibuf->byte_buffer.data != nullptr);
   const bool do_float = (ibuf->float_buffer.data != nullptr);
-  const size_t rect_size = IMB_get_rect_len(ibuf) * 4;
 
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y;
-
-  rectf = _newrectf = newrectf = nullptr;
-  rect = _newrect = newrect = nullptr;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = nullptr;
+  float *_newrectf = nullptr;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -785,108 +778,115 @@ static ImBuf *scaledownx(ImBuf *ibuf, int newx)
     }
   }
 
-  add = (ibuf->x - 0.01) / newx;
-
-  if (do_rect) {
-    rect = ibuf->byte_buffer.data;
-    newrect = _newrect;
-  }
-  if (do_float) {
-    rectf = ibuf->float_buffer.data;
-    newrectf = _newrectf;
-  }
-
-  for (y = ibuf->y; y > 0; y--) {
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+  const float add = (ibuf->x - 0.01) / newx;
 
-    for (x = newx; x > 0; x--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+  /* Every destination row only reads from its own source row, so the rows
+   * can be filtered independently of each other. */
+  blender::threading::parallel_for(
+      blender::IndexRange(ibuf->y), 16, [&](const blender::IndexRange y_range) {
+        for (const int y : y_range) {
+          uchar *rect = nullptr, *newrect = nullptr;
+          float *rectf = nullptr, *newrectf = nullptr;
+          float sample, val[4], nval[4], valf[4], nvalf[4];
 
-      sample += add;
+          if (do_rect) {
+            rect = ibuf->byte_buffer.data + size_t(y) * 4 * ibuf->x;
+            newrect = _newrect + size_t(y) * 4 * newx;
+          }
+          if (do_float) {
+            rectf = ibuf->float_buffer.data + size_t(y) * 4 * ibuf->x;
+            newrectf = _newrectf + size_t(y) * 4 * newx;
+          }
 
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
+          sample = 0.0f;
+          val[0] = val[1] = val[2] = val[3] = 0.0f;
+          valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+
+          for (int x = newx; x > 0; x--) {
+            if (do_rect) {
+              nval[0] = -val[0] * sample;
+              nval[1] = -val[1] * sample;
+              nval[2] = -val[2] * sample;
+              nval[3] = -val[3] * sample;
+            }
+            if (do_float) {
+              nvalf[0] = -valf[0] * sample;
+              nvalf[1] = -valf[1] * sample;
+              nvalf[2] = -valf[2] * sample;
+              nvalf[3] = -valf[3] * sample;
+            }
+
+            sample += add;
+
+            while (sample >= 1.0f) {
+              sample -= 1.0f;
+
+              if (do_rect) {
+                nval[0] += rect[0];
+                nval[1] += rect[1];
+                nval[2] += rect[2];
+                nval[3] += rect[3];
+                rect += 4;
+              }
+              if (do_float) {
+                nvalf[0] += rectf[0];
+                nvalf[1] += rectf[1];
+                nvalf[2] += rectf[2];
+                nvalf[3] += rectf[3];
+                rectf += 4;
+              }
+            }
+
+            if (do_rect) {
+              val[0] = rect[0];
+              val[1] = rect[1];
+              val[2] = rect[2];
+              val[3] = rect[3];
+              rect += 4;
+
+              newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+              newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+              newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+              newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+
+              newrect += 4;
+            }
+            if (do_float) {
+
+              valf[0] = rectf[0];
+              valf[1] = rectf[1];
+              valf[2] = rectf[2];
+              valf[3] = rectf[3];
+              rectf += 4;
+
+              newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+              newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+              newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+              newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+
+              newrectf += 4;
+            }
+
+            sample -= 1.0f;
+          }
 
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += 4;
+          /* The whole source row must have been consumed, see bug #26502. */
+          BLI_assert(rect == nullptr ||
+                     rect == ibuf->byte_buffer.data + size_t(y + 1) * 4 * ibuf->x);
+          BLI_assert(rectf == nullptr ||
+                     rectf == ibuf->float_buffer.data + size_t(y + 1) * 4 * ibuf->x);
         }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += 4;
-        }
-      }
-
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += 4;
-
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
-
-        newrect += 4;
-      }
-      if (do_float) {
-
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += 4;
-
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
-
-        newrectf += 4;
-      }
-
-      sample -= 1.0f;
-    }
-  }
+      });
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ibuf->byte_buffer.data, rect_size);
-    BLI_assert((uchar *)rect - ibuf->byte_buffer.data == rect_size); /* see bug #26502. */
-
     imb_freerectImBuf(ibuf);
     IMB_assign_byte_buffer(ibuf, _newrect, IB_TAKE_OWNERSHIP);
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->float_buffer.data, rect_size);
-    BLI_assert((rectf - ibuf->float_buffer.data) == rect_size); /* see bug #26502. */
-
     imb_freerectfloatImBuf(ibuf);
     IMB_assign_float_buffer(ibuf, _newrectf, IB_TAKE_OWNERSHIP);
   }
 
-  (void)rect_size; /* UNUSED in release builds */
-
   ibuf->x = newx;
   return ibuf;
 }
@@ -895,17 +895,9 @@ static ImBuf *scaledowny(ImBuf *ibuf, int newy)
 {
   const bool do_rect = (ibuf->byte_buffer.data != nullptr);
   const bool do_float = (ibuf->float_buffer.data != nullptr);
-  const size_t rect_size = IMB_get_rect_len(ibuf) * 4;
-
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y, skipx;
 
-  rectf = _newrectf = newrectf = nullptr;
-  rect = _newrect = newrect = nullptr;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = nullptr;
+  float *_newrectf = nullptr;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -928,109 +920,118 @@ static ImBuf *scaledowny(ImBuf *ibuf, int newy)
     }
   }
 
-  add = (ibuf->y - 0.01) / newy;
-  skipx = 4 * ibuf->x;
-
-  for (x = skipx - 4; x >= 0; x -= 4) {
-    if (do_rect) {
-      rect = ibuf->byte_buffer.data + x;
-      newrect = _newrect + x;
-    }
-    if (do_float) {
-      rectf = ibuf->float_buffer.data + x;
-      newrectf = _newrectf + x;
-    }
+  const float add = (ibuf->y - 0.01) / newy;
+  const int skipx = 4 * ibuf->x;
 
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+  /* Every destination column only reads from its own source column, so the
+   * columns can be filtered independently of each other. */
+  blender::threading::parallel_for(
+      blender::IndexRange(ibuf->x), 64, [&](const blender::IndexRange x_range) {
+        for (const int column : x_range) {
+          const int x = 4 * column;
 
-    for (y = newy; y > 0; y--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+          uchar *rect = nullptr, *newrect = nullptr;
+          float *rectf = nullptr, *newrectf = nullptr;
+          float sample, val[4], nval[4], valf[4], nvalf[4];
 
-      sample += add;
+          if (do_rect) {
+            rect = ibuf->byte_buffer.data + x;
+            newrect = _newrect + x;
+          }
+          if (do_float) {
+            rectf = ibuf->float_buffer.data + x;
+            newrectf = _newrectf + x;
+          }
 
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
+          sample = 0.0f;
+          val[0] = val[1] = val[2] = val[3] = 0.0f;
+          valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+
+          for (int y = newy; y > 0; y--) {
+            if (do_rect) {
+              nval[0] = -val[0] * sample;
+              nval[1] = -val[1] * sample;
+              nval[2] = -val[2] * sample;
+              nval[3] = -val[3] * sample;
+            }
+            if (do_float) {
+              nvalf[0] = -valf[0] * sample;
+              nvalf[1] = -valf[1] * sample;
+              nvalf[2] = -valf[2] * sample;
+              nvalf[3] = -valf[3] * sample;
+            }
+
+            sample += add;
+
+            while (sample >= 1.0f) {
+              sample -= 1.0f;
+
+              if (do_rect) {
+                nval[0] += rect[0];
+                nval[1] += rect[1];
+                nval[2] += rect[2];
+                nval[3] += rect[3];
+                rect += skipx;
+              }
+              if (do_float) {
+                nvalf[0] += rectf[0];
+                nvalf[1] += rectf[1];
+                nvalf[2] += rectf[2];
+                nvalf[3] += rectf[3];
+                rectf += skipx;
+              }
+            }
+
+            if (do_rect) {
+              val[0] = rect[0];
+              val[1] = rect[1];
+              val[2] = rect[2];
+              val[3] = rect[3];
+              rect += skipx;
+
+              newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+              newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+              newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+              newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+
+              newrect += skipx;
+            }
+            if (do_float) {
+
+              valf[0] = rectf[0];
+              valf[1] = rectf[1];
+              valf[2] = rectf[2];
+              valf[3] = rectf[3];
+              rectf += skipx;
+
+              newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+              newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+              newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+              newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+
+              newrectf += skipx;
+            }
+
+            sample -= 1.0f;
+          }
 
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += skipx;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += skipx;
+          /* The whole source column must have been consumed, see bug #26502. */
+          BLI_assert(rect == nullptr ||
+                     rect == ibuf->byte_buffer.data + x + size_t(ibuf->y) * skipx);
+          BLI_assert(rectf == nullptr ||
+                     rectf == ibuf->float_buffer.data + x + size_t(ibuf->y) * skipx);
         }
-      }
-
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += skipx;
-
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
-
-        newrect += skipx;
-      }
-      if (do_float) {
-
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += skipx;
-
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
-
-        newrectf += skipx;
-      }
-
-      sample -= 1.0f;
-    }
-  }
+      });
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - byte_buffer.data, rect_size);
-    BLI_assert((uchar *)rect - ibuf->byte_buffer.data == rect_size); /* see bug #26502. */
-
     imb_freerectImBuf(ibuf);
     IMB_assign_byte_buffer(ibuf, _newrect, IB_TAKE_OWNERSHIP);
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->float_buffer.data, rect_size);
-    BLI_assert((rectf - ibuf->float_buffer.data) == rect_size); /* see bug #26502. */
-
     imb_freerectfloatImBuf(ibuf);
     IMB_assign_float_buffer(ibuf, _newrectf, IB_TAKE_OWNERSHIP);
   }
 
-  (void)rect_size; /* UNUSED in release builds */
-
   ibuf->y = newy;
   return ibuf;
 }
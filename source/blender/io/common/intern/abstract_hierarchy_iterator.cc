@@ -286,27 +286,26 @@ void AbstractHierarchyIterator::export_graph_construct()
     }
 
     /* Export the duplicated objects instanced by this object. */
-    ListBase *lb = object_duplilist(depsgraph_, scene, object);
-    if (lb) {
+    DupliList duplilist;
+    object_duplilist(depsgraph_, scene, object, duplilist);
+    if (!duplilist.is_empty()) {
       DupliParentFinder dupli_parent_finder;
 
-      LISTBASE_FOREACH (DupliObject *, dupli_object, lb) {
-        PersistentID persistent_id(dupli_object);
-        if (!should_visit_dupli_object(dupli_object)) {
+      for (const DupliObject &dupli_object : duplilist) {
+        PersistentID persistent_id(&dupli_object);
+        if (!should_visit_dupli_object(&dupli_object)) {
           continue;
         }
-        dupli_parent_finder.insert(dupli_object);
+        dupli_parent_finder.insert(&dupli_object);
       }
 
-      LISTBASE_FOREACH (DupliObject *, dupli_object, lb) {
-        if (!should_visit_dupli_object(dupli_object)) {
+      for (DupliObject &dupli_object : duplilist) {
+        if (!should_visit_dupli_object(&dupli_object)) {
           continue;
         }
-        visit_dupli_object(dupli_object, object, dupli_parent_finder);
+        visit_dupli_object(&dupli_object, object, dupli_parent_finder);
       }
     }
-
-    free_object_duplilist(lb);
   }
   DEG_OBJECT_ITER_END;
 }
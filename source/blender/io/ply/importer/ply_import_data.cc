@@ -15,6 +15,7 @@
 
 #include "fast_float.h"
 
+#include <algorithm>
 #include <charconv>
 
 static bool is_whitespace(char c)
@@ -287,40 +288,22 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     color_norm.w = data_type_normalizer[element.properties[alpha_index].type];
   }
 
-  Vector<float> value_vec(element.properties.size());
-  Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
-
-  for (int i = 0; i < element.count; i++) {
-
-    const char *error = nullptr;
-    if (header.type == PlyFormatType::ASCII) {
-      error = parse_row_ascii(file, value_vec);
-    }
-    else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
-    }
-    if (error != nullptr) {
-      return error;
-    }
-
+  auto scatter_row = [&](const Span<float> values, const int i) {
     /* Vertex coord */
     float3 vertex3;
-    vertex3.x = value_vec[vertex_index.x];
-    vertex3.y = value_vec[vertex_index.y];
-    vertex3.z = value_vec[vertex_index.z];
+    vertex3.x = values[vertex_index.x];
+    vertex3.y = values[vertex_index.y];
+    vertex3.z = values[vertex_index.z];
     data->vertices.append(vertex3);
 
     /* Vertex color */
     if (has_color) {
       float4 colors4;
-      colors4.x = value_vec[color_index.x] / color_norm.x;
-      colors4.y = value_vec[color_index.y] / color_norm.y;
-      colors4.z = value_vec[color_index.z] / color_norm.z;
+      colors4.x = values[color_index.x] / color_norm.x;
+      colors4.y = values[color_index.y] / color_norm.y;
+      colors4.z = values[color_index.z] / color_norm.z;
       if (has_alpha) {
-        colors4.w = value_vec[alpha_index] / color_norm.w;
+        colors4.w = values[alpha_index] / color_norm.w;
       }
       else {
         colors4.w = 1.0f;
@@ -331,25 +314,111 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     /* If normals */
     if (has_normal) {
       float3 normals3;
-      normals3.x = value_vec[normal_index.x];
-      normals3.y = value_vec[normal_index.y];
-      normals3.z = value_vec[normal_index.z];
+      normals3.x = values[normal_index.x];
+      normals3.y = values[normal_index.y];
+      normals3.z = values[normal_index.z];
       data->vertex_normals.append(normals3);
     }
 
     /* If uv */
     if (has_uv) {
       float2 uvmap;
-      uvmap.x = value_vec[uv_index.x];
-      uvmap.y = value_vec[uv_index.y];
+      uvmap.x = values[uv_index.x];
+      uvmap.y = values[uv_index.y];
       data->uv_coordinates.append(uvmap);
     }
 
     /* Custom attributes */
     for (const int64_t ci : custom_attr_indices.index_range()) {
-      float value = value_vec[custom_attr_indices[ci]];
+      float value = values[custom_attr_indices[ci]];
       data->vertex_custom_attr[ci].data[i] = value;
     }
+  };
+
+  const int64_t properties_num = element.properties.size();
+
+  if (header.type == PlyFormatType::ASCII) {
+    Vector<float> value_vec(properties_num);
+    for (int i = 0; i < element.count; i++) {
+      const char *error = parse_row_ascii(file, value_vec);
+      if (error != nullptr) {
+        return error;
+      }
+      scatter_row(value_vec, i);
+    }
+    return nullptr;
+  }
+
+  if (element.stride == 0) {
+    return "Vertex element contains list properties, this is not supported";
+  }
+
+  const bool big_endian = header.type == PlyFormatType::BINARY_BE;
+  const bool all_floats = std::all_of(
+      element.properties.begin(), element.properties.end(), [](const PlyProperty &prop) {
+        return prop.type == PlyDataTypes::FLOAT;
+      });
+
+  /* Byte offset of each property within a row, for endian switching below. */
+  Vector<int> property_offsets(properties_num);
+  int offset = 0;
+  for (const int64_t prop_idx : element.properties.index_range()) {
+    property_offsets[prop_idx] = offset;
+    offset += data_type_size[element.properties[prop_idx].type];
+  }
+
+  /* The vertex element has a fixed stride, so decode whole blocks of rows at a time instead of
+   * issuing a buffered read per row; for large scan data the reads then stay memory bandwidth
+   * bound. */
+  const int chunk_rows = std::max(1, int(64 * 1024 / element.stride));
+  Array<uint8_t> chunk(int64_t(chunk_rows) * element.stride);
+  Vector<float> value_vec(properties_num);
+
+  for (int row_start = 0; row_start < element.count; row_start += chunk_rows) {
+    const int rows = std::min(chunk_rows, element.count - row_start);
+    if (!file.read_bytes(chunk.data(), size_t(rows) * element.stride)) {
+      return "Could not read row of binary property";
+    }
+
+    if (big_endian) {
+      /* Switch the whole block in one pass when all properties have the same size. */
+      const int type_size = data_type_size[element.properties[0].type];
+      if (element.stride == properties_num * type_size) {
+        endian_switch_array(chunk.data(), type_size, rows * int(properties_num));
+      }
+      else {
+        for (int r = 0; r < rows; r++) {
+          uint8_t *row = chunk.data() + int64_t(r) * element.stride;
+          for (const int64_t prop_idx : element.properties.index_range()) {
+            endian_switch(row + property_offsets[prop_idx],
+                          data_type_size[element.properties[prop_idx].type]);
+          }
+        }
+      }
+    }
+
+    if (all_floats) {
+      /* The rows are now native endian float arrays; a pure position element can be copied into
+       * the vertex array wholesale, anything else is scattered without per-value decoding. */
+      if (properties_num == 3 && vertex_index == int3(0, 1, 2)) {
+        data->vertices.extend(Span<float3>(reinterpret_cast<const float3 *>(chunk.data()), rows));
+        continue;
+      }
+      for (int r = 0; r < rows; r++) {
+        const float *row = reinterpret_cast<const float *>(chunk.data() +
+                                                           int64_t(r) * element.stride);
+        scatter_row(Span<float>(row, properties_num), row_start + r);
+      }
+      continue;
+    }
+
+    for (int r = 0; r < rows; r++) {
+      const uint8_t *ptr = chunk.data() + int64_t(r) * element.stride;
+      for (const int64_t prop_idx : element.properties.index_range()) {
+        value_vec[prop_idx] = get_binary_value<float>(element.properties[prop_idx].type, ptr);
+      }
+      scatter_row(value_vec, row_start + r);
+    }
   }
   return nullptr;
 }
@@ -135,44 +135,59 @@ void copy_primvar_to_blender_attribute(const pxr::UsdGeomPrimvar &primvar,
   attribute.finish();
 }
 
-void copy_blender_attribute_to_primvar(const GVArray &attribute,
-                                       const eCustomDataType data_type,
-                                       const pxr::UsdTimeCode timecode,
-                                       const pxr::UsdGeomPrimvar &primvar,
-                                       pxr::UsdUtilsSparseValueWriter &value_writer)
+std::optional<pxr::VtValue> convert_blender_attribute_to_value(const GVArray &attribute,
+                                                               const eCustomDataType data_type)
 {
   switch (data_type) {
     case CD_PROP_FLOAT:
-      copy_blender_buffer_to_primvar<float, float>(
-          attribute.typed<float>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<float, float>(attribute.typed<float>());
     case CD_PROP_INT8:
-      copy_blender_buffer_to_primvar<int8_t, int32_t>(
-          attribute.typed<int8_t>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<int8_t, int32_t>(attribute.typed<int8_t>());
     case CD_PROP_INT32:
-      copy_blender_buffer_to_primvar<int, int32_t>(
-          attribute.typed<int>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<int, int32_t>(attribute.typed<int>());
     case CD_PROP_FLOAT2:
-      copy_blender_buffer_to_primvar<float2, pxr::GfVec2f>(
-          attribute.typed<float2>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<float2, pxr::GfVec2f>(attribute.typed<float2>());
     case CD_PROP_FLOAT3:
-      copy_blender_buffer_to_primvar<float3, pxr::GfVec3f>(
-          attribute.typed<float3>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<float3, pxr::GfVec3f>(attribute.typed<float3>());
     case CD_PROP_BOOL:
-      copy_blender_buffer_to_primvar<bool, bool>(
-          attribute.typed<bool>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<bool, bool>(attribute.typed<bool>());
     case CD_PROP_QUATERNION:
-      copy_blender_buffer_to_primvar<math::Quaternion, pxr::GfQuatf>(
-          attribute.typed<math::Quaternion>(), timecode, primvar, value_writer);
-      break;
+      return convert_blender_buffer_to_value<math::Quaternion, pxr::GfQuatf>(
+          attribute.typed<math::Quaternion>());
     default:
       BLI_assert_unreachable();
+      return std::nullopt;
   }
 }
 
+void set_primvar_value(const pxr::VtValue &value,
+                       const pxr::UsdTimeCode timecode,
+                       const pxr::UsdGeomPrimvar &primvar,
+                       pxr::UsdUtilsSparseValueWriter &value_writer)
+{
+  if (!primvar.HasValue() && timecode != pxr::UsdTimeCode::Default()) {
+    primvar.Set(value, pxr::UsdTimeCode::Default());
+  }
+  else {
+    primvar.Set(value, timecode);
+  }
+
+  value_writer.SetAttribute(primvar.GetAttr(), value, timecode);
+}
+
+void copy_blender_attribute_to_primvar(const GVArray &attribute,
+                                       const eCustomDataType data_type,
+                                       const pxr::UsdTimeCode timecode,
+                                       const pxr::UsdGeomPrimvar &primvar,
+                                       pxr::UsdUtilsSparseValueWriter &value_writer)
+{
+  const std::optional<pxr::VtValue> value = convert_blender_attribute_to_value(attribute,
+                                                                               data_type);
+  if (!value) {
+    return;
+  }
+
+  set_primvar_value(*value, timecode, primvar, value_writer);
+}
+
 }  // namespace blender::io::usd
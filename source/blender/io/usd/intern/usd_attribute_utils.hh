@@ -5,6 +5,7 @@
 
 #include "BLI_color.hh"
 #include "BLI_generic_virtual_array.hh"
+#include "BLI_implicit_sharing.hh"
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_span.hh"
@@ -14,6 +15,8 @@
 
 #include "DNA_customdata_types.h"
 
+#include "MEM_guardedalloc.h"
+
 #include <pxr/base/gf/quatf.h>
 #include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
@@ -87,17 +90,52 @@ template<> inline math::Quaternion convert_value(const pxr::GfQuatf value)
 
 }  // namespace detail
 
+/**
+ * Wraps a #pxr::VtArray as foreign data behind an #ImplicitSharingInfo, so a sample array whose
+ * memory layout matches the Blender attribute type can be attached to attribute storage directly
+ * instead of being copied element by element. The wrapper owns a uniquely held copy of the
+ * (reference counted) USD array, which keeps the sample's buffer alive for as long as the
+ * attribute layer has users, independent of the cache reader that produced it.
+ *
+ * The caller owns one user of the newly constructed sharing info and has to release it with
+ * #ImplicitSharingInfo::remove_user_and_delete_if_last once the attribute layer holds its own.
+ */
+template<typename T> class VtArraySharingInfo : public ImplicitSharingInfo {
+ private:
+  pxr::VtArray<T> array_;
+
+ public:
+  VtArraySharingInfo(pxr::VtArray<T> array) : array_(std::move(array))
+  {
+    /* Once the attribute layer is the sole user of this sharing info, #is_mutable() lets
+     * Blender write through the attached pointer in place (see #ensure_layer_data_is_mutable),
+     * which bypasses VtArray's own copy-on-write. Detach so the wrapped array uniquely owns its
+     * storage: a no-op when it already does, a single buffer copy when the sample is still
+     * shared with the reader or backed by zero-copy file storage. */
+    array_.data();
+  }
+
+  const void *data() const
+  {
+    return array_.cdata();
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    MEM_delete(this);
+  }
+};
+
 std::optional<pxr::SdfValueTypeName> convert_blender_type_to_usd(
     const eCustomDataType blender_type);
 
 std::optional<eCustomDataType> convert_usd_type_to_blender(const pxr::SdfValueTypeName usd_type);
 
-/* Copy a typed Blender attribute array into a typed USD primvar attribute. */
+/* Convert a typed Blender attribute array into a typed USD array value. Pure conversion without
+ * any stage access, so this is safe to run on worker threads. */
 template<typename BlenderT, typename USDT>
-void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
-                                    const pxr::UsdTimeCode timecode,
-                                    const pxr::UsdGeomPrimvar &primvar,
-                                    pxr::UsdUtilsSparseValueWriter &value_writer)
+pxr::VtValue convert_blender_buffer_to_value(const VArray<BlenderT> &buffer)
 {
   constexpr bool is_same = std::is_same_v<BlenderT, USDT>;
   constexpr bool is_compatible = detail::is_layout_compatible<BlenderT, USDT>::value;
@@ -119,14 +157,30 @@ void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
     }
   }
 
-  if (!primvar.HasValue() && timecode != pxr::UsdTimeCode::Default()) {
-    primvar.Set(usd_data, pxr::UsdTimeCode::Default());
-  }
-  else {
-    primvar.Set(usd_data, timecode);
-  }
+  return pxr::VtValue::Take(usd_data);
+}
+
+/* Convert a generic Blender attribute array into a USD array value, or return nothing for types
+ * without a USD equivalent. Safe to run on worker threads. */
+std::optional<pxr::VtValue> convert_blender_attribute_to_value(const GVArray &attribute,
+                                                               eCustomDataType data_type);
+
+/* Commit a converted array value to the given primvar. Authors the stage, so this must run on
+ * the thread that owns it. */
+void set_primvar_value(const pxr::VtValue &value,
+                       pxr::UsdTimeCode timecode,
+                       const pxr::UsdGeomPrimvar &primvar,
+                       pxr::UsdUtilsSparseValueWriter &value_writer);
 
-  value_writer.SetAttribute(primvar.GetAttr(), usd_data, timecode);
+/* Copy a typed Blender attribute array into a typed USD primvar attribute. */
+template<typename BlenderT, typename USDT>
+void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
+                                    const pxr::UsdTimeCode timecode,
+                                    const pxr::UsdGeomPrimvar &primvar,
+                                    pxr::UsdUtilsSparseValueWriter &value_writer)
+{
+  const pxr::VtValue usd_data = convert_blender_buffer_to_value<BlenderT, USDT>(buffer);
+  set_primvar_value(usd_data, timecode, primvar, value_writer);
 }
 
 void copy_blender_attribute_to_primvar(const GVArray &attribute,
@@ -447,6 +447,20 @@ void USDMeshReader::read_velocities(Mesh *mesh, const double motionSampleTime)
 
   if (!velocities.empty()) {
     bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
+    if (velocities.size() == mesh->verts_num) {
+      /* Share the sample's buffer with the mesh instead of copying the values. */
+      static_assert(detail::is_layout_compatible<float3, pxr::GfVec3f>::value);
+      auto *sharing_info = MEM_new<VtArraySharingInfo<pxr::GfVec3f>>(__func__,
+                                                                     std::move(velocities));
+      attributes.remove("velocity");
+      attributes.add("velocity",
+                     bke::AttrDomain::Point,
+                     CD_PROP_FLOAT3,
+                     bke::AttributeInitShared(sharing_info->data(), *sharing_info));
+      sharing_info->remove_user_and_delete_if_last();
+      return;
+    }
+
     bke::GSpanAttributeWriter attribute = attributes.lookup_or_add_for_write_span(
         "velocity", bke::AttrDomain::Point, CD_PROP_FLOAT3);
 
@@ -557,9 +571,26 @@ void USDMeshReader::read_mesh_sample(ImportSettings *settings,
    * in code that expect this data to be there. */
 
   if (new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_VERT) != 0) {
-    MutableSpan<float3> vert_positions = mesh->vert_positions_for_write();
-    for (int i = 0; i < positions_.size(); i++) {
-      vert_positions[i] = {positions_[i][0], positions_[i][1], positions_[i][2]};
+    if (positions_.size() == mesh->verts_num) {
+      /* Positions are read verbatim (any axis conversion is applied on the object transform), so
+       * the sample's buffer can be shared with the mesh instead of copied. This avoids a full
+       * copy per frame per attribute when streaming cached animations. */
+      static_assert(detail::is_layout_compatible<float3, pxr::GfVec3f>::value);
+      auto *sharing_info = MEM_new<VtArraySharingInfo<pxr::GfVec3f>>(__func__, positions_);
+      CustomData_free_layer_named(&mesh->vert_data, "position", mesh->verts_num);
+      CustomData_add_layer_named_with_data(&mesh->vert_data,
+                                           CD_PROP_FLOAT3,
+                                           const_cast<void *>(sharing_info->data()),
+                                           mesh->verts_num,
+                                           "position",
+                                           sharing_info);
+      sharing_info->remove_user_and_delete_if_last();
+    }
+    else {
+      MutableSpan<float3> vert_positions = mesh->vert_positions_for_write();
+      for (int i = 0; i < positions_.size(); i++) {
+        vert_positions[i] = {positions_[i][0], positions_[i][1], positions_[i][2]};
+      }
     }
     mesh->tag_positions_changed();
 
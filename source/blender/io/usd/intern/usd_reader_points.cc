@@ -5,6 +5,7 @@
 #include "usd_reader_points.hh"
 #include "usd_attribute_utils.hh"
 
+#include "BKE_customdata.hh"
 #include "BKE_geometry_set.hh"
 #include "BKE_object.hh"
 #include "BKE_pointcloud.hh"
@@ -94,10 +95,20 @@ void USDPointsReader::read_geometry(bke::GeometrySet &geometry_set,
     point_cloud = BKE_pointcloud_new_nomain(usd_positions.size());
   }
 
-  /* Update point positions and radii */
-  static_assert(sizeof(pxr::GfVec3f) == sizeof(float3));
-  MutableSpan<float3> positions = point_cloud->positions_for_write();
-  positions.copy_from(Span(usd_positions.data(), usd_positions.size()).cast<float3>());
+  /* Update point positions; the sample's buffer is shared with the point cloud instead of
+   * copied, since positions are read verbatim. */
+  static_assert(detail::is_layout_compatible<float3, pxr::GfVec3f>::value);
+  auto *sharing_info = MEM_new<VtArraySharingInfo<pxr::GfVec3f>>(__func__,
+                                                                 std::move(usd_positions));
+  CustomData_free_layer_named(&point_cloud->pdata, "position", point_cloud->totpoint);
+  CustomData_add_layer_named_with_data(&point_cloud->pdata,
+                                       CD_PROP_FLOAT3,
+                                       const_cast<void *>(sharing_info->data()),
+                                       point_cloud->totpoint,
+                                       "position",
+                                       sharing_info);
+  sharing_info->remove_user_and_delete_if_last();
+  point_cloud->tag_positions_changed();
 
   pxr::VtFloatArray usd_widths;
   points_prim_.GetWidthsAttr().Get(&usd_widths, params.motion_sample_time);
@@ -18,6 +18,8 @@
 #include "BLI_assert.h"
 #include "BLI_color.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -146,18 +148,42 @@ void USDGenericMeshWriter::do_write(HierarchyContext &context)
   }
 }
 
+static const std::optional<pxr::TfToken> convert_blender_domain_to_usd(
+    const bke::AttrDomain blender_domain)
+{
+  switch (blender_domain) {
+    case bke::AttrDomain::Corner:
+      return pxr::UsdGeomTokens->faceVarying;
+    case bke::AttrDomain::Point:
+      return pxr::UsdGeomTokens->vertex;
+    case bke::AttrDomain::Face:
+      return pxr::UsdGeomTokens->uniform;
+
+    /* Notice: Edge types are not supported in USD! */
+    default:
+      return std::nullopt;
+  }
+}
+
+/* A primvar to be written for a mesh attribute. The primvar is described and its value converted
+ * before any stage access happens, so that the conversion (the bulk of the work) can run on
+ * multiple threads while primvar creation and value commits stay serialized. */
+struct MeshPrimvarSpec {
+  pxr::TfToken name;
+  pxr::SdfValueTypeName type;
+  pxr::TfToken interpolation;
+  eCustomDataType data_type;
+  GVArray attribute;
+  pxr::VtValue value;
+};
+
 void USDGenericMeshWriter::write_custom_data(const Object *obj,
                                              const Mesh *mesh,
                                              pxr::UsdGeomMesh usd_mesh)
 {
   const bke::AttributeAccessor attributes = mesh->attributes();
 
-  char *active_set_name = nullptr;
-  const int active_uv_set_index = CustomData_get_render_layer_index(&mesh->corner_data,
-                                                                    CD_PROP_FLOAT2);
-  if (active_uv_set_index != -1) {
-    active_set_name = mesh->corner_data.layers[active_uv_set_index].name;
-  }
+  Vector<MeshPrimvarSpec> primvars;
 
   attributes.for_all(
       [&](const bke::AttributeIDRef &attribute_id, const bke::AttributeMetaData &meta_data) {
@@ -195,7 +221,15 @@ void USDGenericMeshWriter::write_custom_data(const Object *obj,
         /* UV Data. */
         if (meta_data.domain == bke::AttrDomain::Corner && meta_data.data_type == CD_PROP_FLOAT2) {
           if (usd_export_context_.export_params.export_uvmaps) {
-            this->write_uv_data(mesh, usd_mesh, attribute_id, active_set_name);
+            const VArray<float2> buffer = *attributes.lookup<float2>(attribute_id,
+                                                                     bke::AttrDomain::Corner);
+            if (!buffer.is_empty()) {
+              primvars.append({pxr::TfToken(pxr::TfMakeValidIdentifier(attribute_id.name())),
+                               pxr::SdfValueTypeNames->TexCoord2fArray,
+                               pxr::UsdGeomTokens->faceVarying,
+                               CD_PROP_FLOAT2,
+                               buffer});
+            }
           }
         }
 
@@ -204,124 +238,85 @@ void USDGenericMeshWriter::write_custom_data(const Object *obj,
                  ELEM(meta_data.data_type, CD_PROP_BYTE_COLOR, CD_PROP_COLOR))
         {
           if (usd_export_context_.export_params.export_mesh_colors) {
-            this->write_color_data(mesh, usd_mesh, attribute_id, meta_data);
+            const VArray<ColorGeometry4f> buffer = *attributes.lookup<ColorGeometry4f>(
+                attribute_id, meta_data.domain);
+            if (!buffer.is_empty()) {
+              /* Varying type depends on original domain. */
+              const pxr::TfToken pv_interp = meta_data.domain == bke::AttrDomain::Corner ?
+                                                 pxr::UsdGeomTokens->faceVarying :
+                                                 pxr::UsdGeomTokens->vertex;
+
+              primvars.append({pxr::TfToken(pxr::TfMakeValidIdentifier(attribute_id.name())),
+                               pxr::SdfValueTypeNames->Color3fArray,
+                               pv_interp,
+                               CD_PROP_COLOR,
+                               buffer});
+            }
           }
         }
 
         else {
-          this->write_generic_data(mesh, usd_mesh, attribute_id, meta_data);
+          /* Varying type depends on original domain. */
+          const std::optional<pxr::TfToken> pv_interp = convert_blender_domain_to_usd(
+              meta_data.domain);
+          const std::optional<pxr::SdfValueTypeName> pv_type = convert_blender_type_to_usd(
+              meta_data.data_type);
+
+          if (!pv_interp || !pv_type) {
+            BKE_reportf(reports(),
+                        RPT_WARNING,
+                        "Mesh '%s', Attribute '%s' (domain %d, type %d) cannot be converted to USD",
+                        &mesh->id.name[2],
+                        attribute_id.name().data(),
+                        int8_t(meta_data.domain),
+                        meta_data.data_type);
+            return true;
+          }
+
+          const GVArray attribute = *attributes.lookup(
+              attribute_id, meta_data.domain, meta_data.data_type);
+          if (!attribute.is_empty()) {
+            primvars.append({pxr::TfToken(pxr::TfMakeValidIdentifier(attribute_id.name())),
+                             *pv_type,
+                             *pv_interp,
+                             meta_data.data_type,
+                             attribute});
+          }
         }
 
         return true;
       });
-}
-
-static const std::optional<pxr::TfToken> convert_blender_domain_to_usd(
-    const bke::AttrDomain blender_domain)
-{
-  switch (blender_domain) {
-    case bke::AttrDomain::Corner:
-      return pxr::UsdGeomTokens->faceVarying;
-    case bke::AttrDomain::Point:
-      return pxr::UsdGeomTokens->vertex;
-    case bke::AttrDomain::Face:
-      return pxr::UsdGeomTokens->uniform;
-
-    /* Notice: Edge types are not supported in USD! */
-    default:
-      return std::nullopt;
-  }
-}
-
-void USDGenericMeshWriter::write_generic_data(const Mesh *mesh,
-                                              pxr::UsdGeomMesh usd_mesh,
-                                              const bke::AttributeIDRef &attribute_id,
-                                              const bke::AttributeMetaData &meta_data)
-{
-  /* Varying type depends on original domain. */
-  const std::optional<pxr::TfToken> pv_interp = convert_blender_domain_to_usd(meta_data.domain);
-  const std::optional<pxr::SdfValueTypeName> pv_type = convert_blender_type_to_usd(
-      meta_data.data_type);
-
-  if (!pv_interp || !pv_type) {
-    BKE_reportf(reports(),
-                RPT_WARNING,
-                "Mesh '%s', Attribute '%s' (domain %d, type %d) cannot be converted to USD",
-                &mesh->id.name[2],
-                attribute_id.name().data(),
-                int8_t(meta_data.domain),
-                meta_data.data_type);
-    return;
-  }
-
-  const GVArray attribute = *mesh->attributes().lookup(
-      attribute_id, meta_data.domain, meta_data.data_type);
-  if (attribute.is_empty()) {
-    return;
-  }
-
-  const pxr::UsdTimeCode timecode = get_export_time_code();
-  const pxr::TfToken pv_name(pxr::TfMakeValidIdentifier(attribute_id.name()));
-  const pxr::UsdGeomPrimvarsAPI pv_api = pxr::UsdGeomPrimvarsAPI(usd_mesh);
-
-  pxr::UsdGeomPrimvar pv_attr = pv_api.CreatePrimvar(pv_name, *pv_type, *pv_interp);
-
-  copy_blender_attribute_to_primvar(
-      attribute, meta_data.data_type, timecode, pv_attr, usd_value_writer_);
-}
 
-void USDGenericMeshWriter::write_uv_data(const Mesh *mesh,
-                                         pxr::UsdGeomMesh usd_mesh,
-                                         const bke::AttributeIDRef &attribute_id,
-                                         const char * /*active_set_name*/)
-{
-  const VArray<float2> buffer = *mesh->attributes().lookup<float2>(attribute_id,
-                                                                   bke::AttrDomain::Corner);
-  if (buffer.is_empty()) {
-    return;
-  }
-
-  const pxr::UsdTimeCode timecode = get_export_time_code();
-  const pxr::TfToken pv_name(pxr::TfMakeValidIdentifier(attribute_id.name()));
-  const pxr::UsdGeomPrimvarsAPI pv_api = pxr::UsdGeomPrimvarsAPI(usd_mesh);
-
-  pxr::UsdGeomPrimvar pv_uv = pv_api.CreatePrimvar(
-      pv_name, pxr::SdfValueTypeNames->TexCoord2fArray, pxr::UsdGeomTokens->faceVarying);
-
-  copy_blender_buffer_to_primvar<float2, pxr::GfVec2f>(buffer, timecode, pv_uv, usd_value_writer_);
-}
-
-void USDGenericMeshWriter::write_color_data(const Mesh *mesh,
-                                            pxr::UsdGeomMesh usd_mesh,
-                                            const bke::AttributeIDRef &attribute_id,
-                                            const bke::AttributeMetaData &meta_data)
-{
-  const VArray<ColorGeometry4f> buffer = *mesh->attributes().lookup<ColorGeometry4f>(
-      attribute_id, meta_data.domain);
-  if (buffer.is_empty()) {
-    return;
-  }
+  /* Convert the attribute arrays to USD arrays in parallel; this is the bulk of the work and
+   * needs no stage access. */
+  threading::parallel_for(primvars.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      MeshPrimvarSpec &spec = primvars[i];
+      if (spec.data_type == CD_PROP_COLOR) {
+        /* Colors may come from byte color attributes; the lookup above already converted them. */
+        spec.value = convert_blender_buffer_to_value<ColorGeometry4f, pxr::GfVec3f>(
+            spec.attribute.typed<ColorGeometry4f>());
+      }
+      else if (const std::optional<pxr::VtValue> value = convert_blender_attribute_to_value(
+                   spec.attribute, spec.data_type))
+      {
+        spec.value = *value;
+      }
+    }
+  });
 
+  /* Author the primvars and commit the converted values. Authoring the stage is not thread-safe,
+   * so this stays on the calling thread. */
   const pxr::UsdTimeCode timecode = get_export_time_code();
-  const pxr::TfToken pv_name(pxr::TfMakeValidIdentifier(attribute_id.name()));
   const pxr::UsdGeomPrimvarsAPI pv_api = pxr::UsdGeomPrimvarsAPI(usd_mesh);
 
-  /* Varying type depends on original domain. */
-  const pxr::TfToken pv_interp = meta_data.domain == bke::AttrDomain::Corner ?
-                                     pxr::UsdGeomTokens->faceVarying :
-                                     pxr::UsdGeomTokens->vertex;
-
-  pxr::UsdGeomPrimvar colors_pv = pv_api.CreatePrimvar(
-      pv_name, pxr::SdfValueTypeNames->Color3fArray, pv_interp);
+  for (const MeshPrimvarSpec &spec : primvars) {
+    if (spec.value.IsEmpty()) {
+      continue;
+    }
 
-  switch (meta_data.domain) {
-    case bke::AttrDomain::Corner:
-    case bke::AttrDomain::Point:
-      copy_blender_buffer_to_primvar<ColorGeometry4f, pxr::GfVec3f>(
-          buffer, timecode, colors_pv, usd_value_writer_);
-      break;
-    default:
-      BLI_assert_msg(0, "Invalid type for mesh color data.");
+    pxr::UsdGeomPrimvar pv_attr = pv_api.CreatePrimvar(spec.name, spec.type, spec.interpolation);
+    set_primvar_value(spec.value, timecode, pv_attr, usd_value_writer_);
   }
 }
 
@@ -12,11 +12,6 @@
 struct Key;
 struct SubsurfModifierData;
 
-namespace blender::bke {
-class AttributeIDRef;
-struct AttributeMetaData;
-}  // namespace blender::bke
-
 namespace blender::io::usd {
 
 struct USDMeshData;
@@ -50,18 +45,6 @@ class USDGenericMeshWriter : public USDAbstractWriter {
   void write_surface_velocity(const Mesh *mesh, pxr::UsdGeomMesh usd_mesh);
 
   void write_custom_data(const Object *obj, const Mesh *mesh, pxr::UsdGeomMesh usd_mesh);
-  void write_generic_data(const Mesh *mesh,
-                          pxr::UsdGeomMesh usd_mesh,
-                          const bke::AttributeIDRef &attribute_id,
-                          const bke::AttributeMetaData &meta_data);
-  void write_uv_data(const Mesh *mesh,
-                     pxr::UsdGeomMesh usd_mesh,
-                     const bke::AttributeIDRef &attribute_id,
-                     const char *active_set_name);
-  void write_color_data(const Mesh *mesh,
-                        pxr::UsdGeomMesh usd_mesh,
-                        const bke::AttributeIDRef &attribute_id,
-                        const bke::AttributeMetaData &meta_data);
 };
 
 class USDMeshWriter : public USDGenericMeshWriter {
@@ -14,6 +14,7 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "obj_export_mtl.hh"
@@ -71,37 +72,69 @@ static Geometry *create_geometry(Geometry *const prev_geometry,
   return new_geometry();
 }
 
-static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+/**
+ * A `v`/`vt`/`vn` line encountered by the serial pass over a chunk. A placeholder has already
+ * been appended to the matching #GlobalVertices array, so any logic that depends on the element
+ * counts (relative face indices, bounds checks) keeps working; the number parsing itself is
+ * deferred so that all vertex data lines of a chunk can be parsed in parallel.
+ */
+struct DeferredVertexData {
+  enum class Type : int8_t { Position, UV, Normal };
+  Type type;
+  /** Destination index in the matching #GlobalVertices array. */
+  int64_t index;
+  const char *p;
+  const char *end;
+  /** Result of the optional `xyzrgb` color extension on `v` lines, see #geom_add_vertex_colors. */
+  bool has_color = false;
+  float3 color;
+};
+
+static void geom_parse_vertex(DeferredVertexData &line, GlobalVertices &r_global_vertices)
 {
   float3 vert;
-  p = parse_floats(p, end, 0.0f, vert, 3);
-  r_global_vertices.vertices.append(vert);
+  const char *p = parse_floats(line.p, line.end, 0.0f, vert, 3);
+  r_global_vertices.vertices[line.index] = vert;
   /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
    * is followed by 3 more RGB color components. See
    * http://paulbourke.net/dataformats/obj/colour.html */
-  if (p < end) {
+  if (p < line.end) {
     float3 srgb;
-    p = parse_floats(p, end, -1.0f, srgb, 3);
+    p = parse_floats(p, line.end, -1.0f, srgb, 3);
     if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
-      float3 linear;
-      srgb_to_linearrgb_v3_v3(linear, srgb);
-
-      auto &blocks = r_global_vertices.vertex_colors;
-      /* If we don't have vertex colors yet, or the previous vertex
-       * was without color, we need to start a new vertex colors block. */
-      if (blocks.is_empty() || (blocks.last().start_vertex_index + blocks.last().colors.size() !=
-                                r_global_vertices.vertices.size() - 1))
-      {
-        GlobalVertices::VertexColorsBlock block;
-        block.start_vertex_index = r_global_vertices.vertices.size() - 1;
-        blocks.append(block);
-      }
-      blocks.last().colors.append(linear);
+      srgb_to_linearrgb_v3_v3(line.color, srgb);
+      line.has_color = true;
     }
   }
   UNUSED_VARS(p);
 }
 
+/**
+ * Fold `xyzrgb` colors parsed by #geom_parse_vertex into the vertex color blocks. This has to
+ * happen serially and in file order, since the block structure depends on which runs of
+ * consecutive vertices carry colors.
+ */
+static void geom_add_vertex_colors(const Span<DeferredVertexData> deferred_vertex_data,
+                                   GlobalVertices &r_global_vertices)
+{
+  for (const DeferredVertexData &line : deferred_vertex_data) {
+    if (line.type != DeferredVertexData::Type::Position || !line.has_color) {
+      continue;
+    }
+    auto &blocks = r_global_vertices.vertex_colors;
+    /* If we don't have vertex colors yet, or the previous vertex
+     * was without color, we need to start a new vertex colors block. */
+    if (blocks.is_empty() ||
+        (blocks.last().start_vertex_index + blocks.last().colors.size() != line.index))
+    {
+      GlobalVertices::VertexColorsBlock block;
+      block.start_vertex_index = line.index;
+      blocks.append(block);
+    }
+    blocks.last().colors.append(line.color);
+  }
+}
+
 static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices &r_global_vertices)
 {
   /* MRGB color extension, in the form of
@@ -142,24 +175,24 @@ static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices
   }
 }
 
-static void geom_add_vertex_normal(const char *p,
-                                   const char *end,
-                                   GlobalVertices &r_global_vertices)
+static void geom_parse_vertex_normal(const DeferredVertexData &line,
+                                     GlobalVertices &r_global_vertices)
 {
   float3 normal;
-  parse_floats(p, end, 0.0f, normal, 3);
+  parse_floats(line.p, line.end, 0.0f, normal, 3);
   /* Normals can be printed with only several digits in the file,
    * making them ever-so-slightly non unit length. Make sure they are
    * normalized. */
   normalize_v3(normal);
-  r_global_vertices.vert_normals.append(normal);
+  r_global_vertices.vert_normals[line.index] = normal;
 }
 
-static void geom_add_uv_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+static void geom_parse_uv_vertex(const DeferredVertexData &line,
+                                 GlobalVertices &r_global_vertices)
 {
   float2 uv;
-  parse_floats(p, end, 0.0f, uv, 2);
-  r_global_vertices.uv_vertices.append(uv);
+  parse_floats(line.p, line.end, 0.0f, uv, 2);
+  r_global_vertices.uv_vertices[line.index] = uv;
 }
 
 /**
@@ -526,6 +559,10 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
    * to possibly store remainder of the previous input line that got broken mid-chunk. */
   Array<char> buffer(read_buffer_size_ * 2);
 
+  /* Vertex data lines of the current chunk whose number parsing is deferred; the line pointers
+   * reference the chunk buffer, so this has to be processed before the next chunk is read. */
+  Vector<DeferredVertexData> deferred_vertex_data;
+
   size_t buffer_offset = 0;
   size_t line_number = 0;
   while (true) {
@@ -582,16 +619,21 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
       if (p == end) {
         continue;
       }
-      /* Most common things that start with 'v': vertices, normals, UVs. */
+      /* Most common things that start with 'v': vertices, normals, UVs.
+       * Append a placeholder now and defer the number parsing, so that all vertex data
+       * lines of this chunk can be parsed in parallel below. */
       if (*p == 'v') {
         if (parse_keyword(p, end, "v")) {
-          geom_add_vertex(p, end, r_global_vertices);
+          const int64_t index = r_global_vertices.vertices.append_and_get_index(float3(0.0f));
+          deferred_vertex_data.append({DeferredVertexData::Type::Position, index, p, end});
         }
         else if (parse_keyword(p, end, "vn")) {
-          geom_add_vertex_normal(p, end, r_global_vertices);
+          const int64_t index = r_global_vertices.vert_normals.append_and_get_index(float3(0.0f));
+          deferred_vertex_data.append({DeferredVertexData::Type::Normal, index, p, end});
         }
         else if (parse_keyword(p, end, "vt")) {
-          geom_add_uv_vertex(p, end, r_global_vertices);
+          const int64_t index = r_global_vertices.uv_vertices.append_and_get_index(float2(0.0f));
+          deferred_vertex_data.append({DeferredVertexData::Type::UV, index, p, end});
         }
       }
       /* Faces. */
@@ -695,6 +737,27 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
       }
     }
 
+    /* Parse the numbers on the vertex data lines found in this chunk in parallel; this is where
+     * the vast majority of the time is spent on vertex-heavy files. Each line writes into its own
+     * pre-allocated slot, so the lines are independent of each other. */
+    threading::parallel_for(deferred_vertex_data.index_range(), 2048, [&](const IndexRange range) {
+      for (DeferredVertexData &vline : deferred_vertex_data.as_mutable_span().slice(range)) {
+        switch (vline.type) {
+          case DeferredVertexData::Type::Position:
+            geom_parse_vertex(vline, r_global_vertices);
+            break;
+          case DeferredVertexData::Type::UV:
+            geom_parse_uv_vertex(vline, r_global_vertices);
+            break;
+          case DeferredVertexData::Type::Normal:
+            geom_parse_vertex_normal(vline, r_global_vertices);
+            break;
+        }
+      }
+    });
+    geom_add_vertex_colors(deferred_vertex_data, r_global_vertices);
+    deferred_vertex_data.clear();
+
     /* We might have a line that was cut in the middle by the previous buffer;
      * copy it over for next chunk reading. */
     size_t left_size = buffer_end - last_nl;
@@ -652,6 +652,18 @@ typedef struct FCurve {
    * \note String look-ups for collection and custom-properties are escaped using #BLI_str_escape.
    */
   char *rna_path;
+  /**
+   * Runtime only: lazily created compiled form of #rna_path (an #RNACompiledPath), used by
+   * animation evaluation to avoid re-parsing the path on every frame. Not written to files.
+   */
+  void *rna_path_compiled;
+
+  /**
+   * Runtime only: index of the keyframe segment hit by the last evaluation, used to
+   * short-circuit the binary search during sequential playback access. Not written to files.
+   */
+  int last_eval_index;
+  char _pad1[4];
 
   /* curve coloring (for editor) */
   /** Coloring method to use (eFCurve_Coloring). */
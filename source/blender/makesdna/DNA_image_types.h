@@ -246,6 +246,8 @@ enum {
 enum {
   /** All mipmap levels in OpenGL texture set? */
   IMA_GPU_MIPMAP_COMPLETE = (1 << 0),
+  /** The texture is a reduced resolution placeholder, full resolution upload is still pending. */
+  IMA_GPU_PARTIAL_RESIDENT = (1 << 1),
 };
 
 /* Image.source, where the image comes from */
@@ -276,4 +276,6 @@ enum {
   VIEW_LAYER_FREESTYLE = (1 << 2),
   VIEW_LAYER_OUT_OF_SYNC = (1 << 3),
   VIEW_LAYER_HAS_EXPORT_COLLECTIONS = (1 << 4),
+  /** Only visibility flags changed, the hierarchy and collection memberships are still valid. */
+  VIEW_LAYER_OUT_OF_SYNC_VISIBILITY = (1 << 5),
 };
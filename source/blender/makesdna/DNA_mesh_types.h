@@ -22,6 +22,7 @@
 
 namespace blender {
 template<typename T> struct Bounds;
+class IndexRange;
 namespace offset_indices {
 template<typename T> struct GroupedSpan;
 template<typename T> class OffsetIndices;
@@ -397,6 +398,12 @@ typedef struct Mesh {
 
   /** Call after changing vertex positions to tag lazily calculated caches for recomputation. */
   void tag_positions_changed();
+  /**
+   * Like #tag_positions_changed, but for the case when only the vertices in \a verts moved.
+   * Cached normals are then updated just in the affected region instead of being recomputed
+   * entirely (see #MeshRuntime::dirty_normal_verts).
+   */
+  void tag_positions_changed_partial(blender::IndexRange verts);
   /** Call after moving every mesh vertex by the same translation. */
   void tag_positions_changed_uniformly();
   /** Like #tag_positions_changed but doesn't tag normals; they must be updated separately. */
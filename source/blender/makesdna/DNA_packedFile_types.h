@@ -9,7 +9,18 @@
 #pragma once
 
 typedef struct PackedFile {
+  /** Size of the file contents, `data` decompresses to this many bytes when compressed. */
   int size;
   int seek;
+  /** #ePackedFile_Flag. */
+  int flag;
+  /** Size of `data` when #PF_COMPRESSED_ZSTD is set, zero otherwise. */
+  int size_compressed;
   void *data;
 } PackedFile;
+
+/** #PackedFile.flag, runtime only: cleared when writing blend files (undo steps excepted). */
+typedef enum ePackedFile_Flag {
+  /** `data` holds a zstd frame, access the contents through #BKE_packedfile_data_get. */
+  PF_COMPRESSED_ZSTD = 1 << 0,
+} ePackedFile_Flag;
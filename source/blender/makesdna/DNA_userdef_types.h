@@ -949,7 +949,8 @@ typedef struct UserDef {
   int prefetchframes;
   /** Control the rotation step of the view when PAD2, PAD4, PAD6&PAD8 is use. */
   float pad_rot_angle;
-  char _pad12[4];
+  /** Budget for GPU image textures in megabytes, zero disables the budget. */
+  int gpu_texture_budget;
   /** Rotating view icon size. */
   short rvisize;
   /** Rotating view icon brightness. */
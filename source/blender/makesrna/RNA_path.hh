@@ -210,6 +210,42 @@ struct PropertyElemRNA {
  */
 bool RNA_path_resolve_elements(PointerRNA *ptr, const char *path, ListBase *r_elements);
 
+/**
+ * Pre-parsed form of an RNA path, which can be resolved repeatedly without tokenizing the path
+ * string again, see #RNA_path_compile. Created once per path and usable from multiple threads
+ * concurrently, which animation evaluation relies on.
+ */
+struct RNACompiledPath;
+
+/**
+ * Parse \a path into a compiled path for repeated resolving.
+ *
+ * \return The compiled path, or null when the path is malformed or uses syntax that
+ * #RNA_path_compiled_resolve_property does not support (e.g. multi-dimensional array indices).
+ * The result must be freed with #RNA_path_compiled_free.
+ */
+RNACompiledPath *RNA_path_compile(const char *path);
+
+void RNA_path_compiled_free(RNACompiledPath *compiled);
+
+/** The path string that \a compiled was created from (used to detect stale compiled paths). */
+const char *RNA_path_compiled_path_get(const RNACompiledPath *compiled);
+
+/**
+ * Resolve a compiled path, matching the behavior of #RNA_path_resolve_property.
+ *
+ * Property name look-ups are cached on the compiled path (keyed by the struct type they resolved
+ * against), collection and ID-property look-ups are redone on every call, so the result never
+ * refers to stale data.
+ *
+ * \note Assumes all pointers provided are valid.
+ * \return True if the path resolves to a valid "pointer + property" pair.
+ */
+bool RNA_path_compiled_resolve_property(const PointerRNA *ptr,
+                                        RNACompiledPath *compiled,
+                                        PointerRNA *r_ptr,
+                                        PropertyRNA **r_prop);
+
 /**
  * Find the path from the structure referenced by the pointer to the runtime RNA-defined
  * #IDProperty object.
@@ -260,7 +260,7 @@ static void rna_ObjectBase_hide_viewport_update(bContext *C, PointerRNA * /*ptr*
 {
   Scene *scene = CTX_data_scene(C);
   ViewLayer *view_layer = CTX_data_view_layer(C);
-  BKE_view_layer_need_resync_tag(view_layer);
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
   WM_event_add_notifier(C, NC_SCENE | ND_OB_SELECT, scene);
 }
@@ -349,7 +349,8 @@ static void rna_LayerCollection_update(Main * /*bmain*/, Scene * /*scene*/, Poin
   LayerCollection *lc = (LayerCollection *)ptr->data;
   ViewLayer *view_layer = BKE_view_layer_find_from_collection(scene, lc);
 
-  BKE_view_layer_need_resync_tag(view_layer);
+  /* Hide/holdout/indirect-only toggles only change visibility flags. */
+  BKE_view_layer_need_visibility_resync_tag(view_layer);
 
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
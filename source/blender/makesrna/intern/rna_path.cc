@@ -12,11 +12,13 @@
 #include <fmt/format.h>
 
 #include "BLI_alloca.h"
-#include "BLI_dynstr.h"
 #include "BLI_listbase.h"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+#include "atomic_ops.h"
 
 #include "BKE_idprop.hh"
 #include "BKE_idtype.hh"
@@ -590,53 +592,301 @@ bool RNA_path_resolve_elements(PointerRNA *ptr, const char *path, ListBase *r_el
   return rna_path_parse(ptr, path, nullptr, nullptr, nullptr, nullptr, r_elements, false);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Compiled Path Resolving
+ * \{ */
+
+/** Cached property look-up of a #RNACompiledPathStep, see #rna_compiled_step_find_property. */
+struct RNACompiledPathStepLookup {
+  const StructRNA *type;
+  PropertyRNA *prop;
+};
+
+struct RNACompiledPathStep {
+  /** Property name, or the ID-property key for steps of the form `["key"]`. */
+  std::string name;
+  /** Collection key (or trailing ID-property key on a pointer property) for `name["key"]`. */
+  std::optional<std::string> str_key;
+  /** Collection key for `name[index]`. */
+  std::optional<int> int_key;
+  /** When true, `name` is looked up as an ID-property instead of a regular property. */
+  bool is_id_prop = false;
+
+  /**
+   * Lazily initialized cache of the property look-up, only valid for pointers of the matching
+   * struct type. Installed through an atomic CAS and never updated or freed until the compiled
+   * path itself is freed, so that concurrent resolves can share one compiled path safely.
+   */
+  RNACompiledPathStepLookup *lookup = nullptr;
+};
+
+struct RNACompiledPath {
+  /** The path string this was compiled from. */
+  std::string path;
+  blender::Vector<RNACompiledPathStep> steps;
+
+  ~RNACompiledPath()
+  {
+    for (RNACompiledPathStep &step : steps) {
+      if (step.lookup) {
+        MEM_delete(step.lookup);
+      }
+    }
+  }
+};
+
+RNACompiledPath *RNA_path_compile(const char *path)
+{
+  if (path == nullptr || *path == '\0') {
+    return nullptr;
+  }
+
+  RNACompiledPath *compiled = MEM_new<RNACompiledPath>(__func__);
+  compiled->path = path;
+
+  const char *p = path;
+  char fixedbuf[256];
+
+  while (*p) {
+    RNACompiledPathStep step;
+
+    const bool use_id_prop = (*p == '[');
+    bool quoted = false;
+    char *token = use_id_prop ? rna_path_token_in_brackets(&p, fixedbuf, sizeof(fixedbuf), &quoted) :
+                                rna_path_token(&p, fixedbuf, sizeof(fixedbuf));
+    /* Unquoted brackets here are either an ID-property look-up that could never succeed, or a
+     * multi-dimensional array index, which isn't supported by the compiled resolver. */
+    if (token == nullptr || (use_id_prop && !quoted)) {
+      if (token && token != fixedbuf) {
+        MEM_freeN(token);
+      }
+      MEM_delete(compiled);
+      return nullptr;
+    }
+    step.is_id_prop = use_id_prop;
+    step.name = token;
+    if (token != fixedbuf) {
+      MEM_freeN(token);
+    }
+
+    /* A bracket following the name is a collection or ID-property key. How to apply it is only
+     * decided when resolving, based on the type of the property it follows. */
+    if (*p == '[') {
+      token = rna_path_token_in_brackets(&p, fixedbuf, sizeof(fixedbuf), &quoted);
+      if (token == nullptr) {
+        MEM_delete(compiled);
+        return nullptr;
+      }
+      if (quoted) {
+        step.str_key = token;
+      }
+      else {
+        const int intkey = atoi(token);
+        if (intkey == 0 && !STREQ(token, "0")) {
+          if (token != fixedbuf) {
+            MEM_freeN(token);
+          }
+          MEM_delete(compiled);
+          return nullptr;
+        }
+        step.int_key = intkey;
+      }
+      if (token != fixedbuf) {
+        MEM_freeN(token);
+      }
+    }
+
+    compiled->steps.append(std::move(step));
+  }
+
+  if (compiled->steps.is_empty()) {
+    MEM_delete(compiled);
+    return nullptr;
+  }
+
+  return compiled;
+}
+
+void RNA_path_compiled_free(RNACompiledPath *compiled)
+{
+  MEM_delete(compiled);
+}
+
+const char *RNA_path_compiled_path_get(const RNACompiledPath *compiled)
+{
+  return compiled->path.c_str();
+}
+
+/**
+ * #RNA_struct_find_property with a per-step cache, keyed by the struct type the step resolved
+ * against. The cache is only installed once: when a compiled path is applied to structs of
+ * several types at the same step (e.g. one action used by IDs of different types), only the
+ * first type benefits, the others do a regular look-up.
+ */
+static PropertyRNA *rna_compiled_step_find_property(PointerRNA *ptr, RNACompiledPathStep *step)
+{
+  RNACompiledPathStepLookup *lookup = static_cast<RNACompiledPathStepLookup *>(
+      atomic_load_ptr((void *const *)&step->lookup));
+  if (lookup && lookup->type == ptr->type) {
+    return lookup->prop;
+  }
+
+  PropertyRNA *prop = RNA_struct_find_property(ptr, step->name.c_str());
+
+  if (lookup == nullptr && prop != nullptr) {
+    RNACompiledPathStepLookup *lookup_new = MEM_new<RNACompiledPathStepLookup>(__func__);
+    lookup_new->type = ptr->type;
+    lookup_new->prop = prop;
+    if (atomic_cas_ptr((void **)&step->lookup, nullptr, lookup_new) != nullptr) {
+      /* Another thread installed its look-up first, discard ours. */
+      MEM_delete(lookup_new);
+    }
+  }
+
+  return prop;
+}
+
+bool RNA_path_compiled_resolve_property(const PointerRNA *ptr,
+                                        RNACompiledPath *compiled,
+                                        PointerRNA *r_ptr,
+                                        PropertyRNA **r_prop)
+{
+  PointerRNA curptr = *ptr;
+  PropertyRNA *prop = nullptr;
+
+  const int64_t steps_num = compiled->steps.size();
+  for (int64_t i = 0; i < steps_num; i++) {
+    RNACompiledPathStep &step = compiled->steps[i];
+    const bool is_last = (i == steps_num - 1);
+
+    if (curptr.data == nullptr) {
+      return false;
+    }
+
+    if (step.is_id_prop) {
+      IDProperty *group = RNA_struct_idprops(&curptr, false);
+      prop = group ? (PropertyRNA *)IDP_GetPropertyFromGroup(group, step.name.c_str()) : nullptr;
+    }
+    else {
+      prop = rna_compiled_step_find_property(&curptr, &step);
+    }
+    if (prop == nullptr) {
+      return false;
+    }
+
+    const bool has_key = step.str_key.has_value() || step.int_key.has_value();
+
+    switch (RNA_property_type(prop)) {
+      case PROP_POINTER: {
+        if (has_key) {
+          /* Paths like `data["prop"]`: dereference the pointer, then look up the key as an
+           * ID-property. Only supported as the final element of the path. */
+          if (!is_last || !step.str_key.has_value()) {
+            return false;
+          }
+          PointerRNA nextptr = RNA_property_pointer_get(&curptr, prop);
+          if (nextptr.data == nullptr) {
+            return false;
+          }
+          IDProperty *group = RNA_struct_idprops(&nextptr, false);
+          prop = group ? (PropertyRNA *)IDP_GetPropertyFromGroup(group, step.str_key->c_str()) :
+                         nullptr;
+          if (prop == nullptr) {
+            return false;
+          }
+          curptr = nextptr;
+        }
+        else if (!is_last) {
+          curptr = RNA_property_pointer_get(&curptr, prop);
+          prop = nullptr;
+        }
+        break;
+      }
+      case PROP_COLLECTION: {
+        if (has_key) {
+          PointerRNA nextptr;
+          bool found;
+          if (step.str_key.has_value()) {
+            found = RNA_property_collection_lookup_string(
+                &curptr, prop, step.str_key->c_str(), &nextptr);
+          }
+          else {
+            found = RNA_property_collection_lookup_int(&curptr, prop, *step.int_key, &nextptr);
+          }
+          if (!found) {
+            return false;
+          }
+          if (!is_last) {
+            curptr = nextptr;
+            prop = nullptr;
+          }
+          /* With a trailing key the collection property itself remains the result, matching
+           * #rna_path_parse without `eval_pointer`. */
+        }
+        else if (!is_last) {
+          PointerRNA nextptr;
+          if (!RNA_property_collection_type_get(&curptr, prop, &nextptr)) {
+            return false;
+          }
+          curptr = nextptr;
+          prop = nullptr;
+        }
+        break;
+      }
+      default: {
+        /* Trailing array indices and component tokens (`location.x`) are not supported, matching
+         * #RNA_path_resolve_property which fails to resolve those as well. */
+        if (has_key || !is_last) {
+          return false;
+        }
+        break;
+      }
+    }
+  }
+
+  if (prop == nullptr || curptr.data == nullptr) {
+    return false;
+  }
+
+  *r_ptr = curptr;
+  *r_prop = prop;
+  return true;
+}
+
+/** \} */
+
 char *RNA_path_append(const char *path,
                       const PointerRNA * /*ptr*/,
                       PropertyRNA *prop,
                       int intkey,
                       const char *strkey)
 {
-  DynStr *dynstr;
-  char *result;
-
-  dynstr = BLI_dynstr_new();
+  /* Build into a stack buffer, typical paths fit without any heap allocation. */
+  fmt::memory_buffer buf;
+  auto buf_appender = fmt::appender(buf);
 
   /* add .identifier */
-  if (path) {
-    BLI_dynstr_append(dynstr, path);
-    if (*path) {
-      BLI_dynstr_append(dynstr, ".");
-    }
+  if (path && *path) {
+    fmt::format_to(buf_appender, "{}.", path);
   }
 
-  BLI_dynstr_append(dynstr, RNA_property_identifier(prop));
+  fmt::format_to(buf_appender, "{}", RNA_property_identifier(prop));
 
   const bool has_key = (intkey > -1) || (strkey != nullptr);
   if (has_key && (RNA_property_type(prop) == PROP_COLLECTION)) {
     /* add ["strkey"] or [intkey] */
-    BLI_dynstr_append(dynstr, "[");
-
     if (strkey) {
       const int strkey_esc_max_size = (strlen(strkey) * 2) + 1;
       char *strkey_esc = static_cast<char *>(BLI_array_alloca(strkey_esc, strkey_esc_max_size));
       BLI_str_escape(strkey_esc, strkey, strkey_esc_max_size);
-      BLI_dynstr_append(dynstr, "\"");
-      BLI_dynstr_append(dynstr, strkey_esc);
-      BLI_dynstr_append(dynstr, "\"");
+      fmt::format_to(buf_appender, "[\"{}\"]", strkey_esc);
     }
     else {
-      char appendstr[128];
-      SNPRINTF(appendstr, "%d", intkey);
-      BLI_dynstr_append(dynstr, appendstr);
+      fmt::format_to(buf_appender, "[{}]", intkey);
     }
-
-    BLI_dynstr_append(dynstr, "]");
   }
 
-  result = BLI_dynstr_get_cstring(dynstr);
-  BLI_dynstr_free(dynstr);
-
-  return result;
+  return BLI_strdupn(buf.data(), buf.size());
 }
 
 /* Having both path append & back seems like it could be useful,
@@ -760,8 +1010,8 @@ struct IDP_Chain {
 
 static char *rna_idp_path_create(IDP_Chain *child_link)
 {
-  DynStr *dynstr = BLI_dynstr_new();
-  char *path;
+  fmt::memory_buffer buf;
+  auto buf_appender = fmt::appender(buf);
   bool is_first = true;
 
   IDP_Chain *link = child_link;
@@ -777,26 +1027,24 @@ static char *rna_idp_path_create(IDP_Chain *child_link)
   }
 
   for (link = link_prev; link; link = link->up) {
-    /* pass */
+    if (!is_first) {
+      buf.push_back('.');
+    }
     if (link->index >= 0) {
-      BLI_dynstr_appendf(dynstr, is_first ? "%s[%d]" : ".%s[%d]", link->name, link->index);
+      fmt::format_to(buf_appender, "{}[{}]", link->name, link->index);
     }
     else {
-      BLI_dynstr_appendf(dynstr, is_first ? "%s" : ".%s", link->name);
+      fmt::format_to(buf_appender, "{}", link->name);
     }
 
     is_first = false;
   }
 
-  path = BLI_dynstr_get_cstring(dynstr);
-  BLI_dynstr_free(dynstr);
-
-  if (*path == '\0') {
-    MEM_freeN(path);
-    path = nullptr;
+  if (buf.size() == 0) {
+    return nullptr;
   }
 
-  return path;
+  return BLI_strdupn(buf.data(), buf.size());
 }
 
 static char *rna_idp_path(PointerRNA *ptr,
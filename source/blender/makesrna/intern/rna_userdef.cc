@@ -6143,6 +6143,15 @@ static void rna_def_userdef_system(BlenderRNA *brna)
       "Texture Collection Rate",
       "Number of seconds between each run of the GL texture garbage collector");
 
+  prop = RNA_def_property(srna, "gpu_texture_budget", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, nullptr, "gpu_texture_budget");
+  RNA_def_property_range(prop, 0, 131072);
+  RNA_def_property_ui_text(
+      prop,
+      "GPU Texture Budget",
+      "Amount of GPU memory in megabytes image textures may use before the least recently "
+      "used ones are freed (set to 0 to disable the budget)");
+
   prop = RNA_def_property(srna, "vbo_time_out", PROP_INT, PROP_NONE);
   RNA_def_property_int_sdna(prop, nullptr, "vbotimeout");
   RNA_def_property_range(prop, 0, 3600);
@@ -29,6 +29,7 @@
 #include "BKE_subdiv_ccg.hh"
 #include "BKE_subdiv_deform.hh"
 #include "BKE_subdiv_mesh.hh"
+#include "BKE_subdiv_modifier.hh"
 #include "BKE_subsurf.hh"
 
 #include "UI_interface.hh"
@@ -46,6 +47,9 @@
 struct MultiresRuntimeData {
   /* Cached subdivision surface descriptor, with topology and settings. */
   blender::bke::subdiv::Subdiv *subdiv;
+  /* Mesh wrapper settings for when display is delegated to the GPU subdivision evaluator,
+   * which is only possible while the mesh has no sculpted displacement. */
+  SubsurfRuntimeData *subsurf_runtime_data;
 };
 
 static void init_data(ModifierData *md)
@@ -82,6 +86,15 @@ static void free_runtime_data(void *runtime_data_v)
   if (runtime_data->subdiv != nullptr) {
     blender::bke::subdiv::free(runtime_data->subdiv);
   }
+  if (runtime_data->subsurf_runtime_data != nullptr) {
+    if (runtime_data->subsurf_runtime_data->subdiv_cpu != nullptr) {
+      blender::bke::subdiv::free(runtime_data->subsurf_runtime_data->subdiv_cpu);
+    }
+    if (runtime_data->subsurf_runtime_data->subdiv_gpu != nullptr) {
+      blender::bke::subdiv::free(runtime_data->subsurf_runtime_data->subdiv_gpu);
+    }
+    MEM_freeN(runtime_data->subsurf_runtime_data);
+  }
   MEM_freeN(runtime_data);
 }
 
@@ -186,6 +199,37 @@ static Mesh *multires_as_ccg(MultiresModifierData *mmd,
   return result;
 }
 
+/* Cache settings for delegating display to the GPU subdivision evaluator. */
+
+static bool multires_cache_mesh_wrapper_settings(const ModifierEvalContext *ctx,
+                                                 Mesh *mesh,
+                                                 MultiresModifierData *mmd,
+                                                 MultiresRuntimeData *runtime_data)
+{
+  const Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
+  blender::bke::subdiv::ToMeshSettings mesh_settings;
+  BKE_multires_subdiv_mesh_settings_init(
+      &mesh_settings, scene, ctx->object, mmd, false, false, false);
+  if (mesh_settings.resolution < 3) {
+    return false;
+  }
+
+  SubsurfRuntimeData *subsurf_runtime_data = runtime_data->subsurf_runtime_data;
+  if (subsurf_runtime_data == nullptr) {
+    subsurf_runtime_data = MEM_cnew<SubsurfRuntimeData>(__func__);
+    runtime_data->subsurf_runtime_data = subsurf_runtime_data;
+  }
+
+  BKE_multires_subdiv_settings_init(&subsurf_runtime_data->settings, mmd);
+  subsurf_runtime_data->has_gpu_subdiv = true;
+  subsurf_runtime_data->resolution = mesh_settings.resolution;
+  subsurf_runtime_data->use_optimal_display = mesh_settings.use_optimal_display;
+  subsurf_runtime_data->use_loop_normals = false;
+
+  mesh->runtime->subsurf_runtime_data = subsurf_runtime_data;
+  return true;
+}
+
 static Mesh *modify_mesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mesh)
 {
   Mesh *result = mesh;
@@ -200,6 +244,23 @@ static Mesh *modify_mesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh
     return result;
   }
   MultiresRuntimeData *runtime_data = multires_ensure_runtime(mmd);
+
+  /* Delay evaluation to the draw code if possible: as long as the mesh has no sculpted
+   * displacement the result is plain Catmull-Clark subdivision, which the GPU subdivision
+   * evaluator can display without building the dense mesh on the CPU. */
+  if ((ctx->flag & (MOD_APPLY_TO_BASE_MESH | MOD_APPLY_ORCO | MOD_APPLY_RENDER)) == 0 &&
+      (ctx->object->mode & OB_MODE_SCULPT) == 0)
+  {
+    const Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
+    const bool is_editmode = (mesh->runtime->edit_mesh != nullptr);
+    const int required_mode = BKE_subsurf_modifier_eval_required_mode(false, is_editmode);
+    if (BKE_multires_modifier_can_do_gpu_subdiv(scene, ctx->object, mesh, mmd, required_mode) &&
+        multires_cache_mesh_wrapper_settings(ctx, mesh, mmd, runtime_data))
+    {
+      return result;
+    }
+  }
+
   blender::bke::subdiv::Subdiv *subdiv = subdiv_descriptor_ensure(mmd, &subdiv_settings, mesh);
   if (subdiv == nullptr) {
     /* Happens on bad topology, also on empty input mesh. */
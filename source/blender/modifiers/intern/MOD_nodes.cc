@@ -8,6 +8,7 @@
 
 #include <cstring>
 #include <fmt/format.h>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -15,10 +16,12 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array.hh"
+#include "BLI_fileops.h"
 #include "BLI_listbase.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_multi_value_map.hh"
 #include "BLI_path_util.h"
+#include "BLI_serialize.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
@@ -301,6 +304,45 @@ static bool logging_enabled(const ModifierEvalContext *ctx)
   return true;
 }
 
+/**
+ * Write the per-node run times of an evaluation to a JSON file, so performance tooling can find
+ * expensive nodes in production files without bisecting by hand. Enabled by pointing the
+ * `BLENDER_GEO_NODES_PROFILE_DIR` environment variable at an output directory; one file is
+ * written per object, modifier and frame.
+ */
+static void dump_evaluation_profile(const char *profile_dir,
+                                    const NodesModifierData &nmd_orig,
+                                    const ModifierEvalContext &ctx,
+                                    const bNodeTree &tree,
+                                    const ComputeContextHash &context_hash)
+{
+  geo_log::GeoTreeLog &tree_log = nmd_orig.runtime->eval_log->get_tree_log(context_hash);
+
+  io::serialize::DictionaryValue profile;
+  profile.append_str("object", ctx.object->id.name + 2);
+  profile.append_str("modifier", nmd_orig.modifier.name);
+  const float frame = DEG_get_ctime(ctx.depsgraph);
+  profile.append_double("frame", double(frame));
+  tree_log.run_times_to_json(tree, *profile.append_dict("evaluation"));
+
+  char filename[FILE_MAX];
+  SNPRINTF(filename,
+           "%s_%s_%06.2f.json",
+           ctx.object->id.name + 2,
+           nmd_orig.modifier.name,
+           double(frame));
+  BLI_path_make_safe_filename(filename);
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), profile_dir, filename);
+  if (!BLI_file_ensure_parent_dir_exists(filepath)) {
+    return;
+  }
+
+  std::fstream stream(filepath, std::ios::out);
+  io::serialize::JsonFormatter formatter;
+  formatter.serialize(stream, profile);
+}
+
 static void update_id_properties_from_node_group(NodesModifierData *nmd)
 {
   if (nmd->node_group == nullptr) {
@@ -1717,6 +1759,10 @@ static void modifyGeometry(ModifierData *md,
 
   if (logging_enabled(ctx)) {
     nmd_orig->runtime->eval_log = std::move(eval_log);
+
+    if (const char *profile_dir = BLI_getenv("BLENDER_GEO_NODES_PROFILE_DIR")) {
+      dump_evaluation_profile(profile_dir, *nmd_orig, *ctx, tree, modifier_compute_context.hash());
+    }
   }
 
   if (DEG_is_active(ctx->depsgraph) && !(ctx->flag & MOD_APPLY_TO_BASE_MESH)) {
@@ -520,6 +520,7 @@ static Mesh *normalEditModifier_do(NormalEditModifierData *enmd,
                                              result->face_normals(),
                                              sharp_edges.span,
                                              sharp_faces,
+                                             {},
                                              clnors,
                                              nullptr,
                                              corner_normals);
@@ -47,6 +47,10 @@
 
 struct SpaceNode;
 
+namespace blender::io::serialize {
+class DictionaryValue;
+}
+
 namespace blender::nodes::geo_eval_log {
 
 using fn::GField;
@@ -297,6 +301,13 @@ class GeoTreeLog {
 
   void ensure_node_warnings();
   void ensure_node_run_time();
+
+  /**
+   * Append the per-node run times of this tree to a JSON dictionary, recursing into group nodes.
+   * This provides a machine-readable evaluation profile for external tooling, in contrast to the
+   * interactive timing overlay in the node editor.
+   */
+  void run_times_to_json(const bNodeTree &tree, io::serialize::DictionaryValue &r_dict);
   void ensure_socket_values();
   void ensure_viewer_node_logs();
   void ensure_existing_attributes();
@@ -157,6 +157,29 @@ class ProximityFunction : public mf::MultiFunction {
 
     /* Construct BVH tree for each group. */
     bvh_trees_.resize(groups_num);
+
+    if (groups_num == 1 && group_masks.first().size() == domain_size) {
+      /* Without grouping (the common case when the Group ID input is not connected), use the BVH
+       * tree cached on the mesh, so that multiple sampling nodes and repeated evaluations of the
+       * same node share one tree instead of each building their own. */
+      BVHTreeFromMesh &bvh = bvh_trees_.first().mesh_bvh;
+      switch (type_) {
+        case GEO_NODE_PROX_TARGET_POINTS: {
+          BKE_bvhtree_from_mesh_get(&bvh, &mesh, BVHTREE_FROM_VERTS, 2);
+          break;
+        }
+        case GEO_NODE_PROX_TARGET_EDGES: {
+          BKE_bvhtree_from_mesh_get(&bvh, &mesh, BVHTREE_FROM_EDGES, 2);
+          break;
+        }
+        case GEO_NODE_PROX_TARGET_FACES: {
+          BKE_bvhtree_from_mesh_get(&bvh, &mesh, BVHTREE_FROM_CORNER_TRIS, 2);
+          break;
+        }
+      }
+      return;
+    }
+
     threading::parallel_for(
         IndexRange(groups_num),
         512,
@@ -18,6 +18,16 @@
  * Currently, lazy-functions are even created for nodes that don't strictly require it, like
  * reroutes or muted nodes. In the future we could avoid that at the cost of additional code
  * complexity. So far, this does not seem to be a performance issue.
+ *
+ * A note on result caching: automatic memoization of subgraph outputs between evaluations (so
+ * that tweaking one input only re-executes the downstream part of the tree) has been considered
+ * but does not work with the current design. There is no general way to build a cache key from
+ * socket values: geometries and fields are not hashable, and object/collection inputs may change
+ * without their pointer changing. More fundamentally, anonymous attribute ids are created per
+ * evaluation, so values cached in a previous evaluation don't match the fields referencing these
+ * attributes in the current one. Explicitly placed bake nodes (see #blender::bke::bake) are the
+ * supported way to cache the result of a branch, they handle these problems by storing geometry
+ * in a self-contained serializable form.
  */
 
 #include "NOD_geometry_exec.hh"
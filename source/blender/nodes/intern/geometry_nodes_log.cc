@@ -7,6 +7,8 @@
 
 #include "BKE_compute_contexts.hh"
 #include "BKE_curves.hh"
+
+#include "BLI_serialize.hh"
 #include "BKE_node_runtime.hh"
 #include "BKE_node_socket_value.hh"
 #include "BKE_volume.hh"
@@ -302,6 +304,50 @@ void GeoTreeLog::ensure_node_run_time()
   reduced_node_run_times_ = true;
 }
 
+void GeoTreeLog::run_times_to_json(const bNodeTree &tree, io::serialize::DictionaryValue &r_dict)
+{
+  using namespace io::serialize;
+  this->ensure_node_run_time();
+  tree.ensure_topology_cache();
+
+  r_dict.append_str("tree", tree.id.name + 2);
+  r_dict.append_double("run_time_ms", double(this->run_time_sum.count()) / 1.0e6);
+
+  /* Map group nodes to the context of the tree they instantiate, so that the dump can recurse
+   * into them. Zone contexts also show up as children here, but their nodes are part of this
+   * tree and their run times have been added to the zone output node already. */
+  Map<int32_t, ComputeContextHash> group_node_children;
+  for (const ComputeContextHash &child_hash : children_hashes_) {
+    GeoTreeLog &child_log = modifier_log_->get_tree_log(child_hash);
+    if (child_log.tree_loggers_.is_empty()) {
+      continue;
+    }
+    if (const std::optional<int32_t> &node_id = child_log.tree_loggers_[0]->parent_node_id) {
+      group_node_children.add(*node_id, child_hash);
+    }
+  }
+
+  const std::shared_ptr<ArrayValue> nodes_array = r_dict.append_array("nodes");
+  for (const bNode *node : tree.all_nodes()) {
+    const GeoNodeLog *node_log = this->nodes.lookup_ptr(node->identifier);
+    if (!node_log) {
+      continue;
+    }
+    const std::shared_ptr<DictionaryValue> node_dict = nodes_array->append_dict();
+    node_dict->append_str("name", node->name);
+    node_dict->append_str("type", node->idname);
+    node_dict->append_double("run_time_ms", double(node_log->run_time.count()) / 1.0e6);
+    if (node->is_group() && node->id != nullptr) {
+      if (const ComputeContextHash *child_hash = group_node_children.lookup_ptr(node->identifier))
+      {
+        GeoTreeLog &child_log = modifier_log_->get_tree_log(*child_hash);
+        child_log.run_times_to_json(*reinterpret_cast<const bNodeTree *>(node->id),
+                                    *node_dict->append_dict("group"));
+      }
+    }
+  }
+}
+
 void GeoTreeLog::ensure_socket_values()
 {
   if (reduced_socket_values_) {
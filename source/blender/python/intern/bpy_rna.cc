@@ -5374,12 +5374,11 @@ static bool foreach_attr_type(BPy_PropertyRNA *self,
 
 /* pyrna_prop_collection_foreach_get/set both use this. */
 static int foreach_parse_args(BPy_PropertyRNA *self,
-                              PyObject *args,
+                              const char *attr,
+                              PyObject *seq,
                               const char *function_name,
 
                               /* Values to assign. */
-                              const char **r_attr,
-                              PyObject **r_seq,
                               int *r_tot,
                               size_t *r_size,
                               RawPropertyType *r_raw_type,
@@ -5390,20 +5389,16 @@ static int foreach_parse_args(BPy_PropertyRNA *self,
   *r_attr_signed = false;
   *r_raw_type = PROP_RAW_UNSET;
 
-  if (!PyArg_ParseTuple(args, "sO:foreach_get/set", r_attr, r_seq)) {
-    return -1;
-  }
-
-  if (!PySequence_Check(*r_seq) && PyObject_CheckBuffer(*r_seq)) {
+  if (!PySequence_Check(seq) && PyObject_CheckBuffer(seq)) {
     PyErr_Format(PyExc_TypeError,
                  "%s(..) expected second argument to be a sequence or buffer, not a %.200s",
                  function_name,
-                 Py_TYPE(*r_seq)->tp_name);
+                 Py_TYPE(seq)->tp_name);
     return -1;
   }
 
   /* TODO: buffer may not be a sequence! array.array() is though. */
-  *r_tot = PySequence_Size(*r_seq);
+  *r_tot = PySequence_Size(seq);
 
   if (*r_tot > 0) {
 #if 0
@@ -5426,13 +5421,13 @@ static int foreach_parse_args(BPy_PropertyRNA *self,
 #endif
 
     bool is_empty = false; /* `array_tot == 0`. */
-    if (!foreach_attr_type(self, *r_attr, r_raw_type, r_attr_tot, r_attr_signed, &is_empty)) {
+    if (!foreach_attr_type(self, attr, r_raw_type, r_attr_tot, r_attr_signed, &is_empty)) {
       PyErr_Format(PyExc_AttributeError,
                    "%s(..) '%.200s.%200s[...]' elements have no attribute '%.200s'",
                    function_name,
                    RNA_struct_identifier(self->ptr.type),
                    RNA_property_identifier(self->prop),
-                   *r_attr);
+                   attr);
       return -1;
     }
 
@@ -5533,26 +5528,25 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return false;
 }
 
-static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
+static PyObject *foreach_getset_attr(BPy_PropertyRNA *self,
+                                     const char *attr,
+                                     PyObject *seq,
+                                     const int set)
 {
   PyObject *item = nullptr;
   int i = 0, ok = 0;
   bool buffer_is_compat;
   void *array = nullptr;
 
-  /* Get/set both take the same args currently. */
-  const char *attr;
-  PyObject *seq;
   int tot, attr_tot;
   size_t size;
   bool attr_signed;
   RawPropertyType raw_type;
 
   if (foreach_parse_args(self,
-                         args,
+                         attr,
+                         seq,
                          set ? "foreach_set" : "foreach_get",
-                         &attr,
-                         &seq,
                          &tot,
                          &size,
                          &raw_type,
@@ -5745,12 +5739,90 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
   Py_RETURN_NONE;
 }
 
+static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
+{
+  const char *function_name = set ? "foreach_set" : "foreach_get";
+  PyObject *attr_py;
+  PyObject *seq_py;
+
+  if (!PyArg_ParseTuple(args, "OO:foreach_get/set", &attr_py, &seq_py)) {
+    return nullptr;
+  }
+
+  /* Common case: a single attribute name with a single sequence or buffer. */
+  if (PyUnicode_Check(attr_py)) {
+    const char *attr = PyUnicode_AsUTF8(attr_py);
+    if (attr == nullptr) {
+      return nullptr;
+    }
+    return foreach_getset_attr(self, attr, seq_py, set);
+  }
+
+  /* Batched access: parallel sequences of attribute names and sequences/buffers, accessed in a
+   * single call so exporters don't pay the per-call overhead for every attribute. */
+  PyObject *attr_fast = PySequence_Fast(
+      attr_py, "foreach_get/set expected first argument to be a string or sequence of strings");
+  if (attr_fast == nullptr) {
+    return nullptr;
+  }
+  PyObject *seq_fast = PySequence_Fast(
+      seq_py, "foreach_get/set expected second argument to be a sequence");
+  if (seq_fast == nullptr) {
+    Py_DECREF(attr_fast);
+    return nullptr;
+  }
+
+  PyObject *ret = nullptr;
+  const Py_ssize_t attr_len = PySequence_Fast_GET_SIZE(attr_fast);
+  if (attr_len != PySequence_Fast_GET_SIZE(seq_fast)) {
+    PyErr_Format(PyExc_TypeError,
+                 "%s(..) attribute and sequence arguments length mismatch (%d, %d)",
+                 function_name,
+                 int(attr_len),
+                 int(PySequence_Fast_GET_SIZE(seq_fast)));
+  }
+  else {
+    Py_ssize_t i;
+    for (i = 0; i < attr_len; i++) {
+      PyObject *attr_item = PySequence_Fast_GET_ITEM(attr_fast, i);
+      if (!PyUnicode_Check(attr_item)) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s(..) expected attribute names to be strings, not %.200s",
+                     function_name,
+                     Py_TYPE(attr_item)->tp_name);
+        break;
+      }
+      const char *attr = PyUnicode_AsUTF8(attr_item);
+      if (attr == nullptr) {
+        break;
+      }
+      PyObject *item_ret = foreach_getset_attr(
+          self, attr, PySequence_Fast_GET_ITEM(seq_fast, i), set);
+      if (item_ret == nullptr) {
+        break;
+      }
+      Py_DECREF(item_ret);
+    }
+    if (i == attr_len) {
+      ret = Py_None;
+      Py_INCREF(ret);
+    }
+  }
+
+  Py_DECREF(attr_fast);
+  Py_DECREF(seq_fast);
+  return ret;
+}
+
 PyDoc_STRVAR(
     /* Wrap. */
     pyrna_prop_collection_foreach_get_doc,
     ".. method:: foreach_get(attr, seq)\n"
     "\n"
-    "   This is a function to give fast access to attributes within a collection.\n");
+    "   This is a function to give fast access to attributes within a collection.\n"
+    "\n"
+    "   Multiple attributes can be fetched in a single call by passing parallel sequences of\n"
+    "   attribute names and buffers: ``foreach_get((\"attr_a\", \"attr_b\"), (seq_a, seq_b))``.\n");
 static PyObject *pyrna_prop_collection_foreach_get(BPy_PropertyRNA *self, PyObject *args)
 {
   PYRNA_PROP_CHECK_OBJ(self);
@@ -5763,7 +5835,10 @@ PyDoc_STRVAR(
     pyrna_prop_collection_foreach_set_doc,
     ".. method:: foreach_set(attr, seq)\n"
     "\n"
-    "   This is a function to give fast access to attributes within a collection.\n");
+    "   This is a function to give fast access to attributes within a collection.\n"
+    "\n"
+    "   Multiple attributes can be set in a single call by passing parallel sequences of\n"
+    "   attribute names and buffers: ``foreach_set((\"attr_a\", \"attr_b\"), (seq_a, seq_b))``.\n");
 static PyObject *pyrna_prop_collection_foreach_set(BPy_PropertyRNA *self, PyObject *args)
 {
   PYRNA_PROP_CHECK_OBJ(self);
@@ -49,11 +49,23 @@ namespace blender::render {
  */
 class TexturePool : public realtime_compositor::TexturePool {
  private:
-  /** Textures that are not yet used and are available to be acquired. After evaluation, any
-   * texture in this map should be freed because it was not acquired in the evaluation and is thus
-   * unused. Textures removed from this map should be moved to the textures_in_use_ map when
-   * acquired. */
-  Map<realtime_compositor::TexturePoolKey, Vector<GPUTexture *>> available_textures_;
+  /** A pooled texture that was not acquired in the latest evaluation, together with the number
+   * of evaluations that have passed since it was last used. */
+  struct PooledTexture {
+    GPUTexture *texture;
+    int unused_evaluations;
+  };
+
+  /** Number of evaluations a texture can go unused before it is freed. Interactive tweaks and
+   * animated trees often alternate between paths needing different intermediate sizes, so
+   * textures are kept around for a few evaluations instead of being freed as soon as a single
+   * evaluation skips them. Matches the draw manager texture pool orphan cycles. */
+  static constexpr int max_unused_evaluations_ = 8;
+
+  /** Textures that are not yet used and are available to be acquired. Textures that stay in
+   * this map for more than max_unused_evaluations_ evaluations are freed. Textures removed from
+   * this map should be moved to the textures_in_use_ map when acquired. */
+  Map<realtime_compositor::TexturePoolKey, Vector<PooledTexture>> available_textures_;
   /** Textures that were acquired in this compositor evaluation. After evaluation, those textures
    * are moved to the available_textures_ map to be acquired in the next evaluation. */
   Map<realtime_compositor::TexturePoolKey, Vector<GPUTexture *>> textures_in_use_;
@@ -61,9 +73,9 @@ class TexturePool : public realtime_compositor::TexturePool {
  public:
   virtual ~TexturePool()
   {
-    for (Vector<GPUTexture *> &available_textures : available_textures_.values()) {
-      for (GPUTexture *texture : available_textures) {
-        GPU_texture_free(texture);
+    for (Vector<PooledTexture> &available_textures : available_textures_.values()) {
+      for (PooledTexture &pooled_texture : available_textures) {
+        GPU_texture_free(pooled_texture.texture);
       }
     }
 
@@ -77,7 +89,7 @@ class TexturePool : public realtime_compositor::TexturePool {
   GPUTexture *allocate_texture(int2 size, eGPUTextureFormat format) override
   {
     const realtime_compositor::TexturePoolKey key(size, format);
-    Vector<GPUTexture *> &available_textures = available_textures_.lookup_or_add_default(key);
+    Vector<PooledTexture> &available_textures = available_textures_.lookup_or_add_default(key);
     GPUTexture *texture = nullptr;
     if (available_textures.is_empty()) {
       texture = GPU_texture_create_2d("compositor_texture_pool",
@@ -89,28 +101,42 @@ class TexturePool : public realtime_compositor::TexturePool {
                                       nullptr);
     }
     else {
-      texture = available_textures.pop_last();
+      texture = available_textures.pop_last().texture;
     }
 
     textures_in_use_.lookup_or_add_default(key).append(texture);
     return texture;
   }
 
-  /** Should be called after compositor evaluation to free unused textures and reset the texture
+  /** Should be called after compositor evaluation to free stale textures and reset the texture
    * pool. */
   void free_unused_and_reset()
   {
-    /* Free all textures in the available textures vectors. The fact that they still exist in those
-     * vectors after evaluation means they were not acquired during the evaluation, and are thus
-     * consequently no longer used. */
-    for (Vector<GPUTexture *> &available_textures : available_textures_.values()) {
-      for (GPUTexture *texture : available_textures) {
-        GPU_texture_free(texture);
+    /* Age all textures that still exist in the available textures vectors. The fact that they
+     * still exist there after evaluation means they were not acquired during the evaluation.
+     * Only free the ones that have gone unused for several evaluations, so that evaluations
+     * with alternating intermediate sizes keep reusing their textures. */
+    for (Vector<PooledTexture> &available_textures : available_textures_.values()) {
+      for (PooledTexture &pooled_texture : available_textures) {
+        pooled_texture.unused_evaluations++;
       }
+      available_textures.remove_if([](const PooledTexture &pooled_texture) {
+        if (pooled_texture.unused_evaluations >= max_unused_evaluations_) {
+          GPU_texture_free(pooled_texture.texture);
+          return true;
+        }
+        return false;
+      });
     }
 
     /* Move all textures in-use to be available textures for the next evaluation. */
-    available_textures_ = textures_in_use_;
+    for (auto item : textures_in_use_.items()) {
+      Vector<PooledTexture> &available_textures = available_textures_.lookup_or_add_default(
+          item.key);
+      for (GPUTexture *texture : item.value) {
+        available_textures.append({texture, 0});
+      }
+    }
     textures_in_use_.clear();
   }
 };
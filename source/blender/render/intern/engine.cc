@@ -16,6 +16,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_bits.h"
 #include "BLI_string.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_object_types.h"
@@ -871,6 +872,7 @@ static void engine_render_view_layer(Render *re,
     }
 
     if (engine->type->update) {
+      BLI_TRACE_SCOPE("render_engine_update");
       engine->type->update(engine, re->main, engine->depsgraph);
     }
     if (use_gpu_context) {
@@ -19,8 +19,10 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_appdir.hh"
 #include "BKE_global.hh"
@@ -804,6 +806,9 @@ static void do_merge_tile(
 
 void render_result_merge(RenderResult *rr, RenderResult *rrpart)
 {
+  /* Collect the matching passes first, so their tile copies can run in parallel below. */
+  blender::Vector<std::pair<RenderPass *, RenderPass *>> pass_pairs;
+
   LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
     RenderLayer *rlp = RE_GetRenderLayer(rrpart, rl->name);
 
@@ -828,17 +833,27 @@ void render_result_merge(RenderResult *rr, RenderResult *rrpart)
           continue;
         }
 
-        do_merge_tile(rr,
-                      rrpart,
-                      rpass->ibuf->float_buffer.data,
-                      rpassp->ibuf->float_buffer.data,
-                      rpass->channels);
+        pass_pairs.append({rpass, rpassp});
 
         /* manually get next render pass */
         rpassp = rpassp->next;
       }
     }
   }
+
+  /* Every pass writes to its own buffer, so the merges are independent. */
+  blender::threading::parallel_for(
+      pass_pairs.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          RenderPass *rpass = pass_pairs[i].first;
+          RenderPass *rpassp = pass_pairs[i].second;
+          do_merge_tile(rr,
+                        rrpart,
+                        rpass->ibuf->float_buffer.data,
+                        rpassp->ibuf->float_buffer.data,
+                        rpass->channels);
+        }
+      });
 }
 
 /** \} */
@@ -24,6 +24,7 @@
 #include "BLI_endian_switch.h"
 #include "BLI_fileops.h"
 #include "BLI_fileops_types.h"
+#include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_threads.h"
@@ -51,6 +52,14 @@
  * size specified in user preferences.
  * To distinguish 2 blend files with same name, scene->ed->disk_cache_timestamp
  * is used as UID. Blend file can still be copied manually which may cause conflict.
+ *
+ * Locking is sharded by strip: each cache file belongs to exactly one strip, so file content
+ * access only takes the strip's shard mutex and prefetch threads working on different strips can
+ * service cache hits concurrently. The file list and total size bookkeeping are guarded by a
+ * separate index mutex which is only held for short, I/O-free sections. Operations which may
+ * delete files of arbitrary strips (enforcing the size limit) take all shard mutexes.
+ * Least-recently-used eviction order is carried by file modification times, so a cache hit does
+ * not need to update any shared list beyond refreshing the file's stat data.
  */
 
 /* Format string:
@@ -58,6 +67,7 @@
 #define DCACHE_FNAME_FORMAT "%d-%dx%d-%d%%(%d)-%d.dcf"
 #define DCACHE_IMAGES_PER_FILE 100
 #define DCACHE_CURRENT_VERSION 2
+#define DCACHE_NUM_SHARDS 64
 #define COLORSPACE_NAME_MAX 64 /* XXX: defined in IMB intern. */
 
 struct DiskCacheHeaderEntry {
@@ -77,7 +87,10 @@ struct SeqDiskCache {
   Main *bmain;
   int64_t timestamp;
   ListBase files;
-  ThreadMutex read_write_mutex;
+  /* Guards `files` and `size_total`. Only held for short, I/O-free sections. */
+  ThreadMutex index_mutex;
+  /* Guard file contents of one shard of strips, see design notes above. */
+  ThreadMutex shard_mutex[DCACHE_NUM_SHARDS];
   size_t size_total;
 };
 
@@ -102,6 +115,11 @@ static const char *seq_disk_cache_base_dir()
   return U.sequencer_disk_cache_dir;
 }
 
+static ThreadMutex *seq_disk_cache_shard_mutex_get(SeqDiskCache *disk_cache, const Sequence *seq)
+{
+  return &disk_cache->shard_mutex[BLI_ghashutil_ptrhash(seq) % DCACHE_NUM_SHARDS];
+}
+
 static int seq_disk_cache_compression_level()
 {
   switch (U.sequencer_disk_cache_compression) {
@@ -218,7 +236,12 @@ static void seq_disk_cache_delete_file(SeqDiskCache *disk_cache, DiskCacheFile *
 
 bool seq_disk_cache_enforce_limits(SeqDiskCache *disk_cache)
 {
-  BLI_mutex_lock(&disk_cache->read_write_mutex);
+  /* May delete files of any strip, so block readers and writers of all shards. Shard mutexes are
+   * always locked before the index mutex. */
+  for (int i = 0; i < DCACHE_NUM_SHARDS; i++) {
+    BLI_mutex_lock(&disk_cache->shard_mutex[i]);
+  }
+  BLI_mutex_lock(&disk_cache->index_mutex);
   while (disk_cache->size_total > seq_disk_cache_size_limit()) {
     DiskCacheFile *oldest_file = seq_disk_cache_get_oldest_file(disk_cache);
 
@@ -237,7 +260,10 @@ bool seq_disk_cache_enforce_limits(SeqDiskCache *disk_cache)
 
     seq_disk_cache_delete_file(disk_cache, oldest_file);
   }
-  BLI_mutex_unlock(&disk_cache->read_write_mutex);
+  BLI_mutex_unlock(&disk_cache->index_mutex);
+  for (int i = DCACHE_NUM_SHARDS - 1; i >= 0; i--) {
+    BLI_mutex_unlock(&disk_cache->shard_mutex[i]);
+  }
 
   return true;
 }
@@ -406,14 +432,18 @@ void seq_disk_cache_invalidate(SeqDiskCache *disk_cache,
   int start;
   int end;
 
-  BLI_mutex_lock(&disk_cache->read_write_mutex);
+  /* Only files of `seq` are deleted, readers and writers of other shards may continue. */
+  ThreadMutex *shard_mutex = seq_disk_cache_shard_mutex_get(disk_cache, seq);
+  BLI_mutex_lock(shard_mutex);
+  BLI_mutex_lock(&disk_cache->index_mutex);
 
   start = SEQ_time_left_handle_frame_get(scene, seq_changed) - DCACHE_IMAGES_PER_FILE;
   end = SEQ_time_right_handle_frame_get(scene, seq_changed);
 
   seq_disk_cache_delete_invalid_files(disk_cache, scene, seq, invalidate_types, start, end);
 
-  BLI_mutex_unlock(&disk_cache->read_write_mutex);
+  BLI_mutex_unlock(&disk_cache->index_mutex);
+  BLI_mutex_unlock(shard_mutex);
 }
 
 static size_t deflate_imbuf_to_file(ImBuf *ibuf,
@@ -544,7 +574,10 @@ static int seq_disk_cache_get_header_entry(SeqCacheKey *key, const DiskCacheHead
 
 bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
 {
-  BLI_mutex_lock(&disk_cache->read_write_mutex);
+  /* Writers to the same file are always in the same shard, so the file contents are guarded by
+   * the shard mutex alone. The index mutex is only taken around the list bookkeeping. */
+  ThreadMutex *shard_mutex = seq_disk_cache_shard_mutex_get(disk_cache, key->seq);
+  BLI_mutex_lock(shard_mutex);
 
   char filepath[FILE_MAX];
 
@@ -556,21 +589,30 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
   if (!file) {
     file = BLI_fopen(filepath, "wb+");
     if (!file) {
-      BLI_mutex_unlock(&disk_cache->read_write_mutex);
+      BLI_mutex_unlock(shard_mutex);
       return false;
     }
+    BLI_mutex_lock(&disk_cache->index_mutex);
     seq_disk_cache_add_file_to_list(disk_cache, filepath);
+    BLI_mutex_unlock(&disk_cache->index_mutex);
   }
 
+  BLI_mutex_lock(&disk_cache->index_mutex);
   DiskCacheFile *cache_file = seq_disk_cache_get_file_entry_by_path(disk_cache, filepath);
+  /* The entry can not be deleted concurrently while this shard mutex is held. */
+  const bool file_is_empty = (cache_file->fstat.st_size == 0);
+  BLI_mutex_unlock(&disk_cache->index_mutex);
+
   DiskCacheHeader header;
   memset(&header, 0, sizeof(header));
   /* The file may be empty when touched (above).
    * This is fine, don't attempt reading the header in that case. */
-  if (cache_file->fstat.st_size != 0 && !seq_disk_cache_read_header(file, &header)) {
+  if (!file_is_empty && !seq_disk_cache_read_header(file, &header)) {
     fclose(file);
+    BLI_mutex_lock(&disk_cache->index_mutex);
     seq_disk_cache_delete_file(disk_cache, cache_file);
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(&disk_cache->index_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return false;
   }
   int entry_index = seq_disk_cache_add_header_entry(key, ibuf, &header);
@@ -584,20 +626,24 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
      */
     header.entry[entry_index].size_compressed = bytes_written;
     seq_disk_cache_write_header(file, &header);
+    BLI_mutex_lock(&disk_cache->index_mutex);
     seq_disk_cache_update_file(disk_cache, filepath);
+    BLI_mutex_unlock(&disk_cache->index_mutex);
     fclose(file);
 
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return true;
   }
 
-  BLI_mutex_unlock(&disk_cache->read_write_mutex);
+  BLI_mutex_unlock(shard_mutex);
   return false;
 }
 
 ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 {
-  BLI_mutex_lock(&disk_cache->read_write_mutex);
+  /* Cache hits of strips in different shards are serviced concurrently. */
+  ThreadMutex *shard_mutex = seq_disk_cache_shard_mutex_get(disk_cache, key->seq);
+  BLI_mutex_lock(shard_mutex);
 
   char filepath[FILE_MAX];
   DiskCacheHeader header;
@@ -607,13 +653,13 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 
   FILE *file = BLI_fopen(filepath, "rb");
   if (!file) {
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return nullptr;
   }
 
   if (!seq_disk_cache_read_header(file, &header)) {
     fclose(file);
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return nullptr;
   }
   int entry_index = seq_disk_cache_get_header_entry(key, &header);
@@ -621,7 +667,7 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
   /* Item not found. */
   if (entry_index < 0) {
     fclose(file);
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return nullptr;
   }
 
@@ -644,7 +690,7 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
   }
   else {
     fclose(file);
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return nullptr;
   }
 
@@ -654,14 +700,17 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
   if (bytes_read != expected_size) {
     fclose(file);
     IMB_freeImBuf(ibuf);
-    BLI_mutex_unlock(&disk_cache->read_write_mutex);
+    BLI_mutex_unlock(shard_mutex);
     return nullptr;
   }
+  /* Touching the file keeps the least-recently-used eviction order without a shared list. */
   BLI_file_touch(filepath);
+  BLI_mutex_lock(&disk_cache->index_mutex);
   seq_disk_cache_update_file(disk_cache, filepath);
+  BLI_mutex_unlock(&disk_cache->index_mutex);
   fclose(file);
 
-  BLI_mutex_unlock(&disk_cache->read_write_mutex);
+  BLI_mutex_unlock(shard_mutex);
   return ibuf;
 }
 
@@ -670,7 +719,10 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
   SeqDiskCache *disk_cache = static_cast<SeqDiskCache *>(
       MEM_callocN(sizeof(SeqDiskCache), "SeqDiskCache"));
   disk_cache->bmain = bmain;
-  BLI_mutex_init(&disk_cache->read_write_mutex);
+  BLI_mutex_init(&disk_cache->index_mutex);
+  for (int i = 0; i < DCACHE_NUM_SHARDS; i++) {
+    BLI_mutex_init(&disk_cache->shard_mutex[i]);
+  }
   seq_disk_cache_handle_versioning(disk_cache);
   seq_disk_cache_get_files(disk_cache, seq_disk_cache_base_dir());
   disk_cache->timestamp = scene->ed->disk_cache_timestamp;
@@ -681,6 +733,9 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 void seq_disk_cache_free(SeqDiskCache *disk_cache)
 {
   BLI_freelistN(&disk_cache->files);
-  BLI_mutex_end(&disk_cache->read_write_mutex);
+  BLI_mutex_end(&disk_cache->index_mutex);
+  for (int i = 0; i < DCACHE_NUM_SHARDS; i++) {
+    BLI_mutex_end(&disk_cache->shard_mutex[i]);
+  }
   MEM_freeN(disk_cache);
 }
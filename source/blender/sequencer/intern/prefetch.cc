@@ -66,9 +66,16 @@ struct PrefetchJob {
   ListBase *seqbasep;
   ListBase *seqbasep_cpy;
 
-  /* prefetch area */
+  /* Prefetch area. Two fronts are maintained, one ahead of the playhead and one behind it, so
+   * scrubbing backwards hits the cache as well. The budget is split between them based on the
+   * last observed playhead direction. */
   float cfra;
   int num_frames_prefetched;
+  int num_frames_prefetched_back;
+  /* Direction of the last playhead movement: 1 when forward (or unknown), -1 when backward. */
+  int scrub_direction;
+  /* Front which the currently rendered frame extends, set at the start of each iteration. */
+  bool fetch_backwards;
 
   /* control */
   bool running;
@@ -175,6 +182,9 @@ static bool seq_prefetch_is_cache_full(Scene *scene)
 
 static float seq_prefetch_cfra(PrefetchJob *pfjob)
 {
+  if (pfjob->fetch_backwards) {
+    return pfjob->cfra - pfjob->num_frames_prefetched_back;
+  }
   return pfjob->cfra + pfjob->num_frames_prefetched;
 }
 static AnimationEvalContext seq_prefetch_anim_eval_context(PrefetchJob *pfjob)
@@ -186,8 +196,8 @@ void seq_prefetch_get_time_range(Scene *scene, int *r_start, int *r_end)
 {
   PrefetchJob *pfjob = seq_prefetch_job_get(scene);
 
-  *r_start = pfjob->cfra;
-  *r_end = seq_prefetch_cfra(pfjob);
+  *r_start = pfjob->cfra - pfjob->num_frames_prefetched_back;
+  *r_end = pfjob->cfra + pfjob->num_frames_prefetched;
 }
 
 static void seq_prefetch_free_depsgraph(PrefetchJob *pfjob)
@@ -227,21 +237,34 @@ static void seq_prefetch_update_area(PrefetchJob *pfjob)
 {
   int cfra = pfjob->scene->r.cfra;
 
-  /* rebase */
+  /* Rebase forward: frames between the old and new playhead are prefetched, they become part of
+   * the backward front. */
   if (cfra > pfjob->cfra) {
     int delta = cfra - pfjob->cfra;
     pfjob->cfra = cfra;
     pfjob->num_frames_prefetched -= delta;
+    pfjob->num_frames_prefetched_back += delta;
+    pfjob->scrub_direction = 1;
 
     if (pfjob->num_frames_prefetched <= 1) {
       pfjob->num_frames_prefetched = 1;
     }
   }
 
-  /* reset */
+  /* Rebase backward, or reset when the playhead jumped past the backward front. */
   if (cfra < pfjob->cfra) {
+    int delta = pfjob->cfra - cfra;
     pfjob->cfra = cfra;
-    pfjob->num_frames_prefetched = 1;
+    pfjob->scrub_direction = -1;
+
+    if (delta < pfjob->num_frames_prefetched_back) {
+      pfjob->num_frames_prefetched_back -= delta;
+      pfjob->num_frames_prefetched += delta;
+    }
+    else {
+      pfjob->num_frames_prefetched = 1;
+      pfjob->num_frames_prefetched_back = 1;
+    }
   }
 }
 
@@ -448,10 +471,55 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *channels,
   return false;
 }
 
+static bool seq_prefetch_forward_done(PrefetchJob *pfjob)
+{
+  return pfjob->cfra + pfjob->num_frames_prefetched >= pfjob->scene->r.efra;
+}
+
+static bool seq_prefetch_backward_done(PrefetchJob *pfjob)
+{
+  return pfjob->cfra - pfjob->num_frames_prefetched_back <= pfjob->scene->r.sfra;
+}
+
+static bool seq_prefetch_area_done(PrefetchJob *pfjob)
+{
+  return seq_prefetch_forward_done(pfjob) && seq_prefetch_backward_done(pfjob);
+}
+
+/* Decide which front the next frame extends: keep roughly a 3:1 budget split in favor of the
+ * last observed scrub direction, as long as neither front has reached the scene range. */
+static bool seq_prefetch_next_frame_is_backwards(PrefetchJob *pfjob)
+{
+  const int favored_front_share = 3;
+
+  if (seq_prefetch_backward_done(pfjob)) {
+    return false;
+  }
+  if (seq_prefetch_forward_done(pfjob)) {
+    return true;
+  }
+
+  if (pfjob->scrub_direction < 0) {
+    return pfjob->num_frames_prefetched * favored_front_share >=
+           pfjob->num_frames_prefetched_back;
+  }
+  return pfjob->num_frames_prefetched_back * favored_front_share < pfjob->num_frames_prefetched;
+}
+
+static void seq_prefetch_front_advance(PrefetchJob *pfjob)
+{
+  if (pfjob->fetch_backwards) {
+    pfjob->num_frames_prefetched_back++;
+  }
+  else {
+    pfjob->num_frames_prefetched++;
+  }
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
-         (seq_prefetch_cfra(pfjob) >= pfjob->scene->r.efra);
+         seq_prefetch_area_done(pfjob);
 }
 
 static void seq_prefetch_do_suspend(PrefetchJob *pfjob)
@@ -472,7 +540,8 @@ static void *seq_prefetch_frames(void *job)
 {
   PrefetchJob *pfjob = (PrefetchJob *)job;
 
-  while (seq_prefetch_cfra(pfjob) <= pfjob->scene->r.efra) {
+  while (!seq_prefetch_area_done(pfjob)) {
+    pfjob->fetch_backwards = seq_prefetch_next_frame_is_backwards(pfjob);
     pfjob->scene_eval->ed->prefetch_job = nullptr;
 
     seq_prefetch_update_depsgraph(pfjob);
@@ -492,7 +561,7 @@ static void *seq_prefetch_frames(void *job)
     ListBase *seqbase = SEQ_active_seqbase_get(SEQ_editing_get(pfjob->scene_eval));
     ListBase *channels = SEQ_channels_displayed_get(SEQ_editing_get(pfjob->scene_eval));
     if (seq_prefetch_must_skip_frame(pfjob, channels, seqbase)) {
-      pfjob->num_frames_prefetched++;
+      seq_prefetch_front_advance(pfjob);
       /* Break instead of keep looping if the job should be terminated. */
       if (!(pfjob->scene->ed->cache_flag & SEQ_CACHE_PREFETCH_ENABLE) || pfjob->stop) {
         break;
@@ -508,7 +577,8 @@ static void *seq_prefetch_frames(void *job)
     seq_prefetch_do_suspend(pfjob);
 
     /* Avoid "collision" with main thread, but make sure to fetch at least few frames */
-    if (pfjob->num_frames_prefetched > 5 && (seq_prefetch_cfra(pfjob) - pfjob->scene->r.cfra) < 2)
+    if (!pfjob->fetch_backwards && pfjob->num_frames_prefetched > 5 &&
+        (seq_prefetch_cfra(pfjob) - pfjob->scene->r.cfra) < 2)
     {
       break;
     }
@@ -518,7 +588,7 @@ static void *seq_prefetch_frames(void *job)
     }
 
     seq_prefetch_update_area(pfjob);
-    pfjob->num_frames_prefetched++;
+    seq_prefetch_front_advance(pfjob);
   }
 
   seq_cache_free_temp_cache(pfjob->scene, pfjob->context.task_id, seq_prefetch_cfra(pfjob));
@@ -550,6 +620,9 @@ static PrefetchJob *seq_prefetch_start_ex(const SeqRenderData *context, float cf
 
   pfjob->cfra = cfra;
   pfjob->num_frames_prefetched = 1;
+  pfjob->num_frames_prefetched_back = 1;
+  pfjob->scrub_direction = 1;
+  pfjob->fetch_backwards = false;
 
   pfjob->waiting = false;
   pfjob->stop = false;
@@ -25,6 +25,8 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
+#include "BLI_task.hh"
+#include "BLI_trace.hh"
 
 #include "BKE_anim_data.hh"
 #include "BKE_animsys.h"
@@ -1970,6 +1972,75 @@ static ImBuf *seq_render_strip_stack_apply_effect(
   return out;
 }
 
+/* Strip types which are safe to render from worker threads: their render only touches the strip
+ * itself and the (mutex guarded) cache. Scene, meta, clip and mask strips evaluate shared data
+ * which is not thread safe, and effect strips recurse into inputs of arbitrary types. */
+static bool seq_render_strip_is_parallelizable(const Sequence *seq)
+{
+  return ELEM(seq->type, SEQ_TYPE_MOVIE, SEQ_TYPE_IMAGE, SEQ_TYPE_COLOR, SEQ_TYPE_TEXT);
+}
+
+/* Render input strips of the stack concurrently into the cache, so that the serial composite
+ * loop below gets cache hits for them. This only warms the cache: the composite order and
+ * results are unaffected, occluded strips may be rendered needlessly in rare cases. */
+static void seq_render_strip_stack_prerender_inputs(const SeqRenderData *context,
+                                                    blender::Span<Sequence *> strips,
+                                                    float timeline_frame)
+{
+  /* Find the bottom-most strip the composite loop will visit: it stops at a cached composite, a
+   * REPLACE blend mode, or a blend mode which only uses the strip's own image. */
+  int64_t base = 0;
+  for (int64_t i = strips.size() - 1; i >= 0; i--) {
+    Sequence *seq = strips[i];
+
+    ImBuf *composite = seq_cache_get(context, seq, timeline_frame, SEQ_CACHE_STORE_COMPOSITE);
+    if (composite != nullptr) {
+      IMB_freeImBuf(composite);
+      base = i;
+      break;
+    }
+    if (seq->blend_mode == SEQ_BLEND_REPLACE ||
+        ELEM(seq_get_early_out_for_blend_mode(seq),
+             StripEarlyOut::NoInput,
+             StripEarlyOut::UseInput2))
+    {
+      base = i;
+      break;
+    }
+  }
+
+  Vector<Sequence *> candidates;
+  for (int64_t i = base; i < strips.size(); i++) {
+    Sequence *seq = strips[i];
+
+    if (!seq_render_strip_is_parallelizable(seq)) {
+      continue;
+    }
+    if (i != base && seq_get_early_out_for_blend_mode(seq) != StripEarlyOut::DoEffect) {
+      continue;
+    }
+
+    /* Already rendered, the task would only take a reference and drop it again. */
+    ImBuf *ibuf = seq_cache_get(context, seq, timeline_frame, SEQ_CACHE_STORE_PREPROCESSED);
+    if (ibuf != nullptr) {
+      IMB_freeImBuf(ibuf);
+      continue;
+    }
+
+    candidates.append(seq);
+  }
+
+  if (candidates.size() < 2) {
+    return;
+  }
+
+  threading::parallel_for_each(candidates, [&](Sequence *seq) {
+    SeqRenderState state;
+    ImBuf *ibuf = seq_render_strip(context, &state, seq, timeline_frame);
+    IMB_freeImBuf(ibuf);
+  });
+}
+
 static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      SeqRenderState *state,
                                      ListBase *channels,
@@ -1983,6 +2054,11 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
     return nullptr;
   }
 
+  /* The prefetch job renders on its own thread already and competes with the main thread. */
+  if (!context->is_prefetch_render) {
+    seq_render_strip_stack_prerender_inputs(context, strips, timeline_frame);
+  }
+
   OpaqueQuadTracker opaques;
 
   int64_t i;
@@ -2089,6 +2165,8 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
 
 ImBuf *SEQ_render_give_ibuf(const SeqRenderData *context, float timeline_frame, int chanshown)
 {
+  BLI_TRACE_SCOPE("SEQ_render_give_ibuf");
+
   Scene *scene = context->scene;
   Editing *ed = SEQ_editing_get(scene);
   ListBase *seqbasep;
@@ -20,6 +20,7 @@
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_task.hh"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.hh"
@@ -32,9 +33,8 @@
 #    pragma GCC diagnostic ignored "-Wtype-limits"
 #  endif
 
-#  ifdef _OPENMP
-#    define CLOTH_OPENMP_LIMIT 512
-#  endif
+/* Below this vertex count the threading overhead outweighs the gain. */
+#  define CLOTH_PARALLEL_LIMIT 512
 
 // #define DEBUG_TIME
 
@@ -591,23 +591,21 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 
   zero_lfvector(to, vcount);
 
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
-      }
-    }
-  }
+  /* The two halves scatter into disjoint vectors, so they can run concurrently. */
+  blender::threading::parallel_invoke(
+      vcount > CLOTH_PARALLEL_LIMIT,
+      [&]() {
+        for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
+        }
+      },
+      [&]() {
+        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+          muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+        }
+      });
   add_lfvector_lfvector(to, to, temp, from[0].vcount);
 
   del_lfvector(temp);
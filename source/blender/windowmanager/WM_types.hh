@@ -338,6 +338,8 @@ struct wmNotifier {
 /* Category. */
 #define NOTE_CATEGORY 0xFF000000
 #define NOTE_CATEGORY_TAG_CLEARED NOTE_CATEGORY
+/** Bit for a single category, so listeners can declare the categories they handle as a mask. */
+#define NOTE_CATEGORY_MASK(category) (1 << ((category) >> 24))
 #define NC_WM (1 << 24)
 #define NC_WINDOW (2 << 24)
 #define NC_WORKSPACE (3 << 24)
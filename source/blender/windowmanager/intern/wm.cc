@@ -628,6 +628,8 @@ void WM_main(bContext *C)
   wm_event_do_refresh_wm_and_depsgraph(C);
 
   while (true) {
+    /* Let the latency watchdog know the main loop is alive. */
+    wm_stall_watchdog_heartbeat();
 
     /* Get events from ghost, handle window events, add to window queues. */
     wm_window_events_process(C);
@@ -1039,6 +1039,18 @@ static void wm_drag_draw_icon(bContext * /*C*/, wmWindow * /*win*/, wmDrag *drag
                                   1.0f,
                                   col);
   }
+  else if ((drag->type == WM_DRAG_ASSET) &&
+           UI_icon_preview_available(drag->icon, ICON_SIZE_PREVIEW))
+  {
+    /* Asset drags may start before the preview image is loaded. The small type icon below acts as
+     * an immediate placeholder, and is replaced by the full preview as soon as the background
+     * loading or rendering job has finished, without ever blocking the drag. */
+    const int size = UI_icon_preview_to_render_size(ICON_SIZE_PREVIEW);
+    x = xy[0] - (size / 2);
+    y = xy[1] - (size / 2);
+
+    UI_icon_draw_preview(x, y, drag->icon, 1.0f, 0.8f, size);
+  }
   else {
     int padding = 4 * UI_SCALE_FAC;
     x = xy[0] - 2 * padding;
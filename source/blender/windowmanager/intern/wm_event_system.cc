@@ -32,6 +32,7 @@
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
 #include "BLI_timer.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_context.hh"
@@ -470,6 +471,8 @@ static bool wm_notifier_is_clear(const wmNotifier *note)
 
 void wm_event_do_depsgraph(bContext *C, bool is_after_open_file)
 {
+  BLI_TRACE_SCOPE("wm_event_do_depsgraph");
+
   wmWindowManager *wm = CTX_wm_manager(C);
   /* The whole idea of locked interface is to prevent viewport and whatever thread from
    * modifying the same data. Because of this, we can not perform dependency graph update. */
@@ -5392,6 +5395,17 @@ static wmEvent *wm_event_add_mousemove(wmWindow *win, const wmEvent *event)
    * handle in between mouse move moves, others can happily ignore
    * them for better performance. */
   if (event_last && event_last->type == MOUSEMOVE) {
+    /* Without a modal handler nothing can act on the in-between samples before the queue is
+     * handled, so merge high-rate motion into the pending move instead of queuing every sample.
+     * Modal operators (paint & sculpt strokes) keep the full resolution trail.
+     * Keep every sample when debugging events so the raw stream can be inspected. */
+    if (BLI_listbase_is_empty(&win->modalhandlers) && (G.debug & G_DEBUG_EVENTS) == 0) {
+      const int prev_xy[2] = {UNPACK2(event_last->prev_xy)};
+      wm_event_free_last(win);
+      wmEvent *event_new = wm_event_add(win, event);
+      copy_v2_v2_int(event_new->prev_xy, prev_xy);
+      return event_new;
+    }
     event_last->type = INBETWEEN_MOUSEMOVE;
     event_last->flag = (eWM_EventFlag)0;
   }
@@ -2200,6 +2200,15 @@ void wm_autosave_timer(Main *bmain, wmWindowManager *wm, wmTimer * /*wt*/)
     }
   }
 
+  /* When there are no unsaved changes all data is on disk already, and writing the auto-save
+   * file would only duplicate the saved file. Skipping the write matters for heavy scenes,
+   * where a redundant auto-save causes a noticeable interface freeze. */
+  if (!wm_file_or_session_data_has_unsaved_changes(bmain, wm)) {
+    wm->autosave_scheduled = false;
+    wm_autosave_timer_begin(wm);
+    return;
+  }
+
   wm->autosave_scheduled = false;
   if (!wm_autosave_write_try(bmain, wm)) {
     wm->autosave_scheduled = true;
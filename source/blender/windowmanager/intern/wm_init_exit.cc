@@ -43,11 +43,13 @@
 #include "BKE_lib_remap.hh"
 #include "BKE_main.hh"
 #include "BKE_mball_tessellate.hh"
+#include "BKE_pointcache.h"
 #include "BKE_preview_image.hh"
 #include "BKE_scene.hh"
 #include "BKE_screen.hh"
 #include "BKE_sound.h"
 #include "BKE_vfont.hh"
+#include "BKE_volume.hh"
 
 #include "BKE_addon.h"
 #include "BKE_appdir.hh"
@@ -168,6 +170,16 @@ void WM_init_gpu()
   gpu_is_init = true;
 }
 
+static void wm_init_history_file_read_fn(TaskPool *__restrict /*pool*/, void * /*taskdata*/)
+{
+  wm_history_file_read();
+}
+
+static void wm_init_recent_searches_read_fn(TaskPool *__restrict /*pool*/, void * /*taskdata*/)
+{
+  blender::ui::string_search::read_recent_searches_file();
+}
+
 static void sound_jack_sync_callback(Main *bmain, int mode, double time)
 {
   /* Ugly: Blender doesn't like it when the animation is played back during rendering. */
@@ -312,6 +324,14 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_spacemacros_init();
 
+  /* Plain file reads into their own storage, overlap them with the Python interpreter startup.
+   * Nothing below touches the recent files or searches until the pool has been waited on. */
+  TaskPool *startup_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_HIGH);
+  BLI_task_pool_push(startup_pool, wm_init_history_file_read_fn, nullptr, false, nullptr);
+  if (!G.background) {
+    BLI_task_pool_push(startup_pool, wm_init_recent_searches_read_fn, nullptr, false, nullptr);
+  }
+
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
@@ -330,11 +350,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_render_clear_mtex_copybuf();
 
-  wm_history_file_read();
-
-  if (!G.background) {
-    blender::ui::string_search::read_recent_searches_file();
-  }
+  BLI_task_pool_work_and_wait(startup_pool);
+  BLI_task_pool_free(startup_pool);
 
   STRNCPY(G.filepath_last_library, BKE_main_blendfile_path_from_global());
 
@@ -354,6 +371,8 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_keyconfig_update(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
   wm_homefile_read_post(C, params_file_read_post);
+
+  wm_stall_watchdog_start();
 }
 
 static bool wm_init_splash_show_on_startup_check()
@@ -461,6 +480,9 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   using namespace blender;
   wmWindowManager *wm = C ? CTX_wm_manager(C) : nullptr;
 
+  /* Stop watching the main thread, exit takes arbitrarily long by design. */
+  wm_stall_watchdog_exit();
+
   /* While nothing technically prevents saving user data in background mode,
    * don't do this as not typically useful and more likely to cause problems
    * if automated scripts happen to write changes to the preferences for e.g.
@@ -607,6 +629,7 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
    * the modifiers were garbage collected. */
   if (gpu_is_init) {
     blender::draw::DRW_subdiv_free();
+    blender::draw::DRW_mesh_extract_pos_free();
   }
 
   ANIM_fcurves_copybuf_free();
@@ -678,6 +701,10 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
 
   DNA_sdna_current_free();
 
+  /* Needs the task scheduler, so must come before it is freed below. */
+  BKE_ptcache_exit();
+  BKE_volumes_exit();
+
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
@@ -46,9 +46,11 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string_utils.hh"
 #include "BLI_time.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_anim_data.hh"
+#include "BKE_appdir.hh"
 #include "BKE_brush.hh"
 #include "BKE_colortools.hh"
 #include "BKE_context.hh"
@@ -3726,6 +3728,58 @@ static void WM_OT_memory_statistics(wmOperatorType *ot)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Frame Trace Recording
+ *
+ * Use for profiling hitches, see `BLI_trace.hh`.
+ * \{ */
+
+static int trace_record_toggle_exec(bContext * /*C*/, wmOperator *op)
+{
+  if (blender::trace::is_enabled()) {
+    blender::trace::disable();
+    BKE_report(op->reports, RPT_INFO, "Frame trace recording disabled");
+  }
+  else {
+    blender::trace::enable();
+    BKE_report(op->reports, RPT_INFO, "Frame trace recording enabled");
+  }
+  return OPERATOR_FINISHED;
+}
+
+static void WM_OT_trace_record_toggle(wmOperatorType *ot)
+{
+  ot->name = "Toggle Frame Trace Recording";
+  ot->idname = "WM_OT_trace_record_toggle";
+  ot->description = "Start or stop recording a timeline trace of the main loop";
+
+  ot->exec = trace_record_toggle_exec;
+}
+
+static int trace_dump_exec(bContext * /*C*/, wmOperator *op)
+{
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_session(), "frame_trace.json");
+  if (!blender::trace::dump_to_file(filepath)) {
+    BKE_report(op->reports, RPT_ERROR, "No frame trace recorded");
+    return OPERATOR_CANCELLED;
+  }
+  BKE_reportf(op->reports, RPT_INFO, "Frame trace written to %s", filepath);
+  return OPERATOR_FINISHED;
+}
+
+static void WM_OT_trace_dump(wmOperatorType *ot)
+{
+  ot->name = "Save Frame Trace";
+  ot->idname = "WM_OT_trace_dump";
+  ot->description =
+      "Write the recorded frame trace as Chrome trace-event JSON to the temporary directory";
+
+  ot->exec = trace_dump_exec;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Data-Block Preview Generation Operator
  *
@@ -4092,6 +4146,8 @@ void wm_operatortypes_register()
   WM_operatortype_append(WM_OT_clear_recent_files);
   WM_operatortype_append(WM_OT_redraw_timer);
   WM_operatortype_append(WM_OT_memory_statistics);
+  WM_operatortype_append(WM_OT_trace_record_toggle);
+  WM_operatortype_append(WM_OT_trace_dump);
   WM_operatortype_append(WM_OT_debug_menu);
   WM_operatortype_append(WM_OT_operator_defaults);
   WM_operatortype_append(WM_OT_splash);
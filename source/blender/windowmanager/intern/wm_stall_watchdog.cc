@@ -0,0 +1,242 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup wm
+ *
+ * Main-thread latency watchdog.
+ *
+ * A monitor thread watches a heartbeat that the main loop updates once per iteration. When
+ * handling an event takes longer than a threshold, the main thread's stack is sampled (via a
+ * signal on POSIX platforms) and aggregated per unique stack for the session. A report with the
+ * collected culprit stacks is written on exit, so real-world UI freezes can be diagnosed from
+ * support tickets without a reproduction case.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <thread>
+
+#ifndef WIN32
+#  include <csignal>
+#  include <pthread.h>
+#  ifdef HAVE_EXECINFO_H
+#    include <cstdlib>
+#    include <execinfo.h>
+#  endif
+#endif
+
+#include "BLI_fileops.h"
+#include "BLI_path_util.h"
+#include "BLI_utildefines.h"
+
+#include "BKE_appdir.hh"
+#include "BKE_global.hh"
+
+#include "CLG_log.h"
+
+#include "WM_api.hh"
+#include "WM_types.hh"
+
+#include "wm.hh"
+
+static CLG_LogRef LOG = {"wm.watchdog"};
+
+/* An event taking longer than this is considered a stall. */
+static constexpr int64_t stall_threshold_ms = 100;
+static constexpr int64_t sample_interval_ms = 25;
+
+namespace {
+
+struct StallRecord {
+  int count = 0;
+  int64_t max_duration_ms = 0;
+  std::string backtrace;
+};
+
+}  // namespace
+
+static std::thread watchdog_thread;
+static std::atomic<bool> watchdog_running = false;
+static std::atomic<int64_t> heartbeat_ms = 0;
+/* Keyed by a hash of the backtrace text. Only the monitor thread touches this while it runs,
+ * the report is written after the thread has been joined. */
+static std::map<uint64_t, StallRecord> stall_records;
+
+static int64_t time_now_ms()
+{
+  using namespace std::chrono;
+  return int64_t(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+#ifndef WIN32
+
+static pthread_t watchdog_main_thread;
+static void *backtrace_addresses[100];
+static volatile int backtrace_address_count = 0;
+static volatile sig_atomic_t backtrace_ready = 0;
+
+static void watchdog_signal_handler(int /*signum*/)
+{
+  /* Runs on the (stalled) main thread, which may be interrupted in the middle of malloc, so only
+   * async-signal-safe calls are allowed here: anything that allocates can self-deadlock on the
+   * allocator lock. backtrace() only walks the stack (its lazy libgcc initialization is primed
+   * from wm_stall_watchdog_start()), symbolization happens on the monitor thread. */
+#ifdef HAVE_EXECINFO_H
+  backtrace_address_count = backtrace(backtrace_addresses, ARRAY_SIZE(backtrace_addresses));
+#endif
+  backtrace_ready = 1;
+}
+
+static std::string watchdog_sample_main_thread()
+{
+  backtrace_address_count = 0;
+  backtrace_ready = 0;
+  if (pthread_kill(watchdog_main_thread, SIGUSR2) != 0) {
+    return "";
+  }
+  /* The main thread is stalled but not suspended, so the handler finishes quickly.
+   * Give up after a short wait, the stall is still counted without a stack. */
+  for (int i = 0; i < 100 && !backtrace_ready; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  if (!backtrace_ready) {
+    return "";
+  }
+
+  std::string result;
+#ifdef HAVE_EXECINFO_H
+  /* Symbolize on this (monitor) thread, where allocating is fine. */
+  const int count = backtrace_address_count;
+  char **symbols = backtrace_symbols(backtrace_addresses, count);
+  if (symbols) {
+    for (int i = 0; i < count; i++) {
+      result += symbols[i];
+      result += '\n';
+    }
+    free(symbols);
+  }
+#endif
+  return result;
+}
+
+#else
+
+static std::string watchdog_sample_main_thread()
+{
+  /* No remote backtrace support here, stalls are still counted without stacks. */
+  return "";
+}
+
+#endif /* !WIN32 */
+
+static void watchdog_run()
+{
+  bool stall_sampled = false;
+  uint64_t stall_key = 0;
+
+  while (watchdog_running.load(std::memory_order_relaxed)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(sample_interval_ms));
+
+    const int64_t latency = time_now_ms() - heartbeat_ms.load(std::memory_order_relaxed);
+    if (latency <= stall_threshold_ms) {
+      stall_sampled = false;
+      continue;
+    }
+
+    if (!stall_sampled) {
+      /* Sample once per stall, further polls only extend the recorded duration. */
+      const std::string backtrace = watchdog_sample_main_thread();
+      stall_key = uint64_t(std::hash<std::string>{}(backtrace));
+      StallRecord &record = stall_records[stall_key];
+      record.count++;
+      if (record.backtrace.empty()) {
+        record.backtrace = backtrace;
+      }
+      stall_sampled = true;
+    }
+
+    StallRecord &record = stall_records[stall_key];
+    record.max_duration_ms = std::max(record.max_duration_ms, latency);
+  }
+}
+
+static void watchdog_write_report()
+{
+  if (stall_records.empty()) {
+    return;
+  }
+
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_base(), "blender_stall_report.txt");
+
+  FILE *file = BLI_fopen(filepath, "w");
+  if (file == nullptr) {
+    return;
+  }
+
+  fprintf(file,
+          "Main-thread stalls over %lld ms recorded this session: %zu unique stack(s)\n\n",
+          (long long)stall_threshold_ms,
+          stall_records.size());
+  for (const auto &item : stall_records) {
+    const StallRecord &record = item.second;
+    fprintf(file,
+            "%d stall(s), longest %lld ms:\n%s\n",
+            record.count,
+            (long long)record.max_duration_ms,
+            record.backtrace.empty() ? "<no stack captured>\n" : record.backtrace.c_str());
+  }
+  fclose(file);
+
+  CLOG_INFO(&LOG, 0, "Main-thread stall report written to %s", filepath);
+}
+
+void wm_stall_watchdog_start()
+{
+  /* UI freezes are what this is for, there is no event loop to watch in background mode. */
+  if (G.background) {
+    return;
+  }
+  BLI_assert(!watchdog_running);
+
+#ifndef WIN32
+  watchdog_main_thread = pthread_self();
+#  ifdef HAVE_EXECINFO_H
+  /* The first backtrace() call initializes libgcc, which is not async-signal-safe.
+   * Prime it here so the call in the signal handler only walks the stack. */
+  backtrace(backtrace_addresses, ARRAY_SIZE(backtrace_addresses));
+#  endif
+  struct sigaction action = {};
+  action.sa_handler = watchdog_signal_handler;
+  sigemptyset(&action.sa_mask);
+  /* Restart interrupted slow syscalls, callers of e.g. read() do not all handle EINTR. */
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGUSR2, &action, nullptr);
+#endif
+
+  heartbeat_ms.store(time_now_ms(), std::memory_order_relaxed);
+  watchdog_running.store(true, std::memory_order_relaxed);
+  watchdog_thread = std::thread(watchdog_run);
+}
+
+void wm_stall_watchdog_heartbeat()
+{
+  heartbeat_ms.store(time_now_ms(), std::memory_order_relaxed);
+}
+
+void wm_stall_watchdog_exit()
+{
+  if (!watchdog_running.load(std::memory_order_relaxed)) {
+    return;
+  }
+  watchdog_running.store(false, std::memory_order_relaxed);
+  watchdog_thread.join();
+  watchdog_write_report();
+  stall_records.clear();
+}
@@ -30,6 +30,18 @@ struct wmPaintCursor {
  */
 void wm_exit_schedule_delayed(const bContext *C);
 
+/* `wm_stall_watchdog.cc` */
+
+/**
+ * Start the main-thread latency watchdog (does nothing in background mode).
+ * Must be called from the main thread.
+ */
+void wm_stall_watchdog_start();
+/** Mark the main loop as alive, called once per #WM_main iteration. */
+void wm_stall_watchdog_heartbeat();
+/** Stop the watchdog and write the stall report if any stalls were recorded. */
+void wm_stall_watchdog_exit();
+
 /**
  * Context is allowed to be NULL, do not free wm itself `lib_id.cc`.
  */